@@ -0,0 +1,130 @@
+#include <algorithm>
+
+#include "Rainbow.hpp"
+
+using namespace rainbow;
+
+BpreDesigner::BpreDesigner() {
+	latest = 1;
+	request_seq = 0;
+	designed_seq = 0;
+	BpreDesignWorker::get().add(this);
+}
+
+BpreDesigner::~BpreDesigner() {
+	BpreDesignWorker::get().remove(this);
+}
+
+// Called from the audio thread only, so the seqlock has a single writer
+void BpreDesigner::request_design(const float *c_maxq96000) {
+
+	uint32_t seq = request_seq.load(std::memory_order_relaxed);
+	request_seq.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	for (int i = 0; i < NUM_BANKNOTES; i++) {
+		request[i] = c_maxq96000[i];
+	}
+
+	request_seq.store(seq + 2, std::memory_order_release);
+
+}
+
+// Newest tables if the worker finished some since the last call, else NULL. The previous tables go back to the worker
+BpreBank *BpreDesigner::take_tables(void) {
+
+	if (!(latest.load(std::memory_order_relaxed) & FRESH)) {
+		return NULL;
+	}
+
+	front = latest.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+	return &tables[front];
+
+}
+
+void BpreDesigner::wake(void) {
+	if (request_seq.load(std::memory_order_acquire) != designed_seq.load(std::memory_order_relaxed)) {
+		BpreDesignWorker::get().wake();
+	}
+}
+
+void BpreDesigner::design(void) {
+
+	float coefs[NUM_BANKNOTES];
+
+	uint32_t seq = request_seq.load(std::memory_order_acquire);
+	if (seq == designed_seq.load(std::memory_order_relaxed) || (seq & 1)) {
+		return; // Nothing new, or being written; the next wake retries
+	}
+
+	for (int i = 0; i < NUM_BANKNOTES; i++) {
+		coefs[i] = request[i];
+	}
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (seq != request_seq.load(std::memory_order_relaxed)) {
+		return; // Rewritten while copying, the next wake retries
+	}
+
+	design_bpre(coefs, &tables[back]);
+
+	back = latest.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+	designed_seq.store(seq, std::memory_order_relaxed);
+
+}
+
+// Function local static, so construction is thread safe and happens once
+BpreDesignWorker &BpreDesignWorker::get(void) {
+	static BpreDesignWorker worker;
+	return worker;
+}
+
+BpreDesignWorker::~BpreDesignWorker() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	cv.notify_one();
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+void BpreDesignWorker::add(BpreDesigner *designer) {
+	std::lock_guard<std::mutex> lock(mutex);
+	designers.push_back(designer);
+}
+
+// Waits for a design of this designer in progress to finish
+void BpreDesignWorker::remove(BpreDesigner *designer) {
+	std::lock_guard<std::mutex> lock(mutex);
+	designers.erase(std::remove(designers.begin(), designers.end(), designer), designers.end());
+}
+
+void BpreDesignWorker::wake(void) {
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!worker.joinable()) {
+		worker = std::thread(&BpreDesignWorker::run, this);
+	}
+	pending = true;
+	cv.notify_one();
+}
+
+void BpreDesignWorker::run(void) {
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true) {
+
+		cv.wait(lock, [this] { return pending || !running; });
+		if (!running) {
+			return;
+		}
+		pending = false;
+
+		for (BpreDesigner *designer : designers) {
+			designer->design();
+		}
+
+	}
+
+}
@@ -2,6 +2,10 @@
 
 #include <iostream>
 #include <bitset>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include "plugin.hpp"
 #include "componentlibrary.hpp"
@@ -40,6 +44,124 @@ struct PrismModule : rack::Module {
 	
 };
 
+// Lock-free queue for passing commands from one producer thread to one consumer thread. S must be a power of 2.
+template <typename T, size_t S>
+struct CommandQueue {
+
+	T data[S];
+	std::atomic<size_t> head{0}; // Advanced by the consumer
+	std::atomic<size_t> tail{0}; // Advanced by the producer
+
+	// Returns false if the queue is full
+	bool push(const T &t) {
+		size_t i = tail.load(std::memory_order_relaxed);
+		if (i - head.load(std::memory_order_acquire) >= S) {
+			return false;
+		}
+		data[i & (S - 1)] = t;
+		tail.store(i + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Returns false if the queue is empty
+	bool pop(T &t) {
+		size_t i = head.load(std::memory_order_relaxed);
+		if (i == tail.load(std::memory_order_acquire)) {
+			return false;
+		}
+		t = data[i & (S - 1)];
+		head.store(i + 1, std::memory_order_release);
+		return true;
+	}
+
+};
+
+// Float arrays are stored in patches as base64 of their little-endian bytes, in an object tagged with a version
+const int FLOAT_BLOB_VERSION = 1;
+
+inline json_t *floatsToJson(const float *data, int count) {
+
+	static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	std::vector<uint8_t> bytes(count * 4);
+	for (int i = 0; i < count; i++) {
+		uint32_t u;
+		memcpy(&u, &data[i], 4);
+		bytes[i * 4 + 0] = u;
+		bytes[i * 4 + 1] = u >> 8;
+		bytes[i * 4 + 2] = u >> 16;
+		bytes[i * 4 + 3] = u >> 24;
+	}
+
+	std::string text;
+	text.reserve((bytes.size() + 2) / 3 * 4);
+	for (size_t i = 0; i < bytes.size(); i += 3) {
+		uint32_t n = bytes[i] << 16;
+		if (i + 1 < bytes.size()) n |= bytes[i + 1] << 8;
+		if (i + 2 < bytes.size()) n |= bytes[i + 2];
+		text += alphabet[(n >> 18) & 63];
+		text += alphabet[(n >> 12) & 63];
+		text += (i + 1 < bytes.size()) ? alphabet[(n >> 6) & 63] : '=';
+		text += (i + 2 < bytes.size()) ? alphabet[n & 63] : '=';
+	}
+
+	json_t *blobJ = json_object();
+	json_object_set_new(blobJ, "version", json_integer(FLOAT_BLOB_VERSION));
+	json_object_set_new(blobJ, "count", json_integer(count));
+	json_object_set_new(blobJ, "data", json_string(text.c_str()));
+	return blobJ;
+
+}
+
+// Returns false, leaving data untouched, if the blob is missing, of an unknown version or the wrong size
+inline bool floatsFromJson(json_t *blobJ, float *data, int count) {
+
+	if (!blobJ) {
+		return false;
+	}
+
+	json_t *versionJ = json_object_get(blobJ, "version");
+	json_t *countJ = json_object_get(blobJ, "count");
+	json_t *dataJ = json_object_get(blobJ, "data");
+	if (!versionJ || json_integer_value(versionJ) != FLOAT_BLOB_VERSION ||
+		!countJ || json_integer_value(countJ) != count ||
+		!dataJ || !json_string_value(dataJ)) {
+		return false;
+	}
+
+	std::vector<uint8_t> bytes;
+	bytes.reserve(count * 4);
+
+	uint32_t n = 0;
+	int bits = 0;
+	for (const char *c = json_string_value(dataJ); *c && *c != '='; c++) {
+		int v;
+		if (*c >= 'A' && *c <= 'Z') v = *c - 'A';
+		else if (*c >= 'a' && *c <= 'z') v = *c - 'a' + 26;
+		else if (*c >= '0' && *c <= '9') v = *c - '0' + 52;
+		else if (*c == '+') v = 62;
+		else if (*c == '/') v = 63;
+		else return false;
+		n = (n << 6) | v;
+		bits += 6;
+		if (bits >= 8) {
+			bits -= 8;
+			bytes.push_back((n >> bits) & 0xFF);
+		}
+	}
+
+	if ((int)bytes.size() != count * 4) {
+		return false;
+	}
+
+	for (int i = 0; i < count; i++) {
+		uint32_t u = bytes[i * 4] | (bytes[i * 4 + 1] << 8) | (bytes[i * 4 + 2] << 16) | ((uint32_t)bytes[i * 4 + 3] << 24);
+		memcpy(&data[i], &u, 4);
+	}
+	return true;
+
+}
+
 } // namespace core
 
 namespace gui {
@@ -160,15 +282,30 @@ struct PrismPort : app::SvgPort {
 };
 
 
+struct PrismReadoutParam;
+
+// Draws the readout text inside the readout framebuffer, so it is only rendered when the readout changes
+struct PrismReadoutText : widget::TransparentWidget {
+
+	PrismReadoutParam *readout;
+
+	void draw(const DrawArgs &ctx) override;
+
+};
+
 struct PrismReadoutParam : app::ParamWidget {
 
 	widget::FramebufferWidget *fb;
 	widget::SvgWidget *sw;
+	PrismReadoutText *tw;
 	std::shared_ptr<Font> font;
 
 	bool isActive = true;
 	std::string title = "";
 
+	bool drawnActive = true;
+	std::string drawnTitle = "";
+
 	PrismReadoutParam() {
 		fb = new widget::FramebufferWidget;
 		addChild(fb);
@@ -176,12 +313,17 @@ struct PrismReadoutParam : app::ParamWidget {
 		sw = new widget::SvgWidget;
 		fb->addChild(sw);
 
+		tw = new PrismReadoutText;
+		tw->readout = this;
+		fb->addChild(tw);
+
 		font = APP->window->loadFont(asset::plugin(pluginInstance, "res/RobotoCondensed-Regular.ttf"));
 	}
 
 	void setSvg(std::shared_ptr<Svg> svg) {
 		sw->setSvg(svg);
 		fb->box.size = sw->box.size;
+		tw->box.size = sw->box.size;
 		box.size = sw->box.size;
 	}
 
@@ -192,6 +334,15 @@ struct PrismReadoutParam : app::ParamWidget {
 		ParamWidget::onChange(e);
 	}
 
+	void step() override {
+		if (isActive != drawnActive || title != drawnTitle) {
+			drawnActive = isActive;
+			drawnTitle = title;
+			fb->dirty = true;
+		}
+		ParamWidget::step();
+	}
+
 	void onHover(const event::Hover &e) override {
 		math::Vec c = box.size.div(2);
 		float dist = e.pos.minus(c).norm();
@@ -221,9 +372,7 @@ struct PrismReadoutParam : app::ParamWidget {
 		}
 	}
 
-	void draw(const DrawArgs &ctx) override {
-
-		ParamWidget::draw(ctx);
+	virtual void drawText(const DrawArgs &ctx) {
 
 		if (paramQuantity) {
 
@@ -234,10 +383,10 @@ struct PrismReadoutParam : app::ParamWidget {
 
 			char text[128];
 
-			snprintf(text, sizeof(text), "%s", title.c_str());
+			snprintf(text, sizeof(text), "%s", drawnTitle.c_str());
 			nvgText(ctx.vg, pos.x, pos.y, text, NULL);
 
-			if (!isActive) {
+			if (!drawnActive) {
 				nvgFillColor(ctx.vg, nvgRGBA(0x80, 0x80, 0x80, 0xFF));
 			}
 
@@ -254,9 +403,7 @@ struct FloatReadout : PrismReadoutParam {
 		setSvg(APP->window->loadSvg(asset::plugin(pluginInstance,"res/ComponentLibrary/PrismFloatReadout.svg")));
 	}
 
-	void draw(const DrawArgs &ctx) override {
-
-		ParamWidget::draw(ctx);
+	void drawText(const DrawArgs &ctx) override {
 
 		if (paramQuantity) {
 
@@ -268,10 +415,10 @@ struct FloatReadout : PrismReadoutParam {
 
 			nvgFontSize(ctx.vg, 14.0f);
 			nvgFillColor(ctx.vg, nvgRGBA(0xBE, 0xBE, 0xBE, 0xFF));
-			snprintf(text, sizeof(text), "%s", title.c_str());
+			snprintf(text, sizeof(text), "%s", drawnTitle.c_str());
 			nvgText(ctx.vg, pos.x, pos.y, text, NULL);
 
-			if (isActive) {
+			if (drawnActive) {
 				nvgFillColor(ctx.vg, nvgRGBA(0xff, 0xff, 0xff, 0xFF));
 			} else {
 				nvgFillColor(ctx.vg, nvgRGBA(0x00, 0x00, 0x00, 0xFF));
@@ -291,9 +438,7 @@ struct IntegerReadout : PrismReadoutParam {
 		setSvg(APP->window->loadSvg(asset::plugin(pluginInstance,"res/ComponentLibrary/PrismIntegerReadout.svg")));
 	}
 
-	void draw(const DrawArgs &ctx) override {
-
-		ParamWidget::draw(ctx);
+	void drawText(const DrawArgs &ctx) override {
 
 		if (paramQuantity) {
 
@@ -305,10 +450,10 @@ struct IntegerReadout : PrismReadoutParam {
 			char text[128];
 
 			nvgFillColor(ctx.vg, nvgRGBA(0xBE, 0xBE, 0xBE, 0xFF));
-			snprintf(text, sizeof(text), "%s", title.c_str());
+			snprintf(text, sizeof(text), "%s", drawnTitle.c_str());
 			nvgText(ctx.vg, pos.x, pos.y, text, NULL);
 
-			if (isActive) {
+			if (drawnActive) {
 				nvgFillColor(ctx.vg, nvgRGBA(0xff, 0xff, 0xff, 0xFF));
 			} else {
 				nvgFillColor(ctx.vg, nvgRGBA(0x00, 0x00, 0x00, 0xFF));
@@ -322,6 +467,10 @@ struct IntegerReadout : PrismReadoutParam {
 };
 
 
+inline void PrismReadoutText::draw(const DrawArgs &ctx) {
+	readout->drawText(ctx);
+}
+
 } // namespace gui
 
 } // namespace ah
@@ -45,13 +45,30 @@ Controller::Controller(void) {
 
 	rotation->configure(io, filter);
 	envelope->configure(io, levels);
-	ring->configure(io, rotation, envelope, filter, q);
+	ring->configure(envelope);
 	filter->configure(io, rotation, envelope, q, tuning, levels);
 	q->configure(io);
 	tuning->configure(io, filter);
 	levels->configure(io);
 	input->configure(io, rotation, envelope, filter, tuning, levels);
 
+	state_seq = 0;
+
+}
+
+Controller::~Controller(void) {
+
+	delete rotation;
+	delete envelope;
+	delete ring;
+	delete filter;
+	delete io;
+	delete q;
+	delete tuning;
+	delete levels;
+	delete input;
+	delete state;
+
 }
 
 void Controller::initialise(void) {
@@ -67,6 +84,8 @@ void Controller::initialise(void) {
 
 	envelope->initialise();
 
+	state_dirty = true;
+
 } 
 
 void Controller::prepare(void) {
@@ -75,8 +94,6 @@ void Controller::prepare(void) {
 
 	tuning->update();
 
-	ring->update_led_ring();
-	
 	rotation->update_motion();
 
 	envelope->update();
@@ -171,29 +188,101 @@ void Controller::load_from_state(void) {
 			filter->userscale_bank96[i] = state->userscale96[i];
 			filter->userscale_bank48[i] = state->userscale48[i];
 		}
+		filter->userscale96 = filter->userscale_bank96;
+		filter->userscale48 = filter->userscale_bank48;
+		filter->user_bpre_requested.store(true, std::memory_order_release);
 
 		rotation->motion_notejump	= 0;
 		rotation->motion_rotate		= 0;
 
 		state->initialised = true;
+		state_dirty = true;
 
 	}
 
 }
 
+// Called every sample, but only rewrites the State mirror when something in it has changed
 void Controller::populate_state(void) {
 
-	if(state != NULL && state->initialised) {
-		for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
-			state->note[i]			= filter->note[i];
-			state->scale[i]			= filter->scale[i];
-			state->scale_bank[i]	= filter->scale_bank[i];
+	if (state == NULL || !state->initialised) {
+		return;
+	}
+
+	bool changed = state_dirty || io->USERSCALE_CHANGED;
+
+	changed |= state->gliss != io->GLIDE_SWITCH;
+	changed |= state->prepost != io->PREPOST_SWITCH;
+	changed |= state->scalerot != io->SCALEROT_SWITCH;
+	changed |= state->freqblock != io->FREQ_BLOCK;
+
+	for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
+		changed |= state->note[i] != filter->note[i];
+		changed |= state->scale[i] != filter->scale[i];
+		changed |= state->scale_bank[i] != filter->scale_bank[i];
+		changed |= state->lock_on[i] != io->LOCK_ON[i];
+		changed |= state->q_on[i] != io->CHANNEL_Q_ON[i];
+	}
+
+	if (!changed) {
+		return;
+	}
+
+	uint32_t seq = state_seq.load(std::memory_order_relaxed);
+	state_seq.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
+		state->note[i]			= filter->note[i];
+		state->scale[i]			= filter->scale[i];
+		state->scale_bank[i]	= filter->scale_bank[i];
+		state->lock_on[i]		= io->LOCK_ON[i];
+		state->q_on[i]			= io->CHANNEL_Q_ON[i];
+	}
+
+	state->gliss		= io->GLIDE_SWITCH;
+	state->prepost		= io->PREPOST_SWITCH;
+	state->scalerot		= io->SCALEROT_SWITCH;
+	state->freqblock	= io->FREQ_BLOCK;
+
+	if (state_dirty || io->USERSCALE_CHANGED) {
+		for (int i = 0; i < NUM_BANKNOTES; i++) {
+			state->userscale96[i] = filter->userscale96[i]; 
+			state->userscale48[i] = filter->userscale48[i]; 
 		}
 	}
 
-	for (int i = 0; i < NUM_BANKNOTES; i++) {
-		state->userscale96[i] = filter->userscale_bank96[i]; 
-		state->userscale48[i] = filter->userscale_bank48[i]; 
+	state_seq.store(seq + 2, std::memory_order_release);
+	state_dirty = false;
+
+}
+
+// Consistent copy of the State mirror for saving, from any thread. Retries if the audio thread was writing it
+void Controller::snapshot_state(State *copy) {
+
+	uint32_t seq;
+
+	do {
+		seq = state_seq.load(std::memory_order_acquire);
+		*copy = *state;
+		std::atomic_thread_fence(std::memory_order_acquire);
+	} while ((seq & 1) || seq != state_seq.load(std::memory_order_relaxed));
+
+}
+
+void Controller::populate_ui_state(UIState *ui) {
+
+	for (uint8_t i = 0; i < NUM_CHANNELS; i++) {
+		ui->note[i]			= filter->note[i];
+		ui->fadeto_note[i]	= rotation->motion_fadeto_note[i];
+		ui->scale_dest[i]	= rotation->motion_scale_dest[i];
+		ui->morphpos[i]		= rotation->motion_morphpos[i];
+		ui->env_out[i]		= io->env_out[i];
+		ui->voct_out[i]		= io->voct_out[i];
+		ui->qval[i]			= q->qval_goal[i];
+		ui->lock_on[i]		= io->LOCK_ON[i];
 	}
 
+	ui->freqblock = io->FREQ_BLOCK;
+
 }
@@ -28,14 +28,12 @@
  */
 
 #include <iostream>
+#include <math.h>
 
 #include "Rainbow.hpp"
+#include "Tables.hpp"
 #include "scales/Scales.hpp"
 
-extern float exp_4096[4096];
-extern float log_4096[4096];
-extern uint32_t twopass_calibration[3380];
-
 using namespace rainbow;
 
 void Filter::configure(IO *_io, Rotation *_rotation, Envelope *_envelope, Q *_q, Tuning *_tuning, Levels *_levels) {
@@ -59,11 +57,26 @@ void Filter::process_bank_change(void) {
 
 void Filter::process_user_scale_change() {
 	if (io->USERSCALE_CHANGED) {
-		for (int i = 0; i < NUM_BANKNOTES; i++) {
-			userscale_bank96[i] = io->USERSCALE96[i];
-			userscale_bank48[i] = io->USERSCALE48[i];
- 		}
+		// The coefficient pointers into the old block are re-resolved with READCOEFFS before the next filter pass
+		userscale96 = io->USERSCALE->maxq96;
+		userscale48 = io->USERSCALE->maxq48;
+		user_bpre_designer.request_design(userscale96);
+	} else if (user_bpre_requested.exchange(false, std::memory_order_acquire)) {
+		user_bpre_designer.request_design(userscale96);
+	}
+}
+
+// Picks up BpRe tables newly designed for the user scale, returns true if they changed
+bool Filter::process_user_bpre() {
+
+	BpreBank *tables = user_bpre_designer.take_tables();
+	if (tables == NULL) {
+		return false;
 	}
+
+	user_bpre = tables;
+	return true;
+
 }
 
 void Filter::change_filter_type(FilterTypes newtype) {
@@ -77,9 +90,20 @@ void Filter::process_scale_bank(void) {
 	// Determine the coef tables we're using for the active filters (Lo-Q and Hi-Q) for each channel
 	// Also clear the buf[] history if we changed scales or banks, so we don't get artifacts
 	// To-Do: move this somewhere else, so it runs on a timer
+	bool user_bpre_changed = process_user_bpre();
+
 	for (int i = 0; i < NUM_CHANNELS; i++) {
 
-		if (scale_bank[i] >= NUM_SCALEBANKS) {
+		// Q coefficients depend on the sample rate, so recalculate if that may have changed
+		if (filter_type_changed || io->READCOEFFS) {
+			q_cached[i] = UINT32_MAX;
+		}
+
+		// Banks past the presets come from the scale library. A rewrite of its pack can move a
+		// bank to a new mapping, or drop it
+		const ScalePackBank *lib_bank = library.bank(scale_bank[i] - NUM_SCALEBANKS);
+
+		if (scale_bank[i] >= NUM_SCALEBANKS && !lib_bank) {
 			scale_bank[i] = NUM_SCALEBANKS - 1;
 		}
 
@@ -87,9 +111,16 @@ void Filter::process_scale_bank(void) {
 			scale[i] = NUM_SCALES - 1;
 		}
 
-		if (scale_bank[i] != old_scale_bank[i] || filter_type_changed || io->READCOEFFS ) {
+		bool user_bank = scale_bank[i] == NUM_SCALEBANKS - 1;
+
+		if (scale_bank[i] != old_scale_bank[i] || lib_bank != old_lib_bank[i] || filter_type_changed || io->READCOEFFS || 
+			(user_bank && user_bpre_changed && filter_type == BPRE)) {
 
 			old_scale_bank[i] = scale_bank[i];
+			old_lib_bank[i] = lib_bank;
+
+			coef_dirty[i] = true;
+			coef_dirty[i + NUM_CHANNELS] = true;
 
 			float *ff = (float *)buf[i];
 			for (int j = 0; j < (NUM_SCALES * NUM_FILTS); j++) {
@@ -110,9 +141,15 @@ void Filter::process_scale_bank(void) {
 			if (filter_type == MAXQ) {
 				if (scale_bank[i] == NUM_SCALEBANKS - 1) {
 					if (io->HICPUMODE) {
-						c_hiq[i] = (float *)(userscale_bank96); 
+						c_hiq[i] = (float *)(userscale96); 
+					} else {
+						c_hiq[i] = (float *)(userscale48); 
+					}
+				} else if (lib_bank) {
+					if (io->HICPUMODE) {
+						c_hiq[i] = (float *)(lib_bank->c_maxq96000);
 					} else {
-						c_hiq[i] = (float *)(userscale_bank48); 
+						c_hiq[i] = (float *)(lib_bank->c_maxq48000);
 					}
 				} else {
 					if (io->HICPUMODE) {
@@ -121,14 +158,28 @@ void Filter::process_scale_bank(void) {
 						c_hiq[i] = (float *)(scales.presets[scale_bank[i]]->c_maxq48000);
 					}
 				}	
+			} else if (filter_mode != TWOPASS && filter_type == BPRE && user_bank && user_bpre) {
+				if (io->HICPUMODE) {
+					c_bpre[i]		= user_bpre->r96000;
+					bpretuning[i]	= (float *)(userscale96);
+				} else {
+					c_bpre[i]		= user_bpre->r48000;
+					bpretuning[i]	= (float *)(userscale48);
+				}
+			} else if (filter_mode != TWOPASS && filter_type == BPRE && lib_bank) {
+				if (io->HICPUMODE) {
+					c_bpre[i]		= lib_bank->bpre.r96000;
+					bpretuning[i]	= (float *)(lib_bank->c_maxq96000);
+				} else {
+					c_bpre[i]		= lib_bank->bpre.r48000;
+					bpretuning[i]	= (float *)(lib_bank->c_maxq48000);
+				}
 			} else if (filter_mode != TWOPASS && filter_type == BPRE) {
 				if (io->HICPUMODE) {
-					c_hiq[i] 		= (float *)(scales.presets[scale_bank[i]]->c_bpre9600080040);
-					c_loq[i] 		= (float *)(scales.presets[scale_bank[i]]->c_bpre9600022);
+					c_bpre[i]		= scales.presets[scale_bank[i]]->bpre.r96000;
 					bpretuning[i]	= (float *)(scales.presets[scale_bank[i]]->c_maxq96000); // Filter tuning, no exact tracking
 				} else {
-					c_hiq[i] 		= (float *)(scales.presets[scale_bank[i]]->c_bpre4800080040);
-					c_loq[i] 		= (float *)(scales.presets[scale_bank[i]]->c_bpre4800022);
+					c_bpre[i]		= scales.presets[scale_bank[i]]->bpre.r48000;
 					bpretuning[i]	= (float *)(scales.presets[scale_bank[i]]->c_maxq48000); // Filter tuning, no exact tracking
 				}
 			}
@@ -136,6 +187,173 @@ void Filter::process_scale_bank(void) {
 	}	// channels
 }
 
+void Filter::process_qval(uint8_t channel_num) {
+
+	uint32_t qval = q->qval[channel_num];
+
+	if (qval == q_cached[channel_num]) {
+		return;
+	}
+	q_cached[channel_num] = qval;
+
+	float qdiv = io->HICPUMODE ? 10.0f : 5.0f;
+
+	qc[channel_num] = qval;
+
+	// QVAL ADJUSTMENTS
+	// first filter max Q at noon on Q knob
+	qval_a[channel_num]	= qc[channel_num] * 2.0f;
+	if (qval_a[channel_num] > 4095.0f) {
+		qval_a[channel_num] = 4095.0f;
+	}
+
+	// limit q knob range on second filter
+	if (qc[channel_num] < 3900.0f) {
+		qval_b[channel_num] = 1000.0f;
+	} else if (qc[channel_num] >= 3900.0f) {
+		qval_b[channel_num] = 1000.0f + (qc[channel_num] - 3900.0f) * 15.0f;
+	} // 1000 to 3925
+
+	// Q/RESONANCE: c0 = 1 - 2/(decay * samplerate), where decay is around 0.01 to 4.0
+	q_c0_a[channel_num]			= 1.0f - exp_4096((uint32_t)(qval_a[channel_num] / 1.4f) + 200) / qdiv; //exp[200...3125]
+	q_c0[channel_num]			= 1.0f - exp_4096((uint32_t)(qval_b[channel_num] / 1.4f) + 200) / qdiv; //exp[200...3125]
+	q_c0_onepass[channel_num]	= 1.0f - exp_4096((uint32_t)(qc[channel_num] / 1.4f) + 200) / qdiv; //exp[200...3125]
+
+	// CROSSFADE between the two filters
+	if (qc[channel_num] < CROSSFADE_MIN) {
+		q_ratio_a[channel_num] = 1.0f;
+	} else if (qc[channel_num] > CROSSFADE_MAX) {
+		q_ratio_a[channel_num] = 0.0f;
+	} else {
+		q_ratio_a[channel_num] = 1.0f - (qc[channel_num] - CROSSFADE_MIN) / CROSSFADE_WIDTH;
+	}
+
+	q_ratio_b[channel_num] = (1.0f - q_ratio_a[channel_num]);
+	q_ratio_b[channel_num] *= 43801543.68f / twopass_calibration((uint32_t)(qval_b[channel_num] - 900)); 
+	// FIXME: 43801543.68f gain could be directly printed into calibration vector
+
+	// AMPLITUDE: Boost high freqs and boost low resonance, c2 = 0.003 * c1 - 0.1 * c0 + 0.102
+	// The c1 term is added in the filter as it depends on the note
+	q_c2_a[channel_num]			= 0.102f - (0.1f * q_c0_a[channel_num]);
+	q_c2[channel_num]			= 0.102f - (0.1f * q_c0[channel_num]);
+	q_c2_onepass[channel_num]	= 0.102f - (0.1f * q_c0_onepass[channel_num]);
+	q_c2_onepass_gain[channel_num] = ((4096.0f - qc[channel_num]) / 1024.0f) + 1.04f;
+
+	// BpRe Q vector
+	if (qval > 4065) {
+		q_var_q[channel_num] = 1.0f;
+	} else {
+		q_var_q[channel_num] = log_4096(qval);
+	}
+
+}
+
+bool Filter::coefficients_changed(uint8_t slot, uint8_t channel_num, uint8_t filter_num, uint8_t scale_num) {
+
+	float nudge = tuning->freq_nudge[channel_num];
+	float shift = tuning->freq_shift[channel_num];
+	uint32_t qval = q->qval[channel_num];
+
+	if (!coef_dirty[slot] &&
+		coef_note[slot] == filter_num &&
+		coef_scale[slot] == scale_num &&
+		coef_nudge[slot] == nudge &&
+		coef_shift[slot] == shift &&
+		coef_qval[slot] == qval) {
+		return false;
+	}
+
+	coef_dirty[slot]	= false;
+	coef_note[slot]		= filter_num;
+	coef_scale[slot]	= scale_num;
+	coef_nudge[slot]	= nudge;
+	coef_shift[slot]	= shift;
+	coef_qval[slot]		= qval;
+
+	return true;
+
+}
+
+void Filter::resolve_maxq(uint8_t slot, uint8_t channel_num, uint8_t filter_num, uint8_t scale_num) {
+
+	float c1;
+
+	process_qval(channel_num);
+
+	if (!coefficients_changed(slot, channel_num, filter_num, scale_num)) {
+		return;
+	}
+
+	// FREQ: c1 = 2 * pi * freq / samplerate
+	c1 = *(c_hiq[channel_num] + (scale_num * NUM_SCALENOTES) + filter_num);
+	c1 *= tuning->freq_nudge[channel_num] * tuning->freq_shift[channel_num];
+
+	if (io->HICPUMODE) {
+		if (c1 > 1.30899581f) {
+			c1 = 1.30899581f; //hard limit at 20k
+		}
+	} else {
+		if (c1 > 1.9f) {
+			c1 = 1.9f; //hard limit at 20k
+		}
+	}
+
+	coef_c1[slot] = c1;
+
+	// AMPLITUDE: Boost high freqs and boost low resonance
+	if (filter_mode == TWOPASS) {
+		coef_c2_a[slot]	= (0.003f * c1) + q_c2_a[channel_num];
+		coef_c2[slot]	= ((0.003f * c1) + q_c2[channel_num]) * q_ratio_b[channel_num];
+	} else {
+		coef_c2[slot]	= ((0.003f * c1) + q_c2_onepass[channel_num]) * q_c2_onepass_gain[channel_num];
+	}
+
+}
+
+void Filter::resolve_bpre(uint8_t slot, uint8_t channel_num, uint8_t filter_num, uint8_t scale_num) {
+
+	float c[4];
+
+	float var_q;
+	float inv_var_q;
+	float var_f;
+	float inv_var_f;
+
+	process_qval(channel_num);
+
+	if (!coefficients_changed(slot, channel_num, filter_num, scale_num)) {
+		return;
+	}
+
+	//Freq nudge vector
+	var_f = tuning->freq_nudge[channel_num];
+	if (var_f < 0.002f) {
+		var_f = 0.0f;
+	}
+	if (var_f > 0.998f) {
+		var_f = 1.0f;
+	}
+	inv_var_f = 1.0f - var_f;
+
+	//Q vector
+	var_q	 = q_var_q[channel_num];
+	inv_var_q = 1.0f - var_q;
+
+	// Lo-Q and Hi-Q of the note and of its nudge neighbour share one record
+	const BpreRecord *r = c_bpre[channel_num] + (scale_num * NUM_SCALENOTES) + filter_num;
+
+	for (int k = 0; k < 4; k++) {
+		float a = r->loq_next[k] * var_f + r->loq[k] * inv_var_f;
+		float b = r->hiq_next[k] * var_f + r->hiq[k] * inv_var_f;
+		c[k] = b * var_q + a * inv_var_q;
+	}
+
+	coef_c0[slot] = c[0];
+	coef_c1[slot] = c[1];
+	coef_c2[slot] = c[2];
+
+}
+
 // CALCULATE FILTER OUTPUTS
 //filter_out[0-5] are the note[]/scale[]/scale_bank[] filters.
 //filter_out[6-11] are the morph destination values
@@ -152,87 +370,33 @@ void Filter::filter_twopass() {
 	float c0, c1, c2;
 	float c0_a, c2_a;
 
-	float pos_in_cf;	// % of Qknob position within crossfade region
-	float ratio_a;
-	float ratio_b;		// two-pass filter crossfade ratios
+	float ratio_a;		// two-pass filter crossfade ratio
 
 	float destvoct[6];
 
 	int32_t *ptmp_i32;
 
-	io->INPUT_CLIP = false;
-
 	for (channel_num = 0; channel_num < NUM_CHANNELS; channel_num++) {
 		filter_num = note[channel_num];
 		scale_num  = scale[channel_num];
 
-		qc[channel_num] = q->qval[channel_num];
-
-		// QVAL ADJUSTMENTS
-		// first filter max Q at noon on Q knob
-		qval_a[channel_num]	= qc[channel_num] * 2.0f;
-		if (qval_a[channel_num] > 4095.0f) {
-			qval_a[channel_num] = 4095.0f;
-		}
-
-		// limit q knob range on second filter
-		if (qc[channel_num] < 3900.0f) {
-			qval_b[channel_num] = 1000.0f;
-		} else if (qc[channel_num] >= 3900.0f) {
-			qval_b[channel_num] = 1000.0f + (qc[channel_num] - 3900.0f) * 15.0f;
-		} // 1000 to 3925
-		
-		// Q/RESONANCE: c0 = 1 - 2/(decay * samplerate), where decay is around 0.01 to 4.0
-		if (io->HICPUMODE) {
-			c0_a = 1.0f - exp_4096[(uint32_t)(qval_a[channel_num] / 1.4f) + 200] / 10.0f; //exp[200...3125]
-			c0   = 1.0f - exp_4096[(uint32_t)(qval_b[channel_num] / 1.4f) + 200] / 10.0f; //exp[200...3125]
-		} else {
-			c0_a = 1.0f - exp_4096[(uint32_t)(qval_a[channel_num] / 1.4f) + 200] / 5.0f; //exp[200...3125]
-			c0   = 1.0f - exp_4096[(uint32_t)(qval_b[channel_num] / 1.4f) + 200] / 5.0f; //exp[200...3125]
-		}
+		process_qval(channel_num);
 
-		// FREQ: c1 = 2 * pi * freq / samplerate
-		c1 = *(c_hiq[channel_num] + (scale_num * NUM_SCALENOTES) + filter_num);
-		c1 *= tuning->freq_nudge[channel_num] * tuning->freq_shift[channel_num];
-
-		if (io->HICPUMODE) {
-			if (c1 > 1.30899581f) {
-				c1 = 1.30899581f; //hard limit at 20k
-			}
-		} else {
-			if (c1 > 1.9f) {
-				c1 = 1.9f; //hard limit at 20k
-			}
-		}
+		c0_a	= q_c0_a[channel_num];
+		c0		= q_c0[channel_num];
+		ratio_a	= q_ratio_a[channel_num];
 
-		// CROSSFADE between the two filters
-		if (qc[channel_num] < CROSSFADE_MIN) {
-			ratio_a = 1.0f;
-		} else if (qc[channel_num] > CROSSFADE_MAX) {
-			ratio_a = 0.0f;
-		} else {
-			pos_in_cf = (qc[channel_num] - CROSSFADE_MIN) / CROSSFADE_WIDTH;
-			ratio_a   = 1.0f - pos_in_cf;
-		}
+		resolve_maxq(channel_num, channel_num, filter_num, scale_num);
 
-		ratio_b = (1.0f - ratio_a);
-		ratio_b *= 43801543.68f / twopass_calibration[(uint32_t)(qval_b[channel_num] - 900)]; 
-		// FIXME: 43801543.68f gain could be directly printed into calibration vector
-		
-		// AMPLITUDE: Boost high freqs and boost low resonance
-		c2_a  = (0.003f * c1) - (0.1f * c0_a) + 0.102f;
-		c2	= (0.003f * c1) - (0.1f * c0)   + 0.102f;
-		c2 *= ratio_b;
+		c1		= coef_c1[channel_num];
+		c2_a	= coef_c2_a[channel_num];
+		c2		= coef_c2[channel_num];
 
 		ptmp_i32 = io->in[channel_num];
 
 		int j = channel_num;
 		for (int i = 0; i < NUM_SAMPLES; i++) {
 
-			if (*ptmp_i32 >= INPUT_LED_CLIP_LEVEL) {
-				io->INPUT_CLIP = true;
-			} 
-
 			// FIRST PASS (_a)
 			buf_a[channel_num][scale_num][filter_num][2] = (c0_a * buf_a[channel_num][scale_num][filter_num][1] + c1 * buf_a[channel_num][scale_num][filter_num][0]) - c2_a * (*ptmp_i32++);
 			buf_a[channel_num][scale_num][filter_num][0] = buf_a[channel_num][scale_num][filter_num][0] - (c1 * buf_a[channel_num][scale_num][filter_num][2]);
@@ -262,27 +426,14 @@ void Filter::filter_twopass() {
 			filter_num = rotation->motion_fadeto_note[channel_num];
 			scale_num  = rotation->motion_fadeto_scale[channel_num];
 
-			//FREQ: c1 = 2 * pi * freq / samplerate
-			c1 = *(c_hiq[channel_num] + (scale_num * NUM_SCALENOTES) + filter_num);
-			c1 *= tuning->freq_nudge[channel_num] * tuning->freq_shift[channel_num];
+			resolve_maxq(channel_num + NUM_CHANNELS, channel_num, filter_num, scale_num);
 
-			if (io->HICPUMODE) {
-				if (c1 > 1.30899581f) {
-					c1 = 1.30899581f; //hard limit at 20k
-				}
-			} else {
-				if (c1 > 1.9f) {
-					c1 = 1.9f; //hard limit at 20k
-				}
-			}
+			c1		= coef_c1[channel_num + NUM_CHANNELS];
+			c2_a	= coef_c2_a[channel_num + NUM_CHANNELS];
+			c2		= coef_c2[channel_num + NUM_CHANNELS];
 
 			destvoct[channel_num] = c1;
 
-			//AMPLITUDE: Boost high freqs and boost low resonance
-			c2_a  = (0.003f * c1) - (0.1f * c0_a) + 0.102f;
-			c2	= (0.003f * c1) - (0.1f * c0)   + 0.102f;
-			c2 	*= ratio_b;
-
 			ptmp_i32 = io->in[channel_num];
 
 			j = channel_num + 6;
@@ -321,7 +472,6 @@ void Filter::filter_onepass() {
 	uint8_t filter_num;
 	uint8_t channel_num;
 	uint8_t scale_num;
-	uint8_t nudge_filter_num;
 
 	float c0, c1, c2;
 	float tmp;
@@ -329,8 +479,6 @@ void Filter::filter_onepass() {
 
 	float destvoct[6];
 
-	io->INPUT_CLIP = false;
-
 	for (int j = 0; j < NUM_CHANNELS * 2; j++) {
 
 		if (j < NUM_CHANNELS) {
@@ -351,31 +499,12 @@ void Filter::filter_onepass() {
 				scale_num  = rotation->motion_fadeto_scale[channel_num];
 			}
 
-			nudge_filter_num = filter_num + 1;
-			if (nudge_filter_num > NUM_FILTS) {
-				nudge_filter_num = NUM_FILTS;
-			}
-
 			// Q/RESONANCE: c0 = 1 - 2/(decay * samplerate), where decay is around 0.01 to 4.0
-			if (io->HICPUMODE) {
-				c0 = 1.0f - exp_4096[(uint32_t)(q->qval[channel_num] / 1.4f) + 200] / 10.0; //exp[200...3125]
-			} else {
-				c0 = 1.0f - exp_4096[(uint32_t)(q->qval[channel_num] / 1.4f) + 200] / 5.0; //exp[200...3125]
-			}
-
-			// FREQ: c1 = 2 * pi * freq / samplerate
-			c1 = *(c_hiq[channel_num] + (scale_num * NUM_SCALENOTES) + filter_num);
-			c1 *= tuning->freq_nudge[channel_num] * tuning->freq_shift[channel_num];
+			resolve_maxq(j, channel_num, filter_num, scale_num);
 
-			if (io->HICPUMODE) {
-				if (c1 > 1.30899581f) {
-					c1 = 1.30899581f; //hard limit at 20k
-				}
-			} else {
-				if (c1 > 1.9f) {
-					c1 = 1.9f; //hard limit at 20k
-				}
-			}
+			c0 = q_c0_onepass[channel_num];
+			c1 = coef_c1[j];
+			c2 = coef_c2[j];
 
 			// Set VOCT output
 			if (j < NUM_CHANNELS) { // Starting v/oct for gliss calc comes from first pass
@@ -384,18 +513,10 @@ void Filter::filter_onepass() {
 				destvoct[channel_num] = c1;
 			}
 
-			// AMPLITUDE: Boost high freqs and boost low resonance
-			c2  = (0.003f * c1) - (0.1f * c0) + 0.102f;
-			c2 *= ((4096.0f - q->qval[channel_num]) / 1024.0f) + 1.04f;
-
 			for (int i = 0; i < NUM_SAMPLES; i++) {
 
 				tmp = io->in[channel_num][i];
 
-				if (tmp >= INPUT_LED_CLIP_LEVEL) {
-					io->INPUT_CLIP = true;
-				}
-
 				buf[channel_num][scale_num][filter_num][2] = (c0 * buf[channel_num][scale_num][filter_num][1] + c1 * buf[channel_num][scale_num][filter_num][0]) - c2 * tmp;
 				iir = buf[channel_num][scale_num][filter_num][0] - (c1 * buf[channel_num][scale_num][filter_num][2]);
 				buf[channel_num][scale_num][filter_num][0] = iir;
@@ -422,23 +543,14 @@ void Filter::filter_bpre() {
 	uint8_t filter_num;
 	uint8_t channel_num;
 	uint8_t scale_num;
-	uint8_t nudge_filter_num;
 
-	float a0, a1, a2;
 	float c0, c1, c2;
 	float tmp;
 	float iir;
 	float fir;
 
-	float var_q;
-	float inv_var_q;
-	float var_f;
-	float inv_var_f;
-
 	float destvoct[6];
 
-	io->INPUT_CLIP = false;
-
 	for (int j = 0; j < NUM_CHANNELS * 2; j++) {
 
 		if (j < NUM_CHANNELS) {
@@ -460,22 +572,6 @@ void Filter::filter_bpre() {
 				scale_num  = rotation->motion_fadeto_scale[channel_num];
 			}
 
-			//Q vector
-			var_f = tuning->freq_nudge[channel_num];
-			if (var_f < 0.002f) {
-				var_f = 0.0f;
-			}
-			if (var_f > 0.998f) {
-				var_f = 1.0f;
-			}
-			inv_var_f = 1.0f - var_f;
-
-			//Freq nudge vector
-			nudge_filter_num = filter_num + 1;
-			if (nudge_filter_num > NUM_FILTS) {
-				nudge_filter_num = NUM_FILTS;
-			}
-
 			// Set VOCT output
 			if (j < NUM_CHANNELS) {
 				envelope->envout_preload_voct[channel_num] = 
@@ -485,26 +581,11 @@ void Filter::filter_bpre() {
 					*(bpretuning[channel_num] + (scale_num * NUM_SCALENOTES) + filter_num);
 			}
 
-			a0 =* (c_loq[channel_num] + (scale_num*63) + (nudge_filter_num*3) + 0)*var_f + *(c_loq[channel_num] + (scale_num*63) + (filter_num*3) + 0)*inv_var_f;
-			a1 =* (c_loq[channel_num] + (scale_num*63) + (nudge_filter_num*3) + 1)*var_f + *(c_loq[channel_num] + (scale_num*63) + (filter_num*3) + 1)*inv_var_f;
-			a2 =* (c_loq[channel_num] + (scale_num*63) + (nudge_filter_num*3) + 2)*var_f + *(c_loq[channel_num] + (scale_num*63) + (filter_num*3) + 2)*inv_var_f;
-
-			c0 =* (c_hiq[channel_num] + (scale_num*63) + (nudge_filter_num*3) + 0)*var_f + *(c_hiq[channel_num] + (scale_num*63) + (filter_num*3) + 0)*inv_var_f;
-			c1 =* (c_hiq[channel_num] + (scale_num*63) + (nudge_filter_num*3) + 1)*var_f + *(c_hiq[channel_num] + (scale_num*63) + (filter_num*3) + 1)*inv_var_f;
-			c2 =* (c_hiq[channel_num] + (scale_num*63) + (nudge_filter_num*3) + 2)*var_f + *(c_hiq[channel_num] + (scale_num*63) + (filter_num*3) + 2)*inv_var_f;
-
-			//Q vector
-			if (q->qval[channel_num] > 4065) {
-				var_q	 = 1.0f;
-				inv_var_q = 0.0f;
-			} else {
-				var_q	 = log_4096[q->qval[channel_num]];
-				inv_var_q = 1.0f - var_q;
-			}
+			resolve_bpre(j, channel_num, filter_num, scale_num);
 
-			c0 = c0 * var_q + a0 * inv_var_q;
-			c1 = c1 * var_q + a1 * inv_var_q;
-			c2 = c2 * var_q + a2 * inv_var_q;
+			c0 = coef_c0[j];
+			c1 = coef_c1[j];
+			c2 = coef_c2[j];
 
 			for (int i = 0; i < NUM_SAMPLES; i++){
 
@@ -516,10 +597,6 @@ void Filter::filter_bpre() {
 
 				int32_t pTmp = io->in[channel_num][i];
 
-				if (pTmp >= INPUT_LED_CLIP_LEVEL) {
-					io->INPUT_CLIP = true;
-				}
-
 				iir = pTmp * c0;
 
 				iir -= c1 * tmp;
@@ -557,6 +634,15 @@ void Filter::process_audio_block() {
 	// UPDATE QVAL
 	q->update();
 
+	// Input clip detection, a max over the whole block rather than a test inside the filter loops
+	int32_t in_peak = 0;
+	for (int j = 0; j < NUM_CHANNELS; j++) {
+		for (int i = 0; i < NUM_SAMPLES; i++) {
+			in_peak = io->in[j][i] > in_peak ? io->in[j][i] : in_peak;
+		}
+	}
+	io->INPUT_CLIP = in_peak >= INPUT_LED_CLIP_LEVEL;
+
 	if (filter_mode == TWOPASS) {
 		filter_twopass();
 	} else {
@@ -568,40 +654,48 @@ void Filter::process_audio_block() {
 	} 	// Filter-mode
 
 	rotation->update_morph();
-	// Since process_audio_block is called half as frequently in 48Khz mode as in 96Khz mode
-	// We must call update_morph twice, instead of once, to compensate
-	if (!io->HICPUMODE) { 
-		rotation->update_morph();
-	}
 
 	// MORPHING
-	for (int i = 0; i < NUM_SAMPLES; i++) {
-		
-		for (int j = 0; j < NUM_CHANNELS; j++) {
-		
-			if (rotation->motion_morphpos[j] == 0.0f) {
-				f_blended = filter_out[j][i];
-			} else {
-				f_blended = (filter_out[j][i] * (1.0f - rotation->motion_morphpos[j])) + (filter_out[j + NUM_CHANNELS][i] * rotation->motion_morphpos[j]); // filter blending
+	// Blend each channel over the whole block, tracking the block peak as we go so the envelope
+	// follower sees every sample rather than only the first one of the block
+	for (int j = 0; j < NUM_CHANNELS; j++) {
+
+		float *out_a = filter_out[j];
+		float *out_b = filter_out[j + NUM_CHANNELS];
+		int32_t *dest = io->out[j];
+		float morph_start = rotation->motion_morph_start[j];
+		float morph_inc = rotation->motion_morph_inc[j];
+		float morph;
+		float peak = 0.0f;
+
+		// Ramp the output level per sample from the last block's level to the current one, to avoid zipper noise
+		float level = levels->channel_level[j];
+		float level_start = levels->block_level[j];
+		float level_step = (level - level_start) / NUM_SAMPLES;
+		levels->block_level[j] = level;
+
+		if (morph_start == 0.0f) {
+			for (int i = 0; i < NUM_SAMPLES; i++) {
+				f_blended = out_a[i];
+				peak = fmaxf(peak, fabsf(f_blended));
+				dest[i] = (f_blended * (level_start + level_step * (i + 1)));
+			}
+		} else {
+			for (int i = 0; i < NUM_SAMPLES; i++) {
+				morph = fminf(morph_start + morph_inc * (i + 1), 1.0f);
+				f_blended = (out_a[i] * (1.0f - morph)) + (out_b[i] * morph); // filter blending
+				peak = fmaxf(peak, fabsf(f_blended));
+				dest[i] = (f_blended * (level_start + level_step * (i + 1)));
 			}
+		}
 
-			io->out[j][i] = (f_blended * levels->channel_level[j]);
+		io->channelLevel[j] = (peak * level) / CLIP_LEVEL;
+		envelope->envout_preload[j] = peak; // Envelope does not take into account channel level
 
-		}
 	}
 
-	for (int j = 0; j < NUM_CHANNELS; j++) {
-		f_blended = (filter_out[j][0] * (1.0f - rotation->motion_morphpos[j])) + (filter_out[j + NUM_CHANNELS][0] * rotation->motion_morphpos[j]);
+	io->METER_UPDATE = true;
 
-		io->channelLevel[j] = (f_blended * levels->channel_level[j]) / CLIP_LEVEL;
-		
-		if (f_blended > 0.0f) { // Envelope does not take into account channel level
-			envelope->envout_preload[j] = f_blended;
-		} else {
-			envelope->envout_preload[j] = -1.0f * f_blended;
-		}
-	}
-	
 	filter_type_changed = false;
 	io->USERSCALE_CHANGED = false;
 	io->READCOEFFS = false;
@@ -613,4 +707,7 @@ void Filter::set_default_user_scalebank(void) {
 		userscale_bank96[j] = scales.presets[NUM_SCALEBANKS - 1]->c_maxq96000[j];
 		userscale_bank48[j] = scales.presets[NUM_SCALEBANKS - 1]->c_maxq48000[j];
 	}
+	userscale96 = userscale_bank96;
+	userscale48 = userscale_bank48;
+	user_bpre_requested.store(true, std::memory_order_release);
 }
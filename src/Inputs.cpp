@@ -27,8 +27,7 @@
  */
 
 #include "Rainbow.hpp"
-
-extern float exp_4096[4096];
+#include "Tables.hpp"
 
 using namespace rainbow;
 
@@ -108,7 +107,7 @@ void Inputs::param_read_switches(void) {
 		if (lag_val > 4095) {
 			lag_val = 4095;
 		}
-		levels->channel_level_lpf = 1.0f - exp_4096[lag_val];
+		levels->channel_level_lpf = 1.0f - exp_4096(lag_val);
 	} else {
 		levels->channel_level_lpf = levels->CHANNEL_LEVEL_MIN_LPF;
 	}
@@ -30,70 +30,66 @@
 
 using namespace rainbow;
 
-void LEDRing::configure(IO *_io, Rotation *_rotation, Envelope *_envelope, Filter *_filter, Q *_q) {
-	rotation	= _rotation;
+void LEDRing::configure(Envelope *_envelope) {
 	envelope	= _envelope;
-	io			= _io;
-	filter		= _filter;
-	q			= _q;
 }
 
-void LEDRing::calculate_envout_leds() {
+void LEDRing::calculate_envout_leds(const UIState &ui) {
 
 	for (int chan = 0; chan < NUM_CHANNELS; chan++) {
 
-		float f = (io->voct_out[chan] - envelope->MIN_VOCT) / envelope->VOCT_RANGE;
+		float f = (ui.voct_out[chan] - envelope->MIN_VOCT) / envelope->VOCT_RANGE;
 		
 		// Here we are going to use HSL
 		// 0V = Green = 120
 		// MIN_VOCT = Blue = 240
 		// MAX_VOCT = Red = 0
-		io->tuning_out_leds[chan][0] = f * hslRange;
-		io->tuning_out_leds[chan][1] = 1.0f;
-		io->tuning_out_leds[chan][2] = 0.5f;
+		tuning_out_leds[chan][0] = f * hslRange;
+		tuning_out_leds[chan][1] = 1.0f;
+		tuning_out_leds[chan][2] = 0.5f;
 
 		// Level leds
-		float qval = q->qval_goal[chan] / 4095.0f;
-		io->q_leds[chan][0] = channel_led_colors[chan][0] * qval;
-		io->q_leds[chan][1] = channel_led_colors[chan][1] * qval;
-		io->q_leds[chan][2] = channel_led_colors[chan][2] * qval;
+		float qval = ui.qval[chan] / 4095.0f;
+		q_leds[chan][0] = channel_led_colors[chan][0] * qval;
+		q_leds[chan][1] = channel_led_colors[chan][1] * qval;
+		q_leds[chan][2] = channel_led_colors[chan][2] * qval;
 
-		if (io->q_leds[chan][0] > 1.0f) {
-			io->q_leds[chan][0] = 1.0f;
+		if (q_leds[chan][0] > 1.0f) {
+			q_leds[chan][0] = 1.0f;
 		}
-		if (io->q_leds[chan][1] > 1.0f) {
-			io->q_leds[chan][1] = 1.0f;
+		if (q_leds[chan][1] > 1.0f) {
+			q_leds[chan][1] = 1.0f;
 		}
-		if (io->q_leds[chan][2] > 1.0f) {
-			io->q_leds[chan][2] = 1.0f;
+		if (q_leds[chan][2] > 1.0f) {
+			q_leds[chan][2] = 1.0f;
 		}
 
 		// Envelope
-		io->envelope_leds[chan][0] = channel_led_colors[chan][0] * io->env_out[chan];
-		io->envelope_leds[chan][1] = channel_led_colors[chan][1] * io->env_out[chan];
-		io->envelope_leds[chan][2] = channel_led_colors[chan][2] * io->env_out[chan];
+		envelope_leds[chan][0] = channel_led_colors[chan][0] * ui.env_out[chan];
+		envelope_leds[chan][1] = channel_led_colors[chan][1] * ui.env_out[chan];
+		envelope_leds[chan][2] = channel_led_colors[chan][2] * ui.env_out[chan];
 
-		if (io->envelope_leds[chan][0] > 1.0f) {
-			io->envelope_leds[chan][0] = 1.0f;
+		if (envelope_leds[chan][0] > 1.0f) {
+			envelope_leds[chan][0] = 1.0f;
 		}
-		if (io->envelope_leds[chan][1] > 1.0f) {
-			io->envelope_leds[chan][1] = 1.0f;
+		if (envelope_leds[chan][1] > 1.0f) {
+			envelope_leds[chan][1] = 1.0f;
 		}
-		if (io->envelope_leds[chan][2] > 1.0f) {
-			io->envelope_leds[chan][2] = 1.0f;
+		if (envelope_leds[chan][2] > 1.0f) {
+			envelope_leds[chan][2] = 1.0f;
 		}
 	}
 }
 
-void LEDRing::display_filter_rotation() {
+void LEDRing::display_filter_rotation(const UIState &ui) {
 
 	float inv_fade[NUM_CHANNELS];
 	float fade[NUM_CHANNELS];
 
 	for (int i = 0; i < NUM_FILTS; i++) {
-		io->ring[i][0] = 0.0f;
-		io->ring[i][1] = 0.0f;
-		io->ring[i][2] = 0.0f;
+		ring[i][0] = 0.0f;
+		ring[i][1] = 0.0f;
+		ring[i][2] = 0.0f;
 	}
 
 	// Set the brightness of each LED in the ring:
@@ -108,9 +104,9 @@ void LEDRing::display_filter_rotation() {
 	}
 
 	for (int chan = 0; chan < NUM_CHANNELS; chan++) {
-		if (!io->LOCK_ON[chan]) {
-			inv_fade[chan] = (1.0f - rotation->motion_morphpos[chan]);
-			fade[chan]	 = rotation->motion_morphpos[chan];
+		if (!ui.lock_on[chan]) {
+			inv_fade[chan] = (1.0f - ui.morphpos[chan]);
+			fade[chan]	 = ui.morphpos[chan];
 		} else {
 			fade[chan] = 0.0f;
 			if (filter_flash_ctr) {
@@ -123,50 +119,50 @@ void LEDRing::display_filter_rotation() {
 
 	for (int i = 0; i < NUM_FILTS; i++) {
 		for (int chan = 0; chan < NUM_CHANNELS; chan++) {
-			int next_i = rotation->motion_fadeto_note[chan];
+			int next_i = ui.fadeto_note[chan];
 
-			if (filter->note[chan] == i) {
+			if (ui.note[chan] == i) {
 				// PROCESS REST OF LED RING
 				if (inv_fade[chan] > 0.0f) {
-					if (io->ring[i][0] + io->ring[i][1] + io->ring[i][2] == 0.0f) {
-						io->ring[i][0] = channel_led_colors[chan][0] * inv_fade[chan];
-						io->ring[i][1] = channel_led_colors[chan][1] * inv_fade[chan];
-						io->ring[i][2] = channel_led_colors[chan][2] * inv_fade[chan];
+					if (ring[i][0] + ring[i][1] + ring[i][2] == 0.0f) {
+						ring[i][0] = channel_led_colors[chan][0] * inv_fade[chan];
+						ring[i][1] = channel_led_colors[chan][1] * inv_fade[chan];
+						ring[i][2] = channel_led_colors[chan][2] * inv_fade[chan];
 					} else {
-						io->ring[i][0] += channel_led_colors[chan][0] * inv_fade[chan];
-						io->ring[i][1] += channel_led_colors[chan][1] * inv_fade[chan];
-						io->ring[i][2] += channel_led_colors[chan][2] * inv_fade[chan];
+						ring[i][0] += channel_led_colors[chan][0] * inv_fade[chan];
+						ring[i][1] += channel_led_colors[chan][1] * inv_fade[chan];
+						ring[i][2] += channel_led_colors[chan][2] * inv_fade[chan];
 					}
 
-					if (io->ring[i][0] > 1.0f) {
-						io->ring[i][0] = 1.0f;
+					if (ring[i][0] > 1.0f) {
+						ring[i][0] = 1.0f;
 					}
-					if (io->ring[i][1] > 1.0f) {
-						io->ring[i][1] = 1.0f;
+					if (ring[i][1] > 1.0f) {
+						ring[i][1] = 1.0f;
 					}
-					if (io->ring[i][2] > 1.0f) {
-						io->ring[i][2] = 1.0f;
+					if (ring[i][2] > 1.0f) {
+						ring[i][2] = 1.0f;
 					}
 				}
 				if (fade[chan] > 0.0f) {
-					if (io->ring[next_i][0] + io->ring[next_i][1] + io->ring[next_i][2] == 0.0f) {
-						io->ring[next_i][0] = channel_led_colors[chan][0] * fade[chan];
-						io->ring[next_i][1] = channel_led_colors[chan][1] * fade[chan];
-						io->ring[next_i][2] = channel_led_colors[chan][2] * fade[chan];
+					if (ring[next_i][0] + ring[next_i][1] + ring[next_i][2] == 0.0f) {
+						ring[next_i][0] = channel_led_colors[chan][0] * fade[chan];
+						ring[next_i][1] = channel_led_colors[chan][1] * fade[chan];
+						ring[next_i][2] = channel_led_colors[chan][2] * fade[chan];
 					} else {
-						io->ring[next_i][0] += channel_led_colors[chan][0] * fade[chan];
-						io->ring[next_i][1] += channel_led_colors[chan][1] * fade[chan];
-						io->ring[next_i][2] += channel_led_colors[chan][2] * fade[chan];
+						ring[next_i][0] += channel_led_colors[chan][0] * fade[chan];
+						ring[next_i][1] += channel_led_colors[chan][1] * fade[chan];
+						ring[next_i][2] += channel_led_colors[chan][2] * fade[chan];
 					}
 
-					if (io->ring[next_i][0] > 1.0f) {
-						io->ring[next_i][0] = 1.0f;
+					if (ring[next_i][0] > 1.0f) {
+						ring[next_i][0] = 1.0f;
 					}
-					if (io->ring[next_i][1] > 1.0f) {
-						io->ring[next_i][1] = 1.0f;
+					if (ring[next_i][1] > 1.0f) {
+						ring[next_i][1] = 1.0f;
 					}
-					if (io->ring[next_i][2] > 1.0f) {
-						io->ring[next_i][2] = 1.0f;
+					if (ring[next_i][2] > 1.0f) {
+						ring[next_i][2] = 1.0f;
 					}
 				}
 				chan = 6; //break;
@@ -175,7 +171,7 @@ void LEDRing::display_filter_rotation() {
 	}
 }
 
-void LEDRing::display_scale() {
+void LEDRing::display_scale(const UIState &ui) {
 	//There's probably a more efficient way of calculating this!
 	uint8_t elacs[NUM_SCALES][NUM_CHANNELS];
 	uint8_t elacs_num[NUM_SCALES];
@@ -198,8 +194,8 @@ void LEDRing::display_scale() {
 
 	// --Each entry in elacs[][] equals the number of channels
 	for (int i = 0; i < NUM_CHANNELS; i++) {
-		elacs[rotation->motion_scale_dest[i]][elacs_num[rotation->motion_scale_dest[i]]] = i;
-		elacs_num[rotation->motion_scale_dest[i]]++;
+		elacs[ui.scale_dest[i]][elacs_num[ui.scale_dest[i]]] = i;
+		elacs_num[ui.scale_dest[i]]++;
 	}
 
 	for (int i = 0; i < NUM_SCALES; i++) {
@@ -213,26 +209,19 @@ void LEDRing::display_scale() {
 
 		// --Blank out the channel if there are no entries
 		if (elacs[i][0] == 99) {
-			io->scale[i][0] = 0.05f;
-			io->scale[i][1] = 0.05f;
-			io->scale[i][2] = 0.05f;
+			scale[i][0] = 0.05f;
+			scale[i][1] = 0.05f;
+			scale[i][2] = 0.05f;
 		} else {
-			io->scale[i][0] = channel_led_colors[ elacs[i][ elacs_ctr[i] ] ][0];
-			io->scale[i][1] = channel_led_colors[ elacs[i][ elacs_ctr[i] ] ][1];
-			io->scale[i][2] = channel_led_colors[ elacs[i][ elacs_ctr[i] ] ][2];
+			scale[i][0] = channel_led_colors[ elacs[i][ elacs_ctr[i] ] ][0];
+			scale[i][1] = channel_led_colors[ elacs[i][ elacs_ctr[i] ] ][1];
+			scale[i][2] = channel_led_colors[ elacs[i][ elacs_ctr[i] ] ][2];
 		}
 	}
 }
 
-void LEDRing::update_led_ring() {
-
-	if (io->UI_UPDATE || io->FORCE_RING_UPDATE) {
-
-		io->FORCE_RING_UPDATE 	= false;
-
-		display_scale();
-		display_filter_rotation();
-		calculate_envout_leds();
-
-	}
+void LEDRing::update_led_ring(const UIState &ui) {
+	display_scale(ui);
+	display_filter_rotation(ui);
+	calculate_envout_leds(ui);
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <atomic>
 #include <bitset>
 
 #include "common.hpp"
@@ -12,17 +14,31 @@ using namespace prism;
 
 struct Rainbow;
 
-struct LED : Widget {
+// Edits made from the GUI, applied by the audio thread at the start of process()
+struct RainbowCommand {
+
+	enum Type {
+		TOGGLE_FREQBLOCK,
+		SET_CPUMODE
+	};
+
+	Type type;
+	int value;
+
+};
+
+struct LED {
 
 	NVGcolor color;
 	NVGcolor colorBorder;
 
-	Rainbow *module = NULL;
+	Rainbow *module = NULL; // Set for LEDs that toggle the frequency block when clicked
 
 	int id;
 
 	float ledRadius = 5.0f;
 	float ledStrokeWidth = 1.0f;
+	Rect box;
 	float xCenter;
 	float yCenter;
 
@@ -33,26 +49,163 @@ struct LED : Widget {
 		box.size.x = ledRadius * 2.0f + ledStrokeWidth * 2.0f;
 		box.size.y = ledRadius * 2.0f + ledStrokeWidth * 2.0f;
 		color = nvgRGB(255, 255, 255);
+		colorBorder = nvgRGB(73, 73, 73);
 		Vec ctr = box.getCenter();
 		xCenter = ctr.x / SVG_DPI;
 		yCenter = ctr.y / SVG_DPI;
 	}
 
+};
+
+// Draws every LED in one pass, relative to the top left of the panel
+struct LEDDisplay : TransparentWidget {
+
+	std::vector<LED *> leds;
+	Vec origin; // Position of the panel on the module
+
 	void draw(const DrawArgs &args) override {
-		nvgFillColor(args.vg, color);
-		nvgStrokeColor(args.vg, colorBorder);
-		nvgStrokeWidth(args.vg, ledStrokeWidth);
-		nvgBeginPath(args.vg);
-		nvgMoveTo(args.vg, 0.0f, 0.0f);
-		nvgCircle(args.vg, xCenter, yCenter, ledRadius);
-		nvgFill(args.vg);
-		nvgStroke(args.vg);
+		for (size_t i = 0; i < leds.size(); i++) {
+			LED *led = leds[i];
+			float x = led->box.pos.x - origin.x + led->xCenter;
+			float y = led->box.pos.y - origin.y + led->yCenter;
+
+			nvgFillColor(args.vg, led->color);
+			nvgStrokeColor(args.vg, led->colorBorder);
+			nvgStrokeWidth(args.vg, led->ledStrokeWidth);
+			nvgBeginPath(args.vg);
+			nvgCircle(args.vg, x, y, led->ledRadius);
+			nvgFill(args.vg);
+			nvgStroke(args.vg);
+		}
+	}
+
+};
+
+// Holds all the LEDs of the module in a single framebuffer, only redrawn when an LED changes
+struct LEDPanel : widget::FramebufferWidget {
+
+	LEDDisplay *display;
+
+	float ledMargin = 10.0f;
+
+	std::vector<NVGcolor> drawnColor;
+	std::vector<NVGcolor> drawnBorder;
+
+	LEDPanel() {
+		display = new LEDDisplay;
+		addChild(display);
+	}
+
+	~LEDPanel() {
+		for (size_t i = 0; i < display->leds.size(); i++) {
+			delete display->leds[i];
+		}
+	}
+
+	LED *addLED(LED *led) {
+
+		// Grow the panel to cover the new LED, with a margin as the circle is offset within the LED box
+		float x0 = led->box.pos.x - ledMargin;
+		float y0 = led->box.pos.y - ledMargin;
+		float x1 = led->box.pos.x + led->box.size.x + ledMargin;
+		float y1 = led->box.pos.y + led->box.size.y + ledMargin;
+
+		if (!display->leds.empty()) {
+			x0 = std::min(x0, box.pos.x);
+			y0 = std::min(y0, box.pos.y);
+			x1 = std::max(x1, box.pos.x + box.size.x);
+			y1 = std::max(y1, box.pos.y + box.size.y);
+		}
+
+		box = Rect(Vec(x0, y0), Vec(x1 - x0, y1 - y0));
+		display->box = Rect(Vec(0.0f, 0.0f), box.size);
+		display->origin = box.pos;
+
+		display->leds.push_back(led);
+		drawnColor.push_back(led->color);
+		drawnBorder.push_back(led->colorBorder);
+		dirty = true;
+
+		return led;
+	}
+
+	static bool colorChanged(const NVGcolor &a, const NVGcolor &b) {
+		return a.r != b.r || a.g != b.g || a.b != b.b || a.a != b.a;
+	}
+
+	void step() override {
+		for (size_t i = 0; i < display->leds.size(); i++) {
+			LED *led = display->leds[i];
+			if (colorChanged(led->color, drawnColor[i]) || colorChanged(led->colorBorder, drawnBorder[i])) {
+				drawnColor[i] = led->color;
+				drawnBorder[i] = led->colorBorder;
+				dirty = true;
+			}
+		}
+		FramebufferWidget::step();
 	}
 
 	void onButton(const event::Button &e) override;
 
 };
 
+// Scale packs in <user folder>/Rainbow extend the bank selector past the presets
+static void scanScaleLibrary(void) {
+
+	std::string dir = asset::user("Rainbow");
+	if (!system::isDirectory(dir)) {
+		return;
+	}
+
+	std::vector<std::string> paths;
+	for (const std::string &path : system::getEntries(dir)) {
+		if (string::filenameExtension(string::filename(path)) == "rbpack") {
+			paths.push_back(path);
+		}
+	}
+	std::sort(paths.begin(), paths.end());
+
+	ScaleLibrary::get().add(paths);
+
+}
+
+// Library banks are saved by pack file and bank as well as by number, as the number changes
+// with the packs installed. NULL for a preset bank
+static json_t *libraryBankToJson(int bank) {
+
+	const ScaleLibrary &library = ScaleLibrary::get();
+	int i = bank - NUM_SCALEBANKS;
+	if (library.bank(i) == NULL) {
+		return NULL;
+	}
+
+	json_t *keyJ = json_object();
+	json_object_set_new(keyJ, "pack", json_string(library.packFile(i).c_str()));
+	json_object_set_new(keyJ, "index", json_integer(library.packIndex(i)));
+	json_object_set_new(keyJ, "name", json_string(library.name(i)));
+	return keyJ;
+
+}
+
+// Bank number of a saved library bank. If its pack is not installed, the user bank is used
+// and the pack is left in missing
+static int libraryBankFromJson(json_t *keyJ, std::string *missing) {
+
+	const char *pack = json_string_value(json_object_get(keyJ, "pack"));
+	const char *name = json_string_value(json_object_get(keyJ, "name"));
+	int index = json_integer_value(json_object_get(keyJ, "index"));
+
+	int i = ScaleLibrary::get().find(pack ? pack : "", index, name ? name : "");
+	if (i < 0) {
+		*missing = pack ? pack : "";
+		WARN("Rainbow: bank %d of scale pack '%s' is not installed, using the user scale", index, missing->c_str());
+		return NUM_SCALEBANKS - 1;
+	}
+
+	return NUM_SCALEBANKS + i;
+
+}
+
 struct Rainbow : core::PrismModule {
 
 	enum ParamIds {
@@ -153,41 +306,65 @@ struct Rainbow : core::PrismModule {
 
 	rainbow::Controller main;
 
+	core::CommandQueue<RainbowCommand, 64> commands;
+	std::vector<RainbowCommand> unsentCommands; // GUI only, commands that did not fit in the queue, in order
+
+	rainbow::UIState uiState;
+	std::atomic<uint32_t> uiFrame;	// Odd while the audio thread is writing uiState
+	uint32_t uiFrameDrawn = 0;
+
 	RainbowScaleExpanderMessage *pMessage = new RainbowScaleExpanderMessage;
 	RainbowScaleExpanderMessage *cMessage = new RainbowScaleExpanderMessage;
 
+	// Last block from the expander, and the one before it, which the filter may still point into
+	// until READCOEFFS has re-resolved its coefficients
+	std::shared_ptr<const UserScaleBlock> userScale;
+	std::shared_ptr<const UserScaleBlock> userScalePrev;
+	uint32_t userScaleVersion = 0;
+
 	int currBank = 0; // TODO Move to State
 	int nextBank = 0;
 
+	// Pack of a library bank the patch was saved with but that is not installed, shown on the
+	// bank display until another bank is picked
+	std::string missingPack;
+
 	int currFilter = 0; // TODO Move to State
 	int nextFilter = 0;
 
-	rack::dsp::SchmittTrigger lockTriggers[6];
-	rack::dsp::SchmittTrigger qlockTriggers[6];
+	// CV trigger inputs, checked every sample
 	rack::dsp::SchmittTrigger lock135Trigger;
 	rack::dsp::SchmittTrigger lock246Trigger;
 
-	rack::dsp::SchmittTrigger lock135ButtonTrigger;
-	rack::dsp::SchmittTrigger lock246ButtonTrigger;
-
 	rack::dsp::SchmittTrigger rotCWTrigger;
 	rack::dsp::SchmittTrigger rotCCWTrigger;
 
-	rack::dsp::SchmittTrigger rotCWButtonTrigger;
-	rack::dsp::SchmittTrigger rotCCWButtonTrigger;
-
-	rack::dsp::SchmittTrigger scaleCWButtonTrigger;
-	rack::dsp::SchmittTrigger scaleCCWButtonTrigger;
+	// Buttons, one bit each, polled every BUTTON_DIVISION samples
+	enum ButtonBits {
+		ROTCW_BUTTON,
+		ROTCCW_BUTTON,
+		SCALECW_BUTTON,
+		SCALECCW_BUTTON,
+		LOCK135_BUTTON,
+		LOCK246_BUTTON,
+		SWITCHBANK_BUTTON,
+		VOCTGLIDE_BUTTON,
+		PREPOST_BUTTON,
+		SCALEROT_BUTTON,
+		ENUMS(LOCKON_BUTTON,6),
+		ENUMS(CHANNEL_Q_ON_BUTTON,6),
+		NUM_BUTTONS
+	};
 
-	rack::dsp::SchmittTrigger changeBankTrigger;
+	const static int BUTTON_DIVISION = 32;
 
-	rack::dsp::SchmittTrigger prepostTrigger;
-	rack::dsp::SchmittTrigger scaleRotTrigger;
-	rack::dsp::SchmittTrigger glissTrigger;
+	dsp::ClockDivider buttonDivider;
+	uint32_t buttonState = 0;
 
 	rainbow::Audio audio;
 
 	int frameC = 100000000;
+	bool compactStorage = true; // Save the user scale as a base64 blob rather than JSON arrays
 	bool highCPUMode = false;
 	bool highCPUModeChanged = true;
 	int internalSampleRate = 48000;
@@ -210,30 +387,38 @@ struct Rainbow : core::PrismModule {
 
 		json_t *rootJ = json_object();
 
+		rainbow::State state;
+		main.snapshot_state(&state);
+
 		// highcpu
 		json_t *cpuJ = json_integer((int) highCPUMode);
 		json_object_set_new(rootJ, "highcpu", cpuJ);
 
 		// gliss
-		json_t *glissJ = json_integer((int) main.io->GLIDE_SWITCH);
+		json_t *glissJ = json_integer((int) state.gliss);
 		json_object_set_new(rootJ, "gliss", glissJ);
 
 		// prepost
-		json_t *prepostJ = json_integer((int) main.io->PREPOST_SWITCH);
+		json_t *prepostJ = json_integer((int) state.prepost);
 		json_object_set_new(rootJ, "prepost", prepostJ);
 
 		// scale rotation
-		json_t *scalerotJ = json_integer((int) main.io->SCALEROT_SWITCH);
+		json_t *scalerotJ = json_integer((int) state.scalerot);
 		json_object_set_new(rootJ, "scalerot", scalerotJ);
 
 		// bank
 		json_t *bankJ = json_integer((int) currBank);
 		json_object_set_new(rootJ, "bank", bankJ);
 
+		json_t *bankPackJ = libraryBankToJson(currBank);
+		if (bankPackJ) {
+			json_object_set_new(rootJ, "bankpack", bankPackJ);
+		}
+
 		// qlocks
 		json_t *qlocksJ = json_array();
 		for (int i = 0; i < NUM_CHANNELS; i++) {
-			json_t *qlockJ = json_integer((int) main.io->CHANNEL_Q_ON[i]);
+			json_t *qlockJ = json_integer((int) state.q_on[i]);
 			json_array_append_new(qlocksJ, qlockJ);
 		}
 		json_object_set_new(rootJ, "qlocks", qlocksJ);
@@ -241,7 +426,7 @@ struct Rainbow : core::PrismModule {
 		// locks
 		json_t *locksJ = json_array();
 		for (int i = 0; i < NUM_CHANNELS; i++) {
-			json_t *lockJ = json_integer((int) main.io->LOCK_ON[i]);
+			json_t *lockJ = json_integer((int) state.lock_on[i]);
 			json_array_append_new(locksJ, lockJ);
 		}
 		json_object_set_new(rootJ, "locks", locksJ);
@@ -250,37 +435,51 @@ struct Rainbow : core::PrismModule {
 		json_t *note_array	  	= json_array();
 		json_t *scale_array		 = json_array();
 		json_t *scale_bank_array	= json_array();
+		json_t *scale_bank_pack_array	= json_array();
 
 		for (int i = 0; i < NUM_CHANNELS; i++) {
-			json_t *noteJ   		= json_integer(main.state->note[i]);
-			json_t *scaleJ	  	= json_integer(main.state->scale[i]);
-			json_t *scale_bankJ		= json_integer(main.state->scale_bank[i]);
+			json_t *noteJ   		= json_integer(state.note[i]);
+			json_t *scaleJ	  	= json_integer(state.scale[i]);
+			json_t *scale_bankJ		= json_integer(state.scale_bank[i]);
 
 			json_array_append_new(note_array,   	noteJ);
 			json_array_append_new(scale_array,	  scaleJ);
 			json_array_append_new(scale_bank_array,	scale_bankJ);
+
+			json_t *scale_bank_packJ = libraryBankToJson(state.scale_bank[i]);
+			json_array_append_new(scale_bank_pack_array, scale_bank_packJ ? scale_bank_packJ : json_null());
 		}
 
 		json_object_set_new(rootJ, "note",		note_array);
 		json_object_set_new(rootJ, "scale",		scale_array);
 		json_object_set_new(rootJ, "scalebank",	scale_bank_array);
+		json_object_set_new(rootJ, "scalebankpacks",	scale_bank_pack_array);
 
-		json_t *blockJ = json_string(main.io->FREQ_BLOCK.to_string().c_str());
+		json_t *blockJ = json_string(state.freqblock.to_string().c_str());
 		json_object_set_new(rootJ, "freqblock", blockJ);
 
-		json_t *userscale96_array	= json_array();
-		for (int i = 0; i < NUM_BANKNOTES; i++) {
-			json_t *noteJ   		= json_real(main.state->userscale96[i]);
-			json_array_append_new(userscale96_array,   	noteJ);
-		}
-		json_object_set_new(rootJ, "userscale",	userscale96_array);
+		json_t *compactJ = json_boolean(compactStorage);
+		json_object_set_new(rootJ, "compact", compactJ);
+
+		if (compactStorage) {
+			// The 48kHz coefficients are exactly twice the 96kHz ones, so only the latter are stored
+			json_t *userscaleJ = core::floatsToJson(state.userscale96, NUM_BANKNOTES);
+			json_object_set_new(rootJ, "userscaleblob", userscaleJ);
+		} else {
+			json_t *userscale96_array	= json_array();
+			for (int i = 0; i < NUM_BANKNOTES; i++) {
+				json_t *noteJ   		= json_real(state.userscale96[i]);
+				json_array_append_new(userscale96_array,   	noteJ);
+			}
+			json_object_set_new(rootJ, "userscale",	userscale96_array);
 
-		json_t *userscale48_array	= json_array();
-		for (int i = 0; i < NUM_BANKNOTES; i++) {
-			json_t *noteJ   		= json_real(main.state->userscale48[i]);
-			json_array_append_new(userscale48_array,   	noteJ);
+			json_t *userscale48_array	= json_array();
+			for (int i = 0; i < NUM_BANKNOTES; i++) {
+				json_t *noteJ   		= json_real(state.userscale48[i]);
+				json_array_append_new(userscale48_array,   	noteJ);
+			}
+			json_object_set_new(rootJ, "userscale48",	userscale48_array);
 		}
-		json_object_set_new(rootJ, "userscale48",	userscale48_array);
 
 		return rootJ;
 	}
@@ -293,6 +492,11 @@ struct Rainbow : core::PrismModule {
 			setCPUMode(json_integer_value(cpuJ));
 		}
 
+		// compact
+		json_t *compactJ = json_object_get(rootJ, "compact");
+		if (compactJ)
+			compactStorage = json_boolean_value(compactJ);
+
 		// gliss
 		json_t *glissJ = json_object_get(rootJ, "gliss");
 		if (glissJ)
@@ -313,6 +517,14 @@ struct Rainbow : core::PrismModule {
 		if (bankJ)
 			currBank = json_integer_value(bankJ);
 
+		// Library bank, found again by its pack
+		missingPack.clear();
+		json_t *bankPackJ = json_object_get(rootJ, "bankpack");
+		if (json_is_object(bankPackJ)) {
+			currBank = libraryBankFromJson(bankPackJ, &missingPack);
+			params[BANK_PARAM].setValue(currBank);
+		}
+
 		// qlocks
 		json_t *qlocksJ = json_object_get(rootJ, "qlocks");
 		if (qlocksJ) {
@@ -368,27 +580,44 @@ struct Rainbow : core::PrismModule {
 			}
 		}
 
+		json_t *scale_bank_pack_array = json_object_get(rootJ, "scalebankpacks");
+		if (scale_bank_pack_array) {
+			for (int i = 0; i < NUM_CHANNELS; i++) {
+				json_t *scale_bank_packJ = json_array_get(scale_bank_pack_array, i);
+				if (json_is_object(scale_bank_packJ))
+					main.state->scale_bank[i] = libraryBankFromJson(scale_bank_packJ, &missingPack);
+			}
+		}
+
 		json_t *blockJ = json_object_get(rootJ, "freqblock");
 		if (blockJ)
 			main.io->FREQ_BLOCK = std::bitset<20>(json_string_value(blockJ));
 
-		// userscale 48
-		json_t *uscale48_array = json_object_get(rootJ, "userscale48");
-		if (uscale48_array) {
+		// userscale, compact form
+		if (core::floatsFromJson(json_object_get(rootJ, "userscaleblob"), main.state->userscale96, NUM_BANKNOTES)) {
 			for (int i = 0; i < NUM_BANKNOTES; i++) {
-				json_t *noteJ = json_array_get(uscale48_array, i);
-				if (noteJ)
-					main.state->userscale48[i] = json_real_value(noteJ);
+				main.state->userscale48[i] = main.state->userscale96[i] * 2.0f;
 			}
-		}
+		} else {
 
-		// userscale 96
-		json_t *uscale96_array = json_object_get(rootJ, "userscale");
-		if (uscale96_array) {
-			for (int i = 0; i < NUM_BANKNOTES; i++) {
-				json_t *noteJ = json_array_get(uscale96_array, i);
-				if (noteJ)
-					main.state->userscale96[i] = json_real_value(noteJ);
+			// userscale 48
+			json_t *uscale48_array = json_object_get(rootJ, "userscale48");
+			if (uscale48_array) {
+				for (int i = 0; i < NUM_BANKNOTES; i++) {
+					json_t *noteJ = json_array_get(uscale48_array, i);
+					if (noteJ)
+						main.state->userscale48[i] = json_real_value(noteJ);
+				}
+			}
+
+			// userscale 96
+			json_t *uscale96_array = json_object_get(rootJ, "userscale");
+			if (uscale96_array) {
+				for (int i = 0; i < NUM_BANKNOTES; i++) {
+					json_t *noteJ = json_array_get(uscale96_array, i);
+					if (noteJ)
+						main.state->userscale96[i] = json_real_value(noteJ);
+				}
 			}
 		}
 
@@ -424,7 +653,8 @@ struct Rainbow : core::PrismModule {
 		configParam(MOD135_PARAM, 0, 1, 0, "Mod 1/135"); // 1/135
 		configParam(MOD246_PARAM, 0, 1, 0, "Mod 2/246"); // 6/246
 
-		configParam(BANK_PARAM, 0, 19, 0, "Bank"); 
+		scanScaleLibrary();
+		configParam(BANK_PARAM, 0, NUM_SCALEBANKS - 1 + ScaleLibrary::get().size(), 0, "Bank"); 
 		configParam(SWITCHBANK_PARAM, 0, 1, 0, "Switch bank"); 
 
 		configParam(ROTCW_PARAM, 0, 1, 0, "Rotate CW/Up"); 
@@ -443,21 +673,21 @@ struct Rainbow : core::PrismModule {
 
 			configParam(TRANS_PARAM + n, -12, 12, 0, "Semitone transpose"); 
 
-			vuMeters[n].mode = dsp::VuMeter2::RMS;
+			vuMeters[n].mode = dsp::VuMeter2::PEAK;
 			channelClipCnt[n] = 0;
 
 		}
 
 		lightDivider.setDivision(256);
+		buttonDivider.setDivision(BUTTON_DIVISION);
+
+		uiFrame = 0;
 
 		main.initialise();
 
 		rightExpander.producerMessage = pMessage;
 		rightExpander.consumerMessage = cMessage;
 
-		pMessage->updated = false;
-		cMessage->updated = false;
-
 		onSampleRateChange();
 
 	}
@@ -481,16 +711,76 @@ struct Rainbow : core::PrismModule {
 		main.initialise();
 	}
 
-	void toggleFreqblock(int id) {
-		main.io->FREQ_BLOCK.flip(id);
+	// Called from the GUI
+	void sendCommand(RainbowCommand::Type type, int value) {
+		RainbowCommand command;
+		command.type = type;
+		command.value = value;
+		unsentCommands.push_back(command);
+		flushCommands();
+	}
+
+	// Called from the GUI, a full queue is retried on the next step so no command is lost or reordered
+	void flushCommands() {
+		size_t sent = 0;
+		while (sent < unsentCommands.size() && commands.push(unsentCommands[sent])) {
+			sent++;
+		}
+		unsentCommands.erase(unsentCommands.begin(), unsentCommands.begin() + sent);
 	}
 
+	void processCommands() {
+		RainbowCommand command;
+		while (commands.pop(command)) {
+			switch (command.type) {
+				case RainbowCommand::TOGGLE_FREQBLOCK:
+					main.io->FREQ_BLOCK.flip(command.value);
+					break;
+				case RainbowCommand::SET_CPUMODE:
+					setCPUMode(command.value);
+					break;
+			}
+		}
+	}
+
+	uint32_t readButtons();
 	void process(const ProcessArgs &args) override;
+	void updateSwitchLights();
+	void updateInputLights();
+	void publishUIState();
+	void updateLEDs();
 
 };
 
+uint32_t Rainbow::readButtons() {
+
+	static const int buttonParams[NUM_BUTTONS] = {
+		ROTCW_PARAM,
+		ROTCCW_PARAM,
+		SCALECW_PARAM,
+		SCALECCW_PARAM,
+		LOCK135_PARAM,
+		LOCK246_PARAM,
+		SWITCHBANK_PARAM,
+		VOCTGLIDE_PARAM,
+		PREPOST_PARAM,
+		SCALEROT_PARAM,
+		LOCKON_PARAM + 0, LOCKON_PARAM + 1, LOCKON_PARAM + 2, LOCKON_PARAM + 3, LOCKON_PARAM + 4, LOCKON_PARAM + 5,
+		CHANNEL_Q_ON_PARAM + 0, CHANNEL_Q_ON_PARAM + 1, CHANNEL_Q_ON_PARAM + 2, CHANNEL_Q_ON_PARAM + 3, CHANNEL_Q_ON_PARAM + 4, CHANNEL_Q_ON_PARAM + 5
+	};
+
+	uint32_t buttons = 0;
+	for (int i = 0; i < NUM_BUTTONS; i++) {
+		buttons |= (uint32_t)(params[buttonParams[i]].getValue() > 0.5f) << i;
+	}
+	return buttons;
+
+}
+
 void Rainbow::process(const ProcessArgs &args) {
 
+	processCommands();
+
 	main.io->UI_UPDATE = false;
 
 	PrismModule::step();
@@ -504,11 +794,11 @@ void Rainbow::process(const ProcessArgs &args) {
 	if (rightExpander.module) {
 		if (rightExpander.module->model == modelRainbowScaleExpander) {
 			RainbowScaleExpanderMessage *cM = (RainbowScaleExpanderMessage*)rightExpander.consumerMessage;
-			if (cM->updated) {
-				for (int i = 0; i < NUM_BANKNOTES; i++) {
-					main.io->USERSCALE96[i] = cM->maxq96[i]; 
-					main.io->USERSCALE48[i] = cM->maxq48[i]; 
-				}
+			if (cM->userscale && cM->userscale->version > userScaleVersion) {
+				userScalePrev = userScale;
+				userScale = cM->userscale;
+				userScaleVersion = userScale->version;
+				main.io->USERSCALE = userScale.get();
 				main.io->USERSCALE_CHANGED = true;
 				main.io->READCOEFFS = true;
 			} 
@@ -521,6 +811,14 @@ void Rainbow::process(const ProcessArgs &args) {
 		highCPUModeChanged = false;
 	}
 
+	// Rising edges of all buttons in one go
+	uint32_t pressed = 0;
+	if (buttonDivider.process()) {
+		uint32_t buttons = readButtons();
+		pressed = (buttons ^ buttonState) & buttons;
+		buttonState = buttons;
+	}
+
 	if (rotCWTrigger.process(inputs[ROTCW_INPUT].getVoltage())) {
 		main.io->ROTUP_TRIGGER = true;
 	} else {
@@ -533,25 +831,25 @@ void Rainbow::process(const ProcessArgs &args) {
 		main.io->ROTDOWN_TRIGGER = false;
 	}
 
-	if (rotCWButtonTrigger.process(params[ROTCW_PARAM].getValue())) {
+	if (pressed & (1 << ROTCW_BUTTON)) {
 		main.io->ROTUP_BUTTON = true;
 	} else {
 		main.io->ROTUP_BUTTON = false;
 	}
 
-	if (rotCCWButtonTrigger.process(params[ROTCCW_PARAM].getValue())) {
+	if (pressed & (1 << ROTCCW_BUTTON)) {
 		main.io->ROTDOWN_BUTTON = true;
 	} else {
 		main.io->ROTDOWN_BUTTON = false;
 	}
 
-	if (scaleCWButtonTrigger.process(params[SCALECW_PARAM].getValue())) {
+	if (pressed & (1 << SCALECW_BUTTON)) {
 		main.io->SCALEUP_BUTTON = true;
 	} else {
 		main.io->SCALEUP_BUTTON = false;
 	}
 
-	if (scaleCCWButtonTrigger.process(params[SCALECCW_PARAM].getValue())) {
+	if (pressed & (1 << SCALECCW_BUTTON)) {
 		main.io->SCALEDOWN_BUTTON = true;
 	} else {
 		main.io->SCALEDOWN_BUTTON = false;
@@ -561,7 +859,7 @@ void Rainbow::process(const ProcessArgs &args) {
 	main.io->MOD246_SWITCH 		= (Mod246Setting)params[MOD246_PARAM].getValue();
 
 	if (lock135Trigger.process(inputs[LOCK135_INPUT].getVoltage()) ||
-		lock135ButtonTrigger.process(params[LOCK135_PARAM].getValue())) {
+		(pressed & (1 << LOCK135_BUTTON))) {
 
 		main.io->LOCK_ON[0] = !main.io->LOCK_ON[0];
 		
@@ -572,7 +870,7 @@ void Rainbow::process(const ProcessArgs &args) {
 	} 
 
 	if (lock246Trigger.process(inputs[LOCK246_INPUT].getVoltage()) ||
-		lock246ButtonTrigger.process(params[LOCK246_PARAM].getValue())) {
+		(pressed & (1 << LOCK246_BUTTON))) {
 		main.io->LOCK_ON[5] = !main.io->LOCK_ON[5];
 		
 		if (main.io->MOD246_SWITCH == Mod_246) {
@@ -583,12 +881,12 @@ void Rainbow::process(const ProcessArgs &args) {
 
 	for (int n = 0; n < 6; n++) {
 		// Process Locks
-		if (lockTriggers[n].process(params[LOCKON_PARAM + n].getValue())) {
+		if (pressed & (1 << (LOCKON_BUTTON + n))) {
 			main.io->LOCK_ON[n] = !main.io->LOCK_ON[n];
 		} 
 
 		// Process QLocks
-		if (qlockTriggers[n].process(params[CHANNEL_Q_ON_PARAM + n].getValue())) {
+		if (pressed & (1 << (CHANNEL_Q_ON_BUTTON + n))) {
 			main.io->CHANNEL_Q_ON[n] = !main.io->CHANNEL_Q_ON[n];
 		}
 	}
@@ -600,25 +898,13 @@ void Rainbow::process(const ProcessArgs &args) {
 	// Handle filter change
 	if (nextFilter != currFilter) {
 		currFilter = nextFilter;
-		if (nextFilter == Bpre && currBank == 19) {
-			params[BANK_PARAM].setValue(0);
-			currBank = 0;
-			nextBank = 0;
-			main.io->CHANGED_BANK = true;
-			main.io->NEW_BANK = nextBank;
-		}
 	}
 
 	// Handle bank switch press
-	if (changeBankTrigger.process(params[SWITCHBANK_PARAM].getValue())) {
-		if (main.io->FILTER_SWITCH == Bpre && nextBank == 19) {
-			main.io->CHANGED_BANK = false;
-			params[BANK_PARAM].setValue(currBank);
-		} else {
-			main.io->CHANGED_BANK = true;
-			main.io->NEW_BANK = nextBank;
-			currBank = nextBank;
-		}
+	if (pressed & (1 << SWITCHBANK_BUTTON)) {
+		main.io->CHANGED_BANK = true;
+		main.io->NEW_BANK = nextBank;
+		currBank = nextBank;
 	} else {
 		main.io->CHANGED_BANK = false;
 	}
@@ -675,15 +961,15 @@ void Rainbow::process(const ProcessArgs &args) {
 
 	main.io->ENV_SWITCH			= (EnvelopeMode)params[ENV_PARAM].getValue();
 
-	if (glissTrigger.process(params[VOCTGLIDE_PARAM].getValue())) {
+	if (pressed & (1 << VOCTGLIDE_BUTTON)) {
 		main.io->GLIDE_SWITCH = !main.io->GLIDE_SWITCH;
 	} 
 
-	if (prepostTrigger.process(params[PREPOST_PARAM].getValue())) {
+	if (pressed & (1 << PREPOST_BUTTON)) {
 		main.io->PREPOST_SWITCH = !main.io->PREPOST_SWITCH;
 	} 
 
-	if (scaleRotTrigger.process(params[SCALEROT_PARAM].getValue())) {
+	if (pressed & (1 << SCALEROT_BUTTON)) {
 		main.io->SCALEROT_SWITCH = !main.io->SCALEROT_SWITCH;
 	} 
 
@@ -723,123 +1009,194 @@ void Rainbow::process(const ProcessArgs &args) {
 		params[Rainbow::LEVEL_OUT_PARAM + n].setValue(main.io->OUTLEVEL[n]);
 	}
 
+	// Meter the block peaks once per filter block
+	if (main.io->METER_UPDATE) {
+		float blockTime = NUM_SAMPLES / (float)internalSampleRate;
+		for (int n = 0; n < 6; n++) {
+			vuMeters[n].process(blockTime, main.io->channelLevel[n]);
+		}
+		main.io->METER_UPDATE = false;
+	}
+
+	// Spread the UI work over the first samples of each UI frame rather than doing it all on one sample
+	switch (frameC) {
+		case 0:
+			updateSwitchLights();
+			break;
+		case 1:
+			updateInputLights();
+			break;
+		case 2:
+			publishUIState();
+			break;
+		default:
+			// A completed morph moves the ring, so show it straight away
+			if (main.io->FORCE_RING_UPDATE) {
+				publishUIState();
+			}
+			break;
+	}
+}
+
+void Rainbow::updateSwitchLights() {
+
+	// Set VCV LEDs
 	for (int n = 0; n < 6; n++) {
-		vuMeters[n].process(args.sampleTime, main.io->channelLevel[n]);
+		main.io->LOCK_ON[n] ? lights[LOCK_LIGHT + n].setBrightness(1.0f) : lights[LOCK_LIGHT + n].setBrightness(0.0f); 
+		main.io->CHANNEL_Q_ON[n] ? lights[QLOCK_LIGHT + n].setBrightness(1.0f) : lights[QLOCK_LIGHT + n].setBrightness(0.0f); 
 	}
 
-	if (main.io->UI_UPDATE) {
+}
 
-		// Set VCV LEDs
-		for (int n = 0; n < 6; n++) {
-			main.io->LOCK_ON[n] ? lights[LOCK_LIGHT + n].setBrightness(1.0f) : lights[LOCK_LIGHT + n].setBrightness(0.0f); 
-			main.io->CHANNEL_Q_ON[n] ? lights[QLOCK_LIGHT + n].setBrightness(1.0f) : lights[QLOCK_LIGHT + n].setBrightness(0.0f); 
-		}
+void Rainbow::updateInputLights() {
 
-		main.io->INPUT_CLIP ? lights[CLIP_LIGHT].setBrightness(1.0f) : lights[CLIP_LIGHT].setBrightness(0.0f); 
+	main.io->INPUT_CLIP ? lights[CLIP_LIGHT].setBrightness(1.0f) : lights[CLIP_LIGHT].setBrightness(0.0f); 
 
-		inputs[POLY_IN_INPUT].getChannels() ? lights[NOISE_LIGHT].setBrightness(0.0f) : lights[NOISE_LIGHT].setBrightness(1.0f); 
-		main.io->GLIDE_SWITCH ? lights[VOCTGLIDE_LIGHT].setBrightness(1.0f) : lights[VOCTGLIDE_LIGHT].setBrightness(0.0f); 
-		main.io->PREPOST_SWITCH ? lights[PREPOST_LIGHT].setBrightness(0.0f) : lights[PREPOST_LIGHT].setBrightness(1.0f); // Light on if PRE (inverted)
-		main.io->SCALEROT_SWITCH ? lights[SCALEROT_LIGHT].setBrightness(1.0f) : lights[SCALEROT_LIGHT].setBrightness(0.0f);
+	inputs[POLY_IN_INPUT].getChannels() ? lights[NOISE_LIGHT].setBrightness(0.0f) : lights[NOISE_LIGHT].setBrightness(1.0f); 
+	main.io->GLIDE_SWITCH ? lights[VOCTGLIDE_LIGHT].setBrightness(1.0f) : lights[VOCTGLIDE_LIGHT].setBrightness(0.0f); 
+	main.io->PREPOST_SWITCH ? lights[PREPOST_LIGHT].setBrightness(0.0f) : lights[PREPOST_LIGHT].setBrightness(1.0f); // Light on if PRE (inverted)
+	main.io->SCALEROT_SWITCH ? lights[SCALEROT_LIGHT].setBrightness(1.0f) : lights[SCALEROT_LIGHT].setBrightness(0.0f);
 
-		main.io->FREQCV1_CHAN > 1 ? lights[POLYCV1IN_LIGHT].setBrightness(1.0f) : lights[POLYCV1IN_LIGHT].setBrightness(0.0f); 
-		main.io->FREQCV6_CHAN > 1 ? lights[POLYCV6IN_LIGHT].setBrightness(1.0f) : lights[POLYCV6IN_LIGHT].setBrightness(0.0f); 
+	main.io->FREQCV1_CHAN > 1 ? lights[POLYCV1IN_LIGHT].setBrightness(1.0f) : lights[POLYCV1IN_LIGHT].setBrightness(0.0f); 
+	main.io->FREQCV6_CHAN > 1 ? lights[POLYCV6IN_LIGHT].setBrightness(1.0f) : lights[POLYCV6IN_LIGHT].setBrightness(0.0f); 
 
-		highCPUMode ? lights[CPUMODE_LIGHT].setBrightness(1.0f) : lights[CPUMODE_LIGHT].setBrightness(0.0f); 
+	highCPUMode ? lights[CPUMODE_LIGHT].setBrightness(1.0f) : lights[CPUMODE_LIGHT].setBrightness(0.0f); 
 
-		switch(audio.inputChannels) {
-			case 0:
-					lights[MONOIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT + 1].setBrightness(0.0f);
-					lights[POLYIN_LIGHT].setBrightness(0.0f);
-					break;
-			case 1:
-					lights[MONOIN_LIGHT].setBrightness(1.0f);
-					lights[OEIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT + 1].setBrightness(0.0f);
-					lights[POLYIN_LIGHT].setBrightness(0.0f);
-					break;
-			case 2:
-					lights[MONOIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT + 1].setBrightness(1.0f);
-					lights[POLYIN_LIGHT].setBrightness(0.0f);
-					break;
-			case 3:
-					lights[MONOIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT].setBrightness(1.0f);
-					lights[OEIN_LIGHT + 1].setBrightness(0.0f);
-					lights[POLYIN_LIGHT].setBrightness(0.0f);
-					break;
-			default:
-					lights[MONOIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT].setBrightness(0.0f);
-					lights[OEIN_LIGHT + 1].setBrightness(0.0f);
-					lights[POLYIN_LIGHT].setBrightness(1.0f);
-					break;
-		}
+	switch(audio.inputChannels) {
+		case 0:
+				lights[MONOIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT + 1].setBrightness(0.0f);
+				lights[POLYIN_LIGHT].setBrightness(0.0f);
+				break;
+		case 1:
+				lights[MONOIN_LIGHT].setBrightness(1.0f);
+				lights[OEIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT + 1].setBrightness(0.0f);
+				lights[POLYIN_LIGHT].setBrightness(0.0f);
+				break;
+		case 2:
+				lights[MONOIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT + 1].setBrightness(1.0f);
+				lights[POLYIN_LIGHT].setBrightness(0.0f);
+				break;
+		case 3:
+				lights[MONOIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT].setBrightness(1.0f);
+				lights[OEIN_LIGHT + 1].setBrightness(0.0f);
+				lights[POLYIN_LIGHT].setBrightness(0.0f);
+				break;
+		default:
+				lights[MONOIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT].setBrightness(0.0f);
+				lights[OEIN_LIGHT + 1].setBrightness(0.0f);
+				lights[POLYIN_LIGHT].setBrightness(1.0f);
+				break;
+	}
 
-		for (int i = 0; i < NUM_FILTS; i++) {
-			if (main.io->FREQ_BLOCK[i]) {
-				ringLEDs[i]->color 			= nvgRGBf(0.0f, 0.0f, 0.0f);
-				ringLEDs[i]->colorBorder 	= blockedBorder;
-			} else {
-				ringLEDs[i]->color = nvgRGBf(
-					main.io->ring[i][0], 
-					main.io->ring[i][1],
-					main.io->ring[i][2]);
-				ringLEDs[i]->colorBorder = defaultBorder;
-			}
+	if (lightDivider.process()) {
+		for (int i = 0; i < NUM_CHANNELS; i++) {
+			vuMeters[i].getBrightness(clipLimit, clipLimit) == 1.0f ? channelClipCnt[i]++ : channelClipCnt[i] = 0;
 		}
+	}
 
-		for (int i = 0; i < NUM_SCALES; i++) {
-			scaleLEDs[i]->color = nvgRGBf(
-				main.io->scale[i][0], 
-				main.io->scale[i][1],
-				main.io->scale[i][2]);
-			scaleLEDs[i]->colorBorder = defaultBorder;
-		}
+}
 
-		bool procVu = lightDivider.process();
-		for (int i = 0; i < NUM_CHANNELS; i++) {
+void Rainbow::publishUIState() {
 
-			if (procVu) {
-				vuMeters[i].getBrightness(clipLimit, clipLimit) == 1.0f ? channelClipCnt[i]++ : channelClipCnt[i] = 0;
-			}
+	main.io->FORCE_RING_UPDATE = false;
 
-			if (channelClipCnt[i] & 32) {
-				envelopeLEDs[i]->color = nvgRGBf(0.0f, 0.0f, 0.0f);
-				envelopeLEDs[i]->colorBorder = defaultBorder;
-			} else {
-				envelopeLEDs[i]->color = nvgRGBf(
-					main.io->envelope_leds[i][0], 
-					main.io->envelope_leds[i][1],
-					main.io->envelope_leds[i][2]);
-				envelopeLEDs[i]->colorBorder = defaultBorder;
-			}
+	// Same seqlock as Controller::populate_state, the GUI retries on the next frame if it sees a write
+	uint32_t seq = uiFrame.load(std::memory_order_relaxed);
+	uiFrame.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
 
-			qLEDs[i]->color = nvgRGBf(
-				main.io->q_leds[i][0], 
-				main.io->q_leds[i][1],
-				main.io->q_leds[i][2]);
-			qLEDs[i]->colorBorder = defaultBorder;
+	main.populate_ui_state(&uiState);
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+		uiState.env_clip[i] = channelClipCnt[i] & 32;
+	}
 
-			tuningLEDs[i]->color = nvgHSL(
-				main.io->tuning_out_leds[i][0], 
-				main.io->tuning_out_leds[i][1],
-				main.io->tuning_out_leds[i][2]);
-			tuningLEDs[i]->colorBorder = defaultBorder;
+	uiFrame.store(seq + 2, std::memory_order_release);
+}
+
+void Rainbow::updateLEDs() {
+
+	uint32_t frame = uiFrame.load(std::memory_order_acquire);
+	if (frame == uiFrameDrawn || (frame & 1)) {
+		return;
+	}
 
+	// Copy the snapshot out; if the audio thread started writing it meanwhile the copy may be torn,
+	// so skip it and pick up the next one
+	rainbow::UIState ui = uiState;
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (uiFrame.load(std::memory_order_relaxed) != frame) {
+		return;
+	}
+	uiFrameDrawn = frame;
+
+	main.ring->update_led_ring(ui);
+
+	for (int i = 0; i < NUM_FILTS; i++) {
+		if (ui.freqblock[i]) {
+			ringLEDs[i]->color 			= nvgRGBf(0.0f, 0.0f, 0.0f);
+			ringLEDs[i]->colorBorder 	= blockedBorder;
+		} else {
+			ringLEDs[i]->color = nvgRGBf(
+				main.ring->ring[i][0], 
+				main.ring->ring[i][1],
+				main.ring->ring[i][2]);
+			ringLEDs[i]->colorBorder = defaultBorder;
 		}
 	}
+
+	for (int i = 0; i < NUM_SCALES; i++) {
+		scaleLEDs[i]->color = nvgRGBf(
+			main.ring->scale[i][0], 
+			main.ring->scale[i][1],
+			main.ring->scale[i][2]);
+		scaleLEDs[i]->colorBorder = defaultBorder;
+	}
+
+	for (int i = 0; i < NUM_CHANNELS; i++) {
+
+		if (ui.env_clip[i]) {
+			envelopeLEDs[i]->color = nvgRGBf(0.0f, 0.0f, 0.0f);
+			envelopeLEDs[i]->colorBorder = defaultBorder;
+		} else {
+			envelopeLEDs[i]->color = nvgRGBf(
+				main.ring->envelope_leds[i][0], 
+				main.ring->envelope_leds[i][1],
+				main.ring->envelope_leds[i][2]);
+			envelopeLEDs[i]->colorBorder = defaultBorder;
+		}
+
+		qLEDs[i]->color = nvgRGBf(
+			main.ring->q_leds[i][0], 
+			main.ring->q_leds[i][1],
+			main.ring->q_leds[i][2]);
+		qLEDs[i]->colorBorder = defaultBorder;
+
+		tuningLEDs[i]->color = nvgHSL(
+			main.ring->tuning_out_leds[i][0], 
+			main.ring->tuning_out_leds[i][1],
+			main.ring->tuning_out_leds[i][2]);
+		tuningLEDs[i]->colorBorder = defaultBorder;
+
+	}
 }
 
-void LED::onButton(const event::Button &e) {
-	Widget::onButton(e);
+void LEDPanel::onButton(const event::Button &e) {
 	if (e.button == GLFW_MOUSE_BUTTON_LEFT && e.action == GLFW_PRESS) {
-		if (module) {
-			module->toggleFreqblock(id);
+		Vec pos = e.pos.plus(box.pos);
+		for (size_t i = 0; i < display->leds.size(); i++) {
+			LED *led = display->leds[i];
+			if (led->module && led->box.isContaining(pos)) {
+				led->module->sendCommand(RainbowCommand::TOGGLE_FREQBLOCK, led->id);
+				e.consume(this);
+				return;
+			}
 		}
 	} 
 }
@@ -848,7 +1205,10 @@ struct BankWidget : Widget {
 
 	std::shared_ptr<Font> font;
 	Rainbow *module = NULL;
-	ScaleSet scales;
+	const ScaleSet &scales = ScaleSet::get();
+	const ScaleLibrary &library = ScaleLibrary::get();
+	int prefetchedBank = -1;
+	NVGcolor libraryColor = nvgRGBf(1.0f, 1.0f, 1.0f);
 	NVGcolor colors[NUM_SCALEBANKS] = {
 
 		// Shades of Blue
@@ -886,6 +1246,40 @@ struct BankWidget : Widget {
 		font = APP->window->loadFont(asset::plugin(pluginInstance, "res/RobotoCondensed-Regular.ttf"));
 	}
 
+	NVGcolor bankColor(int bank) {
+		return bank < NUM_SCALEBANKS ? colors[bank] : libraryColor;
+	}
+
+	const char *bankName(int bank) {
+		return bank < NUM_SCALEBANKS ? scales.presets[bank]->name : library.name(bank - NUM_SCALEBANKS);
+	}
+
+	void step() override {
+
+		if (module) {
+
+			// Follow packs added to the library since the module was created
+			module->paramQuantities[Rainbow::BANK_PARAM]->maxValue = NUM_SCALEBANKS - 1 + library.size();
+
+			// A missing pack is reported until another bank is picked
+			if (module->nextBank != module->currBank) {
+				module->missingPack.clear();
+			}
+
+			// Start reading library banks in while the knob is on them, before the switch is pressed
+			if (module->nextBank != prefetchedBank) {
+				prefetchedBank = module->nextBank;
+				for (int i = -1; i <= 1; i++) {
+					library.prefetch(prefetchedBank + i - NUM_SCALEBANKS);
+				}
+			}
+
+		}
+
+		Widget::step();
+
+	}
+
 	void draw(const DrawArgs &ctx) override {
 
 		if (module == NULL) {
@@ -897,12 +1291,15 @@ struct BankWidget : Widget {
 
 		char text[128];
 
-		if (module->currBank == module->nextBank) {
-			nvgFillColor(ctx.vg, colors[module->currBank]);
-			snprintf(text, sizeof(text), "%s", scales.presets[module->currBank]->name.c_str());
+		if (!module->missingPack.empty()) {
+			nvgFillColor(ctx.vg, nvgRGBf(1.0f, 0.3f, 0.3f));
+			snprintf(text, sizeof(text), "%s missing", module->missingPack.c_str());
+		} else if (module->currBank == module->nextBank) {
+			nvgFillColor(ctx.vg, bankColor(module->currBank));
+			snprintf(text, sizeof(text), "%s", bankName(module->currBank));
 		} else {
-			nvgFillColor(ctx.vg, colors[module->nextBank]);
-			snprintf(text, sizeof(text), "%s*", scales.presets[module->nextBank]->name.c_str());
+			nvgFillColor(ctx.vg, bankColor(module->nextBank));
+			snprintf(text, sizeof(text), "%s*", bankName(module->nextBank));
 		}
 
 		nvgText(ctx.vg, 5, 13, text, NULL);
@@ -1066,6 +1463,8 @@ struct RainbowWidget : ModuleWidget {
 			bankW->box.size = Vec(80.0, 20.0f);
 			addChild(bankW);
 
+			LEDPanel *ledPanel = new LEDPanel;
+
 			float XStartL = 106.5;
 			float XStartR = 256.5 + 2.0;
 			float xDelta = 40.0;
@@ -1074,36 +1473,17 @@ struct RainbowWidget : ModuleWidget {
 			float yQ = 380.0 - 77.500 - 4.5;
 
 			for (int i = 0; i < 3; i++) {
-				module->qLEDs[i] = new LED(i, XStartL + i * xDelta, yQ);
-				module->qLEDs[i]->module = NULL;
-				addChild(module->qLEDs[i]);
-
-				module->envelopeLEDs[i] = new LED(i, XStartL + i * xDelta, yEnv);
-				module->envelopeLEDs[i]->module = NULL;
-				addChild(module->envelopeLEDs[i]);
-
-				module->tuningLEDs[i] = new LED(i, XStartL + i * xDelta, yVoct);
-				module->tuningLEDs[i]->module = NULL;
-				addChild(module->tuningLEDs[i]);
+				module->qLEDs[i] = ledPanel->addLED(new LED(i, XStartL + i * xDelta, yQ));
+				module->envelopeLEDs[i] = ledPanel->addLED(new LED(i, XStartL + i * xDelta, yEnv));
+				module->tuningLEDs[i] = ledPanel->addLED(new LED(i, XStartL + i * xDelta, yVoct));
 			}
 
 			for (int i = 3; i < 6; i++) {
-				module->qLEDs[i] = new LED(i, XStartR + (i - 3) * xDelta, yQ);
-				module->qLEDs[i]->module = NULL;
-				addChild(module->qLEDs[i]);
-
-				module->envelopeLEDs[i] = new LED(i, XStartR + (i - 3) * xDelta, yEnv);
-				module->envelopeLEDs[i]->module = NULL;
-				addChild(module->envelopeLEDs[i]);
-
-				module->tuningLEDs[i] = new LED(i, XStartR + (i - 3) * xDelta, yVoct);
-				module->tuningLEDs[i]->module = NULL;
-				addChild(module->tuningLEDs[i]);
+				module->qLEDs[i] = ledPanel->addLED(new LED(i, XStartR + (i - 3) * xDelta, yQ));
+				module->envelopeLEDs[i] = ledPanel->addLED(new LED(i, XStartR + (i - 3) * xDelta, yEnv));
+				module->tuningLEDs[i] = ledPanel->addLED(new LED(i, XStartR + (i - 3) * xDelta, yVoct));
 			}
 
-		}
-
-		if (module) {
 			Vec ringBox(Vec(429.258, 137.198 - 2.9));
 			float ringDiv = (core::PI * 2.0f) / NUM_FILTS;
 
@@ -1112,9 +1492,8 @@ struct RainbowWidget : ModuleWidget {
 				float xPos  = sin(core::PI - ringDiv * i) * 50.0f;
 				float yPos  = cos(core::PI - ringDiv * i) * 50.0f;
 
-				module->ringLEDs[i] = new LED(i, ringBox.x + 50 + xPos, ringBox.y + 50.0f + yPos);
+				module->ringLEDs[i] = ledPanel->addLED(new LED(i, ringBox.x + 50 + xPos, ringBox.y + 50.0f + yPos));
 				module->ringLEDs[i]->module = module;
-				addChild(module->ringLEDs[i]);
 			}
 
 			float scaleDiv = (core::PI * 2.0f) / NUM_SCALES;
@@ -1124,13 +1503,23 @@ struct RainbowWidget : ModuleWidget {
 				float xPos  = sin(core::PI - scaleDiv * i) * 30.0f;
 				float yPos  = cos(core::PI - scaleDiv * i) * 30.0f;
 
-				module->scaleLEDs[i] = new LED(i, ringBox.x + 50.0f + xPos, ringBox.y + 50.0f + yPos);
-				module->scaleLEDs[i]->module = NULL;
-				addChild(module->scaleLEDs[i]);
+				module->scaleLEDs[i] = ledPanel->addLED(new LED(i, ringBox.x + 50.0f + xPos, ringBox.y + 50.0f + yPos));
 			}
+
+			addChild(ledPanel);
 		}
 	}
 
+	void step() override {
+		Rainbow *rainbow = dynamic_cast<Rainbow*>(module);
+		if (rainbow) {
+			rainbow->flushCommands();
+			rainbow->updateLEDs();
+			rainbow->main.filter->user_bpre_designer.wake();
+		}
+		ModuleWidget::step();
+	}
+
 	void appendContextMenu(Menu *menu) override {
 
 		Rainbow *rainbow = dynamic_cast<Rainbow*>(module);
@@ -1140,7 +1529,7 @@ struct RainbowWidget : ModuleWidget {
 			Rainbow *module;
 			bool mode;
 			void onAction(const rack::event::Action &e) override {
-				module->setCPUMode(mode);
+				module->sendCommand(RainbowCommand::SET_CPUMODE, mode);
 			}
 		};
 
@@ -1161,11 +1550,31 @@ struct RainbowWidget : ModuleWidget {
 			}
 		};
 
+		struct CompactItem : MenuItem {
+			Rainbow *module;
+			void onAction(const rack::event::Action &e) override {
+				module->compactStorage ^= true;
+			}
+		};
+
+		struct RescanItem : MenuItem {
+			void onAction(const rack::event::Action &e) override {
+				scanScaleLibrary();
+			}
+		};
+
 		menu->addChild(construct<MenuLabel>());
 		CPUMenu *item = createMenuItem<CPUMenu>("CPU Mode");
 		item->module = rainbow;
 		menu->addChild(item);
 
+		CompactItem *compactItem = createMenuItem<CompactItem>("Compact user scale in patch", CHECKMARK(rainbow->compactStorage));
+		compactItem->module = rainbow;
+		menu->addChild(compactItem);
+
+		RescanItem *rescanItem = createMenuItem<RescanItem>("Rescan scale library", std::to_string(ScaleLibrary::get().size()) + " banks");
+		menu->addChild(rescanItem);
+
      }
 
 };
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <bitset>
 #include <cmath>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <inttypes.h>
 
@@ -10,6 +15,7 @@
 
 #include "dsp/noise.hpp"
 #include "scales/Scales.hpp"
+#include "scales/ScaleLibrary.hpp"
 
 //Number of components
 #define NUM_FILTS 20
@@ -84,10 +90,23 @@ enum EnvelopeMode {
 
 uint32_t diff(uint32_t a, uint32_t b);
 
-struct RainbowScaleExpanderMessage {
+// User scale coefficients sent by the Spectrum expander. A block is never changed once sent,
+// each transfer sends a new one, so the Rainbow can keep using it without copying.
+// Blocks are made and freed on the UI thread; the audio threads only copy and drop references.
+struct UserScaleBlock {
+	uint32_t version;
 	float maxq48[NUM_BANKNOTES];
 	float maxq96[NUM_BANKNOTES];
-	bool updated;
+};
+
+// Versions only ever increase, across all expanders, so an older block left in the other message buffer is never taken for a new one
+inline uint32_t nextUserScaleVersion(void) {
+	static std::atomic<uint32_t> version(0);
+	return ++version;
+}
+
+struct RainbowScaleExpanderMessage {
+	std::shared_ptr<const UserScaleBlock> userscale;
 };
 
 namespace rainbow {
@@ -105,6 +124,7 @@ struct Q;
 struct Tuning;
 struct Levels;
 struct State;
+struct UIState;
 
 struct Audio {
 
@@ -190,6 +210,63 @@ struct Envelope {
 
 };
 
+// BpRe tables for the user scale of one Filter, designed by the shared BpreDesignWorker so a new user scale
+// never stalls the audio thread. Triple buffered: the worker and the filter each own one buffer and swap it
+// with the shared latest slot, so neither ever touches the buffer the other one holds.
+struct BpreDesigner {
+
+	static const int INDEX_MASK = 3;
+	static const int FRESH = 4;		// Set in latest when the worker has swapped in tables the filter has not taken
+
+	BpreBank tables[3];
+	std::atomic<int> latest;		// Index of the newest finished tables, plus FRESH
+	int front = 0;					// Owned by the filter
+	int back = 2;					// Owned by the worker
+
+	float request[NUM_BANKNOTES];	// 96kHz MaxQ coefficients of the user scale
+	std::atomic<uint32_t> request_seq; // Odd while request is being written, only written by the audio thread
+	std::atomic<uint32_t> designed_seq;
+
+	BpreDesigner();
+	~BpreDesigner();
+
+	// Audio thread, does not block
+	void request_design(const float *c_maxq96000);
+	BpreBank *take_tables(void);
+
+	// UI thread, wakes the worker if a request is waiting
+	void wake(void);
+
+	// Worker thread
+	void design(void);
+
+};
+
+// One worker thread designs the BpRe tables of every Filter. It is started by the first request and
+// sleeps on a condition variable, which is only notified from the UI thread, so no wakeup is missed.
+struct BpreDesignWorker {
+
+	static BpreDesignWorker &get(void);
+
+	void add(BpreDesigner *designer);
+	void remove(BpreDesigner *designer);
+	void wake(void);
+
+private:
+	std::mutex mutex;				// Guards everything below, held while designing
+	std::condition_variable cv;
+	std::vector<BpreDesigner *> designers;
+	bool pending = false;
+	bool running = true;
+	std::thread worker;
+
+	BpreDesignWorker() {}
+	~BpreDesignWorker();
+
+	void run(void);
+
+};
+
 struct Filter {
 
 	Rotation *		rotation;
@@ -199,16 +276,21 @@ struct Filter {
 	IO *			io;
 	Levels *		levels;
 
-	ScaleSet scales;
+	const ScaleSet &scales = ScaleSet::get();
+	const ScaleLibrary &library = ScaleLibrary::get();	// Banks from NUM_SCALEBANKS on
+
+	BpreDesigner	user_bpre_designer;
+	BpreBank *		user_bpre = NULL;	// Tables designed for the user scale, NULL until the first are ready
+	std::atomic<bool> user_bpre_requested{false};	// Set from other threads, the audio thread then makes the request
 
 	//Filters
 	uint8_t note[NUM_CHANNELS];
 	uint8_t scale[NUM_CHANNELS];
-	uint8_t scale_bank[NUM_CHANNELS];
+	uint16_t scale_bank[NUM_CHANNELS];
 
 	// filter coefficients
 	float *c_hiq[NUM_CHANNELS];
-	float *c_loq[NUM_CHANNELS];
+	const BpreRecord *c_bpre[NUM_CHANNELS];
 
 	float *bpretuning[NUM_CHANNELS];
 
@@ -225,7 +307,34 @@ struct Filter {
 	float qval_a[NUM_CHANNELS]   = {0, 0, 0, 0, 0, 0};	
 	float qc[NUM_CHANNELS]   	 = {0, 0, 0, 0, 0, 0};
 
-	uint8_t old_scale_bank[NUM_CHANNELS] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+	uint16_t old_scale_bank[NUM_CHANNELS] = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+	const ScalePackBank *old_lib_bank[NUM_CHANNELS] = {NULL, NULL, NULL, NULL, NULL, NULL};
+
+	// Q-derived coefficients, cached per channel and only recomputed when qval changes
+	uint32_t q_cached[NUM_CHANNELS] = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX};
+	float q_c0[NUM_CHANNELS];				// Two-pass, second filter
+	float q_c0_a[NUM_CHANNELS];				// Two-pass, first filter
+	float q_c2[NUM_CHANNELS];				// c0 term of c2, second filter
+	float q_c2_a[NUM_CHANNELS];				// c0 term of c2, first filter
+	float q_ratio_a[NUM_CHANNELS];			// Two-pass crossfade
+	float q_ratio_b[NUM_CHANNELS];			// Two-pass crossfade, including calibration gain
+	float q_c0_onepass[NUM_CHANNELS];
+	float q_c2_onepass[NUM_CHANNELS];		// c0 term of c2
+	float q_c2_onepass_gain[NUM_CHANNELS];
+	float q_var_q[NUM_CHANNELS];			// BpRe lo/hi Q crossfade
+
+	// Resolved coefficients per filter slot (0-5 are the channels, 6-11 the morph destinations)
+	// Only recalculated when one of the inputs they were built from changes
+	bool coef_dirty[NUM_CHANNELS * 2] = {true, true, true, true, true, true, true, true, true, true, true, true};
+	uint8_t coef_note[NUM_CHANNELS * 2];
+	uint8_t coef_scale[NUM_CHANNELS * 2];
+	float coef_nudge[NUM_CHANNELS * 2];
+	float coef_shift[NUM_CHANNELS * 2];
+	uint32_t coef_qval[NUM_CHANNELS * 2];
+	float coef_c0[NUM_CHANNELS * 2];
+	float coef_c1[NUM_CHANNELS * 2];
+	float coef_c2[NUM_CHANNELS * 2];
+	float coef_c2_a[NUM_CHANNELS * 2];		// Two-pass, first filter
 
 	float CROSSFADE_POINT = 4095.0f * 2.0f / 3.0f;
 	float CROSSFADE_WIDTH = 1800.0f;
@@ -240,15 +349,25 @@ struct Filter {
 
 	bool filter_type_changed = false;
 
+	// User scale loaded from the patch or the default bank
 	float userscale_bank96[231];
 	float userscale_bank48[231];
 
+	// User scale in use: the arrays above, or the latest block sent by the expander
+	const float *userscale96 = userscale_bank96;
+	const float *userscale48 = userscale_bank48;
+
 	void configure(IO *_io, Rotation *_rotation, Envelope *_envelope, Q *_q, Tuning *_tuning, Levels *_levels);
 
 	void process_scale_bank(void);
+	void process_qval(uint8_t channel_num);
+	bool coefficients_changed(uint8_t slot, uint8_t channel_num, uint8_t filter_num, uint8_t scale_num);
+	void resolve_maxq(uint8_t slot, uint8_t channel_num, uint8_t filter_num, uint8_t scale_num);
+	void resolve_bpre(uint8_t slot, uint8_t channel_num, uint8_t filter_num, uint8_t scale_num);
 
 	void process_bank_change(void);
 	void process_user_scale_change(void);
+	bool process_user_bpre(void);
 
 	void filter_twopass();
 	void filter_onepass();
@@ -320,9 +439,8 @@ struct IO {
 
 	// Bank select
 	bool					CHANGED_BANK;
-	uint8_t					NEW_BANK;
-	float					USERSCALE96[NUM_BANKNOTES];
-	float					USERSCALE48[NUM_BANKNOTES];
+	uint16_t				NEW_BANK;
+	const UserScaleBlock *	USERSCALE = NULL;	// Owned by the Rainbow module, valid until the next one arrives
 	bool					USERSCALE_CHANGED = false;
 
 	//FREQ BLOCKS
@@ -339,15 +457,9 @@ struct IO {
 
 	// LEDS
 	bool					INPUT_CLIP;
-	
-	float					ring[NUM_FILTS][3];
-	float					scale[NUM_SCALES][3];
-
-	float					envelope_leds[NUM_CHANNELS][3];
-	float					q_leds[NUM_CHANNELS][3];
-	float					tuning_out_leds[NUM_CHANNELS][3];
 
-	float					channelLevel[NUM_CHANNELS]; // 0.0 - 1+, 1 = Clipping
+	float					channelLevel[NUM_CHANNELS]; // Block peak, 0.0 - 1+, 1 = Clipping
+	bool					METER_UPDATE = false;		// Set when a block has been processed and channelLevel is new
 
 	bool					FORCE_RING_UPDATE = true;
  
@@ -355,14 +467,17 @@ struct IO {
 
 };
 
+// Derives the LED colours from a UIState snapshot, runs on the GUI thread
 struct LEDRing {
 
-	Rotation *		rotation;
 	Envelope *		envelope;
-	IO *			io;
-	Filter *		filter;
-	Q *				q;
 
+	float			ring[NUM_FILTS][3];
+	float			scale[NUM_SCALES][3];
+
+	float			envelope_leds[NUM_CHANNELS][3];
+	float			q_leds[NUM_CHANNELS][3];
+	float			tuning_out_leds[NUM_CHANNELS][3];
 
 	const float sqrt2over2			= sqrt(2.0f) / 2.0f;
 	const float sqrt2				= sqrt(2.0f);
@@ -384,12 +499,12 @@ struct LEDRing {
 		{255.0f/255.0f,	 100.0f/255.0f,  255.0f/255.0f}, // Magenta
 		};
 
-	void configure(IO *_io, Rotation *_rotation, Envelope *_envelope, Filter *_filter, Q *_q);
+	void configure(Envelope *_envelope);
 
-	void display_filter_rotation();
-	void display_scale();
-	void update_led_ring();
-	void calculate_envout_leds();
+	void display_filter_rotation(const UIState &ui);
+	void display_scale(const UIState &ui);
+	void update_led_ring(const UIState &ui);
+	void calculate_envout_leds(const UIState &ui);
 
 };
 
@@ -461,10 +576,17 @@ struct Controller {
 	Inputs *		input;  
 	State *			state;
 
+	// Seqlock over *state, odd while the audio thread is writing it
+	std::atomic<uint32_t> state_seq;
+	bool state_dirty = true;
+
 	Controller();  
+	~Controller();
 	void set_default_param_values(void);
 	void load_from_state(void);
 	void populate_state(void);
+	void snapshot_state(State *copy);
+	void populate_ui_state(UIState *ui);
 
 	void initialise(void);
 	void prepare(void);
@@ -491,8 +613,12 @@ struct Rotation {
 	int8_t motion_scalecv_overage[NUM_CHANNELS]		= {0, 0, 0, 0, 0, 0};
 
 	float motion_morphpos[NUM_CHANNELS]				= {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+	float motion_morph_start[NUM_CHANNELS]			= {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}; // Morph position at the start of the current block
+	float motion_morph_inc[NUM_CHANNELS]			= {0.0, 0.0, 0.0, 0.0, 0.0, 0.0}; // Per-sample morph increment for the current block
 
-	float f_morph									= 0.0;
+	float f_morph									= 0.0; // Per-sample morph increment
+	float MORPH_RATE								= 187.5f; // exp_4096() scaling to morph increments per second
+	float MORPH_LPF_TIME							= 0.333f; // Time constant of the morph knob smoothing, in seconds
 
 	int8_t spread									= 0;	
 	int8_t old_spread								= 1;
@@ -587,6 +713,7 @@ struct Levels {
 
 	//CHANNEL LEVELS/SLEW
 	float channel_level[NUM_CHANNELS] = {0, 0, 0, 0, 0, 0};
+	float block_level[NUM_CHANNELS]		= {0, 0, 0, 0, 0, 0}; // Level at the end of the last audio block, start of the next ramp
 
 	float CHANNEL_LEVEL_MIN_LPF			= 0.75f;
 	float channel_level_lpf				= CHANNEL_LEVEL_MIN_LPF;
@@ -617,13 +744,36 @@ struct State {
 
 	uint8_t note[NUM_CHANNELS];
 	uint8_t scale[NUM_CHANNELS];
-	uint8_t scale_bank[NUM_CHANNELS];
+	uint16_t scale_bank[NUM_CHANNELS];
 	float userscale96[NUM_BANKNOTES];
 	float userscale48[NUM_BANKNOTES];
 
+	bool gliss;
+	bool prepost;
+	bool scalerot;
+	bool lock_on[NUM_CHANNELS];
+	bool q_on[NUM_CHANNELS];
+	std::bitset<20> freqblock;
+
 	FilterTypes filter_type;
 	FilterModes filter_mode;
 
 };
 
+// Compact copy of the engine state needed to light the LEDs, published by the audio thread once per UI frame
+struct UIState {
+
+	uint8_t note[NUM_CHANNELS];
+	int8_t fadeto_note[NUM_CHANNELS];
+	int8_t scale_dest[NUM_CHANNELS];
+	float morphpos[NUM_CHANNELS];
+	float env_out[NUM_CHANNELS];
+	float voct_out[NUM_CHANNELS];
+	float qval[NUM_CHANNELS];
+	bool lock_on[NUM_CHANNELS];
+	bool env_clip[NUM_CHANNELS];
+	std::bitset<20> freqblock;
+
+};
+
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <iostream>
 #include <fstream>
 #include <cctype>
+#include <cstring>
 #include <osdialog.h>
 
 #include "common.hpp"
@@ -17,210 +18,12 @@
 #include "Common.hpp"
 #include "Rainbow.hpp"
 #include "scales/Scales.hpp"
+#include "scales/ScalePack.hpp"
+#include "scales/Scala.hpp"
+#include "scales/ScalaIndex.hpp"
 
 #include "dsp/noise.hpp"
 
-extern float exp_1voct[4096];
-
-// trim from start (in place)
-static inline void ltrim(std::string &s) {
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](int ch) {
-        return !std::isspace(ch);
-    }));
-}
-
-// trim from end (in place)
-static inline void rtrim(std::string &s) {
-    s.erase(std::find_if(s.rbegin(), s.rend(), [](int ch) {
-        return !std::isspace(ch);
-    }).base(), s.end());
-}
-
-// trim from both ends (in place)
-static inline void trim(std::string &s) {
-    ltrim(s);
-    rtrim(s);
-}
-
-// trim from start (copying)
-static inline std::string ltrim_copy(std::string s) {
-    ltrim(s);
-    return s;
-}
-
-// trim from end (copying)
-static inline std::string rtrim_copy(std::string s) {
-    rtrim(s);
-    return s;
-}
-
-template <class Container>
-void split(const std::string& str, Container& cont, char delim = ' ') {
-    std::stringstream ss(str);
-    std::string token;
-    while (std::getline(ss, token, delim)) {
-        cont.push_back(token);
-    }
-}
-
-struct ScalaDef {
-	int upper;
-	int lower;
-	float cents;
-	std::string description;
-	bool isRatio;
-};
-
-struct ScalaFile {
-	std::vector<ScalaDef *> notes;
-	std::string description;
-	bool isValid;
-	std::string lastError;
-
-	ScalaDef *parseNote(std::string text) {
-
-		if (text.find('/') != std::string::npos) {
-
-			std::vector<std::string> ratios;
-			split<std::vector<std::string>>(text,ratios,'/');
-			if (ratios.size() != 2) {
-				lastError = "Invalid ratio " + text;
-				return NULL;
-			}
-
-			ScalaDef *d = new ScalaDef();
-
-			try {
-				d->upper = std::stoi(ratios[0]);
-				d->lower = std::stoi(ratios[1]);
-			} catch (std::exception &e) {
-				lastError = "Cannot convert " + text + " to integer";
-				return NULL;
-			}
-
-			d->isRatio = true;
-			return d;
-
-		} else if (text.find_first_of('.') != std::string::npos) {
-
-			ScalaDef *d = new ScalaDef();
-			try {
-				d->cents = std::stof(text);
-			} catch (std::exception &e) {
-				lastError = "Cannot convert " + text + " to float";
-				return NULL;
-			}
-
-			d->isRatio = false;
-			return d;
-
-		} else {
-
-			ScalaDef *d = new ScalaDef();
-
-			try {
-				d->upper = std::stoi(text);
-				d->lower = 1;
-			} catch (std::exception &e) {
-				lastError = "Cannot convert " + text + " to integer";
-				return NULL;
-			}
-
-			d->isRatio = true;
-			return d;
-
-		}
-
-		lastError = "Unknown error";
-		return NULL;
-
-	}
-
-	bool load(const char *path) {
-
-		bool readNumNotes = false;
-		bool readDescription = false;
-		
-		unsigned int nNotes = 0;
-
-		std::string line;
-		std::ifstream file(path);
-		if (!file.is_open()) {
-			lastError = "Could not load Scala file '" + std::string(path) + "'";
-			return false;
-		}
-		DEFER({
-		    file.close();
-		});
-
-		reset();
-
-		bool failed = false;
-
-		while (std::getline(file,line)) {
-
-			trim(line);
-
-			if (line[0] == '!') {
-				continue;
-			}
-			if (!readDescription) {
-				description = line;
-				readDescription = true;
-				continue;
-			}
-			if (!readNumNotes) {
-				try {
-					nNotes = std::stoi(line);
-				} catch (std::exception &e) {
-					lastError = "Invalid number of notes '" + line + "'";
-					return false;
-				}
-				readNumNotes = true;
-				continue;
-			}
-
-			std::vector<std::string> tokens;
-			split<std::vector<std::string>>(line,tokens);
-
-			ScalaDef *n = parseNote(tokens[0]);
-			n->description = line;
-			if (n != NULL) {
-				notes.push_back(n);
-			} else {
-				lastError = "Failed to parse line '" + tokens[0] + "'";
-				failed = true;
-			}
-
-    	}
-
-		if (notes.size() != nNotes) {
-			lastError = "Number of notes " + std::to_string(notes.size()) + " found does not match declared value of " + std::to_string(nNotes);
-			failed = true;
-		}
-
-		if (failed) {
-			WARN("Loading Scala file failed");
-			reset();
-			return false;
-		}
-
-    	file.close();
-		isValid = true;
-		return true;
-	}
-
-	void reset () {
-		isValid = false;
-		for (unsigned int i = 0; i < notes.size(); i++) {
-			delete notes[i];
-		}
-		notes.clear();
-	}
-
-};
-
-
 using namespace prism;
 
 struct RainbowScaleExpander : core::PrismModule {
@@ -259,6 +62,8 @@ struct RainbowScaleExpander : core::PrismModule {
 
 	int stackMode = 0;
 
+	bool compactStorage = true; // Save the frequencies as a base64 blob rather than a JSON array
+
 	const static int NUM_PAGES = 3;
 
 	float minFreq = 13.75f; 	// A0
@@ -294,9 +99,15 @@ struct RainbowScaleExpander : core::PrismModule {
 	std::string scalename[11];
 	std::string notedesc[231];
 
-    ScaleSet scales;
+	const ScaleSet &scales = ScaleSet::get();
+
+	std::shared_ptr<const ScalaScale> scala;	// Last Scala file loaded, only used from the UI thread
+	ScalaLoader scalaLoader;
 
-	ScalaFile scala;
+	std::string scalaDir;		// Folder of Scala files indexed for the context menu
+	std::string scalaQuery;		// Search text of the Scala library menu
+
+	ScalePack pack;
 
 	json_t *dataToJson() override {
 
@@ -326,21 +137,41 @@ struct RainbowScaleExpander : core::PrismModule {
 		}
 		json_object_set_new(rootJ, "scalename",	scalename_array);
 
+		// compact
+		json_t *compactJ = json_boolean(compactStorage);
+		json_object_set_new(rootJ, "compact", compactJ);
+
+		// scaladir
+		json_t *scaladirJ = json_string(scalaDir.c_str());
+		json_object_set_new(rootJ, "scaladir", scaladirJ);
+
 		// frequency
-		json_t *frequency_array = json_array();
-		for (int i = 0; i < NUM_BANKNOTES; i++) {
-			json_t *frequencyJ = json_real(currFreqs[i]);
-			json_array_append_new(frequency_array, frequencyJ);
+		if (compactStorage) {
+			json_t *frequencyJ = core::floatsToJson(currFreqs, NUM_BANKNOTES);
+			json_object_set_new(rootJ, "frequencyblob", frequencyJ);
+		} else {
+			json_t *frequency_array = json_array();
+			for (int i = 0; i < NUM_BANKNOTES; i++) {
+				json_t *frequencyJ = json_real(currFreqs[i]);
+				json_array_append_new(frequency_array, frequencyJ);
+			}
+			json_object_set_new(rootJ, "frequency",	frequency_array);
 		}
-		json_object_set_new(rootJ, "frequency",	frequency_array);
 
-		// notedesc
-		json_t *notedesc_array = json_array();
+		// notedesc, in compact form left out when every description is empty
+		bool hasNotedesc = false;
 		for (int i = 0; i < NUM_BANKNOTES; i++) {
-			json_t *notedescJ = json_string(notedesc[i].c_str());
-			json_array_append_new(notedesc_array, notedescJ);
+			hasNotedesc |= !notedesc[i].empty();
+		}
+
+		if (hasNotedesc || !compactStorage) {
+			json_t *notedesc_array = json_array();
+			for (int i = 0; i < NUM_BANKNOTES; i++) {
+				json_t *notedescJ = json_string(notedesc[i].c_str());
+				json_array_append_new(notedesc_array, notedescJ);
+			}
+			json_object_set_new(rootJ, "notedesc",	notedesc_array);
 		}
-		json_object_set_new(rootJ, "notedesc",	notedesc_array);
 
         return rootJ;
     }
@@ -367,20 +198,38 @@ struct RainbowScaleExpander : core::PrismModule {
 		if (descriptionJ)
 			description = json_string_value(descriptionJ);
 
+		// compact
+		json_t *compactJ = json_object_get(rootJ, "compact");
+		if (compactJ)
+			compactStorage = json_boolean_value(compactJ);
+
+		// scaladir
+		json_t *scaladirJ = json_object_get(rootJ, "scaladir");
+		if (json_is_string(scaladirJ))
+			scalaDir = json_string_value(scaladirJ);
+
 		// frequency
+		float freqs[NUM_BANKNOTES];
+		bool freqsLoaded = core::floatsFromJson(json_object_get(rootJ, "frequencyblob"), freqs, NUM_BANKNOTES);
+
 		json_t *frequency_array = json_object_get(rootJ, "frequency");
-		if (frequency_array) {
+		if (!freqsLoaded && frequency_array) {
 			for (int i = 0; i < NUM_BANKNOTES; i++) {
 				json_t *frequencyJ = json_array_get(frequency_array, i);
-				if (frequencyJ) {
-					float f = json_real_value(frequencyJ);
-					if (f < minFreq || f > maxFreq) {
-						currFreqs[i] = clamp(f, minFreq, maxFreq);
-						currState[i] = EDITED;
-					} else {
-						currFreqs[i] = f;
-						currState[i] = FRESH;
-					}
+				freqs[i] = frequencyJ ? json_real_value(frequencyJ) : currFreqs[i];
+			}
+			freqsLoaded = true;
+		}
+
+		if (freqsLoaded) {
+			for (int i = 0; i < NUM_BANKNOTES; i++) {
+				float f = freqs[i];
+				if (f < minFreq || f > maxFreq) {
+					currFreqs[i] = clamp(f, minFreq, maxFreq);
+					currState[i] = EDITED;
+				} else {
+					currFreqs[i] = f;
+					currState[i] = FRESH;
 				}
 			}
 		}
@@ -416,7 +265,7 @@ struct RainbowScaleExpander : core::PrismModule {
 		scala.reset();
 
 		for (int j = 0; j < NUM_BANKNOTES; j++) {
-			currFreqs[j] = scales.presets[NUM_SCALEBANKS - 1]->c_maxq96000[j] * CtoF96;
+			currFreqs[j] = scales.presets[NUM_SCALEBANKS - 1]->freq[j];
 			currState[j] = FRESH;
 			notedesc[j] = "";
 		}
@@ -575,6 +424,16 @@ struct RainbowScaleExpander : core::PrismModule {
 	}
 
 	rack::dsp::SchmittTrigger transferTrigger;
+
+	// Transfer handoff: the audio thread asks for a block, the widget builds it on the UI thread and the
+	// audio thread sends it. outgoing is only written by the UI thread once the previous one was taken
+	std::atomic<bool> transferRequested{false};
+	std::shared_ptr<const UserScaleBlock> outgoing;
+	std::atomic<uint32_t> outgoingVersion{0};
+	std::atomic<uint32_t> takenVersion{0};
+
+	// Every block sent, so the last reference is always dropped here on the UI thread
+	std::vector<std::shared_ptr<const UserScaleBlock>> sentBlocks;
 	rack::dsp::SchmittTrigger loadBankTrigger;
 	rack::dsp::SchmittTrigger executeTrigger;
 
@@ -948,6 +807,10 @@ struct RainbowScaleExpander : core::PrismModule {
 
 	void applyScale() {
 
+		if (!scala) {
+			return;
+		}
+
 		float f0;
 
 		float f			= params[PARAMETER_PARAM + 0].getValue();
@@ -984,14 +847,9 @@ struct RainbowScaleExpander : core::PrismModule {
 
 		while (currPosinBank < maxSlot) {
 
-			ScalaDef *note = scala.notes[scalaPos];
+			const ScalaNote &note = scala->notes[scalaPos];
 			float freq;
-			float delta;
-			if (note->isRatio) {
-				delta = (float)note->upper / (float)note->lower;
-			} else {
-				delta = pow(2.0f, note->cents / 1200.0f);
-			}
+			float delta = note.ratio();
 
 			freq = f0 * delta;
 			if (freq > maxFreq) {
@@ -1000,22 +858,98 @@ struct RainbowScaleExpander : core::PrismModule {
 
 			currFreqs[currPosinBank] = freq;
 			currState[currPosinBank] = EDITED;
-			notedesc[currPosinBank] = note->description;
+			notedesc[currPosinBank] = note.description;
 
 			int scale = currPosinBank / 21;
-		 	scalename[scale] = string::filename(path) + ", Page " + std::to_string(scale + 1);
+		 	scalename[scale] = string::filename(scala->path) + ", Page " + std::to_string(scale + 1);
 
 			currPosinBank++;
 
 			// Wrap
-			if (++scalaPos == scala.notes.size()) {
+			if (++scalaPos == scala->notes.size()) {
 				f0 *= delta;
 				scalaPos = 0;
 			} 
 
 		}
 
-		description = scala.description;
+		description = scala->description;
+
+	}
+
+	// Copies a bank of the open scale pack into the editor
+	void loadPackBank(int index) {
+
+		const ScalePackBank *bank = pack.bank(index);
+		if (bank == NULL) {
+			return;
+		}
+
+		name = pack.string(bank->name);
+		description = pack.string(bank->description);
+
+		for (int i = 0; i < NUM_BANKNOTES; i++) {
+			float f = bank->freq[i];
+			currFreqs[i] = clamp(f, minFreq, maxFreq);
+			currState[i] = FRESH;
+			notedesc[i] = pack.string(bank->notedesc[i]);
+		}
+
+		for (int i = 0; i < NUM_SCALES; i++) {
+			scalename[i] = pack.string(bank->scalename[i]);
+		}
+
+	}
+
+	// Appends the bank being edited to a scale pack, creating the pack if needed
+	bool addBankToPack(const char *packPath, std::string *error) {
+
+		std::vector<ScalePackSource> banks;
+
+		// The pack is rewritten, so let go of our mapping if it is the same file
+		bool reopen = pack.isOpen() && pack.path == packPath;
+		if (reopen) {
+			pack.close();
+		}
+
+		ScalePack existing;
+		if (existing.open(packPath)) {
+			banks.resize(existing.size() + 1);
+			for (int b = 0; b < existing.size(); b++) {
+				const ScalePackBank *bank = existing.bank(b);
+				banks[b].name = existing.string(bank->name);
+				banks[b].description = existing.string(bank->description);
+				for (int i = 0; i < NUM_SCALES; i++) {
+					banks[b].scalename[i] = existing.string(bank->scalename[i]);
+				}
+				for (int i = 0; i < NUM_BANKNOTES; i++) {
+					banks[b].notedesc[i] = existing.string(bank->notedesc[i]);
+					banks[b].freq[i] = bank->freq[i];
+				}
+			}
+			existing.close();
+		} else {
+			banks.resize(1);
+		}
+
+		ScalePackSource &src = banks.back();
+		src.name = name;
+		src.description = description;
+		for (int i = 0; i < NUM_SCALES; i++) {
+			src.scalename[i] = scalename[i];
+		}
+		for (int i = 0; i < NUM_BANKNOTES; i++) {
+			src.notedesc[i] = notedesc[i];
+			src.freq[i] = currFreqs[i];
+		}
+
+		bool ok = write_scale_pack(packPath, banks, error);
+
+		if (reopen) {
+			pack.open(packPath);
+		}
+
+		return ok;
 
 	}
 
@@ -1034,7 +968,7 @@ struct RainbowScaleExpander : core::PrismModule {
 			description = scales.full[bank]->description;
 
 			for (int i = 0; i < NUM_BANKNOTES; i++) {
-				currFreqs[i] = scales.full[bank]->c_maxq96000[i] * CtoF96;
+				currFreqs[i] = scales.full[bank]->freq[i];
 				currState[i] = FRESH;
 				notedesc[i] = scales.full[bank]->notedesc[i];
 			}
@@ -1093,19 +1027,51 @@ struct RainbowScaleExpander : core::PrismModule {
 				RainbowScaleExpanderMessage *pM = (RainbowScaleExpanderMessage*)leftExpander.module->rightExpander.producerMessage;
 				if (transferTrigger.process(params[TRANSFER_PARAM].getValue())) {
 					for (int i = 0; i < NUM_BANKNOTES; i++) {
-						pM->maxq96[i] = currFreqs[i] * FtoC96;
-						pM->maxq48[i] = currFreqs[i] * FtoC48;
 						currState[i] = LOADED;
 					}
-					pM->updated = true;
-				} else {
-					pM->updated = false;
+					transferRequested.store(true, std::memory_order_release);
+				}
+				uint32_t version = outgoingVersion.load(std::memory_order_acquire);
+				if (version != takenVersion.load(std::memory_order_relaxed)) {
+					pM->userscale = outgoing;	// The block replaced is still held in sentBlocks, so nothing is freed here
+					takenVersion.store(version, std::memory_order_release);
+					leftExpander.module->rightExpander.messageFlipRequested = true;
 				}
-				leftExpander.module->rightExpander.messageFlipRequested = true;
 			}
 		}
 	}
 
+	// UI thread. Builds the block asked for by a transfer and frees blocks no one else holds any more
+	void prepareTransfer(void) {
+
+		for (size_t i = 0; i + 1 < sentBlocks.size(); ) {
+			if (sentBlocks[i].use_count() == 1) {
+				sentBlocks.erase(sentBlocks.begin() + i);
+			} else {
+				i++;
+			}
+		}
+
+		if (outgoingVersion.load(std::memory_order_relaxed) != takenVersion.load(std::memory_order_acquire)) {
+			return; // Previous block not taken yet, try again next frame
+		}
+		if (!transferRequested.exchange(false, std::memory_order_acquire)) {
+			return;
+		}
+
+		std::shared_ptr<UserScaleBlock> block = std::make_shared<UserScaleBlock>();
+		block->version = nextUserScaleVersion();
+		for (int i = 0; i < NUM_BANKNOTES; i++) {
+			block->maxq96[i] = currFreqs[i] * FtoC96;
+			block->maxq48[i] = currFreqs[i] * FtoC48;
+		}
+
+		sentBlocks.push_back(block);
+		outgoing = block;
+		outgoingVersion.store(block->version, std::memory_order_release);
+
+	}
+
 	void moveNote(void) {
 		int note = params[SLOT_PARAM].getValue();
 		if (note < NUM_SCALENOTES - 1) {
@@ -1115,9 +1081,100 @@ struct RainbowScaleExpander : core::PrismModule {
 
 };
 
+// Copy of the expander state the bank display is drawn from, so the display is only re-rendered when it changes
+struct BankView {
+
+	float freqs[NUM_BANKNOTES] = {};
+	int state[NUM_BANKNOTES] = {};
+	float plotX[NUM_BANKNOTES] = {};
+
+	int scale = -1;
+	int note = -1;
+	int page = -1;
+
+	std::string name;
+	std::string scalename;
+	std::string notedesc[NUM_SCALENOTES];
+
+	float plotWidth = 0.0f;
+	float minFreq = 1.0f;
+	float maxFreq = 1.0f;
+
+	// Returns true if anything visible has changed since the last call
+	bool update(RainbowScaleExpander *module) {
+
+		bool changed = false;
+
+		if (memcmp(freqs, module->currFreqs, sizeof(freqs)) != 0) {
+			memcpy(freqs, module->currFreqs, sizeof(freqs));
+			updatePlot();
+			changed = true;
+		}
+
+		if (memcmp(state, module->currState, sizeof(state)) != 0) {
+			memcpy(state, module->currState, sizeof(state));
+			changed = true;
+		}
+
+		if (scale != module->currScale || note != module->currNote || page != module->currPage) {
+			scale = module->currScale;
+			note = module->currNote;
+			page = module->currPage;
+			changed = true;
+		}
+
+		if (name != module->name) {
+			name = module->name;
+			changed = true;
+		}
+
+		if (scalename != module->scalename[scale]) {
+			scalename = module->scalename[scale];
+			changed = true;
+		}
+
+		for (int i = 0; i < NUM_SCALENOTES; i++) {
+			int index = i + scale * NUM_SCALENOTES;
+			if (notedesc[i] != module->notedesc[index]) {
+				notedesc[i] = module->notedesc[index];
+				changed = true;
+			}
+		}
+
+		return changed;
+
+	}
+
+	// Positions of all notes on a log-frequency axis
+	void updatePlot(void) {
+		float octaves = log2f(maxFreq / minFreq);
+		for (int i = 0; i < NUM_BANKNOTES; i++) {
+			if (freqs[i] > 0.0f) {
+				plotX[i] = clamp(log2f(freqs[i] / minFreq) / octaves, 0.0f, 1.0f) * plotWidth;
+			} else {
+				plotX[i] = -1.0f;
+			}
+		}
+	}
+
+};
+
+static NVGcolor slotColour(int state) {
+	switch(state) {
+		case RainbowScaleExpander::LOADED:
+			return nvgRGBA(0x80, 0xFF, 0x80, 0xFF);
+		case RainbowScaleExpander::EDITED:
+			return nvgRGBA(0x80, 0x80, 0xFF, 0xFF);
+		case RainbowScaleExpander::FRESH:
+			return nvgRGBA(0x80, 0xFF, 0xFF, 0xFF);
+		default:
+			return nvgRGBA(0xFF, 0x80, 0x80, 0xFF);
+	}
+}
+
 struct FrequencyDisplay : TransparentWidget {
 	
-	RainbowScaleExpander *module;
+	BankView *view;
 	std::shared_ptr<Font> font;
 	
 	FrequencyDisplay() {
@@ -1126,24 +1183,16 @@ struct FrequencyDisplay : TransparentWidget {
 
 	void draw(const DrawArgs &ctx) override {
 
-		if (module == NULL) {
-			return;		
-		}
-
-		if (!module->stepX % 60 != 0) {
-			return;
-		}
-
 		nvgFontSize(ctx.vg, 14);
 		nvgFontFaceId(ctx.vg, font->handle);
 		nvgTextLetterSpacing(ctx.vg, -1);
 
 		char text[128];
 
-		snprintf(text, sizeof(text), "Bank: %s", module->name.c_str());
-		nvgText(ctx.vg, box.pos.x + 7, box.pos.y + 0, text, NULL);
+		snprintf(text, sizeof(text), "Bank: %s", view->name.c_str());
+		nvgText(ctx.vg, 7, 0, text, NULL);
 
-		switch(module->currPage) {
+		switch(view->page) {
 			case 0:
 				snprintf(text, sizeof(text), "Mode: Frequency");
 				break;
@@ -1155,56 +1204,138 @@ struct FrequencyDisplay : TransparentWidget {
 				break;
 
 		}
-		nvgText(ctx.vg, box.pos.x + 120, box.pos.y + 0, text, NULL);
+		nvgText(ctx.vg, 120, 0, text, NULL);
 
-		snprintf(text, sizeof(text), "Scale: %s", module->scalename[module->currScale].c_str());
-		nvgText(ctx.vg, box.pos.x + 7, box.pos.y + 15, text, NULL);
+		snprintf(text, sizeof(text), "Scale: %s", view->scalename.c_str());
+		nvgText(ctx.vg, 7, 15, text, NULL);
 
 		for (int i = 0; i < NUM_SCALENOTES; i++) {
-			int index = i + module->currScale * NUM_SCALENOTES;
-
-			switch(module->currState[index]) {
-				case RainbowScaleExpander::LOADED:
-					nvgFillColor(ctx.vg, nvgRGBA(0x80, 0xFF, 0x80, 0xFF));
-					break;
-				case RainbowScaleExpander::EDITED:
-					nvgFillColor(ctx.vg, nvgRGBA(0x80, 0x80, 0xFF, 0xFF));
-					break;
-				case RainbowScaleExpander::FRESH:
-					nvgFillColor(ctx.vg, nvgRGBA(0x80, 0xFF, 0xFF, 0xFF));
-					break;
-				default:
-					nvgFillColor(ctx.vg, nvgRGBA(0xFF, 0x80, 0x80, 0xFF));
-			}
+			int index = i + view->scale * NUM_SCALENOTES;
 
-			if (module->currNote == i) {
+			nvgFillColor(ctx.vg, slotColour(view->state[index]));
+
+			if (view->note == i) {
 				snprintf(text, sizeof(text), ">");
-				nvgText(ctx.vg, box.pos.x + 2, (box.pos.y + 30) + (i * 15), text, NULL);
+				nvgText(ctx.vg, 2, 30 + (i * 15), text, NULL);
 			}
 
 			snprintf(text, sizeof(text), "%02d", i+1);
-			nvgText(ctx.vg, box.pos.x + 9, (box.pos.y + 30) + (i * 15), text, NULL);
+			nvgText(ctx.vg, 9, 30 + (i * 15), text, NULL);
 
-			if (module->currFreqs[index] > 100000.0f) {
-				snprintf(text, sizeof(text), "%e", module->currFreqs[index]);
+			if (view->freqs[index] > 100000.0f) {
+				snprintf(text, sizeof(text), "%e", view->freqs[index]);
 			} else {
-				snprintf(text, sizeof(text), "%.3f", module->currFreqs[index]);
+				snprintf(text, sizeof(text), "%.3f", view->freqs[index]);
 			}
-			nvgText(ctx.vg, box.pos.x + 26, (box.pos.y + 30) + (i * 15), text, NULL);
+			nvgText(ctx.vg, 26, 30 + (i * 15), text, NULL);
 
-			if (module->notedesc[index].length() > 25) {
-				snprintf(text, 25, "%s...", module->notedesc[index].substr(0, 20).c_str());
+			if (view->notedesc[i].length() > 25) {
+				snprintf(text, 25, "%s...", view->notedesc[i].substr(0, 20).c_str());
 			} else {
-				snprintf(text, 25, "%s", module->notedesc[index].c_str());
+				snprintf(text, 25, "%s", view->notedesc[i].c_str());
 			}
-			nvgText(ctx.vg, box.pos.x + 90, (box.pos.y + 30) + (i * 15), text, NULL);
+			nvgText(ctx.vg, 90, 30 + (i * 15), text, NULL);
 
 		}
 	}
 	
 };
 
-struct ExpanderBankWidget : Widget {
+// All 231 notes of the bank on a log-frequency axis, one line per octave.
+// Notes of the selected scale are drawn full height, the selected note in white.
+struct SpectrumPlot : TransparentWidget {
+
+	BankView *view;
+
+	void draw(const DrawArgs &ctx) override {
+
+		float h = box.size.y;
+		int octaves = (int)roundf(log2f(view->maxFreq / view->minFreq));
+
+		nvgStrokeWidth(ctx.vg, 1.0f);
+
+		nvgBeginPath(ctx.vg);
+		for (int o = 0; o <= octaves; o++) {
+			float x = roundf(o * view->plotWidth / octaves) + 0.5f;
+			nvgMoveTo(ctx.vg, x, 0.0f);
+			nvgLineTo(ctx.vg, x, h);
+		}
+		nvgStrokeColor(ctx.vg, nvgRGBA(0x60, 0x60, 0x60, 0xFF));
+		nvgStroke(ctx.vg);
+
+		int first = view->scale * NUM_SCALENOTES;
+		int last = first + NUM_SCALENOTES;
+
+		// One path per slot state, other scales first so the selected scale is drawn on top
+		for (int pass = 0; pass < 2; pass++) {
+			for (int s = RainbowScaleExpander::LOADED; s <= RainbowScaleExpander::FRESH; s++) {
+				nvgBeginPath(ctx.vg);
+				for (int i = 0; i < NUM_BANKNOTES; i++) {
+					bool inScale = i >= first && i < last;
+					if (view->state[i] != s || view->plotX[i] < 0.0f || inScale != (pass == 1)) {
+						continue;
+					}
+					nvgMoveTo(ctx.vg, view->plotX[i], pass ? 0.0f : h * 0.5f);
+					nvgLineTo(ctx.vg, view->plotX[i], h);
+				}
+				NVGcolor colour = slotColour(s);
+				if (pass == 0) {
+					colour.a = 0.5f;
+				}
+				nvgStrokeColor(ctx.vg, colour);
+				nvgStroke(ctx.vg);
+			}
+		}
+
+		int index = first + view->note;
+		if (view->note >= 0 && index < NUM_BANKNOTES && view->plotX[index] >= 0.0f) {
+			nvgBeginPath(ctx.vg);
+			nvgMoveTo(ctx.vg, view->plotX[index], 0.0f);
+			nvgLineTo(ctx.vg, view->plotX[index], h);
+			nvgStrokeColor(ctx.vg, nvgRGBA(0xFF, 0xFF, 0xFF, 0xFF));
+			nvgStrokeWidth(ctx.vg, 2.0f);
+			nvgStroke(ctx.vg);
+		}
+
+	}
+
+};
+
+struct SpectrumPanel : widget::FramebufferWidget {
+
+	RainbowScaleExpander *module = NULL;
+	BankView view;
+
+	FrequencyDisplay *display;
+	SpectrumPlot *plot;
+
+	SpectrumPanel() {
+		display = new FrequencyDisplay;
+		display->view = &view;
+		addChild(display);
+
+		plot = new SpectrumPlot;
+		plot->view = &view;
+		addChild(plot);
+	}
+
+	void setModule(RainbowScaleExpander *m) {
+		module = m;
+		view.minFreq = module->minFreq;
+		view.maxFreq = module->maxFreq;
+		view.plotWidth = plot->box.size.x;
+	}
+
+	void step() override {
+		if (module && view.update(module)) {
+			dirty = true;
+		}
+		FramebufferWidget::step();
+	}
+
+};
+
+struct ExpanderBankWidget : TransparentWidget {
 
 	std::shared_ptr<Font> font;
 
@@ -1212,9 +1343,9 @@ struct ExpanderBankWidget : Widget {
 		font = APP->window->loadFont(asset::plugin(pluginInstance, "res/RobotoCondensed-Regular.ttf"));
 	}
 
-    ScaleSet scales;
+	const ScaleSet &scales = ScaleSet::get();
 
-	RainbowScaleExpander *module = NULL;
+	int bank = 0;
 
 	NVGcolor colors[NUM_SCALEBANKS] = {
 
@@ -1254,28 +1385,44 @@ struct ExpanderBankWidget : Widget {
 
 	void draw(const DrawArgs &ctx) override {
 
-		if (module == NULL) {
-			return;
-	    }
-
 		nvgFontSize(ctx.vg, 17.0f);
 		nvgFontFaceId(ctx.vg, font->handle);
 
 		char text[128];
-		int index = module->currBank;
+		int index = bank;
 		if (index < NUM_SCALEBANKS) {
 			nvgFillColor(ctx.vg, colors[index]);
 		} else {
 			nvgFillColor(ctx.vg, extraColour);
 		}
 
-		snprintf(text, sizeof(text), "%s", scales.full[index]->name.c_str());
-		nvgText(ctx.vg, box.pos.x, box.pos.y + 15, text, NULL);
+		snprintf(text, sizeof(text), "%s", scales.full[index]->name);
+		nvgText(ctx.vg, 0, 15, text, NULL);
 
 	}
 
 };
 
+struct ExpanderBankPanel : widget::FramebufferWidget {
+
+	RainbowScaleExpander *module = NULL;
+	ExpanderBankWidget *bankW;
+
+	ExpanderBankPanel() {
+		bankW = new ExpanderBankWidget;
+		addChild(bankW);
+	}
+
+	void step() override {
+		if (module && bankW->bank != module->currBank) {
+			bankW->bank = module->currBank;
+			dirty = true;
+		}
+		FramebufferWidget::step();
+	}
+
+};
+
 static void loadFile(RainbowScaleExpander *module) {
 
 	std::string dir;
@@ -1293,10 +1440,7 @@ static void loadFile(RainbowScaleExpander *module) {
 	char *path = osdialog_file(OSDIALOG_OPEN, dir.c_str(), filename.c_str(), filter);
 	if (path) {
 		module->path = path;
-		if (!module->scala.load(path)) {
-			std::string message = module->scala.lastError;
-			osdialog_message(OSDIALOG_WARNING, OSDIALOG_OK, message.c_str());
-		}
+		module->scalaLoader.request(path);
 		free(path);
 	}
 	osdialog_filters_free(filter);
@@ -1304,7 +1448,7 @@ static void loadFile(RainbowScaleExpander *module) {
 
 static void applyFile(RainbowScaleExpander *module) {
 
-	if (module->scala.isValid) {
+	if (module->scala) {
 		module->applyScale();
 	} else {
 		std::string message = "No Scala file loaded";
@@ -1313,6 +1457,86 @@ static void applyFile(RainbowScaleExpander *module) {
 
 }
 
+// Scala files below dir, a few folders deep. Called from the index thread
+static std::vector<std::string> listScalaFiles(const std::string &dir) {
+
+	std::vector<std::string> files;
+	std::vector<std::string> dirs = {dir};
+
+	for (int depth = 0; depth < 4 && !dirs.empty(); depth++) {
+		std::vector<std::string> subdirs;
+		for (const std::string &d : dirs) {
+			for (const std::string &path : system::getEntries(d)) {
+				if (system::isDirectory(path)) {
+					subdirs.push_back(path);
+				} else {
+					files.push_back(path);
+				}
+			}
+		}
+		dirs.swap(subdirs);
+	}
+
+	return files;
+
+}
+
+static void scanScalaLibrary(RainbowScaleExpander *module) {
+	std::string dir = asset::user("Rainbow");
+	system::createDirectory(dir);
+	ScalaIndex::get().scan(module->scalaDir, dir + "/scala-index.cache", listScalaFiles);
+}
+
+static void chooseScalaLibrary(RainbowScaleExpander *module) {
+
+	std::string dir = module->scalaDir.empty() ? asset::user("") : module->scalaDir;
+
+	char *path = osdialog_file(OSDIALOG_OPEN_DIR, dir.c_str(), NULL, NULL);
+	if (path) {
+		module->scalaDir = path;
+		scanScalaLibrary(module);
+		free(path);
+	}
+}
+
+static void openPackFile(RainbowScaleExpander *module) {
+
+	std::string dir = module->pack.isOpen() ? string::directory(module->pack.path) : asset::user("");
+
+	osdialog_filters *filter = osdialog_filters_parse("Scale pack:rbpack");
+	char *path = osdialog_file(OSDIALOG_OPEN, dir.c_str(), NULL, filter);
+	if (path) {
+		if (!module->pack.open(path)) {
+			std::string message = module->pack.lastError;
+			osdialog_message(OSDIALOG_WARNING, OSDIALOG_OK, message.c_str());
+		}
+		free(path);
+	}
+	osdialog_filters_free(filter);
+}
+
+static void addToPackFile(RainbowScaleExpander *module) {
+
+	// Packs saved in the Rainbow folder show up in the Rainbow's bank selector
+	std::string dir = asset::user("Rainbow");
+	system::createDirectory(dir);
+	if (module->pack.isOpen()) {
+		dir = string::directory(module->pack.path);
+	}
+	std::string filename = module->pack.isOpen() ? string::filename(module->pack.path) : "Scales.rbpack";
+
+	osdialog_filters *filter = osdialog_filters_parse("Scale pack:rbpack");
+	char *path = osdialog_file(OSDIALOG_SAVE, dir.c_str(), filename.c_str(), filter);
+	if (path) {
+		std::string error;
+		if (!module->addBankToPack(path, &error)) {
+			osdialog_message(OSDIALOG_WARNING, OSDIALOG_OK, error.c_str());
+		}
+		free(path);
+	}
+	osdialog_filters_free(filter);
+}
+
 struct RainbowScaleExpanderWidget : ModuleWidget {
 	
 	RainbowScaleExpanderWidget(RainbowScaleExpander *module) {
@@ -1367,19 +1591,54 @@ struct RainbowScaleExpanderWidget : ModuleWidget {
 		addParam(createParamCentered<gui::PrismButton>(mm2px(Vec(107.59, 109.118)), module, RainbowScaleExpander::BANKLOAD_PARAM));
 
 		if (module != NULL) {
-			FrequencyDisplay *displayW = createWidget<FrequencyDisplay>(ink2vcv(19.5f, 123.0f));
-			displayW->box.size = mm2px(Vec(0.0f, 120.0f));
-			displayW->module = module;
-			addChild(displayW);
-
-			ExpanderBankWidget *bankW = createWidget<ExpanderBankWidget>(ink2vcv(111.722f,24.382f));
-			bankW->box.size = Vec(80.0, 20.0f);
+			// Text origin of the note list is at (58.5, 16.5), the panel leaves room above it for the first line
+			SpectrumPanel *spectrumW = createWidget<SpectrumPanel>(Vec(53.5f, 1.5f));
+			spectrumW->box.size = Vec(225.0f, 370.0f);
+			spectrumW->display->box.pos = Vec(5.0f, 15.0f);
+			spectrumW->display->box.size = Vec(225.0f, 340.0f);
+			spectrumW->plot->box.pos = Vec(16.0f, 356.0f);
+			spectrumW->plot->box.size = Vec(190.0f, 12.0f);
+			spectrumW->setModule(module);
+			addChild(spectrumW);
+
+			ExpanderBankPanel *bankW = createWidget<ExpanderBankPanel>(ink2vcv(111.722f, 24.382f).mult(2.0f));
+			bankW->box.size = Vec(100.0f, 20.0f);
+			bankW->bankW->box.size = bankW->box.size;
 			bankW->module = module;
 			addChild(bankW);
 
 		}
 	}
 
+	void step() override {
+
+		RainbowScaleExpander *spectrum = dynamic_cast<RainbowScaleExpander*>(module);
+
+		// Index the library once the patch has told us where it is
+		if (spectrum && !spectrum->scalaDir.empty() && !ScalaIndex::get().known(spectrum->scalaDir)) {
+			scanScalaLibrary(spectrum);
+		}
+
+		if (spectrum) {
+			spectrum->prepareTransfer();
+		}
+
+		// Scala files are parsed in the background, pick up the result once it is ready
+		if (spectrum) {
+			std::unique_ptr<ScalaLoader::Result> result = spectrum->scalaLoader.take();
+			if (result) {
+				if (result->scale) {
+					spectrum->scala = result->scale;
+				} else {
+					osdialog_message(OSDIALOG_WARNING, OSDIALOG_OK, result->error.c_str());
+				}
+			}
+		}
+
+		ModuleWidget::step();
+
+	}
+
 	void appendContextMenu(Menu *menu) override {
 
 		RainbowScaleExpander *spectrum = dynamic_cast<RainbowScaleExpander*>(module);
@@ -1399,6 +1658,96 @@ struct RainbowScaleExpanderWidget : ModuleWidget {
 			}
 		};
 
+		struct CompactItem : MenuItem {
+			RainbowScaleExpander *module;
+			void onAction(const event::Action &e) override {
+				module->compactStorage ^= true;
+			}
+		};
+
+		struct OpenPackItem : MenuItem {
+			RainbowScaleExpander *module;
+			void onAction(const event::Action &e) override {
+				openPackFile(module);
+			}
+		};
+
+		struct AddToPackItem : MenuItem {
+			RainbowScaleExpander *module;
+			void onAction(const event::Action &e) override {
+				addToPackFile(module);
+			}
+		};
+
+		struct PackBankItem : MenuItem {
+			RainbowScaleExpander *module;
+			int bank;
+			void onAction(const event::Action &e) override {
+				module->loadPackBank(bank);
+			}
+		};
+
+		struct PackMenu : MenuItem {
+			RainbowScaleExpander *module;
+			Menu *createChildMenu() override {
+				Menu *menu = new Menu;
+				for (int i = 0; i < module->pack.size(); i++) {
+					PackBankItem *item = createMenuItem<PackBankItem>(module->pack.string(module->pack.bank(i)->name));
+					item->module = module;
+					item->bank = i;
+					menu->addChild(item);
+				}
+				return menu;
+			}
+		};
+
+		struct ScalaFolderItem : MenuItem {
+			RainbowScaleExpander *module;
+			void onAction(const event::Action &e) override {
+				chooseScalaLibrary(module);
+			}
+		};
+
+		struct RescanScalaItem : MenuItem {
+			RainbowScaleExpander *module;
+			void onAction(const event::Action &e) override {
+				scanScalaLibrary(module);
+			}
+		};
+
+		struct ScalaSearchField : ui::TextField {
+			RainbowScaleExpander *module;
+			void onChange(const event::Change &e) override {
+				module->scalaQuery = text;
+			}
+		};
+
+		// Picks a scale straight from the index, the file is not read again
+		struct ScalaEntryItem : MenuItem {
+			RainbowScaleExpander *module;
+			std::shared_ptr<const ScalaScale> scale;
+			void onAction(const event::Action &e) override {
+				module->scala = scale;
+				module->path = scale->path;
+			}
+		};
+
+		struct ScalaLibraryMenu : MenuItem {
+			RainbowScaleExpander *module;
+			Menu *createChildMenu() override {
+				Menu *menu = new Menu;
+				std::shared_ptr<const ScalaIndexEntries> entries = ScalaIndex::get().entries(module->scalaDir);
+				for (const ScalaIndexEntry *entry : ScalaIndex::search(*entries, module->scalaQuery, 100)) {
+					ScalaEntryItem *item = createMenuItem<ScalaEntryItem>(entry->name);
+					item->rightText = string::f("%d notes, %.1f c", (int)entry->scale->notes.size(), entry->period());
+					item->module = module;
+					item->scale = entry->scale;
+					menu->addChild(item);
+				}
+				return menu;
+			}
+		};
+
 		menu->addChild(construct<MenuLabel>());
 
 		LoadItem *loadItem = new LoadItem;
@@ -1411,6 +1760,48 @@ struct RainbowScaleExpanderWidget : ModuleWidget {
 		applyItem->module = spectrum;
 		menu->addChild(applyItem);
 
+		ScalaFolderItem *scalaFolderItem = createMenuItem<ScalaFolderItem>("Scala library folder", spectrum->scalaDir.empty() ? "None" : string::filename(spectrum->scalaDir));
+		scalaFolderItem->module = spectrum;
+		menu->addChild(scalaFolderItem);
+
+		if (!spectrum->scalaDir.empty()) {
+
+			RescanScalaItem *rescanScalaItem = createMenuItem<RescanScalaItem>(ScalaIndex::get().scanning(spectrum->scalaDir) ? "Scanning Scala library..." : "Rescan Scala library");
+			rescanScalaItem->module = spectrum;
+			menu->addChild(rescanScalaItem);
+
+			ScalaSearchField *searchField = new ScalaSearchField;
+			searchField->box.size.x = 200.0f;
+			searchField->placeholder = "Search Scala library";
+			searchField->text = spectrum->scalaQuery;
+			searchField->module = spectrum;
+			menu->addChild(searchField);
+
+			size_t numScales = ScalaIndex::get().entries(spectrum->scalaDir)->size();
+			ScalaLibraryMenu *scalaLibraryMenu = createMenuItem<ScalaLibraryMenu>(std::to_string(numScales) + " scales in " + string::filename(spectrum->scalaDir), RIGHT_ARROW);
+			scalaLibraryMenu->module = spectrum;
+			menu->addChild(scalaLibraryMenu);
+
+		}
+
+		OpenPackItem *openPackItem = createMenuItem<OpenPackItem>("Open scale pack");
+		openPackItem->module = spectrum;
+		menu->addChild(openPackItem);
+
+		if (spectrum->pack.isOpen()) {
+			PackMenu *packMenu = createMenuItem<PackMenu>("Load bank from " + string::filename(spectrum->pack.path), RIGHT_ARROW);
+			packMenu->module = spectrum;
+			menu->addChild(packMenu);
+		}
+
+		AddToPackItem *addToPackItem = createMenuItem<AddToPackItem>("Add bank to scale pack");
+		addToPackItem->module = spectrum;
+		menu->addChild(addToPackItem);
+
+		CompactItem *compactItem = createMenuItem<CompactItem>("Compact frequencies in patch", CHECKMARK(spectrum->compactStorage));
+		compactItem->module = spectrum;
+		menu->addChild(compactItem);
+
 	 }
 
 };
@@ -27,10 +27,10 @@
  * -----------------------------------------------------------------------------
  */
 
+#include <math.h>
 
 #include "Rainbow.hpp"
-
-extern float exp_4096[4096];
+#include "Tables.hpp"
 
 using namespace rainbow;
 
@@ -204,18 +204,20 @@ void Rotation::update_spread(int8_t t_spread) {
 }
 
 void Rotation::update_morph(void) {
-	f_morph *= 0.999f;
-	f_morph += 0.001f * (exp_4096[io->MORPH_ADC] / 16.0f);
+
+	float sample_rate = io->HICPUMODE ? 96000.0f : 48000.0f;
+	float morph_lpf = expf(-NUM_SAMPLES / (sample_rate * MORPH_LPF_TIME));
+
+	f_morph *= morph_lpf;
+	f_morph += (1.0f - morph_lpf) * (exp_4096(io->MORPH_ADC) * MORPH_RATE / sample_rate);
 
 	//if morph is happening, continue it
+	//the filter interpolates each sample between motion_morph_start and the new motion_morphpos
 	//if it hits the limit, just hold it there until we can run update_motion()
 	for (int chan = 0; chan < NUM_CHANNELS; chan++)	{
-		if (motion_morphpos[chan] > 0.0f) {
-			motion_morphpos[chan] += f_morph;
-		}
-		if (motion_morphpos[chan] >= 1.0f) {
-			motion_morphpos[chan] = 1.0f;
-		}
+		motion_morph_start[chan] = motion_morphpos[chan];
+		motion_morph_inc[chan] = motion_morphpos[chan] > 0.0f ? f_morph : 0.0f;
+		motion_morphpos[chan] = fminf(motion_morphpos[chan] + motion_morph_inc[chan] * NUM_SAMPLES, 1.0f);
 	}
 
 }
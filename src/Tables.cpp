@@ -0,0 +1,122 @@
+#include <math.h>
+
+#include "Tables.hpp"
+
+// Hand tuned start of the curve, it continues linearly to EXP_CURVE_START
+static const float EXP_HEAD[18] = {
+	0.999999f, 0.998f, 0.997f, 0.996f, 0.995f, 0.994f, 0.993f, 0.992f, 0.991f,
+	0.990f, 0.989f, 0.986f, 0.983f, 0.980f, 0.977f, 0.975f, 0.973f, 0.972f
+};
+
+static const uint32_t EXP_CURVE_START = 41;
+
+float exp_4096(uint32_t i) {
+
+	if (i < 18) {
+		return EXP_HEAD[i];
+	}
+
+	if (i < EXP_CURVE_START) {
+		return 0.971809f - 0.0005f * (i - 18);
+	}
+
+	if (i > 4095) {
+		i = 4095;
+	}
+
+	return 40.0f / i * expf(-(float)i / 1000.5f);
+
+}
+
+float log_4096(uint32_t i) {
+
+	if (i < 8) {
+		return 0.25f;
+	}
+
+	if (i > 4095) {
+		i = 4095;
+	}
+
+	return log2f(i + 1) / 12.0f;
+
+}
+
+// The calibration was measured in steps: within each step it rises by 100 per index.
+// {first index, value at first index}
+static const uint32_t TWOPASS_STEPS[][2] = {
+	{0, 25277790}, {1, 35852536}, {3, 56350016}, {27, 56849772},
+	{46, 58967944}, {70, 62350120}, {94, 62921528}, {113, 64442216},
+	{137, 67365168}, {161, 69096744}, {180, 69313168}, {185, 69878464},
+	{204, 73511280}, {228, 75675224}, {252, 76099520}, {271, 78701760},
+	{295, 82045056}, {319, 83658568}, {338, 85309096}, {362, 88863016},
+	{386, 90636232}, {405, 90910096}, {410, 92709560}, {429, 95552552},
+	{453, 99111016}, {477, 100800360}, {496, 103223200}, {520, 106429536},
+	{544, 109396416}, {563, 110136224}, {568, 111184400}, {587, 115350984},
+	{611, 118368400}, {635, 119790200}, {654, 122754856}, {678, 127012000},
+	{702, 130543808}, {721, 132238344}, {745, 136277664}, {769, 139934704},
+	{793, 142640432}, {812, 145556400}, {817, 146379584}, {836, 151273792},
+	{860, 153913792}, {879, 155848224}, {884, 157308096}, {903, 160661856},
+	{927, 165766176}, {951, 169604400}, {970, 172832128}, {994, 177002576},
+	{1018, 180231440}, {1023, 181552256}, {1037, 182701216}, {1042, 185965600},
+	{1061, 188473040}, {1066, 189160432}, {1085, 193753232}, {1090, 194123280},
+	{1104, 195410976}, {1109, 198307520}, {1128, 200189360}, {1133, 202888496},
+	{1152, 205386752}, {1157, 209228720}, {1176, 213303808}, {1200, 218390624},
+	{1219, 219815792}, {1224, 222250416}, {1243, 226191872}, {1248, 226725824},
+	{1267, 231641840}, {1272, 231793024}, {1291, 238364592}, {1310, 241448928},
+	{1315, 242851216}, {1334, 247998000}, {1358, 251873424}, {1363, 253859552},
+	{1377, 254418400}, {1382, 258799680}, {1401, 261453488}, {1406, 265834880},
+	{1425, 269044448}, {1430, 271225504}, {1449, 276782144}, {1468, 277070432},
+	{1473, 282129376}, {1492, 285062976}, {1497, 289454144}, {1516, 294032768},
+	{1521, 294984352}, {1540, 302066944}, {1559, 302379552}, {1564, 307346240},
+	{1583, 312573344}, {1588, 312720352}, {1607, 318210592}, {1612, 320031200},
+	{1631, 325064224}, {1636, 328347968}, {1650, 329653280}, {1655, 335014848},
+	{1674, 337887744}, {1679, 340705760}, {1698, 344486720}, {1703, 348051264},
+	{1722, 354334016}, {1746, 364051712}, {1770, 371362240}, {1789, 377895456},
+	{1813, 383925440}, {1832, 384052704}, {1837, 391339904}, {1856, 395478528},
+	{1861, 399654400}, {1880, 407082912}, {1904, 415521792}, {1923, 420592448},
+	{1928, 421451744}, {1947, 426610272}, {1952, 427222176}, {1963, 427369728},
+	{1966, 428385792}, {1971, 436461536}, {1990, 438579456}, {1995, 448573504},
+	{2019, 455950944}, {2038, 462170048}, {2062, 473811200}, {2078, 476892576},
+	{2097, 480803712}, {2105, 483260160}, {2110, 489353344}, {2121, 494296768},
+	{2129, 500494784}, {2145, 505975744}, {2164, 508210336}, {2169, 511944192},
+	{2177, 512293504}, {2183, 513180128}, {2188, 522454720}, {2193, 522704544},
+	{2196, 523955648}, {2212, 539580544}, {2231, 542679552}, {2236, 544944192},
+	{2250, 545086016}, {2255, 553025280}, {2260, 555282944}, {2274, 555959872},
+	{2279, 566256064}, {2298, 572103296}, {2303, 578851584}, {2322, 587958080},
+	{2327, 591331520}, {2346, 601869760}, {2365, 608895488}, {2370, 617314560},
+	{2389, 623862208}, {2408, 624515392}, {2413, 636495616}, {2418, 638899840},
+	{2437, 651603776}, {2456, 655381440}, {2461, 665434368}, {2480, 671600704},
+	{2485, 674264576}, {2499, 680360768}, {2504, 691915776}, {2523, 695757696},
+	{2528, 700339136}, {2533, 703944832}, {2547, 704728704}, {2552, 713195008},
+	{2566, 714367552}, {2571, 734444608}, {2590, 734518016}, {2595, 744270976},
+	{2600, 744825152}, {2614, 755243072}, {2638, 764657600}, {2643, 768811008},
+	{2657, 772757952}, {2662, 777644672}, {2667, 786099264}, {2681, 788136960},
+	{2686, 796659072}, {2705, 809560640}, {2710, 810058240}, {2724, 814976256},
+	{2729, 817357888}, {2748, 821037824}, {2753, 832727936}, {2758, 836729856},
+	{2777, 848614016}, {2796, 856273472}, {2801, 860821632}, {2820, 875878976},
+	{2844, 883945216}, {2863, 888359104}, {2868, 890531072}, {2882, 898727168},
+	{2887, 909253632},
+};
+
+static const uint32_t TWOPASS_MAX = 909256320;
+
+uint32_t twopass_calibration(uint32_t i) {
+
+	int lo = 0;
+	int hi = sizeof(TWOPASS_STEPS) / sizeof(TWOPASS_STEPS[0]) - 1;
+
+	// Last step starting at or before i
+	while (lo < hi) {
+		int mid = (lo + hi + 1) / 2;
+		if (TWOPASS_STEPS[mid][0] <= i) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	uint32_t value = TWOPASS_STEPS[lo][1] + 100 * (i - TWOPASS_STEPS[lo][0]);
+	return value < TWOPASS_MAX ? value : TWOPASS_MAX;
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdint.h>
+
+// Lookup curves of the firmware, computed rather than read from 4096 entry tables.
+// Worst relative deviation from the old tables over the indices read:
+// exp_4096 1e-6, log_4096 2e-7, twopass_calibration 2e-6, checked by `make test-tables`.
+
+// Decay curve over a 12 bit control value, from 1.0 down to 0.000163
+float exp_4096(uint32_t i);
+
+// log2(i + 1) / 12, not below 0.25
+float log_4096(uint32_t i);
+
+// Measured gain of the second two-pass filter, indexed by its qval - 900
+uint32_t twopass_calibration(uint32_t i);
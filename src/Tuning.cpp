@@ -32,8 +32,6 @@
 
 using namespace rainbow;
 
-extern float exp_1voct[4096];
-
 void Tuning::configure(IO *_io, Filter * _filter) {
 	filter	= _filter;
 	io		= _io;
@@ -1,1647 +1,482 @@
-#include "Scales.hpp"
-Scale et_minor = {
-	.name = "Minor (ET)",
-	.description = "Scales from C Major",
-	.scalename = {
-		"Minor chords",
-		"Minor 6th chords",
-		"Minor 7th chords",
-		"Half Diminished 7th chords",
-		"Minor Pentatonic; C1-",
-		"Minor Pentatonic; C5-",
-		"Blues scale; C1-",
-		"Blues scale; C4-",
-		"Harmonic Minor; C1-",
-		"Harmonic Minor; C3-",
-		"Harmonic Minor; C6-"},
-	.notedesc = {
-		"Oct",
-		"m3",
-		"P5",
-		"Oct",
-		"m3",
-		"P5",
-		"Oct",
-		"m3",
-		"P5",
-		"Oct",
-		"m3",
-		"P5",
-		"Oct",
-		"m3",
-		"P5",
-		"Oct",
-		"m3",
-		"P5",
-		"Oct",
-		"m3",
-		"P5",
-		"Oct",
-		"m3",
-		"P5",
-		"m6",
-		"Oct",
-		"m3",
-		"P5",
-		"m6",
-		"Oct",
-		"m3",
-		"P5",
-		"m6",
-		"Oct",
-		"m3",
-		"P5",
-		"m6",
-		"Oct",
-		"m3",
-		"P5",
-		"m6",
-		"Oct",
-		"Oct",
-		"m3",
-		"P5",
-		"m7",
-		"Oct",
-		"m3",
-		"P5",
-		"m7",
-		"Oct",
-		"m3",
-		"P5",
-		"m7",
-		"Oct",
-		"m3",
-		"P5",
-		"m7",
-		"Oct",
-		"m3",
-		"P5",
-		"m7",
-		"Oct",
-		"Oct",
-		"m3",
-		"M4",
-		"m7",
-		"Oct",
-		"m3",
-		"M4",
-		"m7",
-		"Oct",
-		"m3",
-		"M4",
-		"m7",
-		"Oct",
-		"m3",
-		"M4",
-		"m7",
-		"Oct",
-		"m3",
-		"M4",
-		"m7",
-		"Oct",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"m3",
-		"P4",
-		"P4",
-		"m7",
-		"Oct",
-		"Oct",
-		"M2",
-		"M3",
-		"P5",
-		"d5",
-		"M6",
-		"Oct",
-		"M2",
-		"M3",
-		"P5",
-		"d5",
-		"M6",
-		"Oct",
-		"M2",
-		"M3",
-		"P5",
-		"d5",
-		"M6",
-		"Oct",
-		"M2",
-		"M3",
-		"M3",
-		"P5",
-		"d5",
-		"M6",
-		"Oct",
-		"M2",
-		"M3",
-		"P5",
-		"d5",
-		"M6",
-		"Oct",
-		"M2",
-		"M3",
-		"P5",
-		"d5",
-		"M6",
-		"Oct",
-		"M2",
-		"M3",
-		"P5",
-		"d5",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"M7",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"m6",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5",
-		"m6",
-		"M7",
-		"Oct",
-		"M2",
-		"m3",
-		"P4",
-		"P5"},
-	.c_maxq48000 = {
-		0.004280838301768944,
-		0.005090803366639794,
-		0.006414010322505164,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01282802064501033,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02565604129002066,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.05131208258004132,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.1026241651600826,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.2052483303201653,
-		0.2739736513132124,
-		0.3258114154649468,
-		0.4104966606403305,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01282802064501033,
-		0.01359081444706756,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02565604129002066,
-		0.02718162889413513,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.05131208258004132,
-		0.05436325778827026,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.1026241651600826,
-		0.1087265155765405,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.2052483303201653,
-		0.217453031153081,
-		0.2739736513132124,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01282802064501033,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02565604129002066,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.05131208258004132,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.1026241651600826,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.2052483303201653,
-		0.2440827747591693,
-		0.2739736513132124,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01078703657518983,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02157407315037966,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.04314814630075931,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.08629629260151862,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.1725925852030372,
-		0.2440827747591693,
-		0.2739736513132124,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.005714233574458755,
-		0.006414010322505164,
-		0.007627586711224039,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01142846714891751,
-		0.01282802064501033,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02285693429783502,
-		0.02565604129002066,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.04571386859567004,
-		0.05131208258004132,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.09142773719134008,
-		0.1026241651600826,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.1828554743826802,
-		0.2052483303201653,
-		0.2440827747591693,
-		0.2739736513132124,
-		0.3258114154649468,
-		0.3657109487653603,
-		0.4104966606403305,
-		0.4881655495183385,
-		0.5479473026264249,
-		0.6516228309298936,
-		0.7314218975307206,
-		0.820993321280661,
-		0.976331099036677,
-		1.09589460525285,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.005714233574458755,
-		0.006054019584687849,
-		0.006414010322505164,
-		0.007627586711224039,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01142846714891751,
-		0.0121080391693757,
-		0.01282802064501033,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02285693429783502,
-		0.0242160783387514,
-		0.02565604129002066,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.04571386859567004,
-		0.04571386859567004,
-		0.04843215667750279,
-		0.05131208258004132,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.08145285386623671,
-		0.09142773719134008,
-		0.09686431335500559,
-		0.1026241651600826,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.1828554743826802,
-		0.1937286267100112,
-		0.2052483303201653,
-		0.2440827747591693,
-		0.2739736513132124,
-		0.3258114154649469,
-		0.3657109487653603,
-		0.3874572534200224,
-		0.4104966606403306,
-		0.004280838301768944,
-		0.004805078528684788,
-		0.005090803366639794,
-		0.005714233574458755,
-		0.006414010322505164,
-		0.006795407223533782,
-		0.008081146619567259,
-		0.008561676603537889,
-		0.009610157057369575,
-		0.01018160673327959,
-		0.01142846714891751,
-		0.01282802064501033,
-		0.01359081444706756,
-		0.01616229323913452,
-		0.01712335320707578,
-		0.01922031411473915,
-		0.02036321346655917,
-		0.02285693429783502,
-		0.02565604129002066,
-		0.02718162889413513,
-		0.03232458647826904,
-		0.03232458647826904,
-		0.03424670641415156,
-		0.0384406282294783,
-		0.04072642693311836,
-		0.04571386859567005,
-		0.05131208258004132,
-		0.05436325778827026,
-		0.06464917295653809,
-		0.06849341282830312,
-		0.0768812564589566,
-		0.08145285386623671,
-		0.09142773719134011,
-		0.1026241651600826,
-		0.1087265155765405,
-		0.1292983459130762,
-		0.1369868256566062,
-		0.1537625129179132,
-		0.1629057077324734,
-		0.1828554743826802,
-		0.2052483303201653,
-		0.217453031153081,
-		0.217453031153081,
-		0.2585966918261523,
-		0.2739736513132124,
-		0.3075250258358264,
-		0.3258114154649469,
-		0.3657109487653603,
-		0.4104966606403305,
-		0.4349060623061621,
-		0.5171933836523046,
-		0.5479473026264249,
-		0.6150500516716528,
-		0.6516228309298937,
-		0.7314218975307206,
-		0.820993321280661,
-		0.8698121246123242,
-		1.034386767304609,
-		1.09589460525285,
-		1.230100103343306,
-		1.303245661859787,
-		1.462843795061441,
-		1.641986642561322
-	},
-	.c_maxq96000 = {
-		0.002140419150884472,
-		0.002545401683319897,
-		0.003207005161252582,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.006414010322505164,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01282802064501033,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02565604129002066,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.05131208258004132,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.1026241651600826,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.2052483303201653,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.006414010322505164,
-		0.006795407223533782,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01282802064501033,
-		0.01359081444706756,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02565604129002066,
-		0.02718162889413513,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.05131208258004132,
-		0.05436325778827026,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.1026241651600826,
-		0.1087265155765405,
-		0.1369868256566062,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.006414010322505164,
-		0.007627586711224039,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01282802064501033,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02565604129002066,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.05131208258004132,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.1026241651600826,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.005393518287594914,
-		0.007627586711224039,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01078703657518983,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02157407315037966,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.04314814630075931,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.08629629260151862,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.002140419150884472,
-		0.002545401683319897,
-		0.002857116787229377,
-		0.003207005161252582,
-		0.00381379335561202,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.005714233574458755,
-		0.006414010322505164,
-		0.007627586711224039,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01142846714891751,
-		0.01282802064501033,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02285693429783502,
-		0.02565604129002066,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.03424670641415156,
-		0.04072642693311835,
-		0.04571386859567004,
-		0.05131208258004132,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.0814528538662367,
-		0.09142773719134008,
-		0.1026241651600826,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.1828554743826802,
-		0.2052483303201653,
-		0.2440827747591693,
-		0.2739736513132124,
-		0.3258114154649468,
-		0.3657109487653603,
-		0.4104966606403305,
-		0.4881655495183385,
-		0.5479473026264249,
-		0.002140419150884472,
-		0.002545401683319897,
-		0.002857116787229377,
-		0.003027009792343925,
-		0.003207005161252582,
-		0.00381379335561202,
-		0.004280838301768944,
-		0.005090803366639794,
-		0.005714233574458755,
-		0.006054019584687849,
-		0.006414010322505164,
-		0.007627586711224039,
-		0.008561676603537889,
-		0.01018160673327959,
-		0.01142846714891751,
-		0.0121080391693757,
-		0.01282802064501033,
-		0.01525517342244808,
-		0.01712335320707578,
-		0.02036321346655917,
-		0.02285693429783502,
-		0.02285693429783502,
-		0.0242160783387514,
-		0.02565604129002066,
-		0.03051034684489616,
-		0.03424670641415156,
-		0.04072642693311836,
-		0.04571386859567004,
-		0.04843215667750279,
-		0.05131208258004132,
-		0.06102069368979231,
-		0.06849341282830311,
-		0.08145285386623671,
-		0.09142773719134008,
-		0.09686431335500559,
-		0.1026241651600826,
-		0.1220413873795846,
-		0.1369868256566062,
-		0.1629057077324734,
-		0.1828554743826802,
-		0.1937286267100112,
-		0.2052483303201653,
-		0.002140419150884472,
-		0.002402539264342394,
-		0.002545401683319897,
-		0.002857116787229377,
-		0.003207005161252582,
-		0.003397703611766891,
-		0.00404057330978363,
-		0.004280838301768944,
-		0.004805078528684788,
-		0.005090803366639794,
-		0.005714233574458755,
-		0.006414010322505164,
-		0.006795407223533782,
-		0.008081146619567259,
-		0.008561676603537889,
-		0.009610157057369575,
-		0.01018160673327959,
-		0.01142846714891751,
-		0.01282802064501033,
-		0.01359081444706756,
-		0.01616229323913452,
-		0.01616229323913452,
-		0.01712335320707578,
-		0.01922031411473915,
-		0.02036321346655918,
-		0.02285693429783503,
-		0.02565604129002066,
-		0.02718162889413513,
-		0.03232458647826904,
-		0.03424670641415156,
-		0.0384406282294783,
-		0.04072642693311836,
-		0.04571386859567005,
-		0.05131208258004132,
-		0.05436325778827026,
-		0.06464917295653809,
-		0.06849341282830312,
-		0.0768812564589566,
-		0.08145285386623671,
-		0.09142773719134011,
-		0.1026241651600826,
-		0.1087265155765405,
-		0.1087265155765405,
-		0.1292983459130762,
-		0.1369868256566062,
-		0.1537625129179132,
-		0.1629057077324734,
-		0.1828554743826802,
-		0.2052483303201653,
-		0.217453031153081,
-		0.2585966918261523,
-		0.2739736513132124,
-		0.3075250258358264,
-		0.3258114154649469,
-		0.3657109487653603,
-		0.4104966606403305,
-		0.4349060623061621,
-		0.5171933836523046,
-		0.5479473026264249,
-		0.6150500516716528,
-		0.6516228309298937,
-		0.7314218975307206,
-		0.820993321280661
-	},
-	.c_bpre4800022 = {
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542166660277523, 0.9974578333397325, -1.99743195002248 },
-		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
-		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
-		{ 0.005077864197470508, 0.9949221358025436, -1.994818734900936 },
-		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
-		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
-		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03990825277803053, 0.9600917472219703, -1.953593160270272 },
-		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
-		{ 0.1503289276173477, 0.8496710723859783, -1.752362003179018 },
-		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
-		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
-		{ 0.005077864197470508, 0.9949221358025436, -1.994818734900936 },
-		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
-		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
-		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
-		{ 0.01349885378464802, 0.9865011462156569, -1.98576733966659 },
-		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
-		{ 0.02681555221008397, 0.9731844477900297, -1.970269422622682 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03990825277803053, 0.9600917472219703, -1.953593160270272 },
-		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
-		{ 0.05291196859294583, 0.9470880314071498, -1.935590668385107 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
-		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
-		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
-		{ 0.005077864197470508, 0.9949221358025436, -1.994818734900936 },
-		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
-		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
-		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03990825277803053, 0.9600917472219703, -1.953593160270272 },
-		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
-		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
-		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
-		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
-		{ 0.005077864197470508, 0.9949221358025436, -1.994818734900936 },
-		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
-		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
-		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03990825277803053, 0.9600917472219703, -1.953593160270272 },
-		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
-		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
-		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
-		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542166660277523, 0.9974578333397325, -1.99743195002248 },
-		{ 0.002853037225454236, 0.9971469627745557, -1.9971143570205 },
-		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
-		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
-		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
-		{ 0.005077864197470508, 0.9949221358025436, -1.994818734900936 },
-		{ 0.005697941137181246, 0.9943020588628291, -1.994171822396902 },
-		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
-		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
-		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
-		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
-		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03990825277803053, 0.9600917472219703, -1.953593160270272 },
-		{ 0.04468470227186336, 0.9553152977282937, -1.947148728928402 },
-		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
-		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.08737256246672775, 0.9126274375363427, -1.880741141441922 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
-		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
-		{ 0.1503289276173477, 0.8496710723859783, -1.752362003179018 },
-		{ 0.1671117053831056, 0.8328882946198586, -1.711678582026151 },
-		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
-		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
-		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
-		{ 0.2780585962413487, 0.7219414037589278, -1.36911694221468 },
-		{ 0.3062966346578139, 0.6937033653424187, -1.260497365967171 },
-		{ 0.3366794082814893, 0.6633205917191545, -1.133543532973203 },
-		{ 0.3862487341903956, 0.6137512658096063, -0.9038069316600397 },
-		{ 0.4218647422055749, 0.5781352577946095, -0.7216036473971494 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542166660277523, 0.9974578333397325, -1.99743195002248 },
-		{ 0.002853037225454236, 0.9971469627745557, -1.9971143570205 },
-		{ 0.003022432832100747, 0.9969775671678996, -1.996940971518858 },
-		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
-		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
-		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
-		{ 0.005077864197470508, 0.9949221358025436, -1.994818734900936 },
-		{ 0.005697941137181246, 0.9943020588628291, -1.994171822396902 },
-		{ 0.00603573056397665, 0.9939642694360237, -1.993818109060076 },
-		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
-		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
-		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
-		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
-		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
-		{ 0.02392519464249, 0.9760748053577598, -1.973757650197085 },
-		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
-		{ 0.0300496190506501, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03990825277803052, 0.9600917472219703, -1.953593160270272 },
-		{ 0.04468470227186336, 0.9553152977282937, -1.947148728928402 },
-		{ 0.04727803670133687, 0.9527219632986798, -1.943568222565742 },
-		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
-		{ 0.0591962584962127, 0.9408037415039114, -1.926368394147137 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.08737256246672775, 0.9126274375363427, -1.880741141441922 },
-		{ 0.09232097946502393, 0.9076790205367768, -1.871992389610808 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1148885517004108, 0.8851114483060925, -1.829235310265093 },
-		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
-		{ 0.1503289276173477, 0.8496710723859783, -1.752362003179018 },
-		{ 0.1671117053831056, 0.8328882946198586, -1.711678582026151 },
-		{ 0.1761187956808483, 0.823881204322603, -1.688681565563275 },
-		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002399655738662763, 0.9976003442613375, -1.997577283223565 },
-		{ 0.002542166660277523, 0.9974578333397325, -1.99743195002248 },
-		{ 0.002853037225454236, 0.9971469627745557, -1.9971143570205 },
-		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
-		{ 0.003391938783785411, 0.9966080612162165, -1.996561962127267 },
-		{ 0.004032420351849574, 0.995967579648152, -1.99590240676733 },
-		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
-		{ 0.004793553129661451, 0.995206446870339, -1.995114313795211 },
-		{ 0.005077864197470508, 0.9949221358025436, -1.994818734900936 },
-		{ 0.005697941137181246, 0.9943020588628291, -1.994171822396902 },
-		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
-		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
-		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.009564102178687455, 0.9904358978218357, -1.990068257175529 },
-		{ 0.01012991777617711, 0.989870082224633, -1.989457538864665 },
-		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
-		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
-		{ 0.01349885378464802, 0.9865011462156569, -1.98576733966659 },
-		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
-		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
-		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
-		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
-		{ 0.02015728444715757, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
-		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
-		{ 0.02681555221008397, 0.9731844477900297, -1.970269422622682 },
-		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
-		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
-		{ 0.03990825277803052, 0.9600917472219703, -1.953593160270272 },
-		{ 0.04468470227186335, 0.9553152977282937, -1.947148728928402 },
-		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
-		{ 0.05291196859294583, 0.9470880314071498, -1.935590668385107 },
-		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
-		{ 0.0662002506228301, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.08737256246672774, 0.9126274375363427, -1.880741141441922 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
-		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
-		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
-		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
-		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
-		{ 0.1503289276173477, 0.8496710723859783, -1.752362003179018 },
-		{ 0.1671117053831056, 0.8328882946198586, -1.711678582026151 },
-		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
-		{ 0.1954347338599746, 0.8045652661408609, -1.636577367339129 },
-		{ 0.2278658130660425, 0.772134186935479, -1.54035689744841 },
-		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
-		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
-		{ 0.2780585962413485, 0.7219414037589278, -1.36911694221468 },
-		{ 0.3062966346578139, 0.6937033653424187, -1.260497365967171 },
-		{ 0.3366794082814893, 0.6633205917191545, -1.133543532973203 },
-		{ 0.3526747325212291, 0.6473252674803143, -1.062474801875927 },
-		{ 0.4038084071595591, 0.5961915928408708, -0.8157392198398624 },
-		{ 0.4218647422055749, 0.5781352577946095, -0.7216036473971494 },
-		{ 0.4593860729410246, 0.5406139270592686, -0.5147864327225303 },
-		{ 0.4788006095390899, 0.5211993904614113, -0.4021602134949892 },
-		{ 0.5187756409130231, 0.4812243590873971, -0.15959218096542 },
-		{ 0.5600069445692514, 0.4399930554980156, 0.1024356493099694 }
-	},
-	.c_bpre9600022 = {
-		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
-		{ 0.001271892185004033, 0.998728107815001, -1.998721632860105 },
-		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
-		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
-		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
-		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
-		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
-		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
-		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
-		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
-		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
-		{ 0.003391932261075263, 0.9966080677390012, -1.996561968827503 },
-		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
-		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
-		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
-		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
-		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
-		{ 0.01349888606757408, 0.9865011139324832, -1.985767303861751 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
-		{ 0.02681552036263177, 0.9731844796374167, -1.970269461440493 },
-		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
-		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
-		{ 0.0529120305798396, 0.9470879694203849, -1.935590579107296 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
-		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
-		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
-		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
-		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
-		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
-		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
-		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
-		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
-		{ 0.05919638165034714, 0.9408036183529976, -1.926368210056912 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
-		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
-		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
-		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
-		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
-		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
-		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
-		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
-		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
-		{ 0.05919638165034714, 0.9408036183529976, -1.926368210056912 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
-		{ 0.001271892185004033, 0.998728107815001, -1.998721632860105 },
-		{ 0.00142753754444755, 0.9985724624555575, -1.99856430518216 },
-		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
-		{ 0.001905080679129224, 0.9980949193208749, -1.998080388158578 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
-		{ 0.002853040488605587, 0.9971469595113996, -1.997114353682704 },
-		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
-		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
-		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
-		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
-		{ 0.005697934629499153, 0.9943020653705209, -1.994171829202509 },
-		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
-		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
-		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.02015728444715758, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
-		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
-		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
-		{ 0.04468463974803309, 0.9553153602535356, -1.94714881456053 },
-		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
-		{ 0.05919638165034714, 0.9408036183529976, -1.926368210056912 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.08737286112178209, 0.912627138879761, -1.880740620136492 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1148882620418162, 0.8851117379581842, -1.82923588949804 },
-		{ 0.1280183134139537, 0.8719816865860999, -1.802163088738755 },
-		{ 0.1503286495599155, 0.8496713504402321, -1.752362654093637 },
-		{ 0.1671114328181645, 0.8328885671819604, -1.711679265563538 },
-		{ 0.1855550407065016, 0.8144449592938457, -1.66370569333951 },
-		{ 0.2165772113286436, 0.7834227886713574, -1.57510958880094 },
-		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
-		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
-		{ 0.001271892185004033, 0.998728107815001, -1.998721632860105 },
-		{ 0.00142753754444755, 0.9985724624555575, -1.99856430518216 },
-		{ 0.001512360032483805, 0.998487639967516, -1.998478484116066 },
-		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
-		{ 0.001905080679129224, 0.9980949193208749, -1.998080388158578 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
-		{ 0.002853040488605587, 0.9971469595113996, -1.997114353682704 },
-		{ 0.003022432832100747, 0.9969775671678996, -1.996940971518858 },
-		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
-		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
-		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
-		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
-		{ 0.005697934629499153, 0.9943020653705209, -1.994171829202509 },
-		{ 0.006035724058558791, 0.9939642759415045, -1.993818115881097 },
-		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
-		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
-		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
-		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
-		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
-		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
-		{ 0.01203501815220637, 0.9879649818479194, -1.987382121992113 },
-		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
-		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.02015728444715757, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
-		{ 0.02392522658422153, 0.9760747734157869, -1.973757612031065 },
-		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
-		{ 0.0300496190506501, 0.969950380949413, -1.966283935281568 },
-		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
-		{ 0.04468463974803309, 0.9553153602535356, -1.94714881456053 },
-		{ 0.04727809905774646, 0.9527219009431749, -1.943568135781725 },
-		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
-		{ 0.05919638165034691, 0.9408036183529976, -1.926368210056912 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.08737286112178209, 0.912627138879761, -1.880740620136492 },
-		{ 0.09232097946502393, 0.9076790205367768, -1.871992389610808 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
-		{ 0.001200548527715424, 0.9987994514722851, -1.998793682743783 },
-		{ 0.001271892185004033, 0.998728107815001, -1.998721632860105 },
-		{ 0.00142753754444755, 0.9985724624555575, -1.99856430518216 },
-		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
-		{ 0.001697409992233136, 0.9983025900077674, -1.998291055421122 },
-		{ 0.002018246836070207, 0.9979817531639302, -1.99796544343532 },
-		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002399655738662763, 0.9976003442613375, -1.997577283223565 },
-		{ 0.002542163396101586, 0.9974578366039056, -1.997431953353165 },
-		{ 0.002853040488605587, 0.9971469595113996, -1.997114353682704 },
-		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
-		{ 0.003391932261075263, 0.9966080677390012, -1.996561968827503 },
-		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
-		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
-		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
-		{ 0.005077851174361973, 0.9949221488260438, -1.994818748455509 },
-		{ 0.005697934629499153, 0.9943020653705209, -1.994171829202509 },
-		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
-		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
-		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
-		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
-		{ 0.008525143929762896, 0.9914748560704251, -1.991182902834333 },
-		{ 0.009564134590150012, 0.9904358654098977, -1.990068222265821 },
-		{ 0.01012995016878969, 0.9898700498312105, -1.989457503826128 },
-		{ 0.01136340279995648, 0.9886365972000836, -1.988117149403563 },
-		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
-		{ 0.01349888606757408, 0.9865011139324832, -1.985767303861751 },
-		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
-		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
-		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
-		{ 0.02015728444715757, 0.9798427155528432, -1.97820101732274 },
-		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
-		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
-		{ 0.02681552036263177, 0.9731844796374167, -1.970269461440493 },
-		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
-		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
-		{ 0.03990831561676508, 0.9600916843841145, -1.953593076765058 },
-		{ 0.04468463974803307, 0.9553153602535356, -1.94714881456053 },
-		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
-		{ 0.0529120305798396, 0.9470879694203849, -1.935590579107296 },
-		{ 0.0529120305798396, 0.9470879694203849, -1.935590579107296 },
-		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
-		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
-		{ 0.07822395757819908, 0.9217760424235261, -1.896331997427839 },
-		{ 0.08737286112178209, 0.912627138879761, -1.880740620136492 },
-		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
-		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
-		{ 0.1212883368623883, 0.8787116631384149, -1.816243992388378 },
-		{ 0.1280183134139537, 0.8719816865860999, -1.802163088738755 },
-		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
-		{ 0.1503286495599155, 0.8496713504402321, -1.752362654093637 },
-		{ 0.1671114328181645, 0.8328885671819604, -1.711679265563538 },
-		{ 0.1855550407065016, 0.8144449592938457, -1.66370569333951 },
-		{ 0.1954347338599746, 0.8045652661408609, -1.636577367339129 },
-		{ 0.2278655603843925, 0.7721344396158423, -1.540357690571506 },
-		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
-		{ 0.264735471371676, 0.7352645286284852, -1.417268046675904 },
-		{ 0.2780585962413485, 0.7219414037589278, -1.36911694221468 },
-		{ 0.3062966346578139, 0.6937033653424187, -1.260497365967171 },
-		{ 0.3366802766022222, 0.6633197234350987, -1.133539754460812 }
-	},
-	.c_bpre4800080040 = {
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.0001272698464275461, 0.999993636511615, -1.999967720335096 },
-		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
-		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
-		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
-		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
-		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
-		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
-		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
-		{ 0.002036217798719734, 0.9998981891104207, -1.993267625875558 },
-		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
-		{ 0.008143669182978703, 0.9995928179759731, -1.894396538041369 },
-		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
-		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
-		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
-		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
-		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
-		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
-		{ 0.0006795304907018602, 0.999966023598164, -1.999227243170693 },
-		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
-		{ 0.001359037180215036, 0.9999320481871105, -1.996977508250568 },
-		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
-		{ 0.002036217798719734, 0.9998981891104207, -1.993267625875558 },
-		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
-		{ 0.002717977681979694, 0.9998641011552721, -1.988055100639989 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
-		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
-		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
-		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
-		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
-		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
-		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
-		{ 0.002036217798719734, 0.9998981891104207, -1.993267625875558 },
-		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
-		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
-		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
-		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
-		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
-		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
-		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
-		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
-		{ 0.002036217798719734, 0.9998981891104207, -1.993267625875558 },
-		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
-		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
-		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
-		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.0001272698464275461, 0.999993636511615, -1.999967720335096 },
-		{ 0.0001428553148019067, 0.9999928572382751, -1.999960205021671 },
-		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
-		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
-		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
-		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
-		{ 0.0002857098610605676, 0.9999857145112071, -1.999855106878225 },
-		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
-		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
-		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
-		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
-		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
-		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
-		{ 0.002036217798719734, 0.9998981891104207, -1.993267625875558 },
-		{ 0.00228556259513827, 0.9998857219344829, -1.991533000325126 },
-		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
-		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.004570880552454798, 0.9997714572556161, -1.966432342927127 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
-		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
-		{ 0.008143669182978703, 0.9995928179759731, -1.894396538041369 },
-		{ 0.009140723647193772, 0.9995429651075202, -1.867312305528995 },
-		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
-		{ 0.0122004156783339, 0.9993899792165599, -1.765850670972606 },
-		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
-		{ 0.01628393486402549, 0.999185803384061, -1.589554178814092 },
-		{ 0.01827718755929216, 0.9990861407306839, -1.487771038503012 },
-		{ 0.0205143209067085, 0.9989742842599332, -1.362289617375435 },
-		{ 0.0243933888495387, 0.9987803305584761, -1.119448551885984 },
-		{ 0.02737861637457866, 0.998631069272508, -0.9138757038124511 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.0001272698464275461, 0.999993636511615, -1.999967720335096 },
-		{ 0.0001428553148019067, 0.9999928572382751, -1.999960205021671 },
-		{ 0.0001513499083880542, 0.9999924325046172, -1.999955781606605 },
-		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
-		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
-		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
-		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
-		{ 0.0002857098610605676, 0.9999857145112071, -1.999855106878225 },
-		{ 0.0003026986714271285, 0.9999848650665017, -1.999838263372452 },
-		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
-		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
-		{ 0.0006053931155918866, 0.9999697303947933, -1.999383350816027 },
-		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
-		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
-		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
-		{ 0.001210767906161515, 0.9999394617058355, -1.9975943227302 },
-		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
-		{ 0.002036217798719733, 0.9998981891104207, -1.993267625875558 },
-		{ 0.00228556259513827, 0.9998857219344829, -1.991533000325126 },
-		{ 0.002421461876222307, 0.9998789269129513, -1.990504129302991 },
-		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
-		{ 0.003050804558647558, 0.9998474598231686, -1.984972955964274 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.004570880552454798, 0.9997714572556161, -1.966432342927127 },
-		{ 0.004842651941370079, 0.9997578681574255, -1.962348733697547 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.006101209910639276, 0.9996949422605439, -1.940422462249227 },
-		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
-		{ 0.008143669182978703, 0.9995928179759731, -1.894396538041369 },
-		{ 0.009140723647193772, 0.9995429651075202, -1.867312305528995 },
-		{ 0.009684131322499553, 0.9995157949426802, -1.85129681415655 },
-		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.0001201266174158889, 0.9999939936692211, -1.999970904998273 },
-		{ 0.0001272698464275461, 0.999993636511615, -1.999967720335096 },
-		{ 0.0001428553148019067, 0.9999928572382751, -1.999960205021671 },
-		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
-		{ 0.0001698845141879116, 0.9999915057749519, -1.99994532856666 },
-		{ 0.0002020276145478931, 0.9999898986198159, -1.999924594401133 },
-		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
-		{ 0.0002402525133026302, 0.999987987374518, -1.999895633501168 },
-		{ 0.000254538511871426, 0.9999872730800867, -1.99988360964204 },
-		{ 0.0002857098610605676, 0.9999857145112071, -1.999855106878225 },
-		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
-		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
-		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0004805050298573803, 0.9999759749587874, -1.999606572226021 },
-		{ 0.0005090787622234937, 0.9999745463875961, -1.999559908152373 },
-		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
-		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
-		{ 0.0006795304907018602, 0.999966023598164, -1.999227243170693 },
-		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
-		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
-		{ 0.0008561537828800878, 0.9999571924621234, -1.998784491390396 },
-		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
-		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
-		{ 0.001359037180215036, 0.9999320481871105, -1.996977508250568 },
-		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
-		{ 0.001712261729676577, 0.9999143869203432, -1.99522507617636 },
-		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
-		{ 0.002036217798719733, 0.9998981891104207, -1.993267625875558 },
-		{ 0.00228556259513827, 0.9998857219344829, -1.991533000325126 },
-		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
-		{ 0.002717977681979694, 0.9998641011552721, -1.988055100639989 },
-		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
-		{ 0.003424390514337299, 0.9998287814974788, -1.98109440254788 },
-		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.004570880552454798, 0.9997714572556161, -1.966432342927127 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
-		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
-		{ 0.0064638838212084, 0.9996768068977846, -1.933187347098545 },
-		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
-		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
-		{ 0.008143669182978703, 0.9995928179759731, -1.894396538041369 },
-		{ 0.009140723647193772, 0.9995429651075202, -1.867312305528995 },
-		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
-		{ 0.01086971201995787, 0.9994565147678818, -1.813326090461238 },
-		{ 0.01292568137550575, 0.9993537166141615, -1.737858402905473 },
-		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
-		{ 0.01537036650894682, 0.9992314822889434, -1.632860892900521 },
-		{ 0.01628393486402327, 0.999185803384061, -1.589554178814092 },
-		{ 0.01827718755929216, 0.9990861407306839, -1.487771038503012 },
-		{ 0.0205143209067085, 0.9989742842599332, -1.362289617375435 },
-		{ 0.02173351651195787, 0.9989133249119611, -1.289238428377847 },
-		{ 0.02584295331959977, 0.9987078525446702, -1.021446542884322 },
-		{ 0.02737861637457866, 0.998631069272508, -0.9138757038124511 },
-		{ 0.03072886632770732, 0.9984635568310913, -0.6677740005200434 },
-		{ 0.03255461140340397, 0.9983722696842509, -0.5283106367870398 },
-		{ 0.03653767234131036, 0.9981731166001321, -0.2152900089678612 },
-		{ 0.04100842573648528, 0.997949614081081, 0.1421265646500948 }
-	},
-	.c_bpre9600080040 = {
-		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
-		{ 6.36350244385125e-05, 0.9999968182507458, -1.999990339185814 },
-		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
-		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
-		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
-		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
-		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
-		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
-		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
-		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
-		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
-		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
-		{ 0.0001698847872253687, 0.999991505791314, -1.999945328760923 },
-		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
-		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
-		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
-		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
-		{ 0.0006795301341335686, 0.9999660235163544, -1.999227239531347 },
-		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
-		{ 0.001359035015382198, 0.9999320482689169, -1.996977515444642 },
-		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
-		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
-		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
-		{ 0.00271798201138089, 0.9998641009916696, -1.988055072070793 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
-		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
-		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
-		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
-		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
-		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
-		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
-		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
-		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
-		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
-		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
-		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
-		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
-		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
-		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
-		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
-		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
-		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
-		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
-		{ 6.36350244385125e-05, 0.9999968182507458, -1.999990339185814 },
-		{ 7.142778495035297e-05, 0.9999964286127602, -1.999988265527374 },
-		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
-		{ 9.534468734389891e-05, 0.99999523276723, -1.999980687784888 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
-		{ 0.0001428554407236486, 0.9999928572300939, -1.999960204938692 },
-		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
-		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
-		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
-		{ 0.0002857096092226997, 0.9999857145275692, -1.999855107193774 },
-		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
-		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
-		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
-		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
-		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
-		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
-		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
-		{ 0.002285570871343191, 0.9998857220980886, -1.991533024389042 },
-		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
-		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.004570884146666729, 0.9997714564376801, -1.966432104124481 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.006101138436417942, 0.9996949430784174, -1.94042277933557 },
-		{ 0.006848170598617235, 0.9996575914928905, -1.925077113377608 },
-		{ 0.008143625397619373, 0.9995928187937629, -1.894396957711739 },
-		{ 0.009140682581348598, 0.9995429659252693, -1.867312774300711 },
-		{ 0.01025979203588549, 0.999487010550879, -1.833374942663341 },
-		{ 0.0122004156783339, 0.9993899792165599, -1.765850670972606 },
-		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
-		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
-		{ 6.36350244385125e-05, 0.9999968182507458, -1.999990339185814 },
-		{ 7.142778495035297e-05, 0.9999964286127602, -1.999988265527374 },
-		{ 7.567509735948181e-05, 0.9999962162451502, -1.999987053482323 },
-		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
-		{ 9.534468734389891e-05, 0.99999523276723, -1.999980687784888 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
-		{ 0.0001428554407236486, 0.9999928572300939, -1.999960204938692 },
-		{ 0.0001513499083880542, 0.9999924325046172, -1.999955781606605 },
-		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
-		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
-		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
-		{ 0.0002857096092226997, 0.9999857145275692, -1.999855107193774 },
-		{ 0.0003026988484489674, 0.9999848650828639, -1.99983826370579 },
-		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
-		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0005090738860599832, 0.9999745463057859, -1.999559905405264 },
-		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
-		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
-		{ 0.0006053931155918866, 0.9999697303947933, -1.999383350816027 },
-		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
-		{ 0.0007627447720074377, 0.9999618627741754, -1.999031070515955 },
-		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
-		{ 0.001210767587062397, 0.999939461624028, -1.997594316311407 },
-		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
-		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
-		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
-		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
-		{ 0.002285570871343191, 0.9998857220980886, -1.991533024389042 },
-		{ 0.00242147255846222, 0.9998789267493468, -1.990504103822282 },
-		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
-		{ 0.003050837643482305, 0.9998474594959691, -1.984972891902056 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.004570884146666729, 0.9997714564376801, -1.966432104124481 },
-		{ 0.004842651941370079, 0.9997578681574255, -1.962348733697547 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
-		{ 6.006339890483412e-05, 0.999996996830101, -1.999991224645367 },
-		{ 6.36350244385125e-05, 0.9999968182507458, -1.999990339185814 },
-		{ 7.142778495035297e-05, 0.9999964286127602, -1.999988265527374 },
-		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
-		{ 8.494243747129484e-05, 0.999995752878457, -1.999984208518551 },
-		{ 0.0001010140623681478, 0.999994949297153, -1.999978623134617 },
-		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
-		{ 0.0001201266174158889, 0.9999939936692211, -1.999970904998273 },
-		{ 0.00012726966087585, 0.9999936365197964, -1.999967720409916 },
-		{ 0.0001428554407236486, 0.9999928572300939, -1.999960204938692 },
-		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
-		{ 0.0001698847872253687, 0.999991505791314, -1.999945328760923 },
-		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
-		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002402539579671924, 0.9999879874072427, -1.999895634037066 },
-		{ 0.0002545410008714389, 0.9999872731128111, -1.999883610207857 },
-		{ 0.0002857096092226997, 0.9999857145275692, -1.999855107193774 },
-		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
-		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
-		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
-		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
-		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0004805028445858338, 0.9999759748769773, -1.99960656962848 },
-		{ 0.0005090738860599831, 0.9999745463057859, -1.999559905405264 },
-		{ 0.0005714151369485632, 0.999971429259213, -1.999449020713854 },
-		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
-		{ 0.0006795301341335686, 0.9999660235163544, -1.999227239531347 },
-		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
-		{ 0.0008561491896146904, 0.9999571925439324, -1.998784495954072 },
-		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
-		{ 0.001018134814320826, 0.9999490932594624, -1.998290722692466 },
-		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
-		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
-		{ 0.001359035015382198, 0.9999320482689169, -1.996977515444642 },
-		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
-		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
-		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
-		{ 0.002036228240448031, 0.9998981889468129, -1.993267604412823 },
-		{ 0.002285570871343191, 0.9998857220980886, -1.991533024389042 },
-		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
-		{ 0.00271798201138089, 0.9998641009916696, -1.988055072070793 },
-		{ 0.00271798201138089, 0.9998641009916696, -1.988055072070793 },
-		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
-		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
-		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
-		{ 0.004072249170363886, 0.9997963882591158, -1.973319364839386 },
-		{ 0.004570884146666729, 0.9997714564376801, -1.966432104124481 },
-		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
-		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
-		{ 0.006463885231962107, 0.9996768060799256, -1.93318701161995 },
-		{ 0.006848170598617235, 0.9996575914928905, -1.925077113377608 },
-		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
-		{ 0.008143625397619373, 0.9995928187937629, -1.894396957711739 },
-		{ 0.009140682581348598, 0.9995429659252693, -1.867312774300711 },
-		{ 0.01025979203588549, 0.999487010550879, -1.833374942663341 },
-		{ 0.01086971201995787, 0.9994565147678818, -1.813326090461238 },
-		{ 0.01292565347205853, 0.9993537174317561, -1.737859050630892 },
-		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
-		{ 0.01537033934657654, 0.9992314831064377, -1.632861648568635 },
-		{ 0.01628393486402327, 0.999185803384061, -1.589554178814092 },
-		{ 0.01827718755929216, 0.9990861407306839, -1.487771038503012 },
-		{ 0.02051473404555641, 0.9989742809907974, -1.362285785289611 }
-	}
-};
+#include "Scales.hpp"
+const ScaleDef et_minor = {
+	.name = "Minor (ET)",
+	.description = "Scales from C Major",
+	.scalename = {
+		"Minor chords",
+		"Minor 6th chords",
+		"Minor 7th chords",
+		"Half Diminished 7th chords",
+		"Minor Pentatonic; C1-",
+		"Minor Pentatonic; C5-",
+		"Blues scale; C1-",
+		"Blues scale; C4-",
+		"Harmonic Minor; C1-",
+		"Harmonic Minor; C3-",
+		"Harmonic Minor; C6-"},
+	.notedesc = {
+		"Oct",
+		"m3",
+		"P5",
+		"Oct",
+		"m3",
+		"P5",
+		"Oct",
+		"m3",
+		"P5",
+		"Oct",
+		"m3",
+		"P5",
+		"Oct",
+		"m3",
+		"P5",
+		"Oct",
+		"m3",
+		"P5",
+		"Oct",
+		"m3",
+		"P5",
+		"Oct",
+		"m3",
+		"P5",
+		"m6",
+		"Oct",
+		"m3",
+		"P5",
+		"m6",
+		"Oct",
+		"m3",
+		"P5",
+		"m6",
+		"Oct",
+		"m3",
+		"P5",
+		"m6",
+		"Oct",
+		"m3",
+		"P5",
+		"m6",
+		"Oct",
+		"Oct",
+		"m3",
+		"P5",
+		"m7",
+		"Oct",
+		"m3",
+		"P5",
+		"m7",
+		"Oct",
+		"m3",
+		"P5",
+		"m7",
+		"Oct",
+		"m3",
+		"P5",
+		"m7",
+		"Oct",
+		"m3",
+		"P5",
+		"m7",
+		"Oct",
+		"Oct",
+		"m3",
+		"M4",
+		"m7",
+		"Oct",
+		"m3",
+		"M4",
+		"m7",
+		"Oct",
+		"m3",
+		"M4",
+		"m7",
+		"Oct",
+		"m3",
+		"M4",
+		"m7",
+		"Oct",
+		"m3",
+		"M4",
+		"m7",
+		"Oct",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"m3",
+		"P4",
+		"P4",
+		"m7",
+		"Oct",
+		"Oct",
+		"M2",
+		"M3",
+		"P5",
+		"d5",
+		"M6",
+		"Oct",
+		"M2",
+		"M3",
+		"P5",
+		"d5",
+		"M6",
+		"Oct",
+		"M2",
+		"M3",
+		"P5",
+		"d5",
+		"M6",
+		"Oct",
+		"M2",
+		"M3",
+		"M3",
+		"P5",
+		"d5",
+		"M6",
+		"Oct",
+		"M2",
+		"M3",
+		"P5",
+		"d5",
+		"M6",
+		"Oct",
+		"M2",
+		"M3",
+		"P5",
+		"d5",
+		"M6",
+		"Oct",
+		"M2",
+		"M3",
+		"P5",
+		"d5",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"M7",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"m6",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5",
+		"m6",
+		"M7",
+		"Oct",
+		"M2",
+		"m3",
+		"P4",
+		"P5"},
+	.freq = {
+		32.70319566257483,
+		38.89087296526011,
+		48.99942949771865,
+		65.40639132514966,
+		77.78174593052022,
+		97.9988589954373,
+		130.8127826502993,
+		155.5634918610405,
+		195.9977179908747,
+		261.6255653005987,
+		311.1269837220808,
+		391.9954359817493,
+		523.2511306011974,
+		622.2539674441617,
+		783.9908719634986,
+		1046.502261202394,
+		1244.507934888323,
+		1567.981743926997,
+		2093.004522404789,
+		2489.015869776647,
+		3135.963487853995,
+		65.40639132514966,
+		77.78174593052022,
+		97.9988589954373,
+		103.8261743949863,
+		130.8127826502993,
+		155.5634918610405,
+		195.9977179908747,
+		207.6523487899725,
+		261.6255653005987,
+		311.1269837220808,
+		391.9954359817493,
+		415.3046975799451,
+		523.2511306011974,
+		622.2539674441617,
+		783.9908719634986,
+		830.6093951598901,
+		1046.502261202394,
+		1244.507934888323,
+		1567.981743926997,
+		1661.21879031978,
+		2093.004522404789,
+		65.40639132514966,
+		77.78174593052022,
+		97.9988589954373,
+		116.5409403795225,
+		130.8127826502993,
+		155.5634918610405,
+		195.9977179908747,
+		233.081880759045,
+		261.6255653005987,
+		311.1269837220808,
+		391.9954359817493,
+		466.16376151809,
+		523.2511306011974,
+		622.2539674441617,
+		783.9908719634986,
+		932.3275230361796,
+		1046.502261202394,
+		1244.507934888323,
+		1567.981743926997,
+		1864.655046072359,
+		2093.004522404789,
+		65.40639132514966,
+		77.78174593052022,
+		82.40688922821748,
+		116.5409403795225,
+		130.8127826502993,
+		155.5634918610405,
+		164.813778456435,
+		233.081880759045,
+		261.6255653005987,
+		311.1269837220808,
+		329.62755691287,
+		466.16376151809,
+		523.2511306011974,
+		622.2539674441617,
+		659.2551138257398,
+		932.3275230361796,
+		1046.502261202394,
+		1244.507934888323,
+		1318.51022765148,
+		1864.655046072359,
+		2093.004522404789,
+		32.70319566257483,
+		38.89087296526011,
+		43.65352892912547,
+		48.99942949771865,
+		58.27047018976125,
+		65.40639132514966,
+		77.78174593052022,
+		87.30705785825096,
+		97.9988589954373,
+		116.5409403795225,
+		130.8127826502993,
+		155.5634918610405,
+		174.6141157165019,
+		195.9977179908747,
+		233.081880759045,
+		261.6255653005987,
+		311.1269837220808,
+		349.2282314330038,
+		391.9954359817493,
+		466.16376151809,
+		523.2511306011974,
+		523.2511306011974,
+		622.2539674441617,
+		698.4564628660077,
+		783.9908719634986,
+		932.3275230361796,
+		1046.502261202394,
+		1244.507934888323,
+		1396.912925732015,
+		1567.981743926997,
+		1864.655046072359,
+		2093.004522404789,
+		2489.015869776647,
+		2793.825851464032,
+		3135.963487853995,
+		3729.31009214472,
+		4186.009044809577,
+		4978.031739553294,
+		5587.651702928061,
+		6271.926975707988,
+		7458.620184289439,
+		8372.018089619156,
+		32.70319566257483,
+		38.89087296526011,
+		43.65352892912547,
+		46.24930283895431,
+		48.99942949771865,
+		58.27047018976125,
+		65.40639132514966,
+		77.78174593052022,
+		87.30705785825096,
+		92.4986056779086,
+		97.9988589954373,
+		116.5409403795225,
+		130.8127826502993,
+		155.5634918610405,
+		174.6141157165019,
+		184.9972113558172,
+		195.9977179908747,
+		233.081880759045,
+		261.6255653005987,
+		311.1269837220808,
+		349.2282314330038,
+		349.2282314330038,
+		369.9944227116345,
+		391.9954359817493,
+		466.16376151809,
+		523.2511306011974,
+		622.253967444162,
+		698.4564628660077,
+		739.9888454232686,
+		783.9908719634986,
+		932.3275230361796,
+		1046.502261202394,
+		1244.507934888324,
+		1396.912925732015,
+		1479.977690846538,
+		1567.981743926997,
+		1864.655046072359,
+		2093.004522404789,
+		2489.015869776647,
+		2793.825851464032,
+		2959.955381693076,
+		3135.963487853995,
+		32.70319566257483,
+		36.70809598967595,
+		38.89087296526011,
+		43.65352892912547,
+		48.99942949771865,
+		51.91308719749313,
+		61.73541265701549,
+		65.40639132514966,
+		73.41619197935189,
+		77.78174593052022,
+		87.30705785825096,
+		97.9988589954373,
+		103.8261743949863,
+		123.470825314031,
+		130.8127826502993,
+		146.8323839587038,
+		155.5634918610405,
+		174.6141157165019,
+		195.9977179908747,
+		207.6523487899725,
+		246.941650628062,
+		246.941650628062,
+		261.6255653005987,
+		293.6647679174076,
+		311.126983722081,
+		349.228231433004,
+		391.9954359817493,
+		415.3046975799451,
+		493.883301256124,
+		523.2511306011974,
+		587.3295358348151,
+		622.253967444162,
+		698.4564628660079,
+		783.9908719634986,
+		830.6093951598901,
+		987.7666025122483,
+		1046.502261202395,
+		1174.65907166963,
+		1244.507934888324,
+		1396.912925732016,
+		1567.981743926997,
+		1661.21879031978,
+		1661.21879031978,
+		1975.533205024497,
+		2093.004522404789,
+		2349.318143339261,
+		2489.015869776647,
+		2793.825851464032,
+		3135.963487853995,
+		3322.43758063956,
+		3951.066410048992,
+		4186.009044809577,
+		4698.636286678521,
+		4978.031739553296,
+		5587.651702928061,
+		6271.926975707988,
+		6644.875161279121,
+		7902.132820097983,
+		8372.018089619156,
+		9397.272573357042,
+		9956.06347910659,
+		11175.30340585612,
+		12543.85395141598
+	}
+};
@@ -1,1647 +1,482 @@
-#include "Scales.hpp"
-Scale gamelan = {
-	.name = "Gamelan Pelog",
-	.description = "Gamelan tunings in C.",
-	.scalename = {
-		"Java (5 notes) low, 5-TET",
-		"Bali (7 notes) low, 7-TET",
-		"Pelog, var1, low, pathet nem or lima? 7-TET",
-		"Pelog, var2, low, pathet nem or lima? 7-TET",
-		"Pelog, var3, low, pathet barang? 7-TET",
-		"Java (5 note) mid, 5-TET",
-		"Bali (7 note) mid, 7-TET",
-		"Bali (7 note) high, 7-TET",
-		"Pelog, var1, high, pathet nem or lima? 7-TET",
-		"Pelog, var2, high, pathet nem or lima? 7-TET",
-		"Pelog, var3, high, pathet barang? 7-TET"},
-	.notedesc = {
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		""},
-	.c_maxq48000 = {
-		0.004280838301772239,
-		0.004917391915254073,
-		0.005648600003928072,
-		0.006488537532548423,
-		0.007453372389974894,
-		0.008561676603544479,
-		0.009834783830508146,
-		0.01129720000785614,
-		0.01297707506509685,
-		0.01490674477994979,
-		0.01712335320708896,
-		0.01966956766101629,
-		0.02259440001571229,
-		0.02595415013019369,
-		0.02981348955989958,
-		0.03424670641417792,
-		0.03933913532203259,
-		0.04518880003142458,
-		0.05190830026038738,
-		0.05962697911979915,
-		0.06849341282835583,
-		0.004542637689571389,
-		0.005015478637475206,
-		0.005537537369691395,
-		0.006113936941453135,
-		0.006750333664321347,
-		0.007452972612576519,
-		0.00822874890724385,
-		0.009085275379142778,
-		0.01003095727495041,
-		0.01107507473938279,
-		0.01222787388290627,
-		0.01350066732864269,
-		0.01490594522515304,
-		0.0164574978144877,
-		0.01817055075828556,
-		0.02006191454990082,
-		0.02215014947876558,
-		0.02445574776581254,
-		0.02700133465728539,
-		0.02981189045030607,
-		0.0329149956289754,
-		0.004935336771270113,
-		0.005449053575608102,
-		0.006016242912275698,
-		0.007333882257074974,
-		0.008097262494554908,
-		0.009870673542540226,
-		0.0108981071512162,
-		0.0120324858245514,
-		0.01466776451414995,
-		0.01619452498910982,
-		0.01974134708508045,
-		0.02179621430243241,
-		0.02406497164910279,
-		0.0293355290282999,
-		0.03238904997821963,
-		0.0394826941701609,
-		0.04359242860486481,
-		0.04812994329820559,
-		0.05867105805659979,
-		0.06477809995643927,
-		0.07896538834032181,
-		0.005197136159069263,
-		0.005738103534363367,
-		0.006994826557627904,
-		0.00772291465224406,
-		0.009414338411341315,
-		0.01039427231813853,
-		0.01147620706872673,
-		0.01398965311525581,
-		0.01544582930448812,
-		0.01882867682268263,
-		0.02078854463627705,
-		0.02295241413745347,
-		0.02797930623051162,
-		0.03089165860897624,
-		0.03765735364536526,
-		0.0415770892725541,
-		0.04590482827490694,
-		0.05595861246102323,
-		0.06178331721795248,
-		0.07531470729073052,
-		0.0831541785451082,
-		0.005458935546868411,
-		0.00665451696905477,
-		0.007347182404097812,
-		0.008111947047413144,
-		0.008956315670526096,
-		0.01091787109373682,
-		0.01330903393810954,
-		0.01469436480819562,
-		0.01622389409482629,
-		0.01791263134105219,
-		0.02183574218747365,
-		0.02661806787621908,
-		0.02938872961639125,
-		0.03244778818965258,
-		0.03582526268210438,
-		0.04367148437494729,
-		0.05323613575243816,
-		0.0587774592327825,
-		0.06489557637930515,
-		0.07165052536420877,
-		0.08734296874989458,
-		0.06849341282835583,
-		0.07867827064406517,
-		0.09037760006284916,
-		0.1038166005207748,
-		0.1192539582395983,
-		0.1369868256567117,
-		0.1573565412881303,
-		0.1807552001256983,
-		0.2076332010415495,
-		0.2385079164791966,
-		0.2739736513134233,
-		0.3147130825762607,
-		0.3615104002513966,
-		0.4152664020830991,
-		0.4770158329583932,
-		0.5479473026268467,
-		0.6294261651525214,
-		0.7230208005027933,
-		0.8305328041661981,
-		0.9540316659167865,
-		1.095894605253693,
-		0.03738829906776771,
-		0.0412800289348227,
-		0.0455768470710893,
-		0.0503209189175047,
-		0.05555879889524711,
-		0.06134188725255453,
-		0.06772693446450676,
-		0.07477659813553542,
-		0.0825600578696454,
-		0.0911536941421786,
-		0.1006418378350094,
-		0.1111175977904942,
-		0.1226837745051091,
-		0.1354538689290135,
-		0.1495531962710708,
-		0.1651201157392908,
-		0.1823073882843572,
-		0.2012836756700188,
-		0.2222351955809884,
-		0.2453675490102181,
-		0.270907737858027,
-		0.07687099323792862,
-		0.08487245753968752,
-		0.09370679036929488,
-		0.1034606846067687,
-		0.1142298569518469,
-		0.1261199872089938,
-		0.1392477553421254,
-		0.1537419864758572,
-		0.169744915079375,
-		0.1874135807385898,
-		0.2069213692135373,
-		0.2284597139036938,
-		0.2522399744179876,
-		0.2784955106842508,
-		0.3074839729517145,
-		0.3394898301587501,
-		0.3748271614771795,
-		0.4138427384270746,
-		0.4569194278073876,
-		0.5044799488359752,
-		0.5569910213685016,
-		0.06927881099175327,
-		0.07649000873578483,
-		0.08445181654599834,
-		0.1029479174919434,
-		0.1136637161574116,
-		0.1385576219835065,
-		0.1529800174715697,
-		0.1689036330919967,
-		0.2058958349838869,
-		0.2273274323148232,
-		0.2771152439670131,
-		0.3059600349431393,
-		0.3378072661839934,
-		0.4117916699677737,
-		0.4546548646296463,
-		0.5542304879340262,
-		0.6119200698862787,
-		0.6756145323679867,
-		0.8235833399355474,
-		0.9093097292592927,
-		1.108460975868052,
-		0.06954061037955243,
-		0.07677905869454012,
-		0.09359472090561125,
-		0.1033369498871125,
-		0.1259691528962338,
-		0.1390812207591049,
-		0.1535581173890802,
-		0.1871894418112225,
-		0.206673899774225,
-		0.2519383057924675,
-		0.2781624415182097,
-		0.3071162347781605,
-		0.374378883622445,
-		0.4133477995484501,
-		0.503876611584935,
-		0.5563248830364195,
-		0.6142324695563209,
-		0.74875776724489,
-		0.8266955990969002,
-		1.00775322316987,
-		1.112649766072839,
-		0.06980240976735158,
-		0.08509009060277742,
-		0.09394707675208117,
-		0.1037259822822816,
-		0.1145227693333828,
-		0.1396048195347032,
-		0.1701801812055548,
-		0.1878941535041623,
-		0.2074519645645632,
-		0.2290455386667655,
-		0.2792096390694063,
-		0.3403603624111097,
-		0.3757883070083247,
-		0.4149039291291264,
-		0.458091077333531,
-		0.5584192781388126,
-		0.6807207248222193,
-		0.7515766140166493,
-		0.8298078582582528,
-		0.9161821546670621,
-		1.116838556277625
-	},
-	.c_maxq96000 = {
-		0.00214041915088612,
-		0.002458695957627037,
-		0.002824300001964036,
-		0.003244268766274211,
-		0.003726686194987447,
-		0.004280838301772239,
-		0.004917391915254073,
-		0.005648600003928072,
-		0.006488537532548423,
-		0.007453372389974894,
-		0.008561676603544479,
-		0.009834783830508146,
-		0.01129720000785614,
-		0.01297707506509685,
-		0.01490674477994979,
-		0.01712335320708896,
-		0.01966956766101629,
-		0.02259440001571229,
-		0.02595415013019369,
-		0.02981348955989958,
-		0.03424670641417792,
-		0.002271318844785695,
-		0.002507739318737603,
-		0.002768768684845698,
-		0.003056968470726567,
-		0.003375166832160673,
-		0.003726486306288259,
-		0.004114374453621925,
-		0.004542637689571389,
-		0.005015478637475206,
-		0.005537537369691395,
-		0.006113936941453135,
-		0.006750333664321347,
-		0.007452972612576519,
-		0.00822874890724385,
-		0.009085275379142778,
-		0.01003095727495041,
-		0.01107507473938279,
-		0.01222787388290627,
-		0.01350066732864269,
-		0.01490594522515304,
-		0.0164574978144877,
-		0.002467668385635057,
-		0.002724526787804051,
-		0.003008121456137849,
-		0.003666941128537487,
-		0.004048631247277454,
-		0.004935336771270113,
-		0.005449053575608102,
-		0.006016242912275698,
-		0.007333882257074974,
-		0.008097262494554908,
-		0.009870673542540226,
-		0.0108981071512162,
-		0.0120324858245514,
-		0.01466776451414995,
-		0.01619452498910982,
-		0.01974134708508045,
-		0.02179621430243241,
-		0.02406497164910279,
-		0.0293355290282999,
-		0.03238904997821963,
-		0.0394826941701609,
-		0.002598568079534631,
-		0.002869051767181684,
-		0.003497413278813952,
-		0.00386145732612203,
-		0.004707169205670657,
-		0.005197136159069263,
-		0.005738103534363367,
-		0.006994826557627904,
-		0.00772291465224406,
-		0.009414338411341315,
-		0.01039427231813853,
-		0.01147620706872673,
-		0.01398965311525581,
-		0.01544582930448812,
-		0.01882867682268263,
-		0.02078854463627705,
-		0.02295241413745347,
-		0.02797930623051162,
-		0.03089165860897624,
-		0.03765735364536526,
-		0.0415770892725541,
-		0.002729467773434206,
-		0.003327258484527385,
-		0.003673591202048906,
-		0.004055973523706572,
-		0.004478157835263048,
-		0.005458935546868411,
-		0.00665451696905477,
-		0.007347182404097812,
-		0.008111947047413144,
-		0.008956315670526096,
-		0.01091787109373682,
-		0.01330903393810954,
-		0.01469436480819562,
-		0.01622389409482629,
-		0.01791263134105219,
-		0.02183574218747365,
-		0.02661806787621908,
-		0.02938872961639125,
-		0.03244778818965258,
-		0.03582526268210438,
-		0.04367148437494729,
-		0.03424670641417792,
-		0.03933913532203259,
-		0.04518880003142458,
-		0.05190830026038738,
-		0.05962697911979915,
-		0.06849341282835583,
-		0.07867827064406517,
-		0.09037760006284916,
-		0.1038166005207748,
-		0.1192539582395983,
-		0.1369868256567117,
-		0.1573565412881303,
-		0.1807552001256983,
-		0.2076332010415495,
-		0.2385079164791966,
-		0.2739736513134233,
-		0.3147130825762607,
-		0.3615104002513966,
-		0.4152664020830991,
-		0.4770158329583932,
-		0.5479473026268467,
-		0.01869414953388385,
-		0.02064001446741135,
-		0.02278842353554465,
-		0.02516045945875235,
-		0.02777939944762356,
-		0.03067094362627727,
-		0.03386346723225338,
-		0.03738829906776771,
-		0.0412800289348227,
-		0.0455768470710893,
-		0.0503209189175047,
-		0.05555879889524711,
-		0.06134188725255453,
-		0.06772693446450676,
-		0.07477659813553542,
-		0.0825600578696454,
-		0.0911536941421786,
-		0.1006418378350094,
-		0.1111175977904942,
-		0.1226837745051091,
-		0.1354538689290135,
-		0.03843549661896431,
-		0.04243622876984376,
-		0.04685339518464744,
-		0.05173034230338433,
-		0.05711492847592345,
-		0.06305999360449691,
-		0.06962387767106271,
-		0.07687099323792862,
-		0.08487245753968752,
-		0.09370679036929488,
-		0.1034606846067687,
-		0.1142298569518469,
-		0.1261199872089938,
-		0.1392477553421254,
-		0.1537419864758572,
-		0.169744915079375,
-		0.1874135807385898,
-		0.2069213692135373,
-		0.2284597139036938,
-		0.2522399744179876,
-		0.2784955106842508,
-		0.03463940549587664,
-		0.03824500436789242,
-		0.04222590827299917,
-		0.05147395874597172,
-		0.05683185807870579,
-		0.06927881099175327,
-		0.07649000873578483,
-		0.08445181654599834,
-		0.1029479174919434,
-		0.1136637161574116,
-		0.1385576219835065,
-		0.1529800174715697,
-		0.1689036330919967,
-		0.2058958349838869,
-		0.2273274323148232,
-		0.2771152439670131,
-		0.3059600349431393,
-		0.3378072661839934,
-		0.4117916699677737,
-		0.4546548646296463,
-		0.5542304879340262,
-		0.03477030518977622,
-		0.03838952934727006,
-		0.04679736045280562,
-		0.05166847494355626,
-		0.06298457644811688,
-		0.06954061037955243,
-		0.07677905869454012,
-		0.09359472090561125,
-		0.1033369498871125,
-		0.1259691528962338,
-		0.1390812207591049,
-		0.1535581173890802,
-		0.1871894418112225,
-		0.206673899774225,
-		0.2519383057924675,
-		0.2781624415182097,
-		0.3071162347781605,
-		0.374378883622445,
-		0.4133477995484501,
-		0.503876611584935,
-		0.5563248830364195,
-		0.03490120488367579,
-		0.04254504530138871,
-		0.04697353837604058,
-		0.0518629911411408,
-		0.05726138466669138,
-		0.06980240976735158,
-		0.08509009060277742,
-		0.09394707675208117,
-		0.1037259822822816,
-		0.1145227693333828,
-		0.1396048195347032,
-		0.1701801812055548,
-		0.1878941535041623,
-		0.2074519645645632,
-		0.2290455386667655,
-		0.2792096390694063,
-		0.3403603624111097,
-		0.3757883070083247,
-		0.4149039291291264,
-		0.458091077333531,
-		0.5584192781388126
-	},
-	.c_bpre4800022 = {
-		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002455675379420357, 0.9975443246205805, -1.997520173625104 },
-		{ 0.002820313762106935, 0.997179686237901, -1.997147824671526 },
-		{ 0.003239013414897876, 0.9967609865851084, -1.996718953754668 },
-		{ 0.003719752621409274, 0.9962802473785984, -1.996224798139723 },
-		{ 0.004271689139653243, 0.9957283108603474, -1.995655165543826 },
-		{ 0.004905320417271659, 0.9950946795827299, -1.994998194652291 },
-		{ 0.005632679862615187, 0.9943673201373994, -1.994240054057992 },
-		{ 0.006467535621893479, 0.993532464378119, -1.993364606671232 },
-		{ 0.007425655690563023, 0.9925743443095291, -1.992352962951053 },
-		{ 0.008525143929763187, 0.9914748560704251, -1.991182902834333 },
-		{ 0.009786552743053187, 0.9902134472575826, -1.989828463141434 },
-		{ 0.01123365852935885, 0.9887663414713908, -1.988258720653539 },
-		{ 0.01289322930557193, 0.9871067706944553, -1.986437533596391 },
-		{ 0.01479617101869176, 0.9852038289814914, -1.984321628108906 },
-		{ 0.01697760978050467, 0.9830223902198703, -1.98185961909105 },
-		{ 0.01947739304534638, 0.9805226069546892, -1.97899030684099 },
-		{ 0.02234105798565489, 0.9776589420143451, -1.97564006851586 },
-		{ 0.02562022324921783, 0.9743797767508363, -1.971720421537676 },
-		{ 0.0293734788877801, 0.9706265211124329, -1.967124392497941 },
-		{ 0.0336669170800795, 0.9663330829199375, -1.961722512131246 },
-		{ 0.002268741635181674, 0.9977312583648182, -1.997710646246306 },
-		{ 0.002504595320012913, 0.9974954046800029, -1.997470281253426 },
-		{ 0.002764941180014413, 0.9972350588199974, -1.997204436926285 },
-		{ 0.003052298238541464, 0.9969477017614744, -1.996910378760904 },
-		{ 0.00336948058370905, 0.996630519416316, -1.996585029265835 },
-		{ 0.003719550481575319, 0.9962804495184272, -1.996225006311468 },
-		{ 0.004105921289353948, 0.9958940787106473, -1.995826505817879 },
-		{ 0.004532336081756217, 0.9954676639182437, -1.995385309289981 },
-		{ 0.005002924154524384, 0.9949970758454822, -1.994896708198983 },
-		{ 0.00552223095144347, 0.9944777690485659, -1.994355451801206 },
-		{ 0.006095286457608684, 0.9939047135423946, -1.99375565010807 },
-		{ 0.006727633773033509, 0.9932723662282257, -1.993090712328057 },
-		{ 0.007425265907365684, 0.9925747340926392, -1.992353376017888 },
-		{ 0.008194983989073293, 0.9918050160109287, -1.991535282762392 },
-		{ 0.009044143064914419, 0.9909558569352631, -1.990627189081764 },
-		{ 0.009980832018494749, 0.9900191679817392, -1.989618708171955 },
-		{ 0.01101399276010067, 0.9889860072402193, -1.988498098099937 },
-		{ 0.01215340746739247, 0.987846592532671, -1.987252173897858 },
-		{ 0.01340994191521493, 0.9865900580847849, -1.985865918432031 },
-		{ 0.01479539724093735, 0.9852046027590731, -1.984322494495244 },
-		{ 0.0163228102155649, 0.9836771897844389, -1.982602732277676 },
-		{ 0.002464626478073929, 0.9975353735219262, -1.997511046032793 },
-		{ 0.002720818439710977, 0.9972791815602893, -1.997249529846532 },
-		{ 0.003003600918622879, 0.996996399081378, -1.996960258385774 },
-		{ 0.003660223929868258, 0.9963397760701419, -1.996286088979986 },
-		{ 0.004040444706977448, 0.9959595552930295, -1.995894122508933 },
-		{ 0.004923178572471822, 0.9950768214275286, -1.994979631831219 },
-		{ 0.005434234026439184, 0.9945657659735608, -1.994447321131814 },
-		{ 0.005998180218768663, 0.9940018197812336, -1.993857475082887 },
-		{ 0.007307024632872887, 0.9926929753681415, -1.992478623710346 },
-		{ 0.008064564220525022, 0.9919354357794891, -1.991674236609283 },
-		{ 0.009822132419247941, 0.9901778675809153, -1.989790072217562 },
-		{ 0.01083895010162357, 0.9891610498984873, -1.988688567235508 },
-		{ 0.01196039520507527, 0.9880396047949961, -1.987463971990684 },
-		{ 0.01456072115160865, 0.9854392788484015, -1.984585031628096 },
-		{ 0.01606409124498306, 0.9839359087550449, -1.982895376158945 },
-		{ 0.01954779055323641, 0.9804522094470887, -1.978908758740485 },
-		{ 0.02156041736394286, 0.9784395826362776, -1.976560061851877 },
-		{ 0.02377773935668981, 0.9762222606434517, -1.9739337475428 },
-		{ 0.02890942770276269, 0.9710905722972574, -1.967699007663668 },
-		{ 0.03187012746243924, 0.9681298725376161, -1.964001984664346 },
-		{ 0.03871340207427804, 0.9612865979257367, -1.955174944130868 },
-		{ 0.002595195007245043, 0.9974048049927547, -1.997377829871723 },
-		{ 0.002864941146769568, 0.9971350588532339, -1.997102180249547 },
-		{ 0.003491301929337871, 0.9965086980706767, -1.996459856152488 },
-		{ 0.003854010051466324, 0.9961459899485378, -1.996086461811262 },
-		{ 0.004696104739016382, 0.995303895261, -1.99521547437101 },
-		{ 0.005183654977365412, 0.9948163450226351, -1.994708585095647 },
-		{ 0.005721674405765285, 0.9942783255942423, -1.994147000380772 },
-		{ 0.006970414669514226, 0.9930295853305147, -1.992834560490667 },
-		{ 0.007693140731787063, 0.9923068592690847, -1.992069209829873 },
-		{ 0.009370130144540632, 0.9906298698563487, -1.990277024585392 },
-		{ 0.01034045263057374, 0.9896595473695812, -1.98922963247142 },
-		{ 0.01141063713538108, 0.9885893628652805, -1.988065575363661 },
-		{ 0.01389224265836425, 0.9861077573416941, -1.985330405316782 },
-		{ 0.01532716149424152, 0.9846728385057861, -1.983725931655287 },
-		{ 0.01865252517743781, 0.9813474748225622, -1.979942789809291 },
-		{ 0.02057398030054392, 0.9794260196997644, -1.977715389760713 },
-		{ 0.02269100766490142, 0.977308992335103, -1.975226013409265 },
-		{ 0.02759149091065004, 0.9724085090894656, -1.969321152547283 },
-		{ 0.03041940110901258, 0.969580598891042, -1.965822670796633 },
-		{ 0.03695713365938036, 0.9630428663406199, -1.957478008133478 },
-		{ 0.04072460915066578, 0.9592753908493483, -1.952505476065483 },
-		{ 0.002725746446155033, 0.9972742535538452, -1.997244494257843 },
-		{ 0.003321731581344078, 0.9966782684186688, -1.996634059472183 },
-		{ 0.003666849272886922, 0.9963331507271275, -1.996279268925516 },
-		{ 0.004047758482048997, 0.9959522415179521, -1.995886571394329 },
-		{ 0.004468145073428688, 0.9955318549265721, -1.995451819106062 },
-		{ 0.005444063198621421, 0.9945559368013793, -1.994437062514175 },
-		{ 0.006632455269400163, 0.9933675447317344, -1.993191002725379 },
-		{ 0.007320278750931261, 0.9926797212495503, -1.992464589843143 },
-		{ 0.00807910664768526, 0.991920893353061, -1.991658749415211 },
-		{ 0.008916299880631097, 0.9910837001200516, -1.990764278728822 },
-		{ 0.01085850152111064, 0.9891414984790372, -1.988667305112966 },
-		{ 0.0132208564891129, 0.9867791435108961, -1.98607534757381 },
-		{ 0.01458690652507531, 0.9854130934752185, -1.984555759813839 },
-		{ 0.01609300572628233, 0.9839069942737698, -1.982862697449467 },
-		{ 0.01775316364429965, 0.9822468363557451, -1.980974914176341 },
-		{ 0.02159909598693802, 0.9784009040133551, -1.976514597258002 },
-		{ 0.02626692193192029, 0.9737330780680977, -1.970936875404792 },
-		{ 0.02896109876204459, 0.9710389012380503, -1.967635114536749 },
-		{ 0.0319270266192588, 0.9680729733808444, -1.963930215809802 },
-		{ 0.03519115246921783, 0.9648088475308702, -1.9597675335465 },
-		{ 0.04273160837279472, 0.9572683916272183, -1.94980734072582 },
-		{ 0.0336669170800795, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03857541725084997, 0.9614245827492202, -1.955356833864525 },
-		{ 0.04418299309939113, 0.9558170069006087, -1.94783477776731 },
-		{ 0.05058405065909666, 0.9494159493410096, -1.938920100156369 },
-		{ 0.05788409485184628, 0.9421159051481637, -1.928322360849129 },
-		{ 0.06620025062283003, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07566301368514984, 0.9243369863236232, -1.90056159281712 },
-		{ 0.08641396890913608, 0.9135860310922982, -1.88241019807475 },
-		{ 0.09860935513711779, 0.9013906448630904, -1.860551777196706 },
-		{ 0.1124178536391352, 0.8875821463646506, -1.834147433104086 },
-		{ 0.1280180280633103, 0.8719819719414862, -1.802163694945135 },
-		{ 0.1456005765113769, 0.8543994234887701, -1.763321089147408 },
-		{ 0.165360563795778, 0.8346394362069778, -1.716054759158251 },
-		{ 0.1874949053536999, 0.8125050946466982, -1.658458407773779 },
-		{ 0.2121974178401315, 0.7878025821606958, -1.58822865965431 },
-		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
-		{ 0.2700016251423332, 0.7299983748579426, -1.398471136805887 },
-		{ 0.3033765555896106, 0.6966234444107307, -1.272146259634138 },
-		{ 0.3398354711738975, 0.6601645288268395, -1.119752430023688 },
-		{ 0.3793674977455417, 0.6206325022559037, -0.9373712855985157 },
-		{ 0.421864742205575, 0.5781352577946095, -0.7216036473971494 },
-		{ 0.01852052561967176, 0.9814794743806715, -1.980094691365223 },
-		{ 0.0204284550375262, 0.9795715449625343, -1.977885151176009 },
-		{ 0.02253069892059964, 0.9774693010797202, -1.97541581400459 },
-		{ 0.02484660481493503, 0.9751533951853967, -1.972653179720182 },
-		{ 0.027397102744023, 0.972602897255979, -1.969559184008 },
-		{ 0.03020533060496851, 0.9697946693953059, -1.966089840819374 },
-		{ 0.03329653872539002, 0.9667034612747203, -1.962194606278196 },
-		{ 0.03669797832148799, 0.9633020216785272, -1.957815640816344 },
-		{ 0.0404395882998327, 0.9595604117002865, -1.952885870589137 },
-		{ 0.04455382798053488, 0.955446172019469, -1.947327896739922 },
-		{ 0.04907579362055169, 0.9509242063794485, -1.941052302725095 },
-		{ 0.05404360424927965, 0.9459563957507243, -1.933955270239378 },
-		{ 0.05949836076813977, 0.94050163923186, -1.925916402456176 },
-		{ 0.06548429563253626, 0.934515704368336, -1.916795862368185 },
-		{ 0.07204909356384043, 0.9279509064384196, -1.906430719053939 },
-		{ 0.0792435752532001, 0.9207564247558597, -1.894631681662612 },
-		{ 0.08712285137023154, 0.9128771486359466, -1.881176728676733 },
-		{ 0.09574291699292299, 0.9042570830123039, -1.865811748212844 },
-		{ 0.1051663802058449, 0.8948336197951403, -1.848234505175185 },
-		{ 0.1154566666021844, 0.8845433333978157, -1.828097695115739 },
-		{ 0.1266803982906437, 0.8733196017110469, -1.804996770777409 },
-		{ 0.03770621783453959, 0.9622937821654755, -1.95649889539696 },
-		{ 0.04154842638451125, 0.9584515736155157, -1.95140211230513 },
-		{ 0.04577270919039625, 0.9542272908096192, -1.945653572531215 },
-		{ 0.05041507933403579, 0.9495849206660727, -1.93915994673069 },
-		{ 0.05551449588573865, 0.9444855041142789, -1.931813016895982 },
-		{ 0.0611128717807223, 0.9388871282193157, -1.923487335769227 },
-		{ 0.06725514579891323, 0.9327448542106874, -1.914037368767137 },
-		{ 0.07399055559351568, 0.9260094444086805, -1.903292175512872 },
-		{ 0.0813708215379299, 0.9186291784694705, -1.891054244841347 },
-		{ 0.08945003909918701, 0.910549960907257, -1.877095319716141 },
-		{ 0.09828836041234425, 0.9017116395901618, -1.861144566003894 },
-		{ 0.107946898982862, 0.8920531010209289, -1.842890936927987 },
-		{ 0.1184908450753615, 0.8815091549251852, -1.821970416980783 },
-		{ 0.1299876063656877, 0.8700123936345506, -1.797960980712651 },
-		{ 0.1425065088701691, 0.8574934911340731, -1.77037383238586 },
-		{ 0.1561198801467357, 0.8438801198535607, -1.738640169415684 },
-		{ 0.1708993113374374, 0.8291006886628977, -1.702107775775926 },
-		{ 0.1869166511924694, 0.8130833488103959, -1.660026613330042 },
-		{ 0.2042417857826299, 0.795758214218352, -1.611541618817408 },
-		{ 0.2229416097841223, 0.7770583902169143, -1.555683377035873 },
-		{ 0.24307843492273, 0.7569215650777198, -1.491361922350578 },
-		{ 0.03404632069375566, 0.9659536793062607, -1.96123771821436 },
-		{ 0.03752292281608362, 0.9624770771840412, -1.956738914953496 },
-		{ 0.04134678932227482, 0.9586532106778253, -1.951672704237464 },
-		{ 0.05017160584067331, 0.9498283941593426, -1.939505113033078 },
-		{ 0.05524710197478571, 0.9447528980252313, -1.932203852825235 },
-		{ 0.06693336729901468, 0.9330666327034312, -1.914540665083567 },
-		{ 0.0736377546354101, 0.9263622453652609, -1.903865002023077 },
-		{ 0.08098414195664841, 0.9190158580440004, -1.891707556293944 },
-		{ 0.09782613974387401, 0.9021738602570255, -1.861996494006793 },
-		{ 0.1074417280055717, 0.8925582719982513, -1.843867120063678 },
-		{ 0.1293866589402191, 0.8706133410645195, -1.799247232764555 },
-		{ 0.1418529903631287, 0.8581470096381681, -1.77185153975127 },
-		{ 0.1554098526648996, 0.8445901473363504, -1.740340432775797 },
-		{ 0.186082325870657, 0.8139176741310629, -1.66228322303792 },
-		{ 0.2033402525012306, 0.7966597474997483, -1.614141565411117 },
-		{ 0.2420329064490391, 0.7579670935510607, -1.494809285387102 },
-		{ 0.2635837098515075, 0.73641629015093, -1.421338235802874 },
-		{ 0.2866670161492219, 0.7133329838528313, -1.33695344259391 },
-		{ 0.3375375861573321, 0.6624624138434134, -1.129804804864815 },
-		{ 0.3653328313264285, 0.6346671686749173, -1.004161416740053 },
-		{ 0.4254858850939399, 0.5745141149062424, -0.7022951227240639 },
-		{ 0.03417275545938166, 0.9658272445406351, -1.961075893555514 },
-		{ 0.03766200346833865, 0.9623379965316959, -1.956556818839573 },
-		{ 0.04571924704298556, 0.9542807529570143, -1.945727277561898 },
-		{ 0.0503563455902166, 0.949643654409797, -1.939243258820202 },
-		{ 0.06104201723562001, 0.9389579827644827, -1.923594415857868 },
-		{ 0.06717761159932319, 0.9328223884031127, -1.914158724130179 },
-		{ 0.07390570165929729, 0.9260942983431698, -1.903430050111959 },
-		{ 0.08934812533314704, 0.9106518746682503, -1.877275085818624 },
-		{ 0.09817681159249321, 0.9018231884091654, -1.861350343828643 },
-		{ 0.118358137418674, 0.8816418625838169, -1.822240227162408 },
-		{ 0.1298423916986319, 0.8701576083060877, -1.798272111796561 },
-		{ 0.1423493505810375, 0.8576506494237283, -1.770729571901699 },
-		{ 0.1707131631658832, 0.8292868368367984, -1.7025815247497 },
-		{ 0.1867149368506985, 0.8132850631524727, -1.66057284762794 },
-		{ 0.2227071174046256, 0.7772928825970972, -1.556406770891334 },
-		{ 0.2428262322763632, 0.7571737677237365, -1.492194582243066 },
-		{ 0.2644348821169882, 0.7355651178830291, -1.418331706857439 },
-		{ 0.3122837923588852, 0.6877162076414298, -1.236310988255538 },
-		{ 0.3385678389596053, 0.6614321610404428, -1.125305301871605 },
-		{ 0.3958161701017565, 0.6041838298985833, -0.8562519622215343 },
-		{ 0.4266878854712225, 0.573312114528959, -0.695854460313608 },
-		{ 0.03429917367581799, 0.9657008263241983, -1.960913955595024 },
-		{ 0.04165267881997568, 0.9583473211801568, -1.951262072525208 },
-		{ 0.04588736790057189, 0.954112632099457, -1.945495417026051 },
-		{ 0.05054104940824376, 0.9494589505917679, -1.938981161672505 },
-		{ 0.05565283092830133, 0.9443471690718372, -1.93161057620178 },
-		{ 0.06742179196499345, 0.9325782080374333, -1.913776357170821 },
-		{ 0.08157041198707567, 0.9184295880131831, -1.890716502049416 },
-		{ 0.08966932359904493, 0.9103306764077089, -1.876708202522484 },
-		{ 0.09852793715041874, 0.9014720628539564, -1.860702223596316 },
-		{ 0.1082084242662771, 0.8917915757339929, -1.842384635478201 },
-		{ 0.130297885898391, 0.8697021141063102, -1.797295510205443 },
-		{ 0.1564870918624338, 0.8435129081380651, -1.737758867758251 },
-		{ 0.1712975172069943, 0.8287024827932459, -1.701093164217308 },
-		{ 0.1873475880152155, 0.8126524119857531, -1.658858253521009 },
-		{ 0.2047077854503957, 0.7952922145501181, -1.610194380917157 },
-		{ 0.2436187277696606, 0.7563812722304384, -1.489575792621604 },
-		{ 0.2884859738053968, 0.7115140261955359, -1.330051095193337 },
-		{ 0.313252195012756, 0.6867478049876903, -1.232360705255298 },
-		{ 0.3395964895286512, 0.6604035104730337, -1.120800695511977 },
-		{ 0.3675102934769152, 0.6324897065240311, -0.993945949549085 },
-		{ 0.4278873710192441, 0.5721126289809364, -0.6894117225853158 }
-	},
-	.c_bpre9600022 = {
-		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
-		{ 0.001228592409363851, 0.9987714075906362, -1.998765366123674 },
-		{ 0.00141115255682291, 0.998588847443181, -1.998580876415506 },
-		{ 0.001620820236568431, 0.9983791797634346, -1.998368663012204 },
-		{ 0.001861609104934269, 0.9981383908950696, -1.998124515634098 },
-		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002455675379420357, 0.9975443246205805, -1.997520173625104 },
-		{ 0.002820317025369606, 0.9971796829746379, -1.997147821334479 },
-		{ 0.003239013414897876, 0.9967609865851084, -1.996718953754668 },
-		{ 0.00371974610080847, 0.9962802538992372, -1.996224804854946 },
-		{ 0.00427169565677319, 0.995728304343321, -1.995655158803373 },
-		{ 0.004905307391830243, 0.9950946926084887, -1.994998208191093 },
-		{ 0.005632692879214104, 0.9943673071211618, -1.994240040452746 },
-		{ 0.006467529119239475, 0.9935324708807738, -1.993364613511963 },
-		{ 0.007425655690563023, 0.9925743443095291, -1.992352962951053 },
-		{ 0.008525143929763187, 0.9914748560704251, -1.991182902834333 },
-		{ 0.009786585147093645, 0.9902134148529242, -1.98982842818106 },
-		{ 0.01123362617130593, 0.9887663738286943, -1.988258755943326 },
-		{ 0.01289322930557193, 0.9871067706944553, -1.986437533596391 },
-		{ 0.01479620325933481, 0.9852037967407723, -1.984321592009428 },
-		{ 0.01697757761080529, 0.9830224223892035, -1.981859655685487 },
-		{ 0.001135014947055989, 0.9988649850529441, -1.998859829092285 },
-		{ 0.0012530827682191, 0.9987469172317893, -1.998740632430051 },
-		{ 0.001383427525866529, 0.9986165724741392, -1.998608911690638 },
-		{ 0.001527315465536502, 0.9984726845344717, -1.998463346637022 },
-		{ 0.00168616186276818, 0.9983138381372443, -1.998302455979252 },
-		{ 0.001861507846519137, 0.9981384921534822, -1.998124618402603 },
-		{ 0.002055072305767941, 0.9979449276942326, -1.997928017041112 },
-		{ 0.002268741635181674, 0.9977312583648182, -1.997710646246306 },
-		{ 0.002504598584296458, 0.9974954014157069, -1.997470277923602 },
-		{ 0.002764937916563335, 0.9972350620834414, -1.997204440262065 },
-		{ 0.003052301501030868, 0.9969476984989707, -1.996910375418554 },
-		{ 0.003369493630177412, 0.9966305063704533, -1.996585015867422 },
-		{ 0.003719550481575319, 0.9962804495184272, -1.996225006311468 },
-		{ 0.004105921289353948, 0.9958940787106473, -1.995826505817879 },
-		{ 0.004532342597165441, 0.9954676574029231, -1.995385302537623 },
-		{ 0.005002930666875743, 0.9949970693332414, -1.994896701425112 },
-		{ 0.005522243969278017, 0.9944777560308823, -1.99435543820604 },
-		{ 0.006095279952546081, 0.9939047200474856, -1.993755656931826 },
-		{ 0.006727601267011465, 0.9932723987329884, -1.993090746591097 },
-		{ 0.007425265907365684, 0.9925747340926392, -1.992353376017888 },
-		{ 0.008194983989073293, 0.9918050160109287, -1.991535282762392 },
-		{ 0.0012330734741332, 0.9987669265258667, -1.998760840894624 },
-		{ 0.001361335837486233, 0.9986386641625136, -1.998631246174571 },
-		{ 0.001502929858391098, 0.9984970701416093, -1.998488028157645 },
-		{ 0.001831789691671335, 0.9981682103083338, -1.998154776197723 },
-		{ 0.002022267135672453, 0.9979777328643308, -1.997961358060918 },
-		{ 0.002464626478073929, 0.9975353735219262, -1.997511046032793 },
-		{ 0.002720818439710977, 0.9972791815602893, -1.997249529846532 },
-		{ 0.003003600918622879, 0.996996399081378, -1.996960258385774 },
-		{ 0.003660210888309183, 0.9963397891121991, -1.996286102404985 },
-		{ 0.004040444706977448, 0.9959595552930295, -1.995894122508933 },
-		{ 0.004923185085315682, 0.995076814914766, -1.994979625060991 },
-		{ 0.005434240535912464, 0.9945657594641429, -1.994447314338242 },
-		{ 0.005998186724528703, 0.994001813275507, -1.99385746826358 },
-		{ 0.007307057117664582, 0.9926929428823402, -1.992478589315102 },
-		{ 0.008064564220525022, 0.9919354357794891, -1.991674236609283 },
-		{ 0.009822132419247941, 0.9901778675809153, -1.989790072217562 },
-		{ 0.01083895010162357, 0.9891610498984873, -1.988688567235508 },
-		{ 0.01196039520507527, 0.9880396047949961, -1.987463971990684 },
-		{ 0.01456072115160865, 0.9854392788484015, -1.984585031628096 },
-		{ 0.01606409124498306, 0.9839359087550449, -1.982895376158945 },
-		{ 0.01954775846769488, 0.9804522415323127, -1.978908795917186 },
-		{ 0.001298440477459305, 0.9987015595225405, -1.998694811352695 },
-		{ 0.001433498031688481, 0.9985665019683134, -1.998558276409044 },
-		{ 0.001747177278891086, 0.9982528227211164, -1.998240601537276 },
-		{ 0.001928865286380107, 0.9980711347136221, -1.99805623827108 },
-		{ 0.002350815536351279, 0.9976491844636571, -1.997627053135988 },
-		{ 0.002595195007245043, 0.9974048049927547, -1.997377829871723 },
-		{ 0.002864941146769568, 0.9971350588532339, -1.997102180249547 },
-		{ 0.003491301929337871, 0.9965086980706767, -1.996459856152488 },
-		{ 0.003853997012378595, 0.9961460029880581, -1.996086475253979 },
-		{ 0.004696091710947842, 0.9953039082894977, -1.995215487890695 },
-		{ 0.005183661488500152, 0.9948163385115774, -1.994708578313528 },
-		{ 0.005721687421162537, 0.9942783125791694, -1.994146986767399 },
-		{ 0.006970414669514226, 0.9930295853305147, -1.992834560490667 },
-		{ 0.007693173204094701, 0.9923068267959191, -1.992069175346591 },
-		{ 0.00937016256193734, 0.9906298374380627, -1.990276989719894 },
-		{ 0.01034045263057374, 0.9896595473695812, -1.98922963247142 },
-		{ 0.01141060478321017, 0.988589395216792, -1.988065610693715 },
-		{ 0.01389224265836425, 0.9861077573416941, -1.985330405316782 },
-		{ 0.01532716149424152, 0.9846728385057861, -1.983725931655287 },
-		{ 0.01865252517743781, 0.9813474748225622, -1.979942789809291 },
-		{ 0.02057394824860094, 0.9794260517514062, -1.97771542716946 },
-		{ 0.001363803202665283, 0.9986361967973347, -1.998628751886245 },
-		{ 0.001662247323754604, 0.9983377526762519, -1.998326691223254 },
-		{ 0.001835108447951237, 0.9981648915520559, -1.998151408696317 },
-		{ 0.002025931440123769, 0.9979740685598759, -1.997957634331018 },
-		{ 0.002236573667599693, 0.9977634263324007, -1.997743394901152 },
-		{ 0.002725746446155033, 0.9972742535538452, -1.997244494257843 },
-		{ 0.003321744628387227, 0.9966782553721809, -1.996634046078134 },
-		{ 0.003666862315083987, 0.9963331376851572, -1.996279255499905 },
-		{ 0.004047745445437731, 0.9959522545549365, -1.995886584854758 },
-		{ 0.004468132042288732, 0.9955318679580538, -1.995451832604922 },
-		{ 0.005444069708047972, 0.994555930292026, -1.994437055720162 },
-		{ 0.006632422760393062, 0.9933675772396118, -1.993191036966702 },
-		{ 0.007320246265228827, 0.9926797537349185, -1.992464624241382 },
-		{ 0.008079139107500298, 0.9919208608925261, -1.991658714843925 },
-		{ 0.008916332313108483, 0.9910836676869139, -1.990764243966721 },
-		{ 0.01085850152111064, 0.9891414984790372, -1.988667305112966 },
-		{ 0.0132208564891129, 0.9867791435108961, -1.98607534757381 },
-		{ 0.01458693877239683, 0.985413061227651, -1.984555723761791 },
-		{ 0.01609300572628233, 0.9839069942737698, -1.982862697449467 },
-		{ 0.01775316364429965, 0.9822468363557451, -1.980974914176341 },
-		{ 0.02159906396855595, 0.9784009360314505, -1.976514634898497 },
-		{ 0.01697757761080529, 0.9830224223892035, -1.981859655685487 },
-		{ 0.01947739304534638, 0.9805226069546892, -1.97899030684099 },
-		{ 0.02234105798565489, 0.9776589420143451, -1.97564006851586 },
-		{ 0.02562022324921783, 0.9743797767508363, -1.971720421537676 },
-		{ 0.02937344712389339, 0.9706265528761118, -1.967124431891221 },
-		{ 0.03366685383496579, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03857554310542369, 0.961424456899045, -1.955356668044318 },
-		{ 0.04418305565819886, 0.9558169443425337, -1.947834692357592 },
-		{ 0.05058405065909666, 0.9494159493410096, -1.938920100156369 },
-		{ 0.05788421817645791, 0.9421157818254881, -1.928322177910934 },
-		{ 0.06620025062283003, 0.9337997493796442, -1.915683929838771 },
-		{ 0.0756627111878318, 0.9243372888122443, -1.90056208893814 },
-		{ 0.08641396890913608, 0.9135860310922982, -1.88241019807475 },
-		{ 0.09860935513711779, 0.9013906448630904, -1.860551777196706 },
-		{ 0.1124175631751588, 0.8875824368252764, -1.834148007216534 },
-		{ 0.1280183134139535, 0.8719816865860999, -1.802163088738755 },
-		{ 0.1456005765113769, 0.8543994234887701, -1.763321089147408 },
-		{ 0.1653602906580436, 0.8346397093421394, -1.716055439340278 },
-		{ 0.1874949053536999, 0.8125050946466982, -1.658458407773779 },
-		{ 0.2121976756478404, 0.7878023243529456, -1.588227893389228 },
-		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
-		{ 0.009303540745032113, 0.9906964592551404, -1.99034862275956 },
-		{ 0.01026693246993386, 0.9897330675300963, -1.98930925980236 },
-		{ 0.01132952856909855, 0.9886704714310627, -1.988154124687784 },
-		{ 0.01250144547697343, 0.9874985545231935, -1.986869494376224 },
-		{ 0.01379368423439056, 0.9862063157656102, -1.985439992124831 },
-		{ 0.01521846615859353, 0.984781533841545, -1.98384806028665 },
-		{ 0.01678920811729765, 0.9832107918827582, -1.982073791047956 },
-		{ 0.01852049350049502, 0.9814795064995129, -1.980094728309359 },
-		{ 0.0204284550375262, 0.9795715449625343, -1.977885151176009 },
-		{ 0.02253073090788878, 0.9774692690921127, -1.975415776153622 },
-		{ 0.02484657290278203, 0.9751534270972179, -1.972653218094031 },
-		{ 0.027397102744023, 0.972602897255979, -1.969559184008 },
-		{ 0.03020536234114988, 0.9697946376588499, -1.966089801239506 },
-		{ 0.03329647545512748, 0.9667035245453156, -1.962194686826081 },
-		{ 0.03669791527465129, 0.9633020847264991, -1.957815722887666 },
-		{ 0.04043946269816049, 0.959560537306459, -1.952886038073282 },
-		{ 0.04455395305129058, 0.9554460469518656, -1.947327725591376 },
-		{ 0.04907566914753158, 0.9509243308551443, -1.941052477887874 },
-		{ 0.05404354233707799, 0.9459564576634277, -1.933955360016166 },
-		{ 0.05949836076813977, 0.94050163923186, -1.925916402456176 },
-		{ 0.06548429563253626, 0.934515704368336, -1.916795862368185 },
-		{ 0.01903426045276138, 0.980965739547246, -1.979502692459211 },
-		{ 0.02099459980269297, 0.9790054001973206, -1.977223736956186 },
-		{ 0.02315441813477816, 0.9768455818652297, -1.974676153785211 },
-		{ 0.02553351998851914, 0.9744664800115358, -1.971825207735686 },
-		{ 0.02815355939620682, 0.971846440603802, -1.968631118549663 },
-		{ 0.03103811828365634, 0.9689618817163632, -1.965048326380176 },
-		{ 0.03421283183029411, 0.9657871681745867, -1.96102457148625 },
-		{ 0.03770615485365993, 0.9622938451474584, -1.956498977918864 },
-		{ 0.0415485518492687, 0.9584514481545064, -1.951401943832298 },
-		{ 0.04577258428560608, 0.9542274157176877, -1.945653744762691 },
-		{ 0.05041501718502104, 0.9495849828162627, -1.93916003490457 },
-		{ 0.05551437225479572, 0.9444856277471506, -1.931813197747678 },
-		{ 0.06111281033094402, 0.938887189669337, -1.923487428655742 },
-		{ 0.06725545102942553, 0.9327445489706979, -1.914036890905829 },
-		{ 0.07399055559351568, 0.9260094444086805, -1.903292175512872 },
-		{ 0.08137052090993878, 0.9186294790902154, -1.891054753274472 },
-		{ 0.08945033706964685, 0.9105496629305279, -1.877094793974945 },
-		{ 0.09828865549573285, 0.9017113445057658, -1.861144021501048 },
-		{ 0.1079471909032338, 0.8920528090972821, -1.842890372131017 },
-		{ 0.1184908450753615, 0.8815091549251852, -1.821970416980783 },
-		{ 0.1299876063656877, 0.8700123936345506, -1.797960980712651 },
-		{ 0.01717057466402442, 0.9828294253359842, -1.981639957839529 },
-		{ 0.01894083910096557, 0.9810591608990976, -1.979610507458694 },
-		{ 0.02089162465142498, 0.9791083753486255, -1.977344237276686 },
-		{ 0.02540860143374635, 0.9745913985662619, -1.971976069633711 },
-		{ 0.02801599908989564, 0.9719840009101133, -1.968800240507567 },
-		{ 0.03404625747345963, 0.9659537425277833, -1.961237799098598 },
-		{ 0.03752285982232115, 0.9624771401780206, -1.956738997393097 },
-		{ 0.04134685206620971, 0.9586531479341214, -1.951672620090643 },
-		{ 0.05017166800723877, 0.9498283319932216, -1.939505024966828 },
-		{ 0.05524697830885809, 0.9447530216931044, -1.932204033440281 },
-		{ 0.06693336729901468, 0.9330666327034312, -1.914540665083567 },
-		{ 0.0736377546354101, 0.9263622453652609, -1.903865002023077 },
-		{ 0.08098414195664841, 0.9190158580440004, -1.891707556293944 },
-		{ 0.09782613974387401, 0.9021738602570255, -1.861996494006793 },
-		{ 0.1074420200912265, 0.8925579799092876, -1.843866556322532 },
-		{ 0.1293869438430361, 0.8706130561570167, -1.79924662378106 },
-		{ 0.1418529903631287, 0.8581470096381681, -1.77185153975127 },
-		{ 0.1554095762732227, 0.844590423727875, -1.740341093662635 },
-		{ 0.1860820595153599, 0.8139179404850427, -1.66228394230467 },
-		{ 0.2033399917946465, 0.7966600082060837, -1.614142316040561 },
-		{ 0.2420329064490391, 0.7579670935510607, -1.494809285387102 },
-		{ 0.01723489859447127, 0.982765101405537, -1.981566666891993 },
-		{ 0.01901172456972698, 0.9809882754302907, -1.979528707071907 },
-		{ 0.02312705383094263, 0.9768729461690574, -1.974708672282075 },
-		{ 0.02550338409526358, 0.9744966159047432, -1.971861614178976 },
-		{ 0.03100155688237436, 0.9689984431176777, -1.965094173258744 },
-		{ 0.03417269224735597, 0.9658273077538825, -1.961075974496011 },
-		{ 0.03766206645443317, 0.9623379335468234, -1.95655673633781 },
-		{ 0.0457191845861686, 0.9542808154145458, -1.945727363653921 },
-		{ 0.05035628343701903, 0.9496437165638307, -1.939243346968113 },
-		{ 0.06104214014610349, 0.9389578598551783, -1.92359423014817 },
-		{ 0.06717761159932319, 0.9328223884031127, -1.914158724130179 },
-		{ 0.07390570165929729, 0.9260942983431698, -1.903430050111959 },
-		{ 0.08934812533314704, 0.9106518746682503, -1.877275085818624 },
-		{ 0.09817681159249321, 0.9018231884091654, -1.861350343828643 },
-		{ 0.1183578489004198, 0.8816421511004888, -1.822240813570099 },
-		{ 0.1298426764523296, 0.8701573235477229, -1.798271501882001 },
-		{ 0.1423490699107166, 0.8576509300892927, -1.770730206995641 },
-		{ 0.1707134345468092, 0.8292865654533599, -1.702580834333194 },
-		{ 0.1867152029944245, 0.8132847970056016, -1.660572127178933 },
-		{ 0.2227073717715475, 0.7772926282286379, -1.556405986487604 },
-		{ 0.2428262322763632, 0.7571737677237365, -1.492194582243066 },
-		{ 0.01729921831506498, 0.9827007816849431, -1.981493346783543 },
-		{ 0.02104784530599919, 0.9789521546940675, -1.977161395363517 },
-		{ 0.02321310814516526, 0.9767868918548492, -1.974606388331118 },
-		{ 0.02559815753881287, 0.9744018424611932, -1.971747095225212 },
-		{ 0.02822473324759875, 0.9717752667524717, -1.968543552710529 },
-		{ 0.03429911047206175, 0.9657008895291717, -1.960914036592524 },
-		{ 0.04165267881997568, 0.9583473211801568, -1.951262072525208 },
-		{ 0.04588749279703862, 0.9541125072064139, -1.945495244692179 },
-		{ 0.05054117369435127, 0.9494588263078902, -1.93898098521328 },
-		{ 0.05565283092830133, 0.9443471690718372, -1.93161057620178 },
-		{ 0.06742179196499345, 0.9325782080374333, -1.913776357170821 },
-		{ 0.08157041198707567, 0.9184295880131831, -1.890716502049416 },
-		{ 0.08966902568734997, 0.9103309743127749, -1.876708728729417 },
-		{ 0.09852764214045943, 0.9014723578600473, -1.860702768602819 },
-		{ 0.1082084242662771, 0.8917915757339929, -1.842384635478201 },
-		{ 0.1302981705030472, 0.8697018294970055, -1.79729489936657 },
-		{ 0.1564870918624338, 0.8435129081380651, -1.737758867758251 },
-		{ 0.1712975172069943, 0.8287024827932459, -1.701093164217308 },
-		{ 0.1873478539549934, 0.8126521460459165, -1.65885753192394 },
-		{ 0.2047077854503957, 0.7952922145501181, -1.610194380917157 },
-		{ 0.2436187277696606, 0.7563812722304384, -1.489575792621604 }
-	},
-	.c_bpre4800080040 = {
-		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
-		{ 0.000122934402508309, 0.9999938532801524, -1.999969672669036 },
-		{ 0.0001412144810339613, 0.9999929392790756, -1.999961032832087 },
-		{ 0.0001622129118073007, 0.9999918893569576, -1.999949788514374 },
-		{ 0.0001863335999259271, 0.9999906833231372, -1.999935131022156 },
-		{ 0.0002140408029571688, 0.9999892979600933, -1.999915996474394 },
-		{ 0.0002458680493797547, 0.999987706598087, -1.999890985035584 },
-		{ 0.0002824282847760419, 0.9999858785916428, -1.999858253976524 },
-		{ 0.0003244245079493867, 0.999983778779698, -1.999815377864773 },
-		{ 0.0003726654217692919, 0.9999813667657989, -1.99975916246353 },
-		{ 0.0004280814727609967, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0004917368571737797, 0.9999754134127498, -1.999588540955475 },
-		{ 0.000564859684497539, 0.9999717573172516, -1.999461276383439 },
-		{ 0.0006488431138657212, 0.9999675578552477, -1.99929398937648 },
-		{ 0.0007453238995739959, 0.9999627338787951, -1.999073974325164 },
-		{ 0.0008561537828897495, 0.9999571924621234, -1.998784491390396 },
-		{ 0.0009834549593953029, 0.9999508272663835, -1.998403495835182 },
-		{ 0.001129688084756259, 0.9999435155957678, -1.997901893111486 },
-		{ 0.001297665177872407, 0.9999351167629884, -1.997241340245717 },
-		{ 0.001490622073256448, 0.9999254689827416, -1.996371271301588 },
-		{ 0.001712261729673017, 0.9999143869203432, -1.99522507617636 },
-		{ 0.0001135656362733868, 0.9999943217182997, -1.999973686250035 },
-		{ 0.000125386589782031, 0.9999937306769877, -1.999968575827806 },
-		{ 0.0001384381483717548, 0.9999930780972305, -1.999962413917172 },
-		{ 0.0001528478436579833, 0.9999923576141994, -1.999954977708938 },
-		{ 0.0001687579898559453, 0.9999915621104307, -1.99994599538377 },
-		{ 0.0001863234132384508, 0.9999906838303686, -1.999935137578122 },
-		{ 0.0002057176366150825, 0.999989714118578, -1.999922002564174 },
-		{ 0.00022713062768524, 0.9999886434688424, -1.999906102255955 },
-		{ 0.0002507725146993453, 0.9999874613769175, -1.99988684266576 },
-		{ 0.0002768748994814023, 0.999986156258736, -1.999863501193239 },
-		{ 0.0003056946181573996, 0.999984715270443, -1.999835197297884 },
-		{ 0.0003375255747620888, 0.9999831242266107, -1.999800858751534 },
-		{ 0.0003726450906529224, 0.9999813677475282, -1.999759186858879 },
-		{ 0.000411433157237622, 0.9999794283429555, -1.999708588103132 },
-		{ 0.0004542607468761933, 0.9999772870339317, -1.999647129918847 },
-		{ 0.0005015443139756145, 0.9999749228783282, -1.999572459630698 },
-		{ 0.0005537497022403133, 0.9999723126436727, -1.999481708502613 },
-		{ 0.0006113843659371717, 0.9999694308072326, -1.999371387123613 },
-		{ 0.0006750219674609826, 0.9999662489016322, -1.999237233441631 },
-		{ 0.0007452832380839198, 0.9999627358422175, -1.999074069931352 },
-		{ 0.0008228578506027136, 0.9999588571091038, -1.998875580647396 },
-		{ 0.0001233830549742834, 0.9999938308473555, -1.999969473417279 },
-		{ 0.0001362258666376169, 0.9999931887067123, -1.999963496700659 },
-		{ 0.0001504054831979105, 0.9999924797263255, -1.999956284809073 },
-		{ 0.0001833461901910838, 0.9999908326946696, -1.999937047417517 },
-		{ 0.0002024304998671204, 0.9999898784778292, -1.999924313569177 },
-		{ 0.0002467653487946435, 0.9999876617327694, -1.999890232906276 },
-		{ 0.0002724508054019762, 0.9999863774598182, -1.999867610721701 },
-		{ 0.0003008098352873587, 0.999984959509206, -1.999840181694656 },
-		{ 0.0003666973714855629, 0.9999816655388278, -1.999766529845127 },
-		{ 0.0004048589508385605, 0.9999797570581033, -1.999717503049477 },
-		{ 0.000493529611133134, 0.9999753235850476, -1.999585619142071 },
-		{ 0.000544899440783113, 0.9999727550724862, -1.999497704320208 },
-		{ 0.0006016163359031286, 0.999969919211904, -1.999390832009456 },
-		{ 0.0007333750782577919, 0.9999633312501891, -1.999102834968779 },
-		{ 0.0008097097061309219, 0.9999595145259835, -1.998910577886122 },
-		{ 0.0009870470437288734, 0.9999506477790207, -1.998392001109446 },
-		{ 0.001089784035824627, 0.9999455108872586, -1.998045559436456 },
-		{ 0.001203214574716919, 0.999939839328662, -1.997623860699132 },
-		{ 0.001466723264574017, 0.9999266638449754, -1.996485482278673 },
-		{ 0.001619386630773977, 0.9999190306910408, -1.995724469331344 },
-		{ 0.001974036972600126, 0.9999012981572916, -1.993669315350086 },
-		{ 0.0001299279981116581, 0.9999935036001931, -1.999966493518566 },
-		{ 0.0001434521638236597, 0.9999928273933584, -1.999959901742557 },
-		{ 0.0001748698901740613, 0.9999912565113583, -1.999942329397028 },
-		{ 0.0001930718967489274, 0.999990346406883, -1.999930703624997 },
-		{ 0.0002353570519021094, 0.9999882321540352, -1.999899603680004 },
-		{ 0.0002598551521797689, 0.9999870072425894, -1.999878967996561 },
-		{ 0.0002869032987186223, 0.9999856548381633, -1.99985395379138 },
-		{ 0.0003497382513794223, 0.9999825130991651, -1.999786807891289 },
-		{ 0.0003861475508215539, 0.9999806929724067, -1.999742128171046 },
-		{ 0.0004707169077622614, 0.9999764645120007, -1.999621962528382 },
-		{ 0.0005197088206584071, 0.9999740146212666, -1.999541871028684 },
-		{ 0.0005738089896146863, 0.9999713098166624, -1.999444524349903 },
-		{ 0.0006994703869319935, 0.9999650265041216, -1.999182250817642 },
-		{ 0.000772277143278949, 0.9999613861539562, -1.999007184987659 },
-		{ 0.0009414117151402224, 0.9999529294143038, -1.998535053982065 },
-		{ 0.001039404136486652, 0.9999480299177733, -1.998219664754064 },
-		{ 0.001147587636024835, 0.9999426206200663, -1.997835798495801 },
-		{ 0.001398916310931752, 0.9999300542313889, -1.996799618975093 },
-		{ 0.001544524465959849, 0.9999227737989418, -1.99610695332295 },
-		{ 0.001882779117465248, 0.9999058610442478, -1.994236503163347 },
-		{ 0.002078746111590701, 0.9998960627000438, -1.992985790676191 },
-		{ 0.0001364729391338762, 0.9999931763531379, -1.99996337654531 },
-		{ 0.0001663624483590931, 0.9999916818826473, -1.999947399573056 },
-		{ 0.0001836787027345006, 0.9999908160705608, -1.99993683554715 },
-		{ 0.0002027976209214973, 0.999989860119333, -1.999924057151392 },
-		{ 0.0002239066084539366, 0.9999888046699977, -1.999908590092317 },
-		{ 0.0002729449470243295, 0.999986352752838, -1.999867154816238 },
-		{ 0.0003327337247091155, 0.9999833637690367, -1.99980623583462 },
-		{ 0.0003673606648446989, 0.9999816321600182, -1.999765712433058 },
-		{ 0.0004055978567164607, 0.9999797204069318, -1.999716515898518 },
-		{ 0.0004478148728372794, 0.9999776095307795, -1.999656761326156 },
-		{ 0.0005458880022537144, 0.9999727056591993, -1.99949593023117 },
-		{ 0.0006654405043910782, 0.9999667279784569, -1.99925826047614 },
-		{ 0.000734705947865175, 0.9999632648210326, -1.999099648159042 },
-		{ 0.0008111791897017026, 0.9999594410615071, -1.998906694486666 },
-		{ 0.0008956123733165903, 0.9999552193992748, -1.998671934515374 },
-		{ 0.001091761104842839, 0.9999454120633794, -1.998038563692257 },
-		{ 0.001330858868245402, 0.9999334570639408, -1.997100136124383 },
-		{ 0.001469384211949245, 0.9999265308279262, -1.996472858084572 },
-		{ 0.001622325478831685, 0.9999188837680423, -1.995709091138864 },
-		{ 0.001791184640569065, 0.9999104408038518, -1.994779063018306 },
-		{ 0.002183454702902978, 0.9998908272702083, -1.992267300868003 },
-		{ 0.001712261729673017, 0.9999143869203432, -1.99522507617636 },
-		{ 0.001966861559621712, 0.9999016569507247, -1.99371487762977 },
-		{ 0.002259312359754758, 0.9998870343820238, -1.991724943300416 },
-		{ 0.002595246159019319, 0.9998702377358112, -1.989102737649196 },
-		{ 0.002981126402174446, 0.9998509436839563, -1.985647346199904 },
-		{ 0.003424390514358489, 0.9998287814974788, -1.98109440254788 },
-		{ 0.003933614526427385, 0.9998033229184353, -1.975095534586411 },
-		{ 0.004518388021581568, 0.9997740811981028, -1.967194086457088 },
-		{ 0.005190155553027166, 0.9997404923098678, -1.956789225271085 },
-		{ 0.005961853421219333, 0.9997019089313944, -1.94309324778558 },
-		{ 0.006848194709701493, 0.9996575923107331, -1.925077468264887 },
-		{ 0.007866278177179227, 0.9996066861543477, -1.901396535737035 },
-		{ 0.009035755254348243, 0.9995482134355108, -1.87030440974604 },
-		{ 0.01037896422077536, 0.9994810519639767, -1.829543084655431 },
-		{ 0.01192184023969484, 0.9994039083563446, -1.77620874986269 },
-		{ 0.01369399632535179, 0.9993153002293662, -1.70660670088199 },
-		{ 0.0157294624382472, 0.9992135270044764, -1.616095398981606 },
-		{ 0.01806735084529607, 0.9990966326168894, -1.498943865358002 },
-		{ 0.0207525422984418, 0.9989623732350179, -1.348265750850485 },
-		{ 0.02383660592248287, 0.9988081704036411, -1.15610749616167 },
-		{ 0.02737861637456414, 0.998631069272508, -0.9138757038124511 },
-		{ 0.0009346898287110743, 0.9999532656471217, -1.998555571979506 },
-		{ 0.001031973958604443, 0.9999484013264208, -1.998244648529042 },
-		{ 0.001139389792792574, 0.9999430306399134, -1.997866205901344 },
-		{ 0.001257987720873715, 0.9999371007483313, -1.997405513236773 },
-		{ 0.001388921893848004, 0.9999305539061425, -1.996844674264303 },
-		{ 0.001533488984767647, 0.9999233256623072, -1.996161830516936 },
-		{ 0.001693103678155784, 0.9999153448609176, -1.995330348458042 },
-		{ 0.001869327286016747, 0.9999065336419525, -1.994317862713516 },
-		{ 0.002063894668732458, 0.9998968053152643, -1.993084872717578 },
-		{ 0.002278712796442833, 0.9998860643617291, -1.991583291403564 },
-		{ 0.002515887668593367, 0.9998742056165827, -1.989754609266639 },
-		{ 0.002777747332497157, 0.9998611126350446, -1.987527545310553 },
-		{ 0.003066859200624098, 0.999846657039969, -1.984815370068092 },
-		{ 0.003386062897352478, 0.9998306972155212, -1.981512580748021 },
-		{ 0.003738491803224998, 0.9998130763470532, -1.977490748535997 },
-		{ 0.004127636737506373, 0.9997936219340352, -1.972593871908738 },
-		{ 0.004557230624986181, 0.9997721410504387, -1.96663168728859 },
-		{ 0.005031489638248227, 0.9997484277117259, -1.95937520368278 },
-		{ 0.005555110571977751, 0.9997222448869482, -1.950543633570556 },
-		{ 0.006133248119988324, 0.9996933375940008, -1.939798738826447 },
-		{ 0.006771552524818875, 0.9996614230944755, -1.926730712708945 },
-		{ 0.001921682197753574, 0.9999039158961954, -1.993997961932652 },
-		{ 0.002121699715739264, 0.9998939150252448, -1.992695281692307 },
-		{ 0.002342532208024186, 0.9998828733958903, -1.991108851854298 },
-		{ 0.002586349419668536, 0.9998706825735143, -1.989176816654451 },
-		{ 0.002855543264159032, 0.9998572228440273, -1.986823870298674 },
-		{ 0.00315275235521235, 0.999842362398017, -1.983958427296598 },
-		{ 0.003480955673053901, 0.9998259561881573, -1.980469177209534 },
-		{ 0.003843191198905761, 0.9998078413517322, -1.976220120842638 },
-		{ 0.004243248666176141, 0.999787840650152, -1.971046478016847 },
-		{ 0.004684830625340631, 0.9997657611647673, -1.964748908752536 },
-		{ 0.005172377120153401, 0.99974138219719, -1.957083150468567 },
-		{ 0.005710697463948981, 0.9997144667276825, -1.947754883405652 },
-		{ 0.006305005184311365, 0.9996847499727938, -1.936406447024618 },
-		{ 0.006961181396633077, 0.9996519410318865, -1.922605527759809 },
-		{ 0.007685643895388466, 0.9996157196284104, -1.905830282453902 },
-		{ 0.008485443617769955, 0.9995757279474459, -1.885449409084136 },
-		{ 0.009368491683888876, 0.9995315755618865, -1.860705790435557 },
-		{ 0.01034343234606108, 0.9994828296421477, -1.830690636630102 },
-		{ 0.01141974172428119, 0.9994290133493028, -1.794318992034992 },
-		{ 0.01260802271556988, 0.999369599328167, -1.750300421942703 },
-		{ 0.01391993989164719, 0.9993040032088183, -1.697108124153295 },
-		{ 0.001731894991568403, 0.9999134052571711, -1.995115981032289 },
-		{ 0.001912161052742051, 0.9999043919981951, -1.994056794601755 },
-		{ 0.002111183634539686, 0.9998944408591146, -1.992766953487471 },
-		{ 0.002573531962981773, 0.999871323408464, -1.989283092182705 },
-		{ 0.002841391746437935, 0.9998579304197077, -1.98695330506189 },
-		{ 0.003463653428229521, 0.9998268183401844, -1.98066103985456 },
-		{ 0.003824136281747097, 0.9998087934644668, -1.976453796151463 },
-		{ 0.00422215473088918, 0.9997888925337808, -1.971331160783136 },
-		{ 0.00514674660978992, 0.9997426630474282, -1.957504466498953 },
-		{ 0.005682398730047339, 0.9997158816774937, -1.948267812012685 },
-		{ 0.006926707015213878, 0.999653666672256, -1.923364517545254 },
-		{ 0.007647541363658368, 0.9996176234888732, -1.906752020543665 },
-		{ 0.008443418133399648, 0.9995778296339241, -1.886568759147639 },
-		{ 0.01029216877148358, 0.9994853923171638, -1.83233840750056 },
-		{ 0.01136315982026846, 0.9994318424428925, -1.796314549029705 },
-		{ 0.01385096777886332, 0.9993074516561731, -1.700022346296167 },
-		{ 0.01529215848713784, 0.9992353931895424, -1.636468007604264 },
-		{ 0.01688323637451841, 0.9991558391305315, -1.559987641965509 },
-		{ 0.02057898527590558, 0.9989710510899577, -1.358495133188842 },
-		{ 0.02271982647904652, 0.9988640093231819, -1.227884277552846 },
-		{ 0.02769234309294328, 0.9986153829355542, -0.8914609417476946 },
-		{ 0.001738439407926746, 0.999913078036328, -1.995079342518622 },
-		{ 0.001919385285819989, 0.999904030749647, -1.99401218103308 },
-		{ 0.00233973115665692, 0.9998830134421676, -1.991129946553977 },
-		{ 0.002583256537482881, 0.999870837178794, -1.989202504127995 },
-		{ 0.003148980298050782, 0.9998425510274789, -1.983996557918288 },
-		{ 0.003476741050223342, 0.9998261639552761, -1.980515499741248 },
-		{ 0.003838612838151696, 0.999808070382204, -1.976276436151842 },
-		{ 0.004679193744958683, 0.9997660408973624, -1.964832534810943 },
-		{ 0.005166186583670243, 0.9997416913677868, -1.95718503564569 },
-		{ 0.0062974973299738, 0.9996851261908442, -1.936556977745653 },
-		{ 0.006952877717534669, 0.9996523581295227, -1.922789316223996 },
-		{ 0.007676488932804239, 0.9996161776013865, -1.90605241046281 },
-		{ 0.009357292749950518, 0.9995321365315868, -1.861034806161177 },
-		{ 0.0103310386967442, 0.9994834494589231, -1.831089878210153 },
-		{ 0.01259295217383427, 0.9993703531624204, -1.75088393457726 },
-		{ 0.0139032913227935, 0.9993048354788066, -1.697812645825917 },
-		{ 0.01534991700901583, 0.9992325041573971, -1.633804932355045 },
-		{ 0.01871019645731605, 0.999064490324683, -1.464384464898466 },
-		{ 0.02065671830233562, 0.9989671641077518, -1.353921273952757 },
-		{ 0.02517798040028925, 0.9987411011457941, -1.066851540269976 },
-		{ 0.02779691757073116, 0.998610154211325, -0.8839579746101726 },
-		{ 0.001744983822137079, 0.9999127508155918, -1.995042567276386 },
-		{ 0.00212713887925307, 0.999893643110017, -1.992658080964477 },
-		{ 0.002348539908361442, 0.9998825730163244, -1.99106352237888 },
-		{ 0.002592981108770824, 0.9998703509493602, -1.989121615051987 },
-		{ 0.002862867049814821, 0.9998568567044845, -1.986756643436682 },
-		{ 0.003489828664224003, 0.9998255095707962, -1.980369416753808 },
-		{ 0.004254051522618161, 0.9997872975318219, -1.970898941331295 },
-		{ 0.004696873172131393, 0.9997651591674008, -1.964568607767028 },
-		{ 0.005185675712464381, 0.9997407180532679, -1.956863881087223 },
-		{ 0.005725324299414195, 0.9997137338989722, -1.947488246563257 },
-		{ 0.006979048386750676, 0.9996510495885024, -1.922212007082676 },
-		{ 0.008507198197982138, 0.9995746403059841, -1.884868040579496 },
-		{ 0.009392499682265023, 0.999530375120496, -1.860000456480908 },
-		{ 0.01036990913587662, 0.9994815049690615, -1.829835866687683 },
-		{ 0.01144900963256218, 0.9994275497462248, -1.793282998479585 },
-		{ 0.01395561472976183, 0.9993022193082898, -1.695595503711469 },
-		{ 0.01701077777675212, 0.9991494615428371, -1.553578229623113 },
-		{ 0.01878058841300048, 0.9990609707885193, -1.46054091816194 },
-		{ 0.02073447318614299, 0.9989632771406705, -1.349334313732468 },
-		{ 0.02289146527664517, 0.9988554271917429, -1.217008749054181 },
-		{ 0.02790149150101743, 0.9986049255144733, -0.8764395368997228 }
-	},
-	.c_bpre9600080040 = {
-		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
-		{ 6.14672957070956e-05, 0.9999969266353534, -1.999990881464149 },
-		{ 7.060736514964524e-05, 0.9999964696333061, -1.999988492991572 },
-		{ 8.110662035705936e-05, 0.999995944670256, -1.999985419410573 },
-		{ 9.316701696950962e-05, 0.9999953416507185, -1.999981453494905 },
-		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
-		{ 0.000122934402508309, 0.9999938532801524, -1.999969672669036 },
-		{ 0.0001412146409243914, 0.9999929392708944, -1.999961032749967 },
-		{ 0.0001622129118073007, 0.9999918893569576, -1.999949788514374 },
-		{ 0.0001863335788909549, 0.999990683339499, -1.999935131233644 },
-		{ 0.0002140418817274501, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002458699398674379, 0.9999877066308116, -1.999890985583243 },
-		{ 0.000282431836423447, 0.9999858785589183, -1.999858253352297 },
-		{ 0.0003244241882036977, 0.9999837787960603, -1.999815378220861 },
-		{ 0.0003726654217692919, 0.9999813667657989, -1.99975916246353 },
-		{ 0.0004280814727609967, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0004917335247393661, 0.9999754133309398, -1.999588538299141 },
-		{ 0.0005648520188239455, 0.9999717573990616, -1.999461279422539 },
-		{ 0.0006488431138657212, 0.9999675578552477, -1.99929398937648 },
-		{ 0.0007453249243433084, 0.9999627337969857, -1.999073970341466 },
-		{ 0.0008561491896194267, 0.9999571925439324, -1.998784495954072 },
-		{ 5.678289874786736e-05, 0.9999971608551197, -1.999992001974077 },
-		{ 6.26933931541258e-05, 0.9999968653335809, -1.999990576601542 },
-		{ 6.921919396328817e-05, 0.999996539042626, -1.999988872969653 },
-		{ 7.642406784357233e-05, 0.9999961787997991, -1.999986833783797 },
-		{ 8.437917292916307e-05, 0.9999957810463155, -1.999984389308177 },
-		{ 9.316192359379346e-05, 0.9999953419043354, -1.999981455260721 },
-		{ 0.0001028590828061581, 0.9999948570460639, -1.999977929042294 },
-		{ 0.0001135656362733868, 0.9999943217182997, -1.999973686250035 },
-		{ 0.0001253866503974036, 0.9999937306688065, -1.999968575753973 },
-		{ 0.0001384379288707085, 0.9999930781054116, -1.999962413997839 },
-		{ 0.0001528478931404358, 0.9999923576060182, -1.999954977620727 },
-		{ 0.0001687634993879959, 0.9999915620777061, -1.999945994997602 },
-		{ 0.0001863234132384508, 0.9999906838303686, -1.999935137578122 },
-		{ 0.0002057176366150825, 0.999989714118578, -1.999922002564174 },
-		{ 0.0002271316631549775, 0.9999886434524802, -1.999906102001746 },
-		{ 0.0002507737291695387, 0.9999874613605555, -1.999886842386795 },
-		{ 0.0002768767676306494, 0.9999861562260114, -1.999863500580642 },
-		{ 0.0003056945191907905, 0.9999847152868052, -1.99983519763436 },
-		{ 0.0003375138316215851, 0.9999831243084215, -1.999800860600506 },
-		{ 0.0003726450906529224, 0.9999813677475282, -1.999759186858879 },
-		{ 0.000411433157237622, 0.9999794283429555, -1.999708588103132 },
-		{ 6.169162264139788e-05, 0.9999969154189203, -1.999990826042739 },
-		{ 6.811304929654534e-05, 0.9999965943475571, -1.999989171319628 },
-		{ 7.520288298314496e-05, 0.9999962398560935, -1.999987191089298 },
-		{ 9.16733051949109e-05, 0.9999954163368299, -1.999981969941524 },
-		{ 0.0001012155060472636, 0.9999949392261089, -1.9999785478903 },
-		{ 0.0001233830549742834, 0.9999938308473555, -1.999969473417279 },
-		{ 0.0001362258666376169, 0.9999931887067123, -1.999963496700659 },
-		{ 0.0001504054831979105, 0.9999924797263255, -1.999956284809073 },
-		{ 0.0001833495261591915, 0.9999908327273941, -1.999937047834236 },
-		{ 0.0002024304998671204, 0.9999898784778292, -1.999924313569177 },
-		{ 0.0002467663278969156, 0.9999876617164074, -1.999890232631506 },
-		{ 0.0002724515761391704, 0.999986377443456, -1.999867610420035 },
-		{ 0.0003008104301258981, 0.9999849594928435, -1.999840181363295 },
-		{ 0.0003666909006823064, 0.9999816654570167, -1.999766527843409 },
-		{ 0.0004048589508385605, 0.9999797570581033, -1.999717503049477 },
-		{ 0.000493529611133134, 0.9999753235850476, -1.999585619142071 },
-		{ 0.000544899440783113, 0.9999727550724862, -1.999497704320208 },
-		{ 0.0006016163359031286, 0.999969919211904, -1.999390832009456 },
-		{ 0.0007333750782577919, 0.9999633312501891, -1.999102834968779 },
-		{ 0.0008097097061309219, 0.9999595145259835, -1.998910577886122 },
-		{ 0.0009870428426389688, 0.999950647860829, -1.998392006357997 },
-		{ 6.496410456625338e-05, 0.9999967517948213, -1.999989999252048 },
-		{ 7.172621052761357e-05, 0.9999964136902483, -1.999988182245849 },
-		{ 8.743513620647364e-05, 0.999995628246123, -1.999983396403399 },
-		{ 9.653618135204494e-05, 0.9999951731917925, -1.999980262404752 },
-		{ 0.000117678872163929, 0.999994116059707, -1.999971958753277 },
-		{ 0.0001299279981116581, 0.9999935036001931, -1.999966493518566 },
-		{ 0.0001434521638236597, 0.9999928273933584, -1.999959901742557 },
-		{ 0.0001748698901740613, 0.9999912565113583, -1.999942329397028 },
-		{ 0.0001930747073362063, 0.9999903464396076, -1.999930704062085 },
-		{ 0.0002353598387127018, 0.9999882321867596, -1.999899604205649 },
-		{ 0.0002598560984532172, 0.9999870072262272, -1.999878967708085 },
-		{ 0.0002869065526825847, 0.9999856548054387, -1.999853953157782 },
-		{ 0.0003497382513794223, 0.9999825130991651, -1.999786807891289 },
-		{ 0.0003861422992851959, 0.9999806928905961, -1.999742126067494 },
-		{ 0.0004707113968087134, 0.9999764644301903, -1.999621959982097 },
-		{ 0.0005197088206584071, 0.9999740146212666, -1.999541871028684 },
-		{ 0.0005738020492292452, 0.9999713098984724, -1.999444527435853 },
-		{ 0.0006994703869319935, 0.9999650265041216, -1.999182250817642 },
-		{ 0.000772277143278949, 0.9999613861539562, -1.999007184987659 },
-		{ 0.0009414117151402224, 0.9999529294143038, -1.998535053982065 },
-		{ 0.001039400064613635, 0.9999480299995813, -1.998219670276524 },
-		{ 6.823658596968039e-05, 0.9999965881707487, -1.999989138192207 },
-		{ 8.318139715430623e-05, 0.9999958409326748, -1.999984770301616 },
-		{ 9.183956222613084e-05, 0.9999954080247376, -1.99998191281737 },
-		{ 0.0001013990675018964, 0.9999949300468143, -1.999978479195469 },
-		{ 0.0001119536175657534, 0.9999944023193318, -1.999974348518246 },
-		{ 0.0001364729391338762, 0.9999931763531379, -1.99996337654531 },
-		{ 0.0001663675542811547, 0.9999916818499227, -1.999947399191906 },
-		{ 0.0001836811758890923, 0.9999908160378365, -1.999936835129734 },
-		{ 0.0002027999565299005, 0.9999898601520576, -1.999924057608848 },
-		{ 0.0002239086897885498, 0.9999888047027223, -1.999908590593983 },
-		{ 0.0002729458636138841, 0.9999863527364758, -1.999867154514055 },
-		{ 0.0003327230198134848, 0.9999833638508477, -1.99980623765851 },
-		{ 0.0003673563476877651, 0.9999816322418289, -1.999765714438262 },
-		{ 0.0004055937075170683, 0.9999797203251211, -1.999716513693133 },
-		{ 0.0004478112000208091, 0.9999776094489691, -1.999656758899755 },
-		{ 0.0005458880022537144, 0.9999727056591993, -1.99949593023117 },
-		{ 0.0006654405043910782, 0.9999667279784569, -1.99925826047614 },
-		{ 0.0007347056007803215, 0.9999632647392231, -1.999099644230918 },
-		{ 0.0008111791897017026, 0.9999594410615071, -1.998906694486666 },
-		{ 0.0008956123733165903, 0.9999552193992748, -1.998671934515374 },
-		{ 0.001091757149794276, 0.9999454121451872, -1.998038569488602 },
-		{ 0.0008561491896194267, 0.9999571925439324, -1.998784495954072 },
-		{ 0.0009834549593953029, 0.9999508272663835, -1.998403495835182 },
-		{ 0.001129688084756259, 0.9999435155957678, -1.997901893111486 },
-		{ 0.001297665177872407, 0.9999351167629884, -1.997241340245717 },
-		{ 0.001490618749689011, 0.9999254690645482, -1.99637127918349 },
-		{ 0.001712268553331768, 0.9999143870839539, -1.995225094256315 },
-		{ 0.001966903979186916, 0.9999016566235079, -1.993714836152145 },
-		{ 0.002259321623804756, 0.9998870342184175, -1.991724919510192 },
-		{ 0.002595246159019319, 0.9998702377358112, -1.989102737649196 },
-		{ 0.002981148890635133, 0.9998509433567556, -1.985647283586279 },
-		{ 0.003424390514358489, 0.9998287814974788, -1.98109440254788 },
-		{ 0.003933525904184243, 0.9998033237363975, -1.975095740504688 },
-		{ 0.004518388021581568, 0.9997740811981028, -1.967194086457088 },
-		{ 0.005190155553027166, 0.9997404923098678, -1.956789225271085 },
-		{ 0.005961808698364335, 0.9997019097492736, -1.943093557788935 },
-		{ 0.006848170598607193, 0.9996575914928905, -1.925077113377608 },
-		{ 0.007866278177179227, 0.9996066861543477, -1.901396535737035 },
-		{ 0.009035716526615351, 0.9995482142532641, -1.870304873382341 },
-		{ 0.01037896422077536, 0.9994810519639767, -1.829543084655431 },
-		{ 0.01192185622554457, 0.9994039075387096, -1.776208148315449 },
-		{ 0.01369399632535179, 0.9993153002293662, -1.70660670088199 },
-		{ 0.0004673503747363146, 0.999976632550542, -1.999627174520486 },
-		{ 0.000515993635544457, 0.9999742003303987, -1.999548211269266 },
-		{ 0.0005697030104150318, 0.9999715149142567, -1.99945223392065 },
-		{ 0.0006290037515617232, 0.9999685498796106, -1.999335542873337 },
-		{ 0.0006944730042398349, 0.9999652763502054, -1.999193644188987 },
-		{ 0.0007667591903642178, 0.999961662096256, -1.999021049091487 },
-		{ 0.0008465697560843932, 0.9999576715346092, -1.998811069493391 },
-		{ 0.0009346854839344445, 0.9999532657289303, -1.998555576954123 },
-		{ 0.001031973958604443, 0.9999484013264208, -1.998244648529042 },
-		{ 0.001139388853387202, 0.9999430305581061, -1.997866199855865 },
-		{ 0.001257983397354934, 0.9999371008301385, -1.997405519902487 },
-		{ 0.001388921893848004, 0.9999305539061425, -1.996844674264303 },
-		{ 0.001533488389973746, 0.9999233255805012, -1.996161822410996 },
-		{ 0.001693103113477785, 0.9999153450245283, -1.99533036633784 },
-		{ 0.001869333261352439, 0.9999065338055617, -1.994317882433962 },
-		{ 0.002063924861445937, 0.9998968056424798, -1.993084916220611 },
-		{ 0.002278745128008488, 0.9998860640345172, -1.991583243418459 },
-		{ 0.002515903061953839, 0.9998742059437904, -1.989754662195843 },
-		{ 0.002777748182820505, 0.9998611127986469, -1.987527574501809 },
-		{ 0.003066859200624098, 0.999846657039969, -1.984815370068092 },
-		{ 0.003386062897352478, 0.9998306972155212, -1.981512580748021 },
-		{ 0.0009608641803746987, 0.9999519567940229, -1.998474887388907 },
-		{ 0.001060877994418872, 0.999946956105795, -1.99814643955566 },
-		{ 0.001171300402624196, 0.9999414349830146, -1.997746661072882 },
-		{ 0.001293216520046441, 0.9999353391962473, -1.997259996860229 },
-		{ 0.001427822599018368, 0.9999286088736672, -1.996667495619292 },
-		{ 0.001576438306549944, 0.999921178092562, -1.995946087324604 },
-		{ 0.001740553572961154, 0.9999129743073429, -1.99506769956833 },
-		{ 0.001921687921119757, 0.9999039160598043, -1.993997982199754 },
-		{ 0.002121736875642989, 0.9998939146980304, -1.99269523698276 },
-		{ 0.002342552499905747, 0.9998828737231011, -1.991108901170111 },
-		{ 0.002586355790309109, 0.9998706827371177, -1.989176843853047 },
-		{ 0.002855552585334548, 0.9998572231712299, -1.986823930300054 },
-		{ 0.003152751087956015, 0.999842362561616, -1.983958460386968 },
-		{ 0.003480893613739431, 0.9998259553701767, -1.98046899472921 },
-		{ 0.003843191198905761, 0.9998078413517322, -1.976220120842638 },
-		{ 0.004243171921451698, 0.9997878414681016, -1.971046699929981 },
-		{ 0.004684794524255303, 0.999765760346836, -1.964748664087585 },
-		{ 0.005172385010567731, 0.9997413813792784, -1.957082880772238 },
-		{ 0.005710686159933348, 0.9997144659097931, -1.947754586193136 },
-		{ 0.006305005184311365, 0.9996847499727938, -1.936406447024618 },
-		{ 0.006961181396633077, 0.9996519410318865, -1.922605527759809 },
-		{ 0.0008659662432234846, 0.9999567016912135, -1.998756959817017 },
-		{ 0.0009561033796960294, 0.9999521948564318, -1.998489725847486 },
-		{ 0.001055619675581452, 0.9999472190366423, -1.998164505631536 },
-		{ 0.00128680737832248, 0.9999356596343907, -1.997286762451112 },
-		{ 0.001420746336223027, 0.9999289626867037, -1.996700085253561 },
-		{ 0.00173190170076858, 0.9999134054207814, -1.995115999317347 },
-		{ 0.001912159549600736, 0.9999043921618039, -1.994056814769441 },
-		{ 0.00211118879325151, 0.9998944406955069, -1.992766931242445 },
-		{ 0.002573538882203491, 0.9998713232448605, -1.989283065117567 },
-		{ 0.002841401202892781, 0.9998579307469107, -1.986953364768824 },
-		{ 0.003463653428229521, 0.9998268183401844, -1.98066103985456 },
-		{ 0.003824136281747097, 0.9998087934644668, -1.976453796151463 },
-		{ 0.00422215473088918, 0.9997888925337808, -1.971331160783136 },
-		{ 0.00514674660978992, 0.9997426630474282, -1.957504466498953 },
-		{ 0.005682387147613281, 0.9997158808596033, -1.948267516243376 },
-		{ 0.006926683362908205, 0.9996536658544163, -1.923364158702852 },
-		{ 0.007647541363658368, 0.9996176234888732, -1.906752020543665 },
-		{ 0.008443400460542838, 0.9995778304517018, -1.886569193654217 },
-		{ 0.01029214084111689, 0.9994853931348658, -1.832338932043712 },
-		{ 0.0113631412621672, 0.9994318432605505, -1.796315124449967 },
-		{ 0.01385096777886332, 0.9993074516561731, -1.700022346296167 },
-		{ 0.0008692385933538745, 0.9999565380736944, -1.998747712611147 },
-		{ 0.0009597156692700991, 0.9999520142235059, -1.998478473610232 },
-		{ 0.001169899794962221, 0.9999415050102521, -1.997751975742227 },
-		{ 0.001291669979022888, 0.999935416503883, -1.997266466235011 },
-		{ 0.001574552129367144, 0.9999212724147231, -1.995955686575303 },
-		{ 0.001738446079549662, 0.9999130781999384, -1.995079360872045 },
-		{ 0.001919398520848836, 0.9999040305860378, -1.994012160789925 },
-		{ 0.002339733730985082, 0.9998830136057731, -1.991129971182701 },
-		{ 0.002583260122197401, 0.9998708373423975, -1.989202531294388 },
-		{ 0.003148996568636991, 0.9998425507002812, -1.983996491815827 },
-		{ 0.003476741050223342, 0.9998261639552761, -1.980515499741248 },
-		{ 0.003838612838151696, 0.999808070382204, -1.976276436151842 },
-		{ 0.004679193744958683, 0.9997660408973624, -1.964832534810943 },
-		{ 0.005166186583670243, 0.9997416913677868, -1.95718503564569 },
-		{ 0.006297467538140858, 0.9996851270087097, -1.936557304795207 },
-		{ 0.006952854215856627, 0.999652357311684, -1.922788956064008 },
-		{ 0.00767643169457963, 0.9996161784191956, -1.906052806891031 },
-		{ 0.009357287198901561, 0.9995321357138465, -1.861034326819329 },
-		{ 0.01033102740428821, 0.9994834486412228, -1.831089351802949 },
-		{ 0.01259295476236512, 0.9993703523448122, -1.750883302045322 },
-		{ 0.0139032913227935, 0.9993048354788066, -1.697812645825917 },
-		{ 0.0008725109429484139, 0.9999563744562018, -1.998738431158791 },
-		{ 0.001063597720614865, 0.9999468201409598, -1.998137062679013 },
-		{ 0.001174304428944423, 0.999941284784424, -1.997735240705166 },
-		{ 0.001296532579296709, 0.9999351733734343, -1.997246094453598 },
-		{ 0.001431484753599675, 0.9999284257908087, -1.99665056908691 },
-		{ 0.001744990456462366, 0.9999127509792023, -1.995042585698171 },
-		{ 0.00212713887925307, 0.999893643110017, -1.992658080964477 },
-		{ 0.002348574479453863, 0.9998825726891138, -1.991063472937667 },
-		{ 0.002593005947037098, 0.9998703506221532, -1.989121560516533 },
-		{ 0.002862867049814821, 0.9998568567044845, -1.986756643436682 },
-		{ 0.003489828664224003, 0.9998255095707962, -1.980369416753808 },
-		{ 0.004254051522618161, 0.9997872975318219, -1.970898941331295 },
-		{ 0.004696801339581387, 0.9997651599853317, -1.964568853050405 },
-		{ 0.005185626835525683, 0.9997407188711789, -1.956864151463238 },
-		{ 0.005725324299414195, 0.9997137338989722, -1.947488246563257 },
-		{ 0.006979025034565966, 0.9996510487706647, -1.9222116456055 },
-		{ 0.008507198197982138, 0.9995746403059841, -1.884868040579496 },
-		{ 0.009392499682265023, 0.999530375120496, -1.860000456480908 },
-		{ 0.01036992497459896, 0.9994815041513628, -1.82983533841685 },
-		{ 0.01144900963256218, 0.9994275497462248, -1.793282998479585 },
-		{ 0.01395561472976183, 0.9993022193082898, -1.695595503711469 }
-	}
-};
+#include "Scales.hpp"
+const ScaleDef gamelan = {
+	.name = "Gamelan Pelog",
+	.description = "Gamelan tunings in C.",
+	.scalename = {
+		"Java (5 notes) low, 5-TET",
+		"Bali (7 notes) low, 7-TET",
+		"Pelog, var1, low, pathet nem or lima? 7-TET",
+		"Pelog, var2, low, pathet nem or lima? 7-TET",
+		"Pelog, var3, low, pathet barang? 7-TET",
+		"Java (5 note) mid, 5-TET",
+		"Bali (7 note) mid, 7-TET",
+		"Bali (7 note) high, 7-TET",
+		"Pelog, var1, high, pathet nem or lima? 7-TET",
+		"Pelog, var2, high, pathet nem or lima? 7-TET",
+		"Pelog, var3, high, pathet barang? 7-TET"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.freq = {
+		32.70319566260001,
+		37.5661070607748,
+		43.15212538435451,
+		49.56877544363381,
+		56.93957081131959,
+		65.40639132519999,
+		75.13221412154959,
+		86.30425076870901,
+		99.13755088726764,
+		113.8791416226392,
+		130.8127826504,
+		150.2644282430992,
+		172.608501537418,
+		198.2751017745353,
+		227.7582832452784,
+		261.6255653008001,
+		300.5288564861983,
+		345.217003074836,
+		396.5502035490705,
+		455.5165664905568,
+		523.2511306016002,
+		34.70319566260001,
+		38.31543442204719,
+		42.30366935723895,
+		46.7070377272517,
+		51.56875056942572,
+		56.93651673696337,
+		62.86301107439476,
+		69.4063913252,
+		76.63086884409438,
+		84.60733871447786,
+		93.41407545450339,
+		103.1375011388515,
+		113.8730334739268,
+		125.7260221487895,
+		138.8127826504,
+		153.2617376881887,
+		169.2146774289557,
+		186.8281509090068,
+		206.2750022777028,
+		227.7460669478536,
+		251.4520442975791,
+		37.70319566260001,
+		41.62770296306862,
+		45.96071031985235,
+		56.02673343683657,
+		61.85852887300919,
+		75.4063913252,
+		83.25540592613724,
+		91.92142063970471,
+		112.0534668736731,
+		123.7170577460184,
+		150.8127826504,
+		166.5108118522744,
+		183.8428412794095,
+		224.1069337473463,
+		247.4341154920369,
+		301.6255653008,
+		333.021623704549,
+		367.6856825588188,
+		448.2138674946925,
+		494.8682309840735,
+		603.2511306015999,
+		39.7031956626,
+		43.83588199041626,
+		53.43653869041347,
+		58.99872201511047,
+		71.92024771703382,
+		79.4063913252,
+		87.67176398083251,
+		106.8730773808269,
+		117.9974440302209,
+		143.8404954340676,
+		158.8127826504001,
+		175.3435279616649,
+		213.7461547616539,
+		235.9948880604419,
+		287.6809908681353,
+		317.6255653008,
+		350.68705592333,
+		427.4923095233078,
+		471.9897761208837,
+		575.3619817362705,
+		635.2511306016,
+		41.70319566260001,
+		50.83676493667026,
+		56.12833907567818,
+		61.97071059338435,
+		68.42121172107031,
+		83.40639132519998,
+		101.6735298733405,
+		112.2566781513564,
+		123.9414211867687,
+		136.8424234421406,
+		166.8127826503999,
+		203.347059746681,
+		224.5133563027127,
+		247.8828423735374,
+		273.6848468842811,
+		333.6255653008001,
+		406.6941194933621,
+		449.0267126054255,
+		495.7656847470748,
+		547.3696937685622,
+		667.2511306015999,
+		523.2511306016002,
+		601.0577129723969,
+		690.4340061496721,
+		793.1004070981411,
+		911.0331329811135,
+		1046.5022612032,
+		1202.115425944794,
+		1380.868012299344,
+		1586.200814196283,
+		1822.066265962227,
+		2093.004522406401,
+		2404.230851889587,
+		2761.736024598688,
+		3172.401628392564,
+		3644.132531924454,
+		4186.0090448128,
+		4808.461703779174,
+		5523.472049197376,
+		6344.803256785131,
+		7288.265063848908,
+		8372.018089625601,
+		285.6255653007999,
+		315.356191485768,
+		348.1814640915472,
+		384.4235033590724,
+		424.4379588685014,
+		468.6174995918294,
+		517.3956672233808,
+		571.2511306016,
+		630.712382971536,
+		696.3629281830944,
+		768.8470067181447,
+		848.8759177370027,
+		937.2349991836585,
+		1034.791334446762,
+		1142.5022612032,
+		1261.424765943072,
+		1392.725856366189,
+		1537.694013436289,
+		1697.751835474005,
+		1874.469998367318,
+		2069.582668893523,
+		587.2511306016,
+		648.3778151903169,
+		715.8671466503661,
+		790.3814098002624,
+		872.6518263631939,
+		963.4857305759029,
+		1063.774491703207,
+		1174.5022612032,
+		1296.755630380634,
+		1431.734293300732,
+		1580.762819600525,
+		1745.303652726388,
+		1926.971461151806,
+		2127.548983406413,
+		2349.0045224064,
+		2593.511260761267,
+		2863.468586601465,
+		3161.525639201049,
+		3490.607305452776,
+		3853.942922303612,
+		4255.097966812827,
+		529.2511306016,
+		584.3406233972358,
+		645.1643547065065,
+		786.464157593251,
+		868.3268292790168,
+		1058.5022612032,
+		1168.681246794472,
+		1290.328709413013,
+		1572.928315186502,
+		1736.653658558034,
+		2117.004522406399,
+		2337.362493588944,
+		2580.657418826027,
+		3145.856630373004,
+		3473.307317116068,
+		4234.009044812799,
+		4674.724987177886,
+		5161.314837652053,
+		6291.713260746007,
+		6946.614634232134,
+		8468.018089625599,
+		531.2511306016,
+		586.5488024245836,
+		715.0109990128506,
+		789.4361461715248,
+		962.3334413056485,
+		1062.5022612032,
+		1173.097604849167,
+		1430.021998025701,
+		1578.87229234305,
+		1924.666882611298,
+		2125.004522406401,
+		2346.195209698334,
+		2860.043996051402,
+		3157.744584686099,
+		3849.333765222594,
+		4250.009044812799,
+		4692.390419396669,
+		5720.087992102804,
+		6315.489169372198,
+		7698.667530445188,
+		8500.018089625601,
+		533.2511306016,
+		650.0404093233244,
+		717.7027993981152,
+		792.4081347497987,
+		874.889512127078,
+		1066.5022612032,
+		1300.080818646649,
+		1435.40559879623,
+		1584.816269499597,
+		1749.779024254157,
+		2133.004522406401,
+		2600.161637293297,
+		2870.811197592461,
+		3169.632538999195,
+		3499.558048508311,
+		4266.0090448128,
+		5200.323274586595,
+		5741.622395184923,
+		6339.26507799839,
+		6999.116097016623,
+		8532.018089625601
+	}
+};
@@ -1,1647 +1,482 @@
-#include "Scales.hpp"
-Scale indian_shrutis = {
-	.name = "Indian Shrutis",
-	.description = "In Indian classical music, a shruti is smallest interval or pitch that the human ear can detect and a singer or musical instrument can produce. These are 22 pitches in an octave, the most consonant of which form the 7 notes of the basic scale. Since SMR allows only 21 notes in a scale, the first note of Ri (256:243) is omitted.",
-	.scalename = {
-		"Shrutis; C0-",
-		"Shrutis; C1-",
-		"Shrutis; C2-",
-		"Shrutis; C3-",
-		"Shrutis; C4-",
-		"Shrutis; C5-",
-		"Shrutis; C6-",
-		"Shrutis; C7-",
-		"Shrutis; C8-",
-		"Shrutis; C9-",
-		"Shrutis; C10-"},
-	.notedesc = {
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni",
-		"Sa",
-		"ri",
-		"Ri",
-		"Ri",
-		"ga",
-		"ga",
-		"Ga",
-		"Ga",
-		"ma",
-		"ma",
-		"Ma",
-		"Ma",
-		"Pa",
-		"dha",
-		"dha",
-		"Dha",
-		"Dha",
-		"ni",
-		"ni",
-		"Ni",
-		"Ni"},
-	.c_maxq48000 = {
-		0.00214041915088612,
-		0.002283113760945195,
-		0.002378243500984578,
-		0.002407971544746885,
-		0.002536793067716883,
-		0.002568502981063344,
-		0.00267552393860765,
-		0.002708967987840245,
-		0.002853892201181493,
-		0.002889565853696262,
-		0.003009964430933606,
-		0.003047588986320276,
-		0.00321062872632918,
-		0.003382390756955843,
-		0.003424670641417792,
-		0.003567365251476867,
-		0.003611957317120327,
-		0.003805189601575324,
-		0.003852754471595016,
-		0.004013285907911474,
-		0.004063451981760367,
-		0.004280838301772239,
-		0.004566227521890389,
-		0.004756487001969155,
-		0.004815943089493771,
-		0.005073586135433765,
-		0.005137005962126687,
-		0.0053510478772153,
-		0.005417935975680491,
-		0.005707784402362985,
-		0.005779131707392524,
-		0.006019928861867212,
-		0.006095177972640553,
-		0.006421257452658361,
-		0.006764781513911687,
-		0.006849341282835584,
-		0.007134730502953733,
-		0.007223914634240654,
-		0.007610379203150648,
-		0.007705508943190032,
-		0.008026571815822949,
-		0.008126903963520735,
-		0.008561676603544479,
-		0.009132455043780779,
-		0.00951297400393831,
-		0.009631886178987541,
-		0.01014717227086753,
-		0.01027401192425337,
-		0.0107020957544306,
-		0.01083587195136098,
-		0.01141556880472597,
-		0.01155826341478505,
-		0.01203985772373442,
-		0.01219035594528111,
-		0.01284251490531672,
-		0.01352956302782337,
-		0.01369868256567117,
-		0.01426946100590747,
-		0.01444782926848131,
-		0.0152207584063013,
-		0.01541101788638006,
-		0.0160531436316459,
-		0.01625380792704147,
-		0.01712335320708896,
-		0.01826491008756156,
-		0.01902594800787662,
-		0.01926377235797508,
-		0.02029434454173506,
-		0.02054802384850675,
-		0.0214041915088612,
-		0.02167174390272196,
-		0.02283113760945194,
-		0.02311652682957009,
-		0.02407971544746885,
-		0.02438071189056221,
-		0.02568502981063344,
-		0.02705912605564675,
-		0.02739736513134234,
-		0.02853892201181493,
-		0.02889565853696262,
-		0.03044151681260259,
-		0.03082203577276013,
-		0.0321062872632918,
-		0.03250761585408294,
-		0.03424670641417792,
-		0.03652982017512311,
-		0.03805189601575324,
-		0.03852754471595016,
-		0.04058868908347012,
-		0.0410960476970135,
-		0.0428083830177224,
-		0.04334348780544393,
-		0.04566227521890388,
-		0.04623305365914019,
-		0.0481594308949377,
-		0.04876142378112442,
-		0.05137005962126689,
-		0.05411825211129349,
-		0.05479473026268467,
-		0.05707784402362986,
-		0.05779131707392524,
-		0.06088303362520518,
-		0.06164407154552026,
-		0.06421257452658359,
-		0.06501523170816588,
-		0.06849341282835583,
-		0.07305964035024623,
-		0.07610379203150648,
-		0.07705508943190033,
-		0.08117737816694025,
-		0.082192095394027,
-		0.0856167660354448,
-		0.08668697561088785,
-		0.09132455043780777,
-		0.09246610731828038,
-		0.09631886178987539,
-		0.09752284756224884,
-		0.1027401192425338,
-		0.108236504222587,
-		0.1095894605253693,
-		0.1141556880472597,
-		0.1155826341478505,
-		0.1217660672504104,
-		0.1232881430910405,
-		0.1284251490531672,
-		0.1300304634163318,
-		0.1369868256567117,
-		0.1461192807004925,
-		0.152207584063013,
-		0.1541101788638007,
-		0.1623547563338805,
-		0.164384190788054,
-		0.1712335320708896,
-		0.1733739512217757,
-		0.1826491008756155,
-		0.1849322146365608,
-		0.1926377235797508,
-		0.1950456951244977,
-		0.2054802384850676,
-		0.216473008445174,
-		0.2191789210507387,
-		0.2283113760945195,
-		0.2311652682957009,
-		0.2435321345008207,
-		0.246576286182081,
-		0.2568502981063344,
-		0.2600609268326635,
-		0.2739736513134233,
-		0.2922385614009849,
-		0.3044151681260259,
-		0.3082203577276013,
-		0.324709512667761,
-		0.328768381576108,
-		0.3424670641417792,
-		0.3467479024435514,
-		0.3652982017512311,
-		0.3698644292731215,
-		0.3852754471595016,
-		0.3900913902489954,
-		0.4109604769701351,
-		0.432946016890348,
-		0.4383578421014774,
-		0.4566227521890389,
-		0.4623305365914019,
-		0.4870642690016415,
-		0.493152572364162,
-		0.5137005962126687,
-		0.520121853665327,
-		0.5479473026268467,
-		0.5844771228019698,
-		0.6088303362520519,
-		0.6164407154552026,
-		0.649419025335522,
-		0.657536763152216,
-		0.6849341282835584,
-		0.6934958048871028,
-		0.7305964035024621,
-		0.739728858546243,
-		0.7705508943190031,
-		0.7801827804979907,
-		0.8219209539402702,
-		0.8658920337806959,
-		0.8767156842029548,
-		0.9132455043780778,
-		0.9246610731828038,
-		0.9741285380032829,
-		0.9863051447283241,
-		1.027401192425337,
-		1.040243707330654,
-		1.095894605253693,
-		1.16895424560394,
-		1.217660672504104,
-		1.232881430910405,
-		1.298838050671044,
-		1.315073526304432,
-		1.369868256567117,
-		1.386991609774206,
-		1.461192807004924,
-		1.479457717092486,
-		1.541101788638006,
-		1.560365560995981,
-		1.64384190788054,
-		1.731784067561392,
-		1.75343136840591,
-		1.826491008756156,
-		1.849322146365608,
-		1.948257076006566,
-		1.972610289456648,
-		2.054802384850675,
-		2.080487414661308,
-		2.191789210507387,
-		2.337908491207879,
-		2.435321345008207,
-		2.465762861820811,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088,
-		2.597676101342088
-	},
-	.c_maxq96000 = {
-		0.00107020957544306,
-		0.001141556880472597,
-		0.001189121750492289,
-		0.001203985772373443,
-		0.001268396533858441,
-		0.001284251490531672,
-		0.001337761969303825,
-		0.001354483993920123,
-		0.001426946100590746,
-		0.001444782926848131,
-		0.001504982215466803,
-		0.001523794493160138,
-		0.00160531436316459,
-		0.001691195378477922,
-		0.001712335320708896,
-		0.001783682625738433,
-		0.001805978658560164,
-		0.001902594800787662,
-		0.001926377235797508,
-		0.002006642953955737,
-		0.002031725990880184,
-		0.00214041915088612,
-		0.002283113760945195,
-		0.002378243500984578,
-		0.002407971544746885,
-		0.002536793067716883,
-		0.002568502981063344,
-		0.00267552393860765,
-		0.002708967987840245,
-		0.002853892201181493,
-		0.002889565853696262,
-		0.003009964430933606,
-		0.003047588986320276,
-		0.00321062872632918,
-		0.003382390756955843,
-		0.003424670641417792,
-		0.003567365251476867,
-		0.003611957317120327,
-		0.003805189601575324,
-		0.003852754471595016,
-		0.004013285907911474,
-		0.004063451981760367,
-		0.004280838301772239,
-		0.004566227521890389,
-		0.004756487001969155,
-		0.004815943089493771,
-		0.005073586135433765,
-		0.005137005962126687,
-		0.0053510478772153,
-		0.005417935975680491,
-		0.005707784402362985,
-		0.005779131707392524,
-		0.006019928861867212,
-		0.006095177972640553,
-		0.006421257452658361,
-		0.006764781513911687,
-		0.006849341282835584,
-		0.007134730502953733,
-		0.007223914634240654,
-		0.007610379203150648,
-		0.007705508943190032,
-		0.008026571815822949,
-		0.008126903963520735,
-		0.008561676603544479,
-		0.009132455043780779,
-		0.00951297400393831,
-		0.009631886178987541,
-		0.01014717227086753,
-		0.01027401192425337,
-		0.0107020957544306,
-		0.01083587195136098,
-		0.01141556880472597,
-		0.01155826341478505,
-		0.01203985772373442,
-		0.01219035594528111,
-		0.01284251490531672,
-		0.01352956302782337,
-		0.01369868256567117,
-		0.01426946100590747,
-		0.01444782926848131,
-		0.0152207584063013,
-		0.01541101788638006,
-		0.0160531436316459,
-		0.01625380792704147,
-		0.01712335320708896,
-		0.01826491008756156,
-		0.01902594800787662,
-		0.01926377235797508,
-		0.02029434454173506,
-		0.02054802384850675,
-		0.0214041915088612,
-		0.02167174390272196,
-		0.02283113760945194,
-		0.02311652682957009,
-		0.02407971544746885,
-		0.02438071189056221,
-		0.02568502981063344,
-		0.02705912605564675,
-		0.02739736513134234,
-		0.02853892201181493,
-		0.02889565853696262,
-		0.03044151681260259,
-		0.03082203577276013,
-		0.0321062872632918,
-		0.03250761585408294,
-		0.03424670641417792,
-		0.03652982017512311,
-		0.03805189601575324,
-		0.03852754471595016,
-		0.04058868908347012,
-		0.0410960476970135,
-		0.0428083830177224,
-		0.04334348780544393,
-		0.04566227521890388,
-		0.04623305365914019,
-		0.0481594308949377,
-		0.04876142378112442,
-		0.05137005962126689,
-		0.05411825211129349,
-		0.05479473026268467,
-		0.05707784402362986,
-		0.05779131707392524,
-		0.06088303362520518,
-		0.06164407154552026,
-		0.06421257452658359,
-		0.06501523170816588,
-		0.06849341282835583,
-		0.07305964035024623,
-		0.07610379203150648,
-		0.07705508943190033,
-		0.08117737816694025,
-		0.082192095394027,
-		0.0856167660354448,
-		0.08668697561088785,
-		0.09132455043780777,
-		0.09246610731828038,
-		0.09631886178987539,
-		0.09752284756224884,
-		0.1027401192425338,
-		0.108236504222587,
-		0.1095894605253693,
-		0.1141556880472597,
-		0.1155826341478505,
-		0.1217660672504104,
-		0.1232881430910405,
-		0.1284251490531672,
-		0.1300304634163318,
-		0.1369868256567117,
-		0.1461192807004925,
-		0.152207584063013,
-		0.1541101788638007,
-		0.1623547563338805,
-		0.164384190788054,
-		0.1712335320708896,
-		0.1733739512217757,
-		0.1826491008756155,
-		0.1849322146365608,
-		0.1926377235797508,
-		0.1950456951244977,
-		0.2054802384850676,
-		0.216473008445174,
-		0.2191789210507387,
-		0.2283113760945195,
-		0.2311652682957009,
-		0.2435321345008207,
-		0.246576286182081,
-		0.2568502981063344,
-		0.2600609268326635,
-		0.2739736513134233,
-		0.2922385614009849,
-		0.3044151681260259,
-		0.3082203577276013,
-		0.324709512667761,
-		0.328768381576108,
-		0.3424670641417792,
-		0.3467479024435514,
-		0.3652982017512311,
-		0.3698644292731215,
-		0.3852754471595016,
-		0.3900913902489954,
-		0.4109604769701351,
-		0.432946016890348,
-		0.4383578421014774,
-		0.4566227521890389,
-		0.4623305365914019,
-		0.4870642690016415,
-		0.493152572364162,
-		0.5137005962126687,
-		0.520121853665327,
-		0.5479473026268467,
-		0.5844771228019698,
-		0.6088303362520519,
-		0.6164407154552026,
-		0.649419025335522,
-		0.657536763152216,
-		0.6849341282835584,
-		0.6934958048871028,
-		0.7305964035024621,
-		0.739728858546243,
-		0.7705508943190031,
-		0.7801827804979907,
-		0.8219209539402702,
-		0.8658920337806959,
-		0.8767156842029548,
-		0.9132455043780778,
-		0.9246610731828038,
-		0.9741285380032829,
-		0.9863051447283241,
-		1.027401192425337,
-		1.040243707330654,
-		1.095894605253693,
-		1.16895424560394,
-		1.217660672504104,
-		1.232881430910405,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044,
-		1.298838050671044
-	},
-	.c_bpre4800022 = {
-		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
-		{ 0.001140905267680372, 0.9988590947323202, -1.998853885102284 },
-		{ 0.001188412277528982, 0.9988115877225215, -1.998805935070047 },
-		{ 0.001203258163296067, 0.9987967418367679, -1.998790947031014 },
-		{ 0.001267594321704521, 0.9987324056783171, -1.998725974422472 },
-		{ 0.0012834260552942, 0.9987165739447134, -1.998709980985979 },
-		{ 0.001336867741827628, 0.9986631322581723, -1.998655978617132 },
-		{ 0.001353567682408427, 0.9986464323175938, -1.998639098774728 },
-		{ 0.001425926507539671, 0.9985740734924826, -1.998565934626911 },
-		{ 0.001443742536054898, 0.9985562574639889, -1.998547913873851 },
-		{ 0.001503848046295663, 0.9984961519537313, -1.998487098914163 },
-		{ 0.001522636402870661, 0.9984773635971572, -1.998468082848682 },
-		{ 0.001604026747847973, 0.9983959732521525, -1.998385673388713 },
-		{ 0.001689768596002947, 0.9983102314040267, -1.998298800480031 },
-		{ 0.001710872951283081, 0.9982891270487548, -1.99827740868514 },
-		{ 0.001782095223213279, 0.9982179047768128, -1.998205190000539 },
-		{ 0.001804347466185049, 0.9981956525338234, -1.998182618102466 },
-		{ 0.001900785540633137, 0.9980992144593678, -1.998084748777321 },
-		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
-		{ 0.002004627991681216, 0.9979953720083546, -1.997979281758119 },
-		{ 0.002029664313985725, 0.9979703356860169, -1.997953840808912 },
-		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002280508870531002, 0.99771949112947, -1.997698664517072 },
-		{ 0.002375418760656867, 0.9976245812393466, -1.997601983964474 },
-		{ 0.002405075025500493, 0.9975949249744996, -1.99757175959611 },
-		{ 0.00253357531962396, 0.9974664246804011, -1.99744071612506 },
-		{ 0.002565204928149782, 0.9974347950718664, -1.997408440192681 },
-		{ 0.002671948268296747, 0.9973280517317038, -1.997299456332867 },
-		{ 0.002705303219345619, 0.9972946967806587, -1.997265382502424 },
-		{ 0.002849826274980878, 0.9971501737250377, -1.997117641374173 },
-		{ 0.002885394153414351, 0.9971146058465878, -1.997081255781208 },
-		{ 0.003005441058915976, 0.9969945589410949, -1.996958373915837 },
-		{ 0.00304294785901175, 0.9969570521409983, -1.996919957633316 },
-		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
-		{ 0.003376675351159931, 0.9966233246488458, -1.996577639858749 },
-		{ 0.003418812293628005, 0.9965811877063737, -1.996534354631018 },
-		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
-		{ 0.003605439262592181, 0.9963945607374252, -1.996342470176706 },
-		{ 0.003797958095595352, 0.9962020419044065, -1.996144234325483 },
-		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
-		{ 0.004005243968676354, 0.9959947560313239, -1.995930459524986 },
-		{ 0.004055209090744792, 0.9959447909092616, -1.995878878563031 },
-		{ 0.004271689139653243, 0.9957283108603474, -1.995655165543826 },
-		{ 0.004555817020353541, 0.9954441829796491, -1.995360971845917 },
-		{ 0.004745194907025379, 0.995254805092982, -1.995164523732451 },
-		{ 0.004804365665122996, 0.9951956343348778, -1.995103084652738 },
-		{ 0.005060738147161915, 0.9949392618528398, -1.994836558131651 },
-		{ 0.00512383609139882, 0.9948761639086072, -1.994770879856201 },
-		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
-		{ 0.005403287773181772, 0.9945967122268264, -1.994479614366412 },
-		{ 0.00569152453239668, 0.9943084754676063, -1.994178532578583 },
-		{ 0.005762462807408955, 0.9942375371925961, -1.994104330221415 },
-		{ 0.006001842936157173, 0.9939981570638513, -1.993853635762538 },
-		{ 0.006076642691553303, 0.9939233573084559, -1.993775205745359 },
-		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
-		{ 0.00674193576447449, 0.9932580642358362, -1.993075635870998 },
-		{ 0.00682592330939016, 0.9931740766908648, -1.992987066975018 },
-		{ 0.007109361338607747, 0.9928906386619714, -1.992687747087931 },
-		{ 0.007197866337508856, 0.9928021336628763, -1.992594149826156 },
-		{ 0.007581491705494782, 0.9924185082945092, -1.992187719586632 },
-		{ 0.007675929804751687, 0.9923240701963366, -1.992087484929245 },
-		{ 0.007994445958105334, 0.9920055540418963, -1.991748886163474 },
-		{ 0.008093973460719397, 0.9919060265392927, -1.99164291498941 },
-		{ 0.008525143929763187, 0.9914748560704251, -1.991182902834333 },
-		{ 0.009090904514417318, 0.9909090954860811, -1.990577012434074 },
-		{ 0.00946789887217191, 0.9905321011285994, -1.990171836626721 },
-		{ 0.009585623472325765, 0.9904143765281869, -1.990045075511484 },
-		{ 0.01009583930856181, 0.9899041606919032, -1.989494395340542 },
-		{ 0.01022139257453293, 0.989778607425849, -1.989358560581442 },
-		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
-		{ 0.01077738002760371, 0.9892226199724123, -1.988755504241616 },
-		{ 0.01135065561329091, 0.9886493443867153, -1.988131064640887 },
-		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
-		{ 0.01196763788768067, 0.9880323621129593, -1.987456029859763 },
-		{ 0.01211635979670587, 0.9878836402033123, -1.987292850940948 },
-		{ 0.01276039045869732, 0.9872396095413829, -1.98658413513159 },
-		{ 0.0134384178310987, 0.9865615821695203, -1.985834353511192 },
-		{ 0.01360525338975688, 0.9863947466107515, -1.985649287005155 },
-		{ 0.01416811513509982, 0.9858318848651213, -1.985023241693475 },
-		{ 0.01434398790591168, 0.9856560120945222, -1.984827095788174 },
-		{ 0.0151055043945085, 0.9848944956054988, -1.983974880167563 },
-		{ 0.0152928752600474, 0.9847071247399526, -1.983764465651186 },
-		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
-		{ 0.01612243451505617, 0.9838775654849683, -1.982829430442941 },
-		{ 0.01697760978050467, 0.9830223902198703, -1.98185961909105 },
-		{ 0.01809910021783067, 0.9819008997823047, -1.980578697588161 },
-		{ 0.01884609241740112, 0.9811539075826085, -1.979719778635349 },
-		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
-		{ 0.02008981677994113, 0.9799101832201682, -1.97827951113565 },
-		{ 0.02033837240102352, 0.9796616275991471, -1.977990148889893 },
-		{ 0.0211767502229378, 0.9788232497770653, -1.977010372323061 },
-		{ 0.02143860813494901, 0.9785613918650833, -1.97670316116258 },
-		{ 0.02257247384372903, 0.9774275261562821, -1.975366374270423 },
-		{ 0.02285141802706583, 0.9771485819732816, -1.975035879661568 },
-		{ 0.02379211531014787, 0.9762078846898554, -1.973916587098443 },
-		{ 0.02408591341868893, 0.9759140865813477, -1.973565507747321 },
-		{ 0.0253579533527373, 0.9746420466474223, -1.972037199476861 },
-		{ 0.02669630828975239, 0.9733036917102477, -1.970414705469504 },
-		{ 0.02702546753975829, 0.972974532460253, -1.970013381127019 },
-		{ 0.02813555839184389, 0.971864441608337, -1.968653258655241 },
-		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
-		{ 0.02998283252600512, 0.97001716747401, -1.966367122542472 },
-		{ 0.03035187848637586, 0.9696481215136245, -1.965906983592711 },
-		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
-		{ 0.03198493613542029, 0.9680150638646278, -1.963857144674253 },
-		{ 0.0336669170800795, 0.9663330829199375, -1.961722512131246 },
-		{ 0.03587068610901398, 0.9641293138911817, -1.958889659140922 },
-		{ 0.03733700963539661, 0.9626629903646221, -1.956982072728441 },
-		{ 0.03779482940156732, 0.9622051705986322, -1.956382759213956 },
-		{ 0.03977596997509963, 0.9602240300250973, -1.953768876640452 },
-		{ 0.04026303259525816, 0.9597369674048457, -1.953121159356398 },
-		{ 0.0419050456958703, 0.9580949543041354, -1.950922691401318 },
-		{ 0.04241760235113531, 0.9575823976489289, -1.950231740702229 },
-		{ 0.04463543111203278, 0.9553645688879895, -1.947216198660475 },
-		{ 0.04518058625482295, 0.9548194137451774, -1.946468532475902 },
-		{ 0.0470181658693646, 0.9529818341306421, -1.943929611565316 },
-		{ 0.04759169561216562, 0.9524083043879062, -1.943131261934363 },
-		{ 0.05007294307956665, 0.9499270569204934, -1.939644839428779 },
-		{ 0.05267992370320282, 0.9473200762967972, -1.935924642822358 },
-		{ 0.05332055918377449, 0.9466794408162477, -1.935001466165577 },
-		{ 0.0554794453186195, 0.9445205546814081, -1.931864283832681 },
-		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
-		{ 0.0590666948057279, 0.9409333051943015, -1.926561997532561 },
-		{ 0.05978252044509952, 0.9402174795549011, -1.925490528852913 },
-		{ 0.06219438323302607, 0.9378056167669827, -1.921847431514289 },
-		{ 0.06294683613125548, 0.9370531638688396, -1.92070043869114 },
-		{ 0.06620025062283003, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07045466609610292, 0.9295453339042812, -1.908983213042984 },
-		{ 0.07327996698228047, 0.9267200330177563, -1.90444479377794 },
-		{ 0.07416145206777842, 0.9258385479427459, -1.903014300417245 },
-		{ 0.07796993285624779, 0.9220300671441777, -1.896754159879905 },
-		{ 0.07890483282843277, 0.9210951671745174, -1.895197602729788 },
-		{ 0.08205417869760596, 0.9179458213042083, -1.889896394547758 },
-		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
-		{ 0.08727877946814266, 0.9127212205366463, -1.880904799510105 },
-		{ 0.08832000647530014, 0.9116799935260445, -1.879083307830163 },
-		{ 0.09182538606238837, 0.9081746139425293, -1.872878644988852 },
-		{ 0.09291842173309428, 0.9070815782670465, -1.870921019058288 },
-		{ 0.09763835029632684, 0.9023616497073262, -1.862342050870689 },
-		{ 0.1025845555747964, 0.8974154444263687, -1.853131906715319 },
-		{ 0.1037978017145651, 0.8962021982893195, -1.850838228784563 },
-		{ 0.1078809217843794, 0.8921190782156745, -1.843018565121339 },
-		{ 0.109152895585477, 0.8908471044163706, -1.840550866389203 },
-		{ 0.1146446310695083, 0.885355368931118, -1.829722814184669 },
-		{ 0.1159908597107511, 0.8840091402935922, -1.827025233579297 },
-		{ 0.1205205100374709, 0.8794794899632891, -1.817823105450646 },
-		{ 0.1219313680835824, 0.8780686319166024, -1.814917229795779 },
-		{ 0.1280180280633103, 0.8719819719414862, -1.802163694945135 },
-		{ 0.1359454722175226, 0.8640545277832211, -1.785021009225222 },
-		{ 0.1411899804036392, 0.8588100195964314, -1.773346457806082 },
-		{ 0.1428224221220405, 0.8571775778779611, -1.769658010693557 },
-		{ 0.1498605552829239, 0.8501394447178966, -1.753457366555208 },
-		{ 0.1515842482987786, 0.8484157517052598, -1.749415583690459 },
-		{ 0.1573754691536355, 0.8426245308498574, -1.735621246300642 },
-		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
-		{ 0.166939428346658, 0.833060571654596, -1.712110474345765 },
-		{ 0.1688395894069323, 0.8311604105956486, -1.707330343490485 },
-		{ 0.1752194104090779, 0.8247805895918523, -1.691014744150961 },
-		{ 0.1772030103688335, 0.8227969896314359, -1.685857991414579 },
-		{ 0.1857439860685323, 0.8142560139330381, -1.6631962986446 },
-		{ 0.1946455201072463, 0.8053544798949771, -1.638781489564825 },
-		{ 0.1968221454613213, 0.8031778545397602, -1.63268693628976 },
-		{ 0.2041235502837177, 0.7958764497163848, -1.611883084501303 },
-		{ 0.2063919559715538, 0.7936080440316116, -1.605306360901414 },
-		{ 0.2161458707060334, 0.783854129295156, -1.576410619664972 },
-		{ 0.2185283513499805, 0.78147164865045, -1.569199822561555 },
-		{ 0.2265158267353526, 0.7734841732660874, -1.544584495489581 },
-		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
-		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
-		{ 0.2534097730187154, 0.7465902269826855, -1.45665701461964 },
-		{ 0.2624453502409098, 0.7375546497592229, -1.4253466709472 },
-		{ 0.2652465999832749, 0.7347534000167282, -1.415457082705361 },
-		{ 0.2772629245362842, 0.7227370754652536, -1.372047995867147 },
-		{ 0.2801902411442336, 0.7198097588558323, -1.361229688367437 },
-		{ 0.2899834353056022, 0.7100165646945451, -1.324340846003185 },
-		{ 0.293016571933351, 0.7069834280671006, -1.31269740491967 },
-		{ 0.306010538171412, 0.6939894618302931, -1.261642939422601 },
-		{ 0.3091719197130863, 0.6908280802873006, -1.248932789115144 },
-		{ 0.3197369790342457, 0.6802630209674833, -1.205633459365805 },
-		{ 0.3230051138539472, 0.6769948861465533, -1.191982377224266 },
-		{ 0.3369867098337329, 0.663013290167162, -1.132205713578635 },
-		{ 0.3514045862182348, 0.6485954137820649, -1.068225076216675 },
-		{ 0.3549049117646045, 0.6450950882367019, -1.052333608543035 },
-		{ 0.3665806767870317, 0.6334193232131574, -0.9983138168177181 },
-		{ 0.3701858602360683, 0.629814139763936, -0.9813196652404923 },
-		{ 0.3855723018459378, 0.6144276981549239, -0.90713008315289 },
-		{ 0.389302062356337, 0.6106979376444528, -0.8887423668000664 },
-		{ 0.4017226252791354, 0.5982773747213684, -0.8263808750438928 },
-		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
-		{ 0.421864742205575, 0.5781352577946095, -0.7216036473971494 },
-		{ 0.4426026681586857, 0.5573973318416389, -0.6091209380521765 },
-		{ 0.4560131386187914, 0.54398686138145, -0.533975427136668 },
-		{ 0.4601374411638632, 0.5398625588361424, -0.5104962677098522 },
-		{ 0.477650777871414, 0.5223492221287224, -0.408931136842927 },
-		{ 0.4818732328493087, 0.5181267671699999, -0.3840063997132224 },
-		{ 0.4958758179827635, 0.5041241820372223, -0.3001956854520381 },
-		{ 0.5001731239447729, 0.499826876103498, -0.2741324629120475 },
-		{ 0.5183786268715802, 0.4816213731315, -0.1620642046602609 },
-		{ 0.5227559387972855, 0.4772440612240433, -0.1347465860348699 },
-		{ 0.5372434338834495, 0.4627565662003634, -0.04342001197299912 },
-		{ 0.5416773241962149, 0.4583226758111719, -0.01521397519340812 },
-		{ 0.5604128016671207, 0.439587198356206, 0.1050568965232047 },
-		{ 0.5793250906051042, 0.4206749094533486, 0.2277327264016849 },
-		{ 0.5838517824211475, 0.4161482176035046, 0.2571975712478258 },
-		{ 0.5987810114078777, 0.4012189886295836, 0.3543993761197944 },
-		{ 0.6033346685979624, 0.3966653314125422, 0.3840006055737145 },
-		{ 0.6224790979180121, 0.3775209020859294, 0.507702766010537 },
-		{ 0.6270470525968631, 0.3729529474304429, 0.536940683128211 },
-		{ 0.6420632458498091, 0.3579367541784974, 0.6318817624605987 },
-		{ 0.6466325319782557, 0.353367468075141, 0.6603255571073567 },
-		{ 0.6657587486843425, 0.334241251345644, 0.7763137408249879 },
-		{ 0.6893082144564122, 0.3106917855441781, 0.9096969519576674 },
-		{ 0.7040786820095314, 0.2959213179952881, 0.9859218932776043 },
-		{ 0.7085476545808449, 0.2914523454525645, 1.00757150912454 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
-		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 }
-	},
-	.c_bpre9600022 = {
-		{ 0.0005349617156208133, 0.9994650382843794, -1.999463893242008 },
-		{ 0.0005706154348276653, 0.9994293845651727, -1.999428081785652 },
-		{ 0.0005943827842119868, 0.9994056172158137, -1.999404203632215 },
-		{ 0.0006018101693883827, 0.9993981898306439, -1.999396740692759 },
-		{ 0.0006339981376719009, 0.9993660018623391, -1.999364393538055 },
-		{ 0.0006419190576857418, 0.9993580809423184, -1.999356432172937 },
-		{ 0.0006686574222882169, 0.9993313425777119, -1.999329553568735 },
-		{ 0.0006770130145149731, 0.9993229869854859, -1.999321152978315 },
-		{ 0.0007132175934374753, 0.9992867824065736, -1.999284746963547 },
-		{ 0.0007221320053439594, 0.9992778679946778, -1.999275781342908 },
-		{ 0.0007522069307808499, 0.9992477930692325, -1.999245528956839 },
-		{ 0.0007616082249791413, 0.9992383917750345, -1.999236070703032 },
-		{ 0.0008023352448461595, 0.9991976647551538, -1.999195088754642 },
-		{ 0.000845241514610185, 0.9991547584854044, -1.999151899544625 },
-		{ 0.0008558026747503422, 0.9991441973252683, -1.999141266478641 },
-		{ 0.0008914449486552697, 0.9991085550513581, -1.999105374937946 },
-		{ 0.0009025810593771615, 0.9990974189406271, -1.999094158859551 },
-		{ 0.0009508448232558262, 0.9990491551767446, -1.999045537033632 },
-		{ 0.0009627256821338171, 0.9990372743178716, -1.999033565170043 },
-		{ 0.001002816816624251, 0.9989971831833936, -1.998993158599838 },
-		{ 0.001015347622389953, 0.9989846523776115, -1.998980526560574 },
-		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
-		{ 0.001140905267680372, 0.9988590947323202, -1.998853885102284 },
-		{ 0.001188415546083563, 0.9988115844539183, -1.99880593177034 },
-		{ 0.001203261431787018, 0.9987967385682132, -1.998790943730967 },
-		{ 0.001267591053350762, 0.9987324089466613, -1.99872597772399 },
-		{ 0.0012834260552942, 0.9987165739447134, -1.998709980985979 },
-		{ 0.001336867741827628, 0.9986631322581723, -1.998655978617132 },
-		{ 0.001353567682408427, 0.9986464323175938, -1.998639098774728 },
-		{ 0.001425929775352711, 0.9985740702246565, -1.998565931321768 },
-		{ 0.00144373926824459, 0.9985562607317564, -1.998547917179401 },
-		{ 0.001503851313845102, 0.9984961486861605, -1.998487095607237 },
-		{ 0.001522633135338475, 0.9984773668646668, -1.99846808615604 },
-		{ 0.001604026747847973, 0.9983959732521525, -1.998385673388713 },
-		{ 0.001689765329013734, 0.9983102346709892, -1.998298803791213 },
-		{ 0.001710869684352431, 0.9982891303156485, -1.998277411996805 },
-		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
-		{ 0.001804347466185049, 0.9981956525338234, -1.998182618102466 },
-		{ 0.001900785540633137, 0.9980992144593678, -1.998084748777321 },
-		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
-		{ 0.002004631257578115, 0.9979953687424225, -1.997979278439732 },
-		{ 0.002029664313985725, 0.9979703356860169, -1.997953840808912 },
-		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
-		{ 0.002280508870531002, 0.99771949112947, -1.997698664517072 },
-		{ 0.002375418760656867, 0.9976245812393466, -1.997601983964474 },
-		{ 0.002405075025500493, 0.9975949249744996, -1.99757175959611 },
-		{ 0.002533578583801143, 0.9974664214161997, -1.997440712794571 },
-		{ 0.002565208192234029, 0.997434791807769, -1.997408436861471 },
-		{ 0.002671948268296747, 0.9973280517317038, -1.997299456332867 },
-		{ 0.002705303219345619, 0.9972946967806587, -1.997265382502424 },
-		{ 0.002849823011797788, 0.9971501769882036, -1.997117644711892 },
-		{ 0.002885394153414351, 0.9971146058465878, -1.997081255781208 },
-		{ 0.003005437796251825, 0.9969945622037523, -1.996958377257116 },
-		{ 0.003042951121540986, 0.9969570488784637, -1.996919954291179 },
-		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
-		{ 0.003376668828425839, 0.99662333117173, -1.996577646558282 },
-		{ 0.003418805771145307, 0.9965811942289824, -1.996534361332483 },
-		{ 0.003561021104958328, 0.9964389788953318, -1.996388165043087 },
-		{ 0.003605432741380599, 0.9963945672588124, -1.996342476886699 },
-		{ 0.003797958095595352, 0.9962020419044065, -1.996144234325483 },
-		{ 0.003845358292574048, 0.9961546417079712, -1.996095380792998 },
-		{ 0.004005243968676354, 0.9959947560313239, -1.995930459524986 },
-		{ 0.004055209090744792, 0.9959447909092616, -1.995878878563031 },
-		{ 0.00427169565677319, 0.995728304343321, -1.995655158803373 },
-		{ 0.004555830050934474, 0.9954441699493149, -1.995360958339043 },
-		{ 0.004745207935259034, 0.9952547920651272, -1.995164510208279 },
-		{ 0.00480435263829865, 0.9951956473619583, -1.995103098182323 },
-		{ 0.005060725123668472, 0.9949392748765644, -1.994836571684653 },
-		{ 0.00512382306868581, 0.9948761769315059, -1.994770893414968 },
-		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
-		{ 0.005403287773181772, 0.9945967122268264, -1.994479614366412 },
-		{ 0.00569152453239668, 0.9943084754676063, -1.994178532578583 },
-		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
-		{ 0.006001829925064254, 0.9939981700752569, -1.993853649401502 },
-		{ 0.006076642691553303, 0.9939233573084559, -1.993775205745359 },
-		{ 0.006400679578884212, 0.993599320421156, -1.993434920615793 },
-		{ 0.00674193576447449, 0.9932580642358362, -1.993075635870998 },
-		{ 0.00682592330939016, 0.9931740766908648, -1.992987066975018 },
-		{ 0.007109328845868803, 0.992890671154242, -1.992687781438059 },
-		{ 0.007197898826715353, 0.9928021011735026, -1.992594115455831 },
-		{ 0.007581491705494782, 0.9924185082945092, -1.992187719586632 },
-		{ 0.007675897329933457, 0.9923241026700667, -1.992087519408595 },
-		{ 0.007994445958105334, 0.9920055540418963, -1.991748886163474 },
-		{ 0.008093973460719397, 0.9919060265392927, -1.99164291498941 },
-		{ 0.008525143929763187, 0.9914748560704251, -1.991182902834333 },
-		{ 0.009090872086562115, 0.9909091279135058, -1.990577047235952 },
-		{ 0.009467866456318075, 0.990532133543687, -1.990171871514483 },
-		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
-		{ 0.01009587170268893, 0.9899041282973662, -1.989494360309736 },
-		{ 0.01022142496466544, 0.9897785750354202, -1.989358525522077 },
-		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
-		{ 0.01077738002760371, 0.9892226199724123, -1.988755504241616 },
-		{ 0.01135065561329091, 0.9886493443867153, -1.988131064640887 },
-		{ 0.01149173904669069, 0.9885082609534841, -1.987976979777587 },
-		{ 0.01196767022032501, 0.9880323297796766, -1.987455994402967 },
-		{ 0.01211635979670587, 0.9878836402033123, -1.987292850940948 },
-		{ 0.01276039045869732, 0.9872396095413829, -1.98658413513159 },
-		{ 0.01343845011563134, 0.9865615498843687, -1.98583431772001 },
-		{ 0.01360528566894622, 0.9863947143310596, -1.985649251176066 },
-		{ 0.01416814739624236, 0.9858318526038489, -1.985023205736528 },
-		{ 0.01434395564997145, 0.9856560443500404, -1.984827131784976 },
-		{ 0.0151055043945085, 0.9848944956054988, -1.983974880167563 },
-		{ 0.0152928752600474, 0.9847071247399526, -1.983764465651186 },
-		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
-		{ 0.01612243451505617, 0.9838775654849683, -1.982829430442941 },
-		{ 0.01697757761080529, 0.9830224223892035, -1.981859655685487 },
-		{ 0.01809913235042532, 0.9819008676496734, -1.980578660739472 },
-		{ 0.01884609241740112, 0.9811539075826085, -1.979719778635349 },
-		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
-		{ 0.0200897847124454, 0.9799102152876543, -1.978279548434996 },
-		{ 0.02033834034155276, 0.9796616596584996, -1.977990186245466 },
-		{ 0.0211767502229378, 0.9788232497770653, -1.977010372323061 },
-		{ 0.02143860813494901, 0.9785613918650833, -1.97670316116258 },
-		{ 0.02257247384372903, 0.9774275261562821, -1.975366374270423 },
-		{ 0.02285138604960579, 0.9771486139503947, -1.975035917585081 },
-		{ 0.02379211531014787, 0.9762078846898554, -1.973916587098443 },
-		{ 0.02408591341868893, 0.9759140865813477, -1.973565507747321 },
-		{ 0.02535798524769428, 0.974642014752336, -1.972037160987721 },
-		{ 0.02669630828975239, 0.9733036917102477, -1.970414705469504 },
-		{ 0.02702546753975829, 0.972974532460253, -1.970013381127019 },
-		{ 0.02813552658748722, 0.9718644734125268, -1.968653297769843 },
-		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
-		{ 0.02998283252600512, 0.97001716747401, -1.966367122542472 },
-		{ 0.03035187848637586, 0.9696481215136245, -1.965906983592711 },
-		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
-		{ 0.03198493613542029, 0.9680150638646278, -1.963857144674253 },
-		{ 0.03366685383496579, 0.9663331461662921, -1.961722592845494 },
-		{ 0.03587068610901398, 0.9641293138911817, -1.958889659140922 },
-		{ 0.03733700963539661, 0.9626629903646221, -1.956982072728441 },
-		{ 0.03779495535908165, 0.9622050446462781, -1.956382594090897 },
-		{ 0.03977603282163308, 0.9602239671785838, -1.953768793194234 },
-		{ 0.04026296978201866, 0.9597370302194856, -1.953121243019777 },
-		{ 0.0419051084039563, 0.9580948915969693, -1.950922607005879 },
-		{ 0.04241760235113531, 0.9575823976489289, -1.950231740702229 },
-		{ 0.04463555617137816, 0.9553644438310684, -1.947216027439419 },
-		{ 0.04518064874829227, 0.9548193512523949, -1.9464684466235 },
-		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
-		{ 0.04759169561216562, 0.9524083043879062, -1.943131261934363 },
-		{ 0.05007281873620895, 0.9499271812656622, -1.939645015473931 },
-		{ 0.0526798617018442, 0.9473201382987531, -1.935924731997757 },
-		{ 0.05332043526568792, 0.9466795647363048, -1.935001645081576 },
-		{ 0.0554794453186195, 0.9445205546814081, -1.931864283832681 },
-		{ 0.05615302913312293, 0.9438469708678259, -1.930877195717097 },
-		{ 0.05906675638995908, 0.9409332436103627, -1.926561905544307 },
-		{ 0.05978239737314497, 0.9402176026290892, -1.925490713458613 },
-		{ 0.06219432185417278, 0.9378056781462188, -1.921847524874209 },
-		{ 0.06294683613125548, 0.9370531638688396, -1.92070043869114 },
-		{ 0.06620025062283003, 0.9337997493796442, -1.915683929838771 },
-		{ 0.07045466609610292, 0.9295453339042812, -1.908983213042984 },
-		{ 0.07327996698228047, 0.9267200330177563, -1.90444479377794 },
-		{ 0.07416114907724942, 0.9258388509227515, -1.903014793289067 },
-		{ 0.07796993285624779, 0.9220300671441777, -1.896754159879905 },
-		{ 0.07890513425521681, 0.9210948657468784, -1.895197099605682 },
-		{ 0.08205417869760596, 0.9179458213042083, -1.889896394547758 },
-		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
-		{ 0.0872784807766369, 0.912721519224016, -1.880905320613017 },
-		{ 0.08832000647530014, 0.9116799935260445, -1.879083307830163 },
-		{ 0.09182568325735462, 0.9081743167431304, -1.872878114190059 },
-		{ 0.09291842173309428, 0.9070815782670465, -1.870921019058288 },
-		{ 0.09763864559060596, 0.9023613544102154, -1.862341507741079 },
-		{ 0.1025845555747964, 0.8974154444263687, -1.853131906715319 },
-		{ 0.1037980949926829, 0.896201905007884, -1.850837672677801 },
-		{ 0.1078809217843794, 0.8921190782156745, -1.843018565121339 },
-		{ 0.1091531871142777, 0.8908468128873851, -1.840550299076196 },
-		{ 0.1146446310695083, 0.885355368931118, -1.829722814184669 },
-		{ 0.1159911489979021, 0.8840088510023246, -1.827024652060433 },
-		{ 0.1205205100374709, 0.8794794899632891, -1.817823105450646 },
-		{ 0.1219313680835824, 0.8780686319166024, -1.814917229795779 },
-		{ 0.1280183134139535, 0.8719816865860999, -1.802163088738755 },
-		{ 0.1359454722175226, 0.8640545277832211, -1.785021009225222 },
-		{ 0.1411899804036392, 0.8588100195964314, -1.773346457806082 },
-		{ 0.1428224221220405, 0.8571775778779611, -1.769658010693557 },
-		{ 0.1498605552829239, 0.8501394447178966, -1.753457366555208 },
-		{ 0.1515839706513244, 0.8484160293487106, -1.749416237072139 },
-		{ 0.1573751934019431, 0.8426248065981354, -1.735621911030412 },
-		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
-		{ 0.1669397009647084, 0.8330602990362063, -1.712109791141151 },
-		{ 0.1688393174079064, 0.8311606825923015, -1.707331030335645 },
-		{ 0.1752194104090779, 0.8247805895918523, -1.691014744150961 },
-		{ 0.1772030103688335, 0.8227969896314359, -1.685857991414579 },
-		{ 0.1857437196027436, 0.8142562803977395, -1.663197017279807 },
-		{ 0.1946457836567788, 0.8053542163433832, -1.638780754598021 },
-		{ 0.1968218826215659, 0.8031781173791415, -1.632687675193852 },
-		{ 0.2041235502837177, 0.7958764497163848, -1.611883084501303 },
-		{ 0.2063916962607233, 0.793608303739279, -1.605307116958412 },
-		{ 0.2161456141896071, 0.783854385810862, -1.576411392789127 },
-		{ 0.2185283513499805, 0.78147164865045, -1.569199822561555 },
-		{ 0.2265160798562503, 0.773483920144025, -1.544583704647202 },
-		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
-		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
-		{ 0.2534095286963725, 0.7465904713038056, -1.456657849139329 },
-		{ 0.2624453502409098, 0.7375546497592229, -1.4253466709472 },
-		{ 0.2652465999832749, 0.7347534000167282, -1.415457082705361 },
-		{ 0.2772626880196282, 0.722737311980447, -1.372048866094363 },
-		{ 0.280189770040282, 0.7198102299703719, -1.361231437130568 },
-		{ 0.2899829706115911, 0.7100170293994521, -1.324342621948745 },
-		{ 0.2930156465198328, 0.7069843535068494, -1.312700973200037 },
-		{ 0.306010538171412, 0.6939894618302931, -1.261642939422601 },
-		{ 0.3091714675784416, 0.6908285324333698, -1.248934615025634 },
-		{ 0.3197378695406019, 0.6802621305058538, -1.205629756424184 },
-		{ 0.32300467076528, 0.6769953292388153, -1.191984236310432 },
-		{ 0.3369862759044548, 0.6630137241084877, -1.132207603475486 },
-		{ 0.3514054352592323, 0.648594564773209, -1.06822123872503 },
-		{ 0.3549044895630941, 0.6450955104505882, -1.052335533823167 },
-		{ 0.3665815059510431, 0.6334184940697449, -0.9983099254146518 },
-		{ 0.3701862724541478, 0.6298137275516804, -0.9813177136971202 },
-		{ 0.3855727039891179, 0.6144272960130672, -0.9071281091071478 },
-		{ 0.3893012629684265, 0.6106987370467072, -0.8887463246681315 },
-		{ 0.4017218421505355, 0.5982781578651332, -0.8263848615712317 },
-		{ 0.4055528046663713, 0.5944471953631718, -0.8068021114921052 },
-		{ 0.4218639854441633, 0.5781360145723876, -0.7216076677912432 },
-		{ 0.4426026681586857, 0.5573973318416389, -0.6091209380521765 },
-		{ 0.4560134946596421, 0.5439865053429984, -0.5339734076172157 },
-		{ 0.4601367345032426, 0.5398632655150419, -0.510500305315691 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
-		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 }
-	},
-	.c_bpre4800080040 = {
-		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
-		{ 5.707775288569886e-05, 0.9999971461125834, -1.999991933516442 },
-		{ 5.945626896164841e-05, 0.9999970272069204, -1.999991371202015 },
-		{ 6.019955743878447e-05, 0.999996990047881, -1.999991191762431 },
-		{ 6.341999490161164e-05, 0.9999968290090301, -1.999990393684691 },
-		{ 6.421247911523708e-05, 0.9999967893792746, -1.999990192197627 },
-		{ 6.688799698921024e-05, 0.9999966556002257, -1.999989497186221 },
-		{ 6.772413084975596e-05, 0.9999966137942766, -1.999989275297251 },
-		{ 7.134725619029857e-05, 0.9999964326460926, -1.999988287988197 },
-		{ 7.223950603522835e-05, 0.9999963880421822, -1.999988038439774 },
-		{ 7.524907266241078e-05, 0.9999962375571765, -1.999987177722332 },
-		{ 7.618991636659063e-05, 0.9999961905152769, -1.999986902713507 },
-		{ 8.026556954503774e-05, 0.9999959867216131, -1.9999856786116 },
-		{ 8.455994852350821e-05, 0.9999957720142748, -1.99998433144849 },
-		{ 8.56170275761881e-05, 0.9999957191637481, -1.999983990792338 },
-		{ 8.918426317748259e-05, 0.9999955407973323, -1.999982814709858 },
-		{ 9.029872837902971e-05, 0.9999954850670376, -1.999982438895191 },
-		{ 9.512949763785123e-05, 0.9999952435254973, -1.999980764116728 },
-		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
-		{ 0.000100332033972573, 0.9999949834127143, -1.999978877059215 },
-		{ 0.0001015861102606197, 0.9999949206957149, -1.999978409104007 },
-		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
-		{ 0.0001141553428740544, 0.9999942922333115, -1.999973441905671 },
-		{ 0.0001189119029278971, 0.9999940544063163, -1.99997143032779 },
-		{ 0.0001203982335274824, 0.9999939800884594, -1.999970786889104 },
-		{ 0.0001268393103347369, 0.9999936580444779, -1.999967916962172 },
-		{ 0.0001284247520880769, 0.9999935787688569, -1.999967190128151 },
-		{ 0.0001337757702817552, 0.9999933112116364, -1.999964677654743 },
-		{ 0.0001354480323569916, 0.9999932276000196, -1.99996387371547 },
-		{ 0.0001426943760118488, 0.9999928652885487, -1.999960286631982 },
-		{ 0.00014447774352468, 0.9999927761137726, -1.999959377985468 },
-		{ 0.0001504978451766618, 0.9999924751121461, -1.999956235765422 },
-		{ 0.0001523788511243053, 0.999992381061428, -1.999955230170944 },
-		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
-		{ 0.0001691187909674532, 0.999991544062788, -1.999945782204374 },
-		{ 0.0001712327699628911, 0.9999914383621847, -1.999944525293828 },
-		{ 0.000178367434140717, 0.9999910816309115, -1.999940177743249 },
-		{ 0.0001805970490660872, 0.99999097015446, -1.999938785755083 },
-		{ 0.0001902585427956318, 0.9999904870736187, -1.999932569785937 },
-		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
-		{ 0.0002006633198707925, 0.9999899668342321, -1.999925541631114 },
-		{ 0.000203171704556286, 0.999989841417229, -1.999923795490765 },
-		{ 0.0002140408029571688, 0.9999892979600933, -1.999915996474394 },
-		{ 0.000228310034175833, 0.9999885844992018, -1.999905183861393 },
-		{ 0.0002378230988697134, 0.9999881088479821, -1.999897613314754 },
-		{ 0.0002407957422590524, 0.9999879602131582, -1.999895188232903 },
-		{ 0.0002536777542818017, 0.9999873161128144, -1.999884352507044 },
-		{ 0.0002568487976863675, 0.9999871575625837, -1.99988160376605 },
-		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
-		{ 0.0002708951474157991, 0.9999864552459046, -1.999869040966948 },
-		{ 0.0002853871354825546, 0.9999857306443637, -1.999855417843191 },
-		{ 0.0002889544433750187, 0.9999855522797299, -1.999851961364473 },
-		{ 0.0003009941195070155, 0.9999849502972785, -1.999839995084257 },
-		{ 0.0003047567828463676, 0.9999847621645425, -1.999836160229763 },
-		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
-		{ 0.0003382378968830565, 0.999983088229803, -1.999800044372587 },
-		{ 0.0003424654386490728, 0.999982876830395, -1.999795228278334 },
-		{ 0.0003567391296011746, 0.9999821632759116, -1.999778549730198 },
-		{ 0.0003611946267087568, 0.9999819404231826, -1.999773207247765 },
-		{ 0.0003805152756813137, 0.999980974237733, -1.999749309543339 },
-		{ 0.0003852820973979059, 0.9999807363320938, -1.999743241848262 },
-		{ 0.0004013246264698192, 0.9999799337691286, -1.999722238400035 },
-		{ 0.0004063413451585637, 0.999979682937655, -1.999715504935722 },
-		{ 0.0004280814727609967, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0004566227377528523, 0.9999771690632689, -1.999643573459251 },
-		{ 0.0004756507587851876, 0.9999762177719155, -1.999614243988385 },
-		{ 0.0004815913860323758, 0.9999759206367215, -1.99960484557337 },
-		{ 0.0005073547002414787, 0.9999746324519577, -1.999562793367351 },
-		{ 0.0005136959589358272, 0.9999743153555438, -1.999552116173722 },
-		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
-		{ 0.0005417866256076224, 0.9999729106752698, -1.999503270526228 },
-		{ 0.0005707701986741852, 0.9999714614923424, -1.99945023098801 },
-		{ 0.0005779055430794498, 0.99997110480092, -1.999436764056811 },
-		{ 0.0006019874206012352, 0.9999699008864983, -1.999390107930775 },
-		{ 0.0006095089218488926, 0.9999695245612764, -1.999375143433401 },
-		{ 0.0006421155140426252, 0.9999678942566038, -1.999308221528274 },
-		{ 0.0006764700735534339, 0.9999661767456141, -1.999234041012943 },
-		{ 0.0006849250132112075, 0.9999657539539929, -1.999215201383949 },
-		{ 0.0007134611086017462, 0.9999643270335906, -1.999149929043009 },
-		{ 0.0007223833188336273, 0.9999638810088949, -1.999128991852354 },
-		{ 0.000761023311765466, 0.9999619488374458, -1.999035352543512 },
-		{ 0.0007705360234567621, 0.9999614731988953, -1.999011568884837 },
-		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
-		{ 0.0008126744346443001, 0.999959366288093, -1.998902734804912 },
-		{ 0.0008561537828897495, 0.9999571924621234, -1.998784491390396 },
-		{ 0.0009132248632596821, 0.9999543388114068, -1.998620092474825 },
-		{ 0.0009512746150121417, 0.9999524362730423, -1.99850469934004 },
-		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
-		{ 0.00101469320865016, 0.9999492653838118, -1.998302088928483 },
-		{ 0.001027377236784231, 0.9999486312071723, -1.998260023664356 },
-		{ 0.001070181108262045, 0.9999464909457915, -1.998114261663522 },
-		{ 0.001083558574583829, 0.9999458220843713, -1.998067507494197 },
-		{ 0.001141524108413177, 0.9999429237991311, -1.997858303212896 },
-		{ 0.001155797347729746, 0.999942210273157, -1.99780515159712 },
-		{ 0.001203949720337874, 0.9999398025153384, -1.997620989151649 },
-		{ 0.001218999268648669, 0.9999390500513053, -1.997561915056227 },
-		{ 0.001284210412497621, 0.9999357895439864, -1.997297576156662 },
-		{ 0.001352910568090637, 0.9999323544716272, -1.997004382928787 },
-		{ 0.001369821748022286, 0.9999315089171638, -1.996929899034883 },
-		{ 0.001426897947238077, 0.9999286551761292, -1.996671769626806 },
-		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
-		{ 0.00152201766572143, 0.9999238991227826, -1.996218443042531 },
-		{ 0.001541042360630608, 0.9999229478821053, -1.996124306136216 },
-		{ 0.00160525018807507, 0.9999197374924035, -1.995798063661091 },
-		{ 0.001625315847309666, 0.9999187342272845, -1.995693410632624 },
-		{ 0.001712261729673017, 0.9999143869203432, -1.99522507617636 },
-		{ 0.001826410709794119, 0.9999086795441485, -1.994573577146226 },
-		{ 0.001902503983861199, 0.9999048748083929, -1.994116160734863 },
-		{ 0.001926287656166788, 0.9999036856985055, -1.993969412279075 },
-		{ 0.002029331504598626, 0.9998985335052328, -1.993312729234924 },
-		{ 0.002054696514754673, 0.9998972652167053, -1.993145881411851 },
-		{ 0.002140304952153661, 0.9998929847548015, -1.992567620766334 },
-		{ 0.002167058444225417, 0.9998916471039889, -1.992382120329821 },
-		{ 0.002282983062950283, 0.9998858508559548, -1.991551952111663 },
-		{ 0.002311519012658675, 0.9998844240495721, -1.991341027529162 },
-		{ 0.002407826965934198, 0.9998796086544139, -1.990610011260134 },
-		{ 0.002437924239346702, 0.9998781038175072, -1.990375504371664 },
-		{ 0.002568339546457089, 0.9998715830473518, -1.989326001611416 },
-		{ 0.002705729617834832, 0.9998647135191715, -1.988161796480142 },
-		{ 0.00273954967546968, 0.9998630225253557, -1.987866003811073 },
-		{ 0.002853688108686574, 0.9998573156059436, -1.98684087523726 },
-		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
-		{ 0.003043919504561965, 0.9998478040369082, -1.985040274076141 },
-		{ 0.003081965980692818, 0.9998459017012391, -1.984666349761049 },
-		{ 0.003210371534745037, 0.9998394814268773, -1.983370435902031 },
-		{ 0.003250499612085536, 0.9998374750586944, -1.982954720760028 },
-		{ 0.003424390514358489, 0.9998287814974788, -1.98109440254788 },
-		{ 0.003652654630921126, 0.9998173674277224, -1.978506395517164 },
-		{ 0.00380482699165725, 0.9998097586655874, -1.976689512834859 },
-		{ 0.003852487003425909, 0.9998073800190838, -1.97610648427529 },
-		{ 0.004058463964617003, 0.9997970769787324, -1.973498484501744 },
-		{ 0.004109198255735472, 0.9997945413150283, -1.972836060082579 },
-		{ 0.004280402431744895, 0.9997859806346864, -1.970539664199966 },
-		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
-		{ 0.004565758275449458, 0.9997717140875881, -1.966507285309539 },
-		{ 0.004622788647089528, 0.9997688611297714, -1.965670143118048 },
-		{ 0.004815392055299514, 0.9997592324572451, -1.962769200588452 },
-		{ 0.004875551305043191, 0.9997562224936934, -1.961838440626878 },
-		{ 0.005136365895631378, 0.9997431832399478, -1.957674988699425 },
-		{ 0.005411096453258486, 0.9997294456679355, -1.953058014497314 },
-		{ 0.005478743383419195, 0.9997260644678598, -1.951885432130258 },
-		{ 0.005706969040621805, 0.9997146515707231, -1.947822032037516 },
-		{ 0.005778304047438303, 0.9997110855782673, -1.946519082633143 },
-		{ 0.006087387103067512, 0.9996956309102784, -1.940689154733952 },
-		{ 0.00616348077133826, 0.9996918278030612, -1.939208972312558 },
-		{ 0.006420227518090532, 0.9996789889471115, -1.934079456041472 },
-		{ 0.006500470936909455, 0.9996749765317453, -1.932434474023008 },
-		{ 0.006848194709701493, 0.9996575923107331, -1.925077468264887 },
-		{ 0.007304642168143501, 0.9996347682101013, -1.914852821539776 },
-		{ 0.007608930147950567, 0.99961955352294, -1.907681911988136 },
-		{ 0.007704024488874238, 0.9996147987762403, -1.905382871892993 },
-		{ 0.008116104373472002, 0.9995941951352175, -1.895102113297306 },
-		{ 0.008217570716430294, 0.9995891232077541, -1.892492189535821 },
-		{ 0.00855988877446783, 0.9995720070736617, -1.883454605585992 },
-		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
-		{ 0.009130372409092553, 0.9995434819251329, -1.867608409816096 },
-		{ 0.009244508788035446, 0.9995377756847199, -1.864321387479757 },
-		{ 0.009629583168974188, 0.9995185212480414, -1.852943482581711 },
-		{ 0.009749914060346903, 0.9995125044148597, -1.849297619901652 },
-		{ 0.01027139781241304, 0.9994864307993379, -1.833003945061082 },
-		{ 0.01082072891094206, 0.9994589645355174, -1.814976713279369 },
-		{ 0.01095596273347256, 0.9994522023410451, -1.810403495287652 },
-		{ 0.01141230960658726, 0.9994293845651727, -1.794581361178249 },
-		{ 0.01155496824587437, 0.9994222529927768, -1.789513194673186 },
-		{ 0.01217292139366928, 0.9993913544610991, -1.766883128094894 },
-		{ 0.01232502502424766, 0.9993837489409875, -1.761146536603933 },
-		{ 0.01283839407219861, 0.9993580809423184, -1.741305357737381 },
-		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
-		{ 0.01369399632535179, 0.9993153002293662, -1.70660670088199 },
-		{ 0.01460661644874286, 0.9992696698144632, -1.667391780666945 },
-		{ 0.01521496550522532, 0.9992392517854021, -1.640011157277238 },
-		{ 0.01540508137808651, 0.9992297459324639, -1.631254277295424 },
-		{ 0.01622891519230186, 0.9991885549480233, -1.592223612792206 },
-		{ 0.01643166320463701, 0.9991784168701481, -1.582350024113791 },
-		{ 0.01711602216258372, 0.9991441989601142, -1.548258873257762 },
-		{ 0.01732989438065723, 0.9991335054904866, -1.537365460945775 },
-		{ 0.01825660343574346, 0.9990871706242659, -1.488872434526308 },
-		{ 0.01848467051038387, 0.9990757666554915, -1.476620421676324 },
-		{ 0.01925452989825914, 0.9990372743178714, -1.434362474404255 },
-		{ 0.01949507508063808, 0.9990252464816647, -1.420876643777872 },
-		{ 0.02053746875333805, 0.9989731269865654, -1.360932476609053 },
-		{ 0.021635599743861, 0.9989182201559326, -1.295220495114529 },
-		{ 0.02190588452263806, 0.998904706398819, -1.278658369248598 },
-		{ 0.02281810717315457, 0.9988590947323202, -1.221663429457817 },
-		{ 0.0231031718107536, 0.9988448414115139, -1.203514991544666 },
-		{ 0.02433838825349413, 0.9987830810058453, -1.123095363513268 },
-		{ 0.02464245473877935, 0.9987678776473425, -1.102869540399949 },
-		{ 0.02566855872077779, 0.9987165723105675, -1.033425847197282 },
-		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
-		{ 0.02737861637456414, 0.998631069272508, -0.9138757038124511 },
-		{ 0.029202510340193, 0.9985398746449632, -0.7816582565524766 },
-		{ 0.03041835625262062, 0.99847908230865, -0.6911579031300052 },
-		{ 0.03079829692957477, 0.9984600851562562, -0.6625308270281016 },
-		{ 0.032444601927579, 0.9983777699727107, -0.5368012026175845 },
-		{ 0.03284995618453285, 0.9983575120062522, -0.5054795753234451 },
-		{ 0.03421753283133658, 0.998289133582542, -0.3988219744993046 },
-		{ 0.03464512827743095, 0.9982677683273552, -0.3652355305875898 },
-		{ 0.03649654170754918, 0.9981751745060014, -0.2185664139873872 },
-		{ 0.03695240513161675, 0.9981523907847037, -0.1822611578956234 },
-		{ 0.03849149420916198, 0.9980754689440932, -0.05931025219977079 },
-		{ 0.03897114961596116, 0.9980514463738671, -0.02084470438900135 },
-		{ 0.04105401119502478, 0.9979473117070917, 0.1458043973671458 },
-		{ 0.04324853880043088, 0.9978376040286647, 0.3202513126014485 },
-		{ 0.04378794705409299, 0.997810615731039, 0.3628377536458661 },
-		{ 0.04561070787174522, 0.9977194845994114, 0.5052675883283164 },
-		{ 0.04617983331902856, 0.9976910139494558, 0.5492472260747285 },
-		{ 0.0486472496439048, 0.9975676396389963, 0.7362288400805693 },
-		{ 0.049254695363442, 0.9975372799490434, 0.7812059645763143 },
-		{ 0.05130433987381382, 0.9974347983359644, 0.9294561155763529 },
-		{ 0.0519453445215216, 0.9974027617311032, 0.9745587377387659 },
-		{ 0.05471994613645774, 0.9972640190434308, 1.162086317256758 },
-		{ 0.0583623813546218, 0.9970818812559786, 1.386091925091135 },
-		{ 0.06079056210604199, 0.9969604745453784, 1.519264344590776 },
-		{ 0.06154940431744864, 0.9969225481750811, 1.557968648720469 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
-		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 }
-	},
-	.c_bpre9600080040 = {
-		{ 2.675522564807299e-05, 0.9999986622387479, -1.999997516890784 },
-		{ 2.853889680146557e-05, 0.9999985730552736, -1.999997269904884 },
-		{ 2.972815657166637e-05, 0.9999985136023557, -1.999997099599579 },
-		{ 3.009980136551308e-05, 0.9999984950228079, -1.999997045449829 },
-		{ 3.171002260133804e-05, 0.9999984145032582, -1.999996805670251 },
-		{ 3.210626533721097e-05, 0.9999983946883486, -1.999996745390933 },
-		{ 3.344402645941078e-05, 0.9999983277987147, -1.999996538192917 },
-		{ 3.386209408654081e-05, 0.9999983068957051, -1.999996472269054 },
-		{ 3.56736599054945e-05, 0.9999982163214556, -1.999996180154129 },
-		{ 3.611978564452553e-05, 0.9999981940194603, -1.999996106615884 },
-		{ 3.762457172694356e-05, 0.9999981187768185, -1.999995853814694 },
-		{ 3.809499445719922e-05, 0.9999980952558245, -1.999995773301823 },
-		{ 4.013282503878434e-05, 0.999997993358793, -1.999995416327044 },
-		{ 4.228001895425983e-05, 0.9999978860049028, -1.999995025858388 },
-		{ 4.280855960542794e-05, 0.9999978595795834, -1.999994927481444 },
-		{ 4.45921813008597e-05, 0.9999977703961807, -1.999994588868235 },
-		{ 4.51494151514959e-05, 0.9999977425309707, -1.999994480981668 },
-		{ 4.75648053768047e-05, 0.9999976217599208, -1.999994001900148 },
-		{ 4.8159452691642e-05, 0.9999975920293988, -1.999993881099732 },
-		{ 5.016607990088579e-05, 0.9999974917032112, -1.999993465105733 },
-		{ 5.079311963490773e-05, 0.9999974603446324, -1.999993332437204 },
-		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
-		{ 5.707775288569886e-05, 0.9999971461125834, -1.999991933516442 },
-		{ 5.945603983921473e-05, 0.9999970271987394, -1.999991371162703 },
-		{ 6.01992073542403e-05, 0.9999969900396999, -1.99999119172273 },
-		{ 6.341975571700887e-05, 0.9999968290172114, -1.999990393726079 },
-		{ 6.421247911523708e-05, 0.9999967893792746, -1.999990192197627 },
-		{ 6.688799698921024e-05, 0.9999966556002257, -1.999989497186221 },
-		{ 6.772413084975596e-05, 0.9999966137942766, -1.999989275297251 },
-		{ 7.134731526951769e-05, 0.9999964326379114, -1.999988287942658 },
-		{ 7.223900222397565e-05, 0.9999963880503632, -1.999988038485779 },
-		{ 7.524906414649108e-05, 0.9999962375489951, -1.99998717767475 },
-		{ 7.6189570685437e-05, 0.9999961905234579, -1.999986902761581 },
-		{ 8.026556954503774e-05, 0.9999959867216131, -1.9999856786116 },
-		{ 8.455957425045155e-05, 0.9999957720224558, -1.999984331500946 },
-		{ 8.561656824233252e-05, 0.9999957191719294, -1.999983990845348 },
-		{ 8.918391591496197e-05, 0.9999955408055136, -1.999982814764736 },
-		{ 9.029872837902971e-05, 0.9999954850670376, -1.999982438895191 },
-		{ 9.512949763785123e-05, 0.9999952435254973, -1.999980764116728 },
-		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
-		{ 0.0001003319116039944, 0.999994983404533, -1.9999788769985 },
-		{ 0.0001015861102606197, 0.9999949206957149, -1.999978409104007 },
-		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
-		{ 0.0001141553428740544, 0.9999942922333115, -1.999973441905671 },
-		{ 0.0001189119029278971, 0.9999940544063163, -1.99997143032779 },
-		{ 0.0001203982335274824, 0.9999939800884594, -1.999970786889104 },
-		{ 0.0001268392793493511, 0.999993658036297, -1.999967916887578 },
-		{ 0.0001284248111656334, 0.9999935787606755, -1.999967190052727 },
-		{ 0.0001337757702817552, 0.9999933112116364, -1.999964677654743 },
-		{ 0.0001354480323569916, 0.9999932276000196, -1.99996387371547 },
-		{ 0.0001426940767712871, 0.9999928652967303, -1.999960286714877 },
-		{ 0.00014447774352468, 0.9999927761137726, -1.999959377985468 },
-		{ 0.0001504976259986189, 0.9999924751203272, -1.999956235852403 },
-		{ 0.0001523789719009338, 0.9999923810532472, -1.999955230082978 },
-		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
-		{ 0.0001691196634678111, 0.9999915440791504, -1.999945782397836 },
-		{ 0.0001712334523479517, 0.9999914383785468, -1.999944525489502 },
-		{ 0.000178370360190369, 0.9999910815981871, -1.999940177336956 },
-		{ 0.000180598128737175, 0.9999909701708225, -1.999938785960564 },
-		{ 0.0001902585427956318, 0.9999904870736187, -1.999932569785937 },
-		{ 0.0001926419764465632, 0.9999903681196604, -1.999930993331417 },
-		{ 0.0002006633198707925, 0.9999899668342321, -1.999925541631114 },
-		{ 0.000203171704556286, 0.999989841417229, -1.999923795490765 },
-		{ 0.0002140418817274501, 0.999989297943731, -1.999915996233891 },
-		{ 0.0002283126720322718, 0.9999885844664773, -1.999905183350505 },
-		{ 0.0002378267934076185, 0.9999881088152578, -1.999897612783943 },
-		{ 0.0002407971425936614, 0.9999879602458827, -1.999895188769939 },
-		{ 0.0002536789589334511, 0.9999873161455388, -1.999884353071058 },
-		{ 0.0002568496287530024, 0.9999871575953083, -1.999881604336706 },
-		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
-		{ 0.0002708951474157991, 0.9999864552459046, -1.999869040966948 },
-		{ 0.0002853871354825546, 0.9999857306443637, -1.999855417843191 },
-		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
-		{ 0.0003009959752412928, 0.999984950330003, -1.999839995747363 },
-		{ 0.0003047567828463676, 0.9999847621645425, -1.999836160229763 },
-		{ 0.0003210603340123206, 0.9999839469994526, -1.999819020693428 },
-		{ 0.0003382378968830565, 0.999983088229803, -1.999800044372587 },
-		{ 0.0003424654386490728, 0.999982876830395, -1.999795228278334 },
-		{ 0.0003567337357669565, 0.9999821633577224, -1.99977855167979 },
-		{ 0.0003611949209502634, 0.9999819403413718, -1.99977320527483 },
-		{ 0.0003805152756813137, 0.999980974237733, -1.999749309543339 },
-		{ 0.0003852717225862434, 0.9999807364139048, -1.999743243947266 },
-		{ 0.0004013246264698192, 0.9999799337691286, -1.999722238400035 },
-		{ 0.0004063413451585637, 0.999979682937655, -1.999715504935722 },
-		{ 0.0004280814727609967, 0.9999785960019963, -1.999685396104728 },
-		{ 0.0004566176441167561, 0.9999771691450796, -1.999643575931761 },
-		{ 0.0004756429634125831, 0.999976217853726, -1.999614246560495 },
-		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
-		{ 0.0005073530394988365, 0.9999746323701476, -1.999562790629252 },
-		{ 0.0005136952154511888, 0.9999743152737336, -1.999552113402424 },
-		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
-		{ 0.0005417866256076224, 0.9999729106752698, -1.999503270526228 },
-		{ 0.0005707701986741852, 0.9999714614923424, -1.99945023098801 },
-		{ 0.0005779070232612934, 0.9999711047191098, -1.999436760949389 },
-		{ 0.0006019839197813993, 0.9999699008046884, -1.999390104697317 },
-		{ 0.0006095089218488926, 0.9999695245612764, -1.999375143433401 },
-		{ 0.0006421155140426252, 0.9999678942566038, -1.999308221528274 },
-		{ 0.0006764667242294318, 0.9999661766638044, -1.999234037389628 },
-		{ 0.0006849226019958762, 0.9999657538721831, -1.999215197716376 },
-		{ 0.0007134616993024724, 0.9999643269517813, -1.999149925226071 },
-		{ 0.0007223782808232838, 0.9999638810907043, -1.999128995715971 },
-		{ 0.000761023311765466, 0.9999619488374458, -1.999035352543512 },
-		{ 0.0007705360234567621, 0.9999614731988953, -1.999011568884837 },
-		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
-		{ 0.0008126744346443001, 0.999959366288093, -1.998902734804912 },
-		{ 0.0008561491896194267, 0.9999571925439324, -1.998784495954072 },
-		{ 0.0009132262044308695, 0.9999543387295984, -1.998620087612502 },
-		{ 0.0009512746150121417, 0.9999524362730423, -1.99850469934004 },
-		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
-		{ 0.001014691492247178, 0.99994926546562, -1.998302094321678 },
-		{ 0.001027374644832786, 0.9999486312889803, -1.998260029123904 },
-		{ 0.001070181108262045, 0.9999464909457915, -1.998114261663522 },
-		{ 0.001083558574583829, 0.9999458220843713, -1.998067507494197 },
-		{ 0.001141524108413177, 0.9999429237991311, -1.997858303212896 },
-		{ 0.001155792902760762, 0.9999422103549646, -1.997805157728407 },
-		{ 0.001203949720337874, 0.9999398025153384, -1.997620989151649 },
-		{ 0.001218999268648669, 0.9999390500513053, -1.997561915056227 },
-		{ 0.001284211003174573, 0.9999357894621792, -1.997297569353812 },
-		{ 0.001352910568090637, 0.9999323544716272, -1.997004382928787 },
-		{ 0.001369821748022286, 0.9999315089171638, -1.996929899034883 },
-		{ 0.001426894955067957, 0.9999286552579357, -1.996671777175632 },
-		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
-		{ 0.00152201766572143, 0.9999238991227826, -1.996218443042531 },
-		{ 0.001541042360630608, 0.9999229478821053, -1.996124306136216 },
-		{ 0.00160525018807507, 0.9999197374924035, -1.995798063661091 },
-		{ 0.001625315847309666, 0.9999187342272845, -1.995693410632624 },
-		{ 0.001712268553331768, 0.9999143870839539, -1.995225094256315 },
-		{ 0.001826410709794119, 0.9999086795441485, -1.994573577146226 },
-		{ 0.001902503983861199, 0.9999048748083929, -1.994116160734863 },
-		{ 0.001926336268891952, 0.9999036853712879, -1.993969371648631 },
-		{ 0.002029334937227048, 0.9998985333416249, -1.993312707844078 },
-		{ 0.00205470467251888, 0.9998972653803131, -1.993145903067395 },
-		{ 0.002140315739249093, 0.9998929845911944, -1.992567598217461 },
-		{ 0.002167058444225417, 0.9998916471039889, -1.992382120329821 },
-		{ 0.00228300943988037, 0.9998858505287431, -1.991551904037502 },
-		{ 0.002311527902252336, 0.9998844238859664, -1.991341003194546 },
-		{ 0.002407840968865237, 0.999879608981624, -1.990610061937231 },
-		{ 0.002437924239346702, 0.9998781038175072, -1.990375504371664 },
-		{ 0.002568347857096391, 0.9998715833745591, -1.989326055633414 },
-		{ 0.00270573125083632, 0.999864713682774, -1.988161824921814 },
-		{ 0.002739559320222182, 0.9998630228525605, -1.987866061398457 },
-		{ 0.002853688108686574, 0.9998573156059436, -1.98684087523726 },
-		{ 0.00288936073328693, 0.9998555323536832, -1.986512055744461 },
-		{ 0.00304392518834468, 0.9998478038733086, -1.985040242116599 },
-		{ 0.003081977848941141, 0.9998459020284381, -1.984666414470842 },
-		{ 0.003210371420908163, 0.9998394815904758, -1.983370469590857 },
-		{ 0.003250499612085536, 0.9998374750586944, -1.982954720760028 },
-		{ 0.003424390514358489, 0.9998287814974788, -1.98109440254788 },
-		{ 0.003652654630921126, 0.9998173674277224, -1.978506395517164 },
-		{ 0.00380482699165725, 0.9998097586655874, -1.976689512834859 },
-		{ 0.003852383265855143, 0.9998073808370493, -1.976106685996817 },
-		{ 0.004058463964617003, 0.9997970769787324, -1.973498484501744 },
-		{ 0.004109207496078834, 0.9997945404970734, -1.972835845087075 },
-		{ 0.004280402431744895, 0.9997859806346864, -1.970539664199966 },
-		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
-		{ 0.004565707346012931, 0.9997717149055243, -1.966507523846898 },
-		{ 0.004622788647089528, 0.9997688611297714, -1.965670143118048 },
-		{ 0.004815371279004653, 0.9997592316393189, -1.962768949210551 },
-		{ 0.004875551305043191, 0.9997562224936934, -1.961838440626878 },
-		{ 0.005136358459782836, 0.9997431824220345, -1.957674720848942 },
-		{ 0.005411096453258486, 0.9997294456679355, -1.953058014497314 },
-		{ 0.005478731778631801, 0.9997260636499606, -1.951885146758174 },
-		{ 0.005706969040621805, 0.9997146515707231, -1.947822032037516 },
-		{ 0.00577831884512846, 0.9997110847603804, -1.946518781973501 },
-		{ 0.006087387103067512, 0.9996956309102784, -1.940689154733952 },
-		{ 0.006163462218492916, 0.9996918269851901, -1.939208652062085 },
-		{ 0.006420227518090532, 0.9996789889471115, -1.934079456041472 },
-		{ 0.006500470936909455, 0.9996749765317453, -1.932434474023008 },
-		{ 0.006848170598607193, 0.9996575914928905, -1.925077113377608 },
-		{ 0.007304642168143501, 0.9996347682101013, -1.914852821539776 },
-		{ 0.007608930147950567, 0.99961955352294, -1.907681911988136 },
-		{ 0.007704024488874238, 0.9996147987762403, -1.905382871892993 },
-		{ 0.008116104373472002, 0.9995941951352175, -1.895102113297306 },
-		{ 0.008217519793043245, 0.9995891240255406, -1.892492612869118 },
-		{ 0.00855984285388944, 0.9995720078914345, -1.883455045839285 },
-		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
-		{ 0.009130385814681325, 0.9995434811073832, -1.867607941548946 },
-		{ 0.009244471761227448, 0.9995377765024649, -1.864321861321117 },
-		{ 0.009629583168974188, 0.9995185212480414, -1.852943482581711 },
-		{ 0.009749914060346903, 0.9995125044148597, -1.849297619901652 },
-		{ 0.01027137190259931, 0.9994864316170408, -1.833004468607755 },
-		{ 0.01082072707489991, 0.9994589637178372, -1.814976163500448 },
-		{ 0.01095594307681139, 0.9994522031587202, -1.810404051483756 },
-		{ 0.01141230960658726, 0.9994293845651727, -1.794581361178249 },
-		{ 0.01155492381198395, 0.9994222538104269, -1.789513779095394 },
-		{ 0.01217289861198704, 0.9993913552787242, -1.766883741285598 },
-		{ 0.01232502502424766, 0.9993837489409875, -1.761146536603933 },
-		{ 0.01283839997244521, 0.9993580801247205, -1.741304713986138 },
-		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
-		{ 0.01369399632535179, 0.9993153002293662, -1.70660670088199 },
-		{ 0.01460658898054228, 0.9992696706319886, -1.6673925033418 },
-		{ 0.01521496550522532, 0.9992392517854021, -1.640011157277238 },
-		{ 0.01540508137808651, 0.9992297459324639, -1.631254277295424 },
-		{ 0.01622888538152909, 0.9991885557654823, -1.592224404703838 },
-		{ 0.01643172809397999, 0.9991784185050498, -1.582351624785743 },
-		{ 0.01711609038548329, 0.9991442005949602, -1.548260530013976 },
-		{ 0.01733007231606983, 0.999133508760143, -1.537368809003415 },
-		{ 0.01825660343574346, 0.9990871706242659, -1.488872434526308 },
-		{ 0.01848474465917962, 0.9990757682902252, -1.476622186823735 },
-		{ 0.01925501578633604, 0.9990372710485296, -1.434358826780869 },
-		{ 0.01949507623906387, 0.9990252481163162, -1.42087848556302 },
-		{ 0.02053755030851989, 0.9989731286211316, -1.360934394298138 },
-		{ 0.02163597211572971, 0.9989182168869806, -1.295216507034651 },
-		{ 0.02190597024329101, 0.9989047080332734, -1.278660381490443 },
-		{ 0.02281837077335729, 0.9988590914635616, -1.22165928558084 },
-		{ 0.02310326064342762, 0.9988448397771577, -1.203512901516769 },
-		{ 0.02433843379303366, 0.9987830793715906, -1.123093198275008 },
-		{ 0.02464252894623508, 0.9987678809158029, -1.102873906287602 },
-		{ 0.02566864181710677, 0.9987165755788598, -1.033430327795327 },
-		{ 0.02598955850253184, 0.9987005365629396, -1.011357301667456 },
-		{ 0.02737871280319348, 0.9986310725405206, -0.9138803586780401 },
-		{ 0.029202510340193, 0.9985398746449632, -0.7816582565524766 },
-		{ 0.03041841302917224, 0.9984790806748923, -0.6911554479877058 },
-		{ 0.03079841557544585, 0.998460088423709, -0.6625357641875309 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
-		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 }
-	}
-};
+#include "Scales.hpp"
+const ScaleDef indian_shrutis = {
+	.name = "Indian Shrutis",
+	.description = "In Indian classical music, a shruti is smallest interval or pitch that the human ear can detect and a singer or musical instrument can produce. These are 22 pitches in an octave, the most consonant of which form the 7 notes of the basic scale. Since SMR allows only 21 notes in a scale, the first note of Ri (256:243) is omitted.",
+	.scalename = {
+		"Shrutis; C0-",
+		"Shrutis; C1-",
+		"Shrutis; C2-",
+		"Shrutis; C3-",
+		"Shrutis; C4-",
+		"Shrutis; C5-",
+		"Shrutis; C6-",
+		"Shrutis; C7-",
+		"Shrutis; C8-",
+		"Shrutis; C9-",
+		"Shrutis; C10-"},
+	.notedesc = {
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni",
+		"Sa",
+		"ri",
+		"Ri",
+		"Ri",
+		"ga",
+		"ga",
+		"Ga",
+		"Ga",
+		"ma",
+		"ma",
+		"Ma",
+		"Ma",
+		"Pa",
+		"dha",
+		"dha",
+		"Dha",
+		"Dha",
+		"ni",
+		"ni",
+		"Ni",
+		"Ni"},
+	.freq = {
+		16.3515978313,
+		17.44170435338666,
+		18.16844203477778,
+		18.39554756021251,
+		19.37967150376296,
+		19.62191739756,
+		20.439497289125,
+		20.69499100523907,
+		21.80213044173333,
+		22.074657072255,
+		22.99443445026563,
+		23.28186488089395,
+		24.52739674695001,
+		25.83956200501729,
+		26.16255653008,
+		27.25266305216666,
+		27.59332134031876,
+		29.06950725564444,
+		29.43287609634,
+		30.6592459336875,
+		31.0424865078586,
+		32.70319566260001,
+		34.88340870677334,
+		36.33688406955557,
+		36.791095120425,
+		38.75934300752593,
+		39.24383479512001,
+		40.87899457825,
+		41.38998201047812,
+		43.60426088346667,
+		44.14931414451001,
+		45.98886890053125,
+		46.56372976178789,
+		49.05479349390001,
+		51.67912401003456,
+		52.32511306016001,
+		54.50532610433335,
+		55.1866426806375,
+		58.13901451128888,
+		58.86575219268001,
+		61.31849186737499,
+		62.08497301571717,
+		65.40639132519999,
+		69.76681741354668,
+		72.6737681391111,
+		73.58219024085003,
+		77.51868601505184,
+		78.48766959024,
+		81.7579891565,
+		82.77996402095624,
+		87.20852176693333,
+		88.29862828902002,
+		91.9777378010625,
+		93.12745952357581,
+		98.10958698780003,
+		103.3582480200691,
+		104.65022612032,
+		109.0106522086667,
+		110.373285361275,
+		116.2780290225778,
+		117.73150438536,
+		122.63698373475,
+		124.1699460314343,
+		130.8127826504,
+		139.5336348270934,
+		145.3475362782222,
+		147.1643804817001,
+		155.0373720301037,
+		156.9753391804799,
+		163.515978313,
+		165.5599280419125,
+		174.4170435338667,
+		176.5972565780401,
+		183.955475602125,
+		186.2549190471516,
+		196.2191739756001,
+		206.7164960401382,
+		209.3004522406401,
+		218.0213044173334,
+		220.74657072255,
+		232.5560580451556,
+		235.46300877072,
+		245.2739674695001,
+		248.3398920628687,
+		261.6255653008001,
+		279.0672696541868,
+		290.6950725564444,
+		294.3287609634,
+		310.0747440602074,
+		313.95067836096,
+		327.031956626,
+		331.119856083825,
+		348.8340870677333,
+		353.1945131560799,
+		367.9109512042501,
+		372.5098380943032,
+		392.4383479512001,
+		413.4329920802766,
+		418.6009044812801,
+		436.0426088346666,
+		441.4931414451001,
+		465.1121160903111,
+		470.9260175414401,
+		490.5479349390001,
+		496.6797841257374,
+		523.2511306016002,
+		558.1345393083733,
+		581.3901451128888,
+		588.6575219268,
+		620.1494881204147,
+		627.90135672192,
+		654.063913252,
+		662.2397121676499,
+		697.6681741354666,
+		706.3890263121601,
+		735.8219024085001,
+		745.0196761886064,
+		784.8766959024002,
+		826.8659841605529,
+		837.2018089625601,
+		872.0852176693332,
+		882.9862828902002,
+		930.2242321806222,
+		941.8520350828802,
+		981.0958698779999,
+		993.3595682514748,
+		1046.5022612032,
+		1116.269078616747,
+		1162.780290225778,
+		1177.3150438536,
+		1240.29897624083,
+		1255.80271344384,
+		1308.127826504,
+		1324.4794243353,
+		1395.336348270933,
+		1412.77805262432,
+		1471.643804817,
+		1490.039352377213,
+		1569.753391804801,
+		1653.731968321106,
+		1674.40361792512,
+		1744.170435338666,
+		1765.9725657804,
+		1860.448464361245,
+		1883.70407016576,
+		1962.191739756001,
+		1986.71913650295,
+		2093.004522406401,
+		2232.538157233494,
+		2325.560580451556,
+		2354.630087707201,
+		2480.597952481659,
+		2511.60542688768,
+		2616.255653008,
+		2648.9588486706,
+		2790.672696541866,
+		2825.556105248641,
+		2943.287609634001,
+		2980.078704754426,
+		3139.506783609602,
+		3307.463936642213,
+		3348.80723585024,
+		3488.340870677334,
+		3531.945131560799,
+		3720.896928722488,
+		3767.40814033152,
+		3924.383479512001,
+		3973.438273005899,
+		4186.0090448128,
+		4465.076314466987,
+		4651.121160903111,
+		4709.260175414402,
+		4961.195904963319,
+		5023.21085377536,
+		5232.511306016,
+		5297.9176973412,
+		5581.345393083733,
+		5651.112210497281,
+		5886.575219268001,
+		5960.157409508852,
+		6279.013567219202,
+		6614.927873284426,
+		6697.614471700481,
+		6976.681741354668,
+		7063.890263121601,
+		7441.793857444979,
+		7534.816280663041,
+		7848.766959023999,
+		7946.876546011798,
+		8372.018089625601,
+		8930.152628933974,
+		9302.242321806221,
+		9418.520350828803,
+		9922.391809926638,
+		10046.42170755072,
+		10465.022612032,
+		10595.8353946824,
+		11162.69078616747,
+		11302.22442099456,
+		11773.150438536,
+		11920.3148190177,
+		12558.0271344384,
+		13229.85574656885,
+		13395.22894340096,
+		13953.36348270934,
+		14127.7805262432,
+		14883.58771488995,
+		15069.63256132608,
+		15697.53391804799,
+		15893.7530920236,
+		16744.0361792512,
+		17860.30525786795,
+		18604.48464361245,
+		18837.0407016576,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328,
+		19844.78361985328
+	}
+};
@@ -1,1647 +1,482 @@
-#include "Scales.hpp"
-Scale ji_intervals = {
-	.name = "Intervals (JI)",
-	.description = "Single western intervals in A, Just Intonation. A0 is defined as a major sixth above C0=16.35Hz",
-	.scalename = {
-		"Octave + m2; A0-A8",
-		"Octave + M2; A0-A8",
-		"Octave + m3; A0-A8",
-		"Octave + M2; A0-A8",
-		"Octave + P4; A0-A8",
-		"Octave + d5; A0-A8",
-		"Octave + P5; A0-A8",
-		"Octave + m6; A0-A8",
-		"Octave + M6; A0-A8",
-		"Octave + m7; A0-A8",
-		"Octave + M7; A0-A8"},
-	.notedesc = {
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"m2",
-		"Oct",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"M2",
-		"Oct",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"m3",
-		"Oct",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"M3",
-		"Oct",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"P4",
-		"Oct",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"d5",
-		"Oct",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"P5",
-		"Oct",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"m6",
-		"Oct",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"M6",
-		"Oct",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"m7",
-		"Oct",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct",
-		"M7",
-		"Oct"},
-	.c_maxq48000 = {
-		0.003567016658763411,
-		0.003804817769347638,
-		0.007134033317526822,
-		0.007609635538695277,
-		0.01426806663505364,
-		0.01521927107739055,
-		0.02853613327010729,
-		0.03043854215478111,
-		0.05707226654021458,
-		0.06087708430956221,
-		0.1141445330804292,
-		0.1217541686191244,
-		0.2282890661608583,
-		0.2435083372382489,
-		0.4565781323217166,
-		0.4870166744764977,
-		0.9131562646434332,
-		0.9740333489529954,
-		1.826312529286866,
-		1.948066697905991,
-		1.948066697905991,
-		0.003567016658763411,
-		0.004012893741108838,
-		0.007134033317526822,
-		0.008025787482217675,
-		0.01426806663505364,
-		0.01605157496443535,
-		0.02853613327010729,
-		0.0321031499288707,
-		0.05707226654021458,
-		0.0642062998577414,
-		0.1141445330804292,
-		0.1284125997154828,
-		0.2282890661608583,
-		0.2568251994309656,
-		0.4565781323217166,
-		0.5136503988619312,
-		0.9131562646434332,
-		1.027300797723862,
-		1.826312529286866,
-		2.054601595447725,
-		2.054601595447725,
-		0.003567016658763411,
-		0.004280419990516093,
-		0.007134033317526822,
-		0.008560839981032187,
-		0.01426806663505364,
-		0.01712167996206437,
-		0.02853613327010729,
-		0.03424335992412875,
-		0.05707226654021458,
-		0.06848671984825749,
-		0.1141445330804292,
-		0.136973439696515,
-		0.2282890661608583,
-		0.27394687939303,
-		0.4565781323217166,
-		0.5478937587860599,
-		0.9131562646434332,
-		1.09578751757212,
-		1.826312529286866,
-		2.19157503514424,
-		2.19157503514424,
-		0.003567016658763411,
-		0.004458770823454265,
-		0.007134033317526822,
-		0.00891754164690853,
-		0.01426806663505364,
-		0.01783508329381706,
-		0.02853613327010729,
-		0.03567016658763412,
-		0.05707226654021458,
-		0.07134033317526824,
-		0.1141445330804292,
-		0.1426806663505365,
-		0.2282890661608583,
-		0.2853613327010729,
-		0.4565781323217166,
-		0.5707226654021459,
-		0.9131562646434332,
-		1.141445330804292,
-		1.826312529286866,
-		2.282890661608584,
-		2.282890661608584,
-		0.003567016658763411,
-		0.004756022211684548,
-		0.007134033317526822,
-		0.009512044423369096,
-		0.01426806663505364,
-		0.01902408884673819,
-		0.02853613327010729,
-		0.03804817769347638,
-		0.05707226654021458,
-		0.07609635538695277,
-		0.1141445330804292,
-		0.1521927107739055,
-		0.2282890661608583,
-		0.3043854215478111,
-		0.4565781323217166,
-		0.6087708430956221,
-		0.9131562646434332,
-		1.217541686191244,
-		1.826312529286866,
-		2.435083372382489,
-		2.435083372382489,
-		0.003567016658763411,
-		0.005095738083947731,
-		0.007134033317526822,
-		0.01019147616789546,
-		0.01426806663505364,
-		0.02038295233579093,
-		0.02853613327010729,
-		0.04076590467158185,
-		0.05707226654021458,
-		0.0815318093431637,
-		0.1141445330804292,
-		0.1630636186863274,
-		0.2282890661608583,
-		0.3261272373726548,
-		0.4565781323217166,
-		0.6522544747453096,
-		0.9131562646434332,
-		1.304508949490619,
-		1.826312529286866,
-		2.609017898981238,
-		2.609017898981238,
-		0.003567016658763411,
-		0.005350524988145118,
-		0.007134033317526822,
-		0.01070104997629024,
-		0.01426806663505364,
-		0.02140209995258047,
-		0.02853613327010729,
-		0.04280419990516094,
-		0.05707226654021458,
-		0.08560839981032188,
-		0.1141445330804292,
-		0.1712167996206438,
-		0.2282890661608583,
-		0.3424335992412875,
-		0.4565781323217166,
-		0.684867198482575,
-		0.9131562646434332,
-		1.36973439696515,
-		1.826312529286866,
-		1.826312529286866,
-		1.826312529286866,
-		0.003567016658763411,
-		0.005707226654021459,
-		0.007134033317526822,
-		0.01141445330804292,
-		0.01426806663505364,
-		0.02282890661608583,
-		0.02853613327010729,
-		0.04565781323217167,
-		0.05707226654021458,
-		0.09131562646434334,
-		0.1141445330804292,
-		0.1826312529286867,
-		0.2282890661608583,
-		0.3652625058573734,
-		0.4565781323217166,
-		0.7305250117147467,
-		0.9131562646434332,
-		1.461050023429493,
-		1.826312529286866,
-		1.826312529286866,
-		1.826312529286866,
-		0.003567016658763411,
-		0.005945027764605685,
-		0.007134033317526822,
-		0.01189005552921137,
-		0.01426806663505364,
-		0.02378011105842274,
-		0.02853613327010729,
-		0.04756022211684548,
-		0.05707226654021458,
-		0.09512044423369097,
-		0.1141445330804292,
-		0.1902408884673819,
-		0.2282890661608583,
-		0.3804817769347639,
-		0.4565781323217166,
-		0.7609635538695277,
-		0.9131562646434332,
-		1.521927107739055,
-		1.826312529286866,
-		1.826312529286866,
-		1.826312529286866,
-		0.003567016658763411,
-		0.006341362948912732,
-		0.007134033317526822,
-		0.01268272589782546,
-		0.01426806663505364,
-		0.02536545179565093,
-		0.02853613327010729,
-		0.05073090359130186,
-		0.05707226654021458,
-		0.1014618071826037,
-		0.1141445330804292,
-		0.2029236143652074,
-		0.2282890661608583,
-		0.4058472287304148,
-		0.4565781323217166,
-		0.8116944574608297,
-		0.9131562646434332,
-		1.623388914921659,
-		1.826312529286866,
-		1.826312529286866,
-		1.826312529286866,
-		0.003567016658763411,
-		0.006688156235181397,
-		0.007134033317526822,
-		0.01337631247036279,
-		0.01426806663505364,
-		0.02675262494072559,
-		0.02853613327010729,
-		0.05350524988145117,
-		0.05707226654021458,
-		0.1070104997629023,
-		0.1141445330804292,
-		0.2140209995258047,
-		0.2282890661608583,
-		0.4280419990516094,
-		0.4565781323217166,
-		0.8560839981032188,
-		0.9131562646434332,
-		1.712167996206438,
-		1.826312529286866,
-		1.826312529286866,
-		1.826312529286866
-	},
-	.c_maxq96000 = {
-		0.001783508329381706,
-		0.001902408884673819,
-		0.003567016658763411,
-		0.003804817769347638,
-		0.007134033317526822,
-		0.007609635538695277,
-		0.01426806663505364,
-		0.01521927107739055,
-		0.02853613327010729,
-		0.03043854215478111,
-		0.05707226654021458,
-		0.06087708430956221,
-		0.1141445330804292,
-		0.1217541686191244,
-		0.2282890661608583,
-		0.2435083372382489,
-		0.4565781323217166,
-		0.4870166744764977,
-		0.9131562646434332,
-		0.9740333489529954,
-		0.9740333489529954,
-		0.001783508329381706,
-		0.002006446870554419,
-		0.003567016658763411,
-		0.004012893741108838,
-		0.007134033317526822,
-		0.008025787482217675,
-		0.01426806663505364,
-		0.01605157496443535,
-		0.02853613327010729,
-		0.0321031499288707,
-		0.05707226654021458,
-		0.0642062998577414,
-		0.1141445330804292,
-		0.1284125997154828,
-		0.2282890661608583,
-		0.2568251994309656,
-		0.4565781323217166,
-		0.5136503988619312,
-		0.9131562646434332,
-		1.027300797723862,
-		1.027300797723862,
-		0.001783508329381706,
-		0.002140209995258047,
-		0.003567016658763411,
-		0.004280419990516093,
-		0.007134033317526822,
-		0.008560839981032187,
-		0.01426806663505364,
-		0.01712167996206437,
-		0.02853613327010729,
-		0.03424335992412875,
-		0.05707226654021458,
-		0.06848671984825749,
-		0.1141445330804292,
-		0.136973439696515,
-		0.2282890661608583,
-		0.27394687939303,
-		0.4565781323217166,
-		0.5478937587860599,
-		0.9131562646434332,
-		1.09578751757212,
-		1.09578751757212,
-		0.001783508329381706,
-		0.002229385411727132,
-		0.003567016658763411,
-		0.004458770823454265,
-		0.007134033317526822,
-		0.00891754164690853,
-		0.01426806663505364,
-		0.01783508329381706,
-		0.02853613327010729,
-		0.03567016658763412,
-		0.05707226654021458,
-		0.07134033317526824,
-		0.1141445330804292,
-		0.1426806663505365,
-		0.2282890661608583,
-		0.2853613327010729,
-		0.4565781323217166,
-		0.5707226654021459,
-		0.9131562646434332,
-		1.141445330804292,
-		1.141445330804292,
-		0.001783508329381706,
-		0.002378011105842274,
-		0.003567016658763411,
-		0.004756022211684548,
-		0.007134033317526822,
-		0.009512044423369096,
-		0.01426806663505364,
-		0.01902408884673819,
-		0.02853613327010729,
-		0.03804817769347638,
-		0.05707226654021458,
-		0.07609635538695277,
-		0.1141445330804292,
-		0.1521927107739055,
-		0.2282890661608583,
-		0.3043854215478111,
-		0.4565781323217166,
-		0.6087708430956221,
-		0.9131562646434332,
-		1.217541686191244,
-		1.217541686191244,
-		0.001783508329381706,
-		0.002547869041973866,
-		0.003567016658763411,
-		0.005095738083947731,
-		0.007134033317526822,
-		0.01019147616789546,
-		0.01426806663505364,
-		0.02038295233579093,
-		0.02853613327010729,
-		0.04076590467158185,
-		0.05707226654021458,
-		0.0815318093431637,
-		0.1141445330804292,
-		0.1630636186863274,
-		0.2282890661608583,
-		0.3261272373726548,
-		0.4565781323217166,
-		0.6522544747453096,
-		0.9131562646434332,
-		1.304508949490619,
-		1.304508949490619,
-		0.001783508329381706,
-		0.002675262494072559,
-		0.003567016658763411,
-		0.005350524988145118,
-		0.007134033317526822,
-		0.01070104997629024,
-		0.01426806663505364,
-		0.02140209995258047,
-		0.02853613327010729,
-		0.04280419990516094,
-		0.05707226654021458,
-		0.08560839981032188,
-		0.1141445330804292,
-		0.1712167996206438,
-		0.2282890661608583,
-		0.3424335992412875,
-		0.4565781323217166,
-		0.684867198482575,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.001783508329381706,
-		0.002853613327010729,
-		0.003567016658763411,
-		0.005707226654021459,
-		0.007134033317526822,
-		0.01141445330804292,
-		0.01426806663505364,
-		0.02282890661608583,
-		0.02853613327010729,
-		0.04565781323217167,
-		0.05707226654021458,
-		0.09131562646434334,
-		0.1141445330804292,
-		0.1826312529286867,
-		0.2282890661608583,
-		0.3652625058573734,
-		0.4565781323217166,
-		0.7305250117147467,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.001783508329381706,
-		0.002972513882302843,
-		0.003567016658763411,
-		0.005945027764605685,
-		0.007134033317526822,
-		0.01189005552921137,
-		0.01426806663505364,
-		0.02378011105842274,
-		0.02853613327010729,
-		0.04756022211684548,
-		0.05707226654021458,
-		0.09512044423369097,
-		0.1141445330804292,
-		0.1902408884673819,
-		0.2282890661608583,
-		0.3804817769347639,
-		0.4565781323217166,
-		0.7609635538695277,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.001783508329381706,
-		0.003170681474456366,
-		0.003567016658763411,
-		0.006341362948912732,
-		0.007134033317526822,
-		0.01268272589782546,
-		0.01426806663505364,
-		0.02536545179565093,
-		0.02853613327010729,
-		0.05073090359130186,
-		0.05707226654021458,
-		0.1014618071826037,
-		0.1141445330804292,
-		0.2029236143652074,
-		0.2282890661608583,
-		0.4058472287304148,
-		0.4565781323217166,
-		0.8116944574608297,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.001783508329381706,
-		0.003344078117590698,
-		0.003567016658763411,
-		0.006688156235181397,
-		0.007134033317526822,
-		0.01337631247036279,
-		0.01426806663505364,
-		0.02675262494072559,
-		0.02853613327010729,
-		0.05350524988145117,
-		0.05707226654021458,
-		0.1070104997629023,
-		0.1141445330804292,
-		0.2140209995258047,
-		0.2282890661608583,
-		0.4280419990516094,
-		0.4565781323217166,
-		0.8560839981032188,
-		0.9131562646434332,
-		0.9131562646434332,
-		0.9131562646434332
-	},
-	.c_bpre4800022 = {
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.001900602629401197, 0.9980993973706187, -1.998084934473805 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.003797586448288047, 0.9962024135517217, -1.99614461729644 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.00758077721569739, 0.9924192227848008, -1.992188477656889 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01510402178617149, 0.9848959782140769, -1.983976543967886 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.02997997558552456, 0.970020024414599, -1.966370680228606 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.05906109065045628, 0.9409389093496044, -1.926570368361008 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1146342006631835, 0.8853657993397686, -1.829743648098742 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2161268883172697, 0.7838731116841319, -1.576467829997388 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3855433469403512, 0.6144566530602925, -0.9072722163483264 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.6224420330958134, 0.377557966933209, 0.5074649752321724 },
-		{ 0.6224420330958134, 0.377557966933209, 0.5074649752321724 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.00200443856760159, 0.9979955614324414, -1.99797947422443 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.226496589214798, 0.7735034107852021, -1.544644598471812 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4016924735036589, 0.5983075264963411, -0.8265343537434172 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.6420281037378299, 0.3579718962621701, 0.6316620915120217 },
-		{ 0.6420281037378299, 0.3579718962621701, 0.6316620915120217 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002137921378843723, 0.9978620786211562, -1.997843776239298 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004271272049865176, 0.9957287279501347, -1.995655596932044 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.008524300334807507, 0.9914756996651926, -1.991183804328913 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.0169759369734164, 0.9830240630265834, -1.981861521991906 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03366369151070796, 0.9663363084892923, -1.961726628506107 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.06619413889528776, 0.9338058611047124, -1.915693440912805 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1280066137664863, 0.8719933862335137, -1.80218794261495 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2396275343650102, 0.7603724656349897, -1.502695368135347 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4218337135041663, 0.5781662864958336, -0.7217684821742635 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.6657237451596177, 0.3342762548403825, 0.7761068122816975 },
-		{ 0.6657237451596177, 0.3342762548403825, 0.7761068122816975 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002226902177774589, 0.9977730978222253, -1.997753239353986 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004448845262240184, 0.9955511547377598, -1.995471809606304 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.008877898300312402, 0.9911221016996872, -1.990805431884052 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01767697952239542, 0.9823230204776048, -1.981062039151428 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03504148343975495, 0.964958516560245, -1.959960364598655 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.06885506131785173, 0.9311449386821484, -1.91152135891591 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.132969103166618, 0.8670308968333823, -1.791528164810938 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2482574239363009, 0.7517425760636991, -1.474110264943814 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4348830993331137, 0.5651169006668862, -0.6515281033821497 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.6806428885806526, 0.3193571114193474, 0.8620951206070395 },
-		{ 0.6806428885806526, 0.3193571114193474, 0.8620951206070395 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002375183700887301, 0.9976248162991285, -1.99760222349892 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004744732418068793, 0.9952552675819394, -1.995165003839896 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.009466926418705465, 0.990533073581693, -1.99017288325679 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01884429435749583, 0.9811557056427026, -1.979721851620626 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03733341827848971, 0.962666581721608, -1.956986767024492 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.0732732950577728, 0.9267267049470497, -1.904455594761891 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.141177052242193, 0.8588229477601368, -1.773375564980453 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2624236271444499, 0.7375763728566451, -1.425423024096506 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.455980738144475, 0.5440192618560227, -0.5341592010936728 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.7040438175648251, 0.2959561824578837, 0.9857502166432905 },
-		{ 0.7040438175648251, 0.2959561824578837, 0.9857502166432905 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002544627843779239, 0.9974553721562315, -1.997429438665259 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005082774044968121, 0.9949172259550442, -1.994813624743526 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01013970054095189, 0.9898602994593212, -1.989446956885366 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02017665168389907, 0.9798233483164069, -1.978178477994632 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03994614325866584, 0.9600538567413511, -1.953542801525038 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.07829635086205963, 0.9217036491453625, -1.89621158156902 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1504629391734082, 0.8495370608269894, -1.752048198555538 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2782867822821852, 0.7217132177185599, -1.368275059570512 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4791296904623732, 0.5208703095383864, -0.4002201096123373 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.7362699498364697, 0.2713062344974124, 1.041741300894637 },
-		{ 0.7362699498364697, 0.2713062344974124, 1.041741300894637 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002671687168388755, 0.9973283128316114, -1.997299723024857 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005336236424451628, 0.9946637635755483, -1.994549557727603 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01064399742972557, 0.9893560025702742, -1.98890040781962 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02117470017816778, 0.9788252998218326, -1.977012775197733 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.04190103242869928, 0.9580989675713006, -1.950928092653622 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.08204636833880795, 0.9179536316611919, -1.889909651819493 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.157361130120029, 0.8426388698799712, -1.735655811188261 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.289959734967405, 0.7100402650325952, -1.324431418345154 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4958428220324421, 0.5041571779675579, -0.3003952007345272 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002849545642620056, 0.9971504543573798, -1.997117928417908 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005690971374870557, 0.9943090286251293, -1.994179111028996 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01134955559455193, 0.9886504444054481, -1.988132265394634 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02257029877691012, 0.97742970122309, -1.975368948772113 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.044631179166941, 0.955368820833059, -1.947222020112726 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.08727041618005063, 0.9127295838199495, -1.88091939016434 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1669247068198619, 0.8330752931801381, -1.712147366860138 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.3059855558928268, 0.6940144441071732, -1.261742928207247 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.5183439513706116, 0.4816560486293884, -0.162280058881953 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002968102512302826, 0.99703189748771, -1.996996606636078 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005927388885872869, 0.9940726111141335, -1.993931658445309 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01181966970354796, 0.9881803302967705, -1.987618203016969 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02349957090292243, 0.976500429097236, -1.974265457523175 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.04644697438289373, 0.9535530256171846, -1.944721903973276 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.09073638929551171, 0.9092636107083126, -1.874818194899734 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1732402273566989, 0.8267597726451348, -1.696120262004948 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.3164678309660052, 0.6835321690348473, -1.219167131210593 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.5327849971005978, 0.4672150029378646, -0.07166672086827941 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.003165657272682691, 0.9968343427273385, -1.996794193701604 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.006321299662967956, 0.9936787003370326, -1.993518359308714 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01260265342163966, 0.9873973465784931, -1.986758027559294 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02504647997001478, 0.9749535200302487, -1.9724126647458 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.04946557156830424, 0.950534428431704, -1.9405031546216 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.09648418209766672, 0.9035158179039221, -1.864458749813676 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1836591668004464, 0.8163408332025933, -1.668796693786617 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.3335880802119081, 0.6664119197881799, -1.146941439336815 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.5558957345116085, 0.444104265504263, 0.07591836824398461 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.003338496177473305, 0.9966615038225523, -1.996616847135648 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.006665872804872333, 0.9933341271964043, -1.993155798723077 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01328724716676127, 0.9867127528332389, -1.98600184715428 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.0263979433962513, 0.9736020566037487, -1.970777704905667 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.05209903537695132, 0.9479009646230487, -1.936758655894357 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.1014837612666936, 0.8985162387333062, -1.855201198171193 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1926685687325519, 0.807331431267448, -1.644274423657083 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.348215960087654, 0.6517840399123458, -1.082579542078551 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.5751775653155417, 0.4248224346844585, 0.200759236390456 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 },
-		{ 0.5987442460760855, 0.4012557539239145, 0.3541602246491707 }
-	},
-	.c_bpre9600022 = {
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.0009507532806008126, 0.9990492467194091, -1.999045629273103 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.001900599363113368, 0.9980994006368914, -1.998084937789812 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.003797599488786984, 0.9962024005114626, -1.996144603858881 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.00758074473848004, 0.9924192552616442, -1.99218851211454 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01510405401663037, 0.9848959459834316, -1.983976507798527 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.02997994384160067, 0.9700200561584305, -1.966370719758175 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.05906121382052063, 0.9409387861809975, -1.926570184389391 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1146339109256416, 0.8853660890750964, -1.829744226807387 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2161271448380526, 0.7838728551622978, -1.576467056904811 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3855425426333917, 0.6144574573826971, -0.9072761644444367 },
-		{ 0.3855425426333917, 0.6144574573826971, -0.9072761644444367 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001002722009514622, 0.9989972779905066, -1.99899325416808 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002004435301626584, 0.9979955646983741, -1.997979477542813 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004004852842373051, 0.9959951471576267, -1.9959308632208 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.007993666838457588, 0.9920063331615423, -1.991749715409004 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01592343496739134, 0.9840765650326088, -1.98305424604643 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03159331415362125, 0.9684066858463785, -1.964350751469719 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.06218849080803343, 0.9378115091919667, -1.921856393986694 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1205095732270861, 0.8794904267729141, -1.817845557713384 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.226496589214798, 0.7735034107852021, -1.544644598471812 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4016924735036589, 0.5983075264963411, -0.8265343537434172 },
-		{ 0.4016924735036589, 0.5983075264963411, -0.8265343537434172 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001069532639455734, 0.9989304673605446, -1.998925889312965 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002137921378843723, 0.9978620786211562, -1.997843776239298 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004271272049865176, 0.9957287279501347, -1.995655596932044 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.008524300334807507, 0.9914756996651926, -1.991183804328913 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.0169759369734164, 0.9830240630265834, -1.981861521991906 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03366369151070796, 0.9663363084892923, -1.961726628506107 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.06619413889528776, 0.9338058611047124, -1.915693440912805 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1280066137664863, 0.8719933862335137, -1.80218794261495 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2396275343650102, 0.7603724656349897, -1.502695368135347 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4218337135041663, 0.5781662864958336, -0.7217684821742635 },
-		{ 0.4218337135041663, 0.5781662864958336, -0.7217684821742635 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001114071666726421, 0.9988859283332734, -1.998880960944573 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002226902177774589, 0.9977730978222253, -1.997753239353986 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004448845262240184, 0.9955511547377598, -1.995471809606304 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.008877898300312402, 0.9911221016996872, -1.990805431884052 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01767697952239542, 0.9823230204776048, -1.981062039151428 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03504148343975495, 0.964958516560245, -1.959960364598655 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.06885506131785173, 0.9311449386821484, -1.91152135891591 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.132969103166618, 0.8670308968333823, -1.791528164810938 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2482574239363009, 0.7517425760636991, -1.474110264943814 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4348830993331137, 0.5651169006668862, -0.6515281033821497 },
-		{ 0.4348830993331137, 0.5651169006668862, -0.6515281033821497 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001188297876365557, 0.9988117021236427, -1.998806050559731 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002375186965595038, 0.997624813034409, -1.997602220172056 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.004744719390399471, 0.9952552806098006, -1.995165017364032 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.009466958833525232, 0.9905330411665744, -1.990172848369216 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.01884426224910103, 0.9811557377509484, -1.979721888638078 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03733354429359989, 0.9626664557088553, -1.956986602314137 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.07327299178350143, 0.926727008217704, -1.904456085709187 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1411773332895522, 0.8588226667110301, -1.773374932225782 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2624233857722855, 0.7375766142279883, -1.425423872466048 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.455981450275502, 0.5440185497369403, -0.5341551621255853 },
-		{ 0.455981450275502, 0.5440185497369403, -0.5341551621255853 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001273124344688168, 0.9987268756553173, -1.998720388144979 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.00254462457960931, 0.9974553754203968, -1.997429441996 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005082767533374916, 0.9949172324667622, -1.994813631521037 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01013973293393443, 0.9898602670662192, -1.989446921844602 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02017661961895689, 0.9798233803810517, -1.978178515313623 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.03994601759166819, 0.9600539824121156, -1.953542968569177 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.07829665248160801, 0.9217033475185981, -1.896211079758046 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1504629391734082, 0.8495370608269894, -1.752048198555538 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.2782865461017223, 0.7217134538986968, -1.368275931245359 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.4791293495611221, 0.5208706504473184, -0.4002221199081736 },
-		{ 0.4791293495611221, 0.5208706504473184, -0.4002221199081736 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001336737017120661, 0.9986632629828791, -1.998656110741265 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002671687168388755, 0.9973283128316114, -1.997299723024857 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005336236424451628, 0.9946637635755483, -1.994549557727603 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01064399742972557, 0.9893560025702742, -1.98890040781962 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02117470017816778, 0.9788252998218326, -1.977012775197733 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.04190103242869928, 0.9580989675713006, -1.950928092653622 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.08204636833880795, 0.9179536316611919, -1.889909651819493 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.157361130120029, 0.8426388698799712, -1.735655811188261 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.289959734967405, 0.7100402650325952, -1.324431418345154 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001425789258815162, 0.9985742107411848, -1.998566073442865 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002849545642620056, 0.9971504543573798, -1.997117928417908 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005690971374870557, 0.9943090286251293, -1.994179111028996 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01134955559455193, 0.9886504444054481, -1.988132265394634 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02257029877691012, 0.97742970122309, -1.975368948772113 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.044631179166941, 0.955368820833059, -1.947222020112726 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.08727041618005063, 0.9127295838199495, -1.88091939016434 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1669247068198619, 0.8330752931801381, -1.712147366860138 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.3059855558928268, 0.6940144441071732, -1.261742928207247 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001485154097498383, 0.9985148459025083, -1.99850601661856 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.002968099249514201, 0.9970319007504893, -1.996996609976503 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.005927401898405942, 0.9940725981017536, -1.993931644813151 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01181963736518303, 0.9881803626348968, -1.98761823844007 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.02349960285870466, 0.9765003971413349, -1.974265419453205 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.04644684956496328, 0.9535531504369922, -1.944722076804154 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.09073668684841575, 0.9092633131525404, -1.874817666416468 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1732399567987765, 0.8267600432016822, -1.696120957231261 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.3164687257273982, 0.6835312742939157, -1.219163443773223 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001584083296286416, 0.9984159167037243, -1.998405871472129 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.003165660534794901, 0.9968343394652054, -1.99679419035666 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.006321306166645848, 0.9936786938334207, -1.993518352474648 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01260265342163966, 0.9873973465784931, -1.986758027559294 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.0250464480644755, 0.9749535519355286, -1.972412703164715 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.04946550935677493, 0.9505344906440388, -1.940503242375505 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.09648418209766672, 0.9035158179039221, -1.864458749813676 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1836594339443236, 0.816340566055724, -1.668795979017618 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.3335885163860639, 0.6664114836227411, -1.146939556644412 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.0008913566701104016, 0.9991086433298897, -1.999105463846431 },
-		{ 0.001670643613778767, 0.9983293563862341, -1.998318182857607 },
-		{ 0.001781918823507313, 0.9982180811764928, -1.998205368918346 },
-		{ 0.003338509224355499, 0.9966614907762837, -1.996616833740067 },
-		{ 0.003560662412320981, 0.996439337587679, -1.996388533980716 },
-		{ 0.006665840296811887, 0.9933341597031882, -1.993155832972025 },
-		{ 0.007108646507827316, 0.9928913534921726, -1.992688502789063 },
-		{ 0.01328724716676127, 0.9867127528332389, -1.98600184715428 },
-		{ 0.0141667601604821, 0.985833239839518, -1.985024751876759 },
-		{ 0.0263979433962513, 0.9736020566037487, -1.970777704905667 },
-		{ 0.02813282322751931, 0.9718671767724809, -1.968656622498875 },
-		{ 0.05209903537695132, 0.9479009646230487, -1.936758655894357 },
-		{ 0.05547419071228737, 0.9445258092877127, -1.931871968596603 },
-		{ 0.1014837612666936, 0.8985162387333062, -1.855201198171193 },
-		{ 0.1078709955893919, 0.8921290044106083, -1.843037763124579 },
-		{ 0.1926685687325519, 0.807331431267448, -1.644274423657083 },
-		{ 0.2041058394893369, 0.7958941605106632, -1.611934220908413 },
-		{ 0.348215960087654, 0.6517840399123458, -1.082579542078551 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 },
-		{ 0.3665524852650262, 0.6334475147349737, -0.9984461227362407 }
-	},
-	.c_bpre4800080040 = {
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 9.512048724019277e-05, 0.999995243983644, -1.999980767364073 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0001902399546550362, 0.9999904880062703, -1.999932582074476 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0003804832515902212, 0.9999809760375696, -1.999749355171412 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0007609499881093219, 0.9999619526006686, -1.999035539564211 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001521871294136717, 0.9999239064853298, -1.99621916714766 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003043622010693213, 0.9998478189244823, -1.985043182252052 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.006086817940287245, 0.9996956603537455, -1.940700544129329 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01217171319848347, 0.9993914149653614, -1.766928502163607 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02433603280672198, 0.9987831986722118, -1.123251255611502 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.0486426227790368, 0.9975678844789616, 0.7358643058486463 },
-		{ 0.0486426227790368, 0.9975678844789616, 0.7358643058486463 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001003225971288486, 0.9999949838872232, -1.999978880580515 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01283713840475552, 0.9993581430797622, -1.74135428065068 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02566603720339196, 0.9987166981398303, -1.033598345114666 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.05129913713349929, 0.997435043143325, 0.9291090637077825 },
-		{ 0.05129913713349929, 0.997435043143325, 0.9291090637077825 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001070102134811192, 0.9999946494893258, -1.999976327571021 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002140198543980546, 0.9999892990072798, -1.999916011865817 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004280374185897884, 0.9999785981290706, -1.999685456502705 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0008560656763660545, 0.9999571967161814, -1.998784728690155 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001712094710316203, 0.9999143952644842, -1.995225998210467 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003424042857226423, 0.9998287978571391, -1.981097993371668 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.006847499510961472, 0.9996576250244518, -1.925091663080493 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01369265460944374, 0.9993153672695279, -1.706662652633935 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02737593477937958, 0.9986312032610311, -0.9140665481796424 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.0547143974685086, 0.9972642801265745, 1.161746233731799 },
-		{ 0.0547143974685086, 0.9972642801265745, 1.161746233731799 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001114689599430909, 0.9999944265520027, -1.999974546003085 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002229372986383897, 0.9999888531350681, -1.999909331556239 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004458721122253452, 0.9999777063943889, -1.999659628175578 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0008917342843468313, 0.9999554132857825, -1.998683215766355 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001783428809193301, 0.9999108285595402, -1.994823770412042 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003566698587475959, 0.9998216650706262, -1.979500217841435 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.007132761108015767, 0.9996433619445994, -1.918777781649975 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01426297840197647, 0.9992868510799013, -1.682421441385198 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02851578517630079, 0.9985742107411849, -0.8319680558384898 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.05699091285240125, 0.9971504543573799, 1.304979256145427 },
-		{ 0.05699091285240125, 0.9971504543573799, 1.304979256145427 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001189002208807432, 0.9999940549953611, -1.999971435399462 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002377998699893366, 0.9999881100097033, -1.99989763215768 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004755986778639706, 0.9999762202262265, -1.999614321147963 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0009511845149059036, 0.9999524408543136, -1.998504982765527 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001902318118400527, 0.9999048841341085, -1.994117304491694 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003804506809035357, 0.9998097766608713, -1.976693896359541 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.007608197165705643, 0.999619591142285, -1.907699991794208 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01521350279445708, 0.9992393253604677, -1.640078565512339 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.03041538538799814, 0.9984792309806005, -0.6913813161425856 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.06078488631793617, 0.9969607681745186, 1.518959156507215 },
-		{ 0.06078488631793617, 0.9969607681745186, 1.518959156507215 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001273932277123935, 0.9999936303430065, -1.999967663897158 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002547852398636466, 0.9999872607429475, -1.999883396231408 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.000509568577768671, 0.9999745216809079, -1.999559078136035 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.00101912552349463, 0.9999490438473447, -1.998287452761407 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002038191040716728, 0.9998980904548262, -1.993254677647996 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.004076222763091756, 0.9997961919495735, -1.973268199619211 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.008151527404704345, 0.9995924238012891, -1.894194162512779 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01629973244084993, 0.999185013720936, -1.58878666064426 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.03258614215213446, 0.9983706932780873, -0.5258753049846094 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.06511928211306933, 0.9967440444584059, 1.720196369510729 },
-		{ 0.06511928211306933, 0.9967440444584059, 1.720196369510729 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001337626773889666, 0.9999933118661306, -1.999964683912513 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002675244601628479, 0.9999866237769921, -1.999872113165017 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0005350453418509497, 0.9999732477329074, -1.999515221461104 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001070076370020479, 0.9999464961814989, -1.998114625388505 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002140095486879026, 0.9998929952256563, -1.992569063823208 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.004279961973306256, 0.9997860019013346, -1.970545483570273 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.008559008042891437, 0.9995720495978553, -1.883477497687099 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01711435325486028, 0.9991442823372572, -1.548343364449012 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.03421406145533944, 0.998289296927233, -0.3990783165513909 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001426801574067358, 0.9999928659921298, -1.999960293760649 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002853592969265684, 0.9999857320351535, -1.999855444634919 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.000570714522378445, 0.9999714642738813, -1.999450335365594 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001141412758990282, 0.9999429293620506, -1.9978587150454 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002282760376821589, 0.9998858619811591, -1.991553586551972 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.004565260203900548, 0.9997717369898051, -1.966513964037374 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.009129478327755153, 0.9995435260836122, -1.867633695055731 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01825478928678775, 0.9990872605356607, -1.488968540154917 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.03649291670696839, 0.9981753541646515, -0.2188524215758395 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001486253534291239, 0.9999925687374523, -1.999957225565869 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002972491214343767, 0.9999851375464901, -1.999843766945854 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0005944975934235914, 0.9999702752484246, -1.999404814543765 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001188970400437831, 0.9999405515440249, -1.997679074533049 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002377871469184402, 0.9998811064585637, -1.99084055670486 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.004755477877591967, 0.9997622277071443, -1.963684107815375 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.009509809718692688, 0.9995245103144839, -1.856529844325296 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.0190150409202982, 0.9990492483540996, -1.447655816806063 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.03801251783448739, 0.9980993941043461, -0.09759798748509513 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001585334707513377, 0.9999920733350023, -1.999951860818869 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.000317065675854581, 0.9999841467164742, -1.999823298574469 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0006341280364343549, 0.9999682936515513, -1.999324930727598 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001268235966994538, 0.999936588308395, -1.997363591325164 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002536384037984616, 0.9998731808014368, -1.989588166002408 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.005072453078801296, 0.999746378013149, -1.9587148143588 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.01014361967198752, 0.9994928203504102, -1.837070965349754 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.02028207488494441, 0.9989858962974301, -1.37584215154063 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.04054381191759564, 0.9979728177353213, 0.105035931149143 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001672035755294032, 0.9999916398314712, -1.99994690866382 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.000334416899844439, 0.9999832796673861, -1.999804356344868 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0006688044407838253, 0.9999665597779608, -1.999250911487534 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001337586516597611, 0.9999331206741701, -1.997071087527014 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002675083576313313, 0.9998662458211843, -1.988426687275196 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.005349809349025217, 0.9997325095325488, -1.954108198821757 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.01069818767504399, 0.9994650906162479, -1.819073830409642 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.02139065278910767, 0.9989304673605445, -1.310099369948963 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.04275842757688255, 0.9978620786211559, 0.2815012281191623 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 },
-		{ 0.04560573697012076, 0.997719713151494, 0.5049134395811802 }
-	},
-	.c_bpre9600080040 = {
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 4.756030016720971e-05, 0.9999976219889944, -1.999994002826524 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 9.512020352855222e-05, 0.9999952439918252, -1.999980767422059 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0001902425305993555, 0.9999904879735453, -1.999932581643318 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0003804786131433227, 0.9999809761193803, -1.999749357245316 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0007609501231807829, 0.9999619525188594, -1.999035535498736 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.0015218689074604, 0.9999239065671361, -1.996219175192884 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003043640562886732, 0.9998478185972831, -1.985043118339126 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.006086782821430586, 0.9996956611716192, -1.940700860486051 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01217172017170488, 0.9993914141477362, -1.766927889028119 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02433611745915346, 0.9987832019407221, -1.123255585805342 },
-		{ 0.02433611745915346, 0.9987832019407221, -1.123255585805342 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 5.016136145617604e-05, 0.9999974919404665, -1.999993466104689 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001003220919228108, 0.9999949838954042, -1.999978880641224 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.000200643680609847, 0.9999899678159698, -1.999925555220116 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004012853483083204, 0.9999799357325845, -1.999722290790544 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0008025626451184721, 0.9999598718677439, -1.998929368819309 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001605093084889711, 0.9999197453457549, -1.995798877791213 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003210057353613643, 0.9998394971323192, -1.983373669874642 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.006419599483818156, 0.9996790200258093, -1.934092119664897 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01283713840475552, 0.9993581430797622, -1.74135428065068 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02566603720339196, 0.9987166981398303, -1.033598345114666 },
-		{ 0.02566603720339196, 0.9987166981398303, -1.033598345114666 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 5.350517830496087e-05, 0.9999973247410846, -1.999992744250136 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001070102134811192, 0.9999946494893258, -1.999976327571021 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002140198543980546, 0.9999892990072798, -1.999916011865817 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004280374185897884, 0.9999785981290706, -1.999685456502705 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0008560656763660545, 0.9999571967161814, -1.998784728690155 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001712094710316203, 0.9999143952644842, -1.995225998210467 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003424042857226423, 0.9998287978571391, -1.981097993371668 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.006847499510961472, 0.9996576250244518, -1.925091663080493 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01369265460944374, 0.9993153672695279, -1.706662652633935 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02737593477937958, 0.9986312032610311, -0.9140665481796424 },
-		{ 0.02737593477937958, 0.9986312032610311, -0.9140665481796424 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 5.573455762583015e-05, 0.9999972132721185, -1.999992243121788 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001114689599430909, 0.9999944265520027, -1.999974546003085 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002229372986383897, 0.9999888531350681, -1.999909331556239 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004458721122253452, 0.9999777063943889, -1.999659628175578 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0008917342843468313, 0.9999554132857825, -1.998683215766355 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001783428809193301, 0.9999108285595402, -1.994823770412042 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003566698587475959, 0.9998216650706262, -1.979500217841435 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.007132761108015767, 0.9996433619445994, -1.918777781649975 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01426297840197647, 0.9992868510799013, -1.682421441385198 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02851578517630079, 0.9985742107411849, -0.8319680558384898 },
-		{ 0.02851578517630079, 0.9985742107411849, -0.8319680558384898 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 5.945019879691116e-05, 0.9999970274932626, -1.999991372577889 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001189002884224847, 0.9999940549871801, -1.999971435329025 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002378007526595362, 0.9999881100424276, -1.999897632688441 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0004755979122918221, 0.999976220144416, -1.999614318576101 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.0009511816778520232, 0.9999524409361221, -1.998504987826453 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.001902343876373979, 0.9999048838068905, -1.994117264361755 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.003804460429881722, 0.9998097774788388, -1.976694095600924 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.007608198513386671, 0.9996195903244735, -1.907699598773311 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01521347894157776, 0.9992393261779686, -1.640079314460776 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.03041557073810118, 0.9984792277130848, -0.6913764060714829 },
-		{ 0.03041557073810118, 0.9984792277130848, -0.6913764060714829 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 6.369671528418275e-05, 0.9999968151664317, -1.999990323534097 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001273930256532726, 0.9999936303511875, -1.999967663972041 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002547859117752565, 0.99998726075931, -1.999883396514575 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0005095692532535659, 0.9999745215990979, -1.999559075386339 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001019121485569616, 0.9999490439291525, -1.99828745817778 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002038215238001406, 0.9998980907820424, -1.993254720614549 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.00407617908307386, 0.9997961911316173, -1.973267986328961 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.008151527404704345, 0.9995924238012891, -1.894194162512779 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01629971309066297, 0.9991850145383923, -1.588787455504679 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.03258618747636706, 0.9983706949116675, -0.5258778290774685 },
-		{ 0.03258618747636706, 0.9983706949116675, -0.5258778290774685 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 6.688145052665553e-05, 0.9999966559274738, -1.999989498914297 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001337626773889666, 0.9999933118661306, -1.999964683912513 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002675244601628479, 0.9999866237769921, -1.999872113165017 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0005350453418509497, 0.9999732477329074, -1.999515221461104 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001070076370020479, 0.9999464961814989, -1.998114625388505 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002140095486879026, 0.9998929952256563, -1.992569063823208 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.004279961973306256, 0.9997860019013346, -1.970545483570273 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.008559008042891437, 0.9995720495978553, -1.883477497687099 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01711435325486028, 0.9991442823372572, -1.548343364449012 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 7.134020594608063e-05, 0.9999964329897029, -1.999988289900732 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001426801574067358, 0.9999928659921298, -1.999960293760649 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002853592969265684, 0.9999857320351535, -1.999855444634919 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.000570714522378445, 0.9999714642738813, -1.999450335365594 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001141412758990282, 0.9999429293620506, -1.9978587150454 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002282760376821589, 0.9998858619811591, -1.991553586551972 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.004565260203900548, 0.9997717369898051, -1.966513964037374 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.009129478327755153, 0.9995435260836122, -1.867633695055731 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01825478928678775, 0.9990872605356607, -1.488968540154917 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 7.431281477747601e-05, 0.9999962843618229, -1.999987448532994 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001486251129539931, 0.9999925687456332, -1.999957225651869 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0002972510056517797, 0.9999851375137655, -1.999843766290589 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0005944940357881876, 0.9999702753302345, -1.999404817738023 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001188971075882606, 0.9999405514622176, -1.997679068228249 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002377880295710329, 0.999881106785774, -1.990840606757468 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.004755470220823343, 0.9997622268892158, -1.963683859516419 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.009509781357734054, 0.9995245111322181, -1.856530331088484 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.01901529836175531, 0.9990492450847186, -1.447652205312296 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 7.926689245705752e-05, 0.9999960366596471, -1.999985983485425 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001585334662537781, 0.9999920733268209, -1.999951860727681 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0003170665314967659, 0.9999841467001119, -1.999823298226086 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0006341280364343549, 0.9999682936515513, -1.999324930727598 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001268232229314885, 0.9999365883902024, -1.997363598044471 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002536387370507428, 0.9998731809650407, -1.989588192680556 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.005072453078801296, 0.999746378013149, -1.9587148143588 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.01014360976284635, 0.9994928195327017, -1.837070447941382 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.0202821900974982, 0.9989858946628433, -1.375840252141858 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 4.458765852612238e-05, 0.9999977706170734, -1.999994589719501 },
-		{ 8.360196250185704e-05, 0.9999958199069989, -1.999984637060449 },
-		{ 8.917521766229952e-05, 0.9999955412391168, -1.99998281767313 },
-		{ 0.0001672091488685301, 0.9999916397987465, -1.999946908280908 },
-		{ 0.0001783500377199401, 0.9999910824981142, -1.999940188509516 },
-		{ 0.0003344050160633195, 0.9999832797491969, -1.999804358177564 },
-		{ 0.0003566984849941582, 0.9999821650757503, -1.999778592619248 },
-		{ 0.0006688044407838253, 0.9999665597779608, -1.999250911487534 },
-		{ 0.0007133906082930759, 0.9999643304695852, -1.999150089346655 },
-		{ 0.001337586516597611, 0.9999331206741701, -1.997071087527014 },
-		{ 0.001426755770282967, 0.9999286622114859, -1.996672418794531 },
-		{ 0.002675083576313313, 0.9998662458211843, -1.988426687275196 },
-		{ 0.002853409758974427, 0.9998573295120515, -1.986843423535275 },
-		{ 0.005349809349025217, 0.9997325095325488, -1.954108198821757 },
-		{ 0.005706412420573146, 0.9997146793789713, -1.947832130357208 },
-		{ 0.01069818767504399, 0.9994650906162479, -1.819073830409642 },
-		{ 0.01141119668401153, 0.9994294401657996, -1.794620645124532 },
-		{ 0.02139065278910767, 0.9989304673605445, -1.310099369948963 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 },
-		{ 0.02281588259752495, 0.9988592058701238, -1.221804316299075 }
-	}
-};
+#include "Scales.hpp"
+const ScaleDef ji_intervals = {
+	.name = "Intervals (JI)",
+	.description = "Single western intervals in A, Just Intonation. A0 is defined as a major sixth above C0=16.35Hz",
+	.scalename = {
+		"Octave + m2; A0-A8",
+		"Octave + M2; A0-A8",
+		"Octave + m3; A0-A8",
+		"Octave + M2; A0-A8",
+		"Octave + P4; A0-A8",
+		"Octave + d5; A0-A8",
+		"Octave + P5; A0-A8",
+		"Octave + m6; A0-A8",
+		"Octave + M6; A0-A8",
+		"Octave + m7; A0-A8",
+		"Octave + M7; A0-A8"},
+	.notedesc = {
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"m2",
+		"Oct",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"M2",
+		"Oct",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"m3",
+		"Oct",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"M3",
+		"Oct",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"P4",
+		"Oct",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"d5",
+		"Oct",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"P5",
+		"Oct",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"m6",
+		"Oct",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"M6",
+		"Oct",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"m7",
+		"Oct",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct",
+		"M7",
+		"Oct"},
+	.freq = {
+		27.25000000000001,
+		29.06666666666666,
+		54.50000000000001,
+		58.13333333333333,
+		109,
+		116.2666666666667,
+		217.9999999999999,
+		232.5333333333333,
+		436.0000000000001,
+		465.0666666666667,
+		872.0000000000001,
+		930.1333333333332,
+		1744.000000000001,
+		1860.266666666666,
+		3488,
+		3720.533333333334,
+		6976.000000000001,
+		7441.066666666667,
+		13952,
+		14882.13333333333,
+		14882.13333333333,
+		27.25000000000001,
+		30.65625000000001,
+		54.50000000000001,
+		61.31250000000001,
+		109,
+		122.625,
+		217.9999999999999,
+		245.25,
+		436.0000000000001,
+		490.5000000000001,
+		872.0000000000001,
+		981.0000000000001,
+		1744.000000000001,
+		1962,
+		3488,
+		3924,
+		6976.000000000001,
+		7848.000000000001,
+		13952,
+		15695.99999999999,
+		15695.99999999999,
+		27.25000000000001,
+		32.70000000000001,
+		54.50000000000001,
+		65.40000000000001,
+		109,
+		130.8,
+		217.9999999999999,
+		261.6,
+		436.0000000000001,
+		523.2,
+		872.0000000000001,
+		1046.4,
+		1744.000000000001,
+		2092.8,
+		3488,
+		4185.6,
+		6976.000000000001,
+		8371.200000000001,
+		13952,
+		16742.4,
+		16742.4,
+		27.25000000000001,
+		34.0625,
+		54.50000000000001,
+		68.12500000000001,
+		109,
+		136.25,
+		217.9999999999999,
+		272.5000000000001,
+		436.0000000000001,
+		545.0000000000001,
+		872.0000000000001,
+		1090,
+		1744.000000000001,
+		2180.000000000001,
+		3488,
+		4360,
+		6976.000000000001,
+		8720.000000000002,
+		13952,
+		17440.00000000001,
+		17440.00000000001,
+		27.25000000000001,
+		36.33333333333334,
+		54.50000000000001,
+		72.66666666666667,
+		109,
+		145.3333333333333,
+		217.9999999999999,
+		290.6666666666667,
+		436.0000000000001,
+		581.3333333333334,
+		872.0000000000001,
+		1162.666666666667,
+		1744.000000000001,
+		2325.333333333333,
+		3488,
+		4650.666666666668,
+		6976.000000000001,
+		9301.333333333334,
+		13952,
+		18602.66666666666,
+		18602.66666666666,
+		27.25000000000001,
+		38.92857142857144,
+		54.50000000000001,
+		77.85714285714288,
+		109,
+		155.7142857142857,
+		217.9999999999999,
+		311.4285714285716,
+		436.0000000000001,
+		622.857142857143,
+		872.0000000000001,
+		1245.714285714286,
+		1744.000000000001,
+		2491.428571428572,
+		3488,
+		4982.857142857144,
+		6976.000000000001,
+		9965.714285714288,
+		13952,
+		19931.42857142858,
+		19931.42857142858,
+		27.25000000000001,
+		40.87500000000002,
+		54.50000000000001,
+		81.75000000000004,
+		109,
+		163.5000000000001,
+		217.9999999999999,
+		327.0000000000001,
+		436.0000000000001,
+		654.0000000000001,
+		872.0000000000001,
+		1308,
+		1744.000000000001,
+		2616.000000000001,
+		3488,
+		5232.000000000001,
+		6976.000000000001,
+		10464,
+		13952,
+		13952,
+		13952,
+		27.25000000000001,
+		43.6,
+		54.50000000000001,
+		87.20000000000002,
+		109,
+		174.4000000000001,
+		217.9999999999999,
+		348.8,
+		436.0000000000001,
+		697.6000000000001,
+		872.0000000000001,
+		1395.2,
+		1744.000000000001,
+		2790.400000000001,
+		3488,
+		5580.800000000001,
+		6976.000000000001,
+		11161.6,
+		13952,
+		13952,
+		13952,
+		27.25000000000001,
+		45.41666666666668,
+		54.50000000000001,
+		90.83333333333333,
+		109,
+		181.6666666666667,
+		217.9999999999999,
+		363.3333333333333,
+		436.0000000000001,
+		726.6666666666666,
+		872.0000000000001,
+		1453.333333333333,
+		1744.000000000001,
+		2906.666666666667,
+		3488,
+		5813.333333333335,
+		6976.000000000001,
+		11626.66666666667,
+		13952,
+		13952,
+		13952,
+		27.25000000000001,
+		48.44444444444445,
+		54.50000000000001,
+		96.8888888888889,
+		109,
+		193.7777777777778,
+		217.9999999999999,
+		387.5555555555557,
+		436.0000000000001,
+		775.1111111111114,
+		872.0000000000001,
+		1550.222222222222,
+		1744.000000000001,
+		3100.444444444444,
+		3488,
+		6200.888888888889,
+		6976.000000000001,
+		12401.77777777778,
+		13952,
+		13952,
+		13952,
+		27.25000000000001,
+		51.09375,
+		54.50000000000001,
+		102.1875,
+		109,
+		204.375,
+		217.9999999999999,
+		408.7500000000002,
+		436.0000000000001,
+		817.5,
+		872.0000000000001,
+		1635,
+		1744.000000000001,
+		3270,
+		3488,
+		6540.000000000001,
+		6976.000000000001,
+		13080,
+		13952,
+		13952,
+		13952
+	}
+};
@@ -1,1647 +1,482 @@
-#include "Scales.hpp"
-Scale mesopotamian = {
-	.name = "Mesopotamian",
-	.description = "The Mesopotamian tuning systems have reconstructed from cuneiform tablet from the Sumerian civilisation describing a Babylonian harp. The original work was made in 1960-70s by Duchesne-Guillemin, Kilmer, Gurney and Wulstan deriving a heptatonic ascending scale. Subsequent work by Vitale and Dumbrill indicated that a descending scale was used. The reader is referred to 'NEW LIGHT ON THE BABYLONIAN TONAL SYSTEM, Leon Crickmore for an up-to-date summary of the discussion. Here the module used a Pythagorian tuning and step size suggested by West in THE BABYLONIAN MUSICAL NOTATION AND THE HURRIAN MELODIC TEXTS, p164. The frequencies have been recalculated using more accurate frequency ratios.",
-	.scalename = {
-		"Ishartum; A1-",
-		"Ishartum; A4-",
-		"Embulum; A1-",
-		"Embulum; A4-",
-		"Nid Murub; A1-",
-		"Nid Murub; A4-",
-		"Quablitum; A1-",
-		"Quablitum; A4-",
-		"Kitmun; A1-",
-		"Kitmun; A4-",
-		"Mitum; A1-"},
-	.notedesc = {
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		""},
-	.c_maxq48000 = {
-		0.00719948316447661,
-		0.007584640700024741,
-		0.008532720787527832,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01137696105003711,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01516928140004948,
-		0.01706544157505566,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02275392210007422,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03033856280009897,
-		0.03413088315011133,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04550784420014844,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06067712560019793,
-		0.06826176630022265,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09101568840029688,
-		0.102392649450334,
-		0.1151917306316258,
-		0.1213542512003959,
-		0.1365235326004453,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1820313768005938,
-		0.204785298900668,
-		0.2303834612632515,
-		0.2427085024007917,
-		0.2730470652008906,
-		0.307177948351002,
-		0.3455751918948772,
-		0.3640627536011875,
-		0.409570597801336,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.008532720787527832,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01214912784005428,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01706544157505566,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02429825568010856,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03239767424014475,
-		0.03413088315011133,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04859651136021712,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06479534848028949,
-		0.06826176630022265,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09719302272043423,
-		0.102392649450334,
-		0.1151917306316258,
-		0.129590696960579,
-		0.1365235326004453,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1943860454408685,
-		0.204785298900668,
-		0.2303834612632515,
-		0.259181393921158,
-		0.2730470652008906,
-		0.307177948351002,
-		0.3455751918948772,
-		0.3887720908817369,
-		0.409570597801336,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.009111845880040709,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01214912784005428,
-		0.01366776882006106,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01822369176008142,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02429825568010856,
-		0.02733553764012213,
-		0.02879793265790644,
-		0.03239767424014475,
-		0.03644738352016284,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04859651136021712,
-		0.05467107528024425,
-		0.05759586531581288,
-		0.06479534848028949,
-		0.07289476704032567,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09719302272043423,
-		0.1093421505604885,
-		0.1151917306316258,
-		0.129590696960579,
-		0.1457895340806513,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1943860454408685,
-		0.218684301120977,
-		0.2303834612632515,
-		0.259181393921158,
-		0.2915790681613027,
-		0.307177948351002,
-		0.3455751918948772,
-		0.3887720908817369,
-		0.437368602241954,
-		0.00719948316447661,
-		0.007584640700024741,
-		0.008532720787527832,
-		0.01011285426669965,
-		0.01079922474671491,
-		0.01137696105003711,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01516928140004948,
-		0.01706544157505566,
-		0.02022570853339931,
-		0.02159844949342983,
-		0.02275392210007422,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03033856280009897,
-		0.03413088315011133,
-		0.04045141706679861,
-		0.04319689898685965,
-		0.04550784420014844,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06067712560019793,
-		0.06826176630022265,
-		0.08090283413359722,
-		0.08639379797371931,
-		0.09101568840029688,
-		0.102392649450334,
-		0.1151917306316258,
-		0.1213542512003959,
-		0.1365235326004453,
-		0.1618056682671944,
-		0.1727875959474386,
-		0.1820313768005938,
-		0.204785298900668,
-		0.2303834612632515,
-		0.2427085024007917,
-		0.2730470652008906,
-		0.3236113365343889,
-		0.3455751918948772,
-		0.3640627536011875,
-		0.409570597801336,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.009111845880040709,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01214912784005428,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01822369176008142,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02429825568010856,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03239767424014475,
-		0.03644738352016284,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04859651136021712,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06479534848028949,
-		0.07289476704032567,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09719302272043423,
-		0.102392649450334,
-		0.1151917306316258,
-		0.129590696960579,
-		0.1457895340806513,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1943860454408685,
-		0.204785298900668,
-		0.2303834612632515,
-		0.259181393921158,
-		0.2915790681613027,
-		0.307177948351002,
-		0.3455751918948772,
-		0.3887720908817369,
-		0.409570597801336,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.009111845880040709,
-		0.01011285426669965,
-		0.01079922474671491,
-		0.01137696105003711,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01822369176008142,
-		0.02022570853339931,
-		0.02159844949342983,
-		0.02275392210007422,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03239767424014475,
-		0.03644738352016284,
-		0.04045141706679861,
-		0.04319689898685965,
-		0.04550784420014844,
-		0.051196324725167
-	},
-	.c_maxq96000 = {
-		0.003599741582238305,
-		0.003792320350012371,
-		0.004266360393763916,
-		0.004799655442984406,
-		0.005399612373357457,
-		0.005688480525018555,
-		0.006399540590645875,
-		0.00719948316447661,
-		0.007584640700024741,
-		0.008532720787527832,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01137696105003711,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01516928140004948,
-		0.01706544157505566,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02275392210007422,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03033856280009897,
-		0.03413088315011133,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04550784420014844,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06067712560019793,
-		0.06826176630022265,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09101568840029688,
-		0.102392649450334,
-		0.1151917306316258,
-		0.1213542512003959,
-		0.1365235326004453,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1820313768005938,
-		0.204785298900668,
-		0.003599741582238305,
-		0.004049709280018093,
-		0.004266360393763916,
-		0.004799655442984406,
-		0.005399612373357457,
-		0.006074563920027139,
-		0.006399540590645875,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.008532720787527832,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01214912784005428,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01706544157505566,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02429825568010856,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03239767424014475,
-		0.03413088315011133,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04859651136021712,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06479534848028949,
-		0.06826176630022265,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09719302272043423,
-		0.102392649450334,
-		0.1151917306316258,
-		0.129590696960579,
-		0.1365235326004453,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1943860454408685,
-		0.204785298900668,
-		0.003599741582238305,
-		0.004049709280018093,
-		0.004555922940020355,
-		0.004799655442984406,
-		0.005399612373357457,
-		0.006074563920027139,
-		0.006833884410030531,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.009111845880040709,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01214912784005428,
-		0.01366776882006106,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01822369176008142,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02429825568010856,
-		0.02733553764012213,
-		0.02879793265790644,
-		0.03239767424014475,
-		0.03644738352016284,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04859651136021712,
-		0.05467107528024425,
-		0.05759586531581288,
-		0.06479534848028949,
-		0.07289476704032567,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09719302272043423,
-		0.1093421505604885,
-		0.1151917306316258,
-		0.129590696960579,
-		0.1457895340806513,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1943860454408685,
-		0.218684301120977,
-		0.003599741582238305,
-		0.003792320350012371,
-		0.004266360393763916,
-		0.005056427133349826,
-		0.005399612373357457,
-		0.005688480525018555,
-		0.006399540590645875,
-		0.00719948316447661,
-		0.007584640700024741,
-		0.008532720787527832,
-		0.01011285426669965,
-		0.01079922474671491,
-		0.01137696105003711,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01516928140004948,
-		0.01706544157505566,
-		0.02022570853339931,
-		0.02159844949342983,
-		0.02275392210007422,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03033856280009897,
-		0.03413088315011133,
-		0.04045141706679861,
-		0.04319689898685965,
-		0.04550784420014844,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06067712560019793,
-		0.06826176630022265,
-		0.08090283413359722,
-		0.08639379797371931,
-		0.09101568840029688,
-		0.102392649450334,
-		0.1151917306316258,
-		0.1213542512003959,
-		0.1365235326004453,
-		0.1618056682671944,
-		0.1727875959474386,
-		0.1820313768005938,
-		0.204785298900668,
-		0.003599741582238305,
-		0.004049709280018093,
-		0.004555922940020355,
-		0.004799655442984406,
-		0.005399612373357457,
-		0.006074563920027139,
-		0.006399540590645875,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.009111845880040709,
-		0.009599310885968812,
-		0.01079922474671491,
-		0.01214912784005428,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01822369176008142,
-		0.01919862177193762,
-		0.02159844949342983,
-		0.02429825568010856,
-		0.0255981623625835,
-		0.02879793265790644,
-		0.03239767424014475,
-		0.03644738352016284,
-		0.03839724354387525,
-		0.04319689898685965,
-		0.04859651136021712,
-		0.051196324725167,
-		0.05759586531581288,
-		0.06479534848028949,
-		0.07289476704032567,
-		0.0767944870877505,
-		0.08639379797371931,
-		0.09719302272043423,
-		0.102392649450334,
-		0.1151917306316258,
-		0.129590696960579,
-		0.1457895340806513,
-		0.153588974175501,
-		0.1727875959474386,
-		0.1943860454408685,
-		0.204785298900668,
-		0.003599741582238305,
-		0.004049709280018093,
-		0.004555922940020355,
-		0.005056427133349826,
-		0.005399612373357457,
-		0.005688480525018555,
-		0.006399540590645875,
-		0.00719948316447661,
-		0.008099418560036186,
-		0.009111845880040709,
-		0.01011285426669965,
-		0.01079922474671491,
-		0.01137696105003711,
-		0.01279908118129175,
-		0.01439896632895322,
-		0.01619883712007237,
-		0.01822369176008142,
-		0.02022570853339931,
-		0.02159844949342983,
-		0.02275392210007422,
-		0.0255981623625835
-	},
-	.c_bpre4800022 = {
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.003785139443210433, 0.9962148605567909, -1.996157442904828 },
-		{ 0.004257273372562218, 0.9957427266274392, -1.995670074691522 },
-		{ 0.004788153331530846, 0.9952118466684768, -1.995119921294878 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.005672333040346987, 0.9943276669596555, -1.994198600150314 },
-		{ 0.006379108587388924, 0.9936208914126137, -1.993457599590032 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.00755596459710658, 0.9924440354031242, -1.992214801145795 },
-		{ 0.008496396411598783, 0.9915036035889498, -1.991213620177953 },
-		{ 0.009553406180946982, 0.9904465938194478, -1.990079776972387 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01131247777675677, 0.9886875222233206, -1.988172732880796 },
-		{ 0.01271754999592279, 0.9872824500046028, -1.986631383370363 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01505483659322236, 0.9849451634072374, -1.984031729961584 },
-		{ 0.01692066841265467, 0.9830793315874795, -1.98192437981991 },
-		{ 0.01901548058636593, 0.9809845194138307, -1.979524371551896 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.0224969834000645, 0.9775030166000891, -1.975455705079264 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.02988296158669045, 0.9701170384133195, -1.966491449145213 },
-		{ 0.03355496455206538, 0.9664450354481633, -1.961865331416006 },
-		{ 0.03766943565490317, 0.962330564345194, -1.956547083390605 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04448791507594231, 0.9555120849241522, -1.947418076565975 },
-		{ 0.04990786053561373, 0.9500921394644185, -1.939878442229646 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.05887293178019017, 0.9411270682198296, -1.926851259030487 },
-		{ 0.06598387119944465, 0.9340161288048191, -1.916020459417925 },
-		{ 0.07391964248459894, 0.9260803575201788, -1.903407402818902 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.08699677507840903, 0.9130032249242496, -1.881396436895366 },
-		{ 0.09732469021440632, 0.9026753097918885, -1.862918502695245 },
-		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
-		{ 0.1142800733484093, 0.885719926655087, -1.830450382103676 },
-		{ 0.1276144421115654, 0.8723855578923411, -1.803020285525327 },
-		{ 0.142375732731559, 0.8576242672707481, -1.770669870747374 },
-		{ 0.1586837051417145, 0.8413162948582856, -1.732459091390878 },
-		{ 0.1664245657078643, 0.833575434295747, -1.713399440710146 },
-		{ 0.1851778183923515, 0.8148221816078368, -1.664721585614433 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004257273372562218, 0.9957427266274392, -1.995670074691522 },
-		{ 0.004788153331530846, 0.9952118466684768, -1.995119921294878 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.006056151058851262, 0.9939438489411488, -1.993796696391784 },
-		{ 0.006379108587388924, 0.9936208914126137, -1.993457599590032 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.008496396411598783, 0.9915036035889498, -1.991213620177953 },
-		{ 0.009553406180946982, 0.9904465938194478, -1.990079776972387 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01207562515205425, 0.9879243748479458, -1.987337563247202 },
-		{ 0.01271754999592279, 0.9872824500046028, -1.986631383370363 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
-		{ 0.01692066841265467, 0.9830793315874795, -1.98192437981991 },
-		{ 0.01901548058636593, 0.9809845194138307, -1.979524371551896 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02400542958129584, 0.9759945704187045, -1.973661754521053 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
-		{ 0.03355496455206538, 0.9664450354481633, -1.961865331416006 },
-		{ 0.03766943565490317, 0.962330564345194, -1.956547083390605 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04743459851320932, 0.9525654014867908, -1.943350220583601 },
-		{ 0.04990786053561373, 0.9500921394644185, -1.939878442229646 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
-		{ 0.06598387119944465, 0.9340161288048191, -1.916020459417925 },
-		{ 0.07391964248459894, 0.9260803575201788, -1.903407402818902 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.09261915589030885, 0.9073808441096913, -1.871458088735904 },
-		{ 0.09732469021440632, 0.9026753097918885, -1.862918502695245 },
-		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
-		{ 0.12154508838741, 0.8784549116125902, -1.815714709197418 },
-		{ 0.1276144421115654, 0.8723855578923411, -1.803020285525327 },
-		{ 0.142375732731559, 0.8576242672707481, -1.770669870747374 },
-		{ 0.1586837051417145, 0.8413162948582856, -1.732459091390878 },
-		{ 0.1766600037427842, 0.823339996257216, -1.68727361241319 },
-		{ 0.1851778183923515, 0.8148221816078368, -1.664721585614433 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004545562094766653, 0.9954544379052381, -1.995371601382848 },
-		{ 0.004788153331530846, 0.9952118466684768, -1.995119921294878 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.006056151058851262, 0.9939438489411488, -1.993796696391784 },
-		{ 0.006810582461126179, 0.9931894175388931, -1.993003248890746 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.009070475026237656, 0.9909295249739962, -1.990598936160337 },
-		{ 0.009553406180946982, 0.9904465938194478, -1.990079776972387 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01207562515205425, 0.9879243748479458, -1.987337563247202 },
-		{ 0.01357478088879262, 0.9864252191112461, -1.985683106346936 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
-		{ 0.01805867653527547, 0.9819413234651904, -1.980625047374303 },
-		{ 0.01901548058636593, 0.9809845194138307, -1.979524371551896 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02400542958129584, 0.9759945704187045, -1.973661754521053 },
-		{ 0.02696528710140779, 0.9730347128986694, -1.970086822947743 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
-		{ 0.03579117416411229, 0.9642088258358876, -1.958992579995535 },
-		{ 0.03766943565490317, 0.962330564345194, -1.956547083390605 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04743459851320932, 0.9525654014867908, -1.943350220583601 },
-		{ 0.05320344749435627, 0.9467965525057962, -1.935170492993256 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
-		{ 0.07030134018017865, 0.9296986598198212, -1.909227482029392 },
-		{ 0.07391964248459894, 0.9260803575201788, -1.903407402818902 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.09261915589030885, 0.9073808441096913, -1.871458088735904 },
-		{ 0.103576053487366, 0.8964239465200707, -1.851258469244699 },
-		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
-		{ 0.12154508838741, 0.8784549116125902, -1.815714709197418 },
-		{ 0.1356604019292287, 0.8643395980707717, -1.78564795453379 },
-		{ 0.142375732731559, 0.8576242672707481, -1.770669870747374 },
-		{ 0.1586837051417145, 0.8413162948582856, -1.732459091390878 },
-		{ 0.1766600037427842, 0.823339996257216, -1.68727361241319 },
-		{ 0.1964246340444011, 0.8035753659555991, -1.633803636708615 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.003785139443210433, 0.9962148605567909, -1.996157442904828 },
-		{ 0.004257273372562218, 0.9957427266274392, -1.995670074691522 },
-		{ 0.005043663897860815, 0.994956336102141, -1.994854325099077 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.005672333040346987, 0.9943276669596555, -1.994198600150314 },
-		{ 0.006379108587388924, 0.9936208914126137, -1.993457599590032 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.00755596459710658, 0.9924440354031242, -1.992214801145795 },
-		{ 0.008496396411598783, 0.9915036035889498, -1.991213620177953 },
-		{ 0.01006188925020659, 0.9899381107497967, -1.989531103560697 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01131247777675677, 0.9886875222233206, -1.988172732880796 },
-		{ 0.01271754999592279, 0.9872824500046028, -1.986631383370363 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01505483659322236, 0.9849451634072374, -1.984031729961584 },
-		{ 0.01692066841265467, 0.9830793315874795, -1.98192437981991 },
-		{ 0.02002253688513037, 0.9799774631148763, -1.978357749125685 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.0224969834000645, 0.9775030166000891, -1.975455705079264 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.02988296158669045, 0.9701170384133195, -1.966491449145213 },
-		{ 0.03355496455206538, 0.9664450354481633, -1.961865331416006 },
-		{ 0.03964417178694395, 0.9603558282130693, -1.953943801650932 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04448791507594231, 0.9555120849241522, -1.947418076565975 },
-		{ 0.04990786053561373, 0.9500921394644185, -1.939878442229646 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.05887293178019017, 0.9411270682198296, -1.926851259030487 },
-		{ 0.06598387119944465, 0.9340161288048191, -1.916020459417925 },
-		{ 0.0777164417713171, 0.9222835582360495, -1.897174859521674 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.08699677507840903, 0.9130032249242496, -1.881396436895366 },
-		{ 0.09732469021440632, 0.9026753097918885, -1.862918502695245 },
-		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
-		{ 0.1142800733484093, 0.885719926655087, -1.830450382103676 },
-		{ 0.1276144421115654, 0.8723855578923411, -1.803020285525327 },
-		{ 0.1493935949286631, 0.8506064050717757, -1.75454727961115 },
-		{ 0.1586837051417145, 0.8413162948582856, -1.732459091390878 },
-		{ 0.1664245657078643, 0.833575434295747, -1.713399440710146 },
-		{ 0.1851778183923515, 0.8148221816078368, -1.664721585614433 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004545562094766653, 0.9954544379052381, -1.995371601382848 },
-		{ 0.004788153331530846, 0.9952118466684768, -1.995119921294878 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.006056151058851262, 0.9939438489411488, -1.993796696391784 },
-		{ 0.006379108587388924, 0.9936208914126137, -1.993457599590032 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.009070475026237656, 0.9909295249739962, -1.990598936160337 },
-		{ 0.009553406180946982, 0.9904465938194478, -1.990079776972387 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01207562515205425, 0.9879243748479458, -1.987337563247202 },
-		{ 0.01271754999592279, 0.9872824500046028, -1.986631383370363 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
-		{ 0.01805867653527547, 0.9819413234651904, -1.980625047374303 },
-		{ 0.01901548058636593, 0.9809845194138307, -1.979524371551896 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02400542958129584, 0.9759945704187045, -1.973661754521053 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
-		{ 0.03579117416411229, 0.9642088258358876, -1.958992579995535 },
-		{ 0.03766943565490317, 0.962330564345194, -1.956547083390605 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04743459851320932, 0.9525654014867908, -1.943350220583601 },
-		{ 0.04990786053561373, 0.9500921394644185, -1.939878442229646 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
-		{ 0.07030134018017865, 0.9296986598198212, -1.909227482029392 },
-		{ 0.07391964248459894, 0.9260803575201788, -1.903407402818902 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.09261915589030885, 0.9073808441096913, -1.871458088735904 },
-		{ 0.09732469021440632, 0.9026753097918885, -1.862918502695245 },
-		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
-		{ 0.12154508838741, 0.8784549116125902, -1.815714709197418 },
-		{ 0.1356604019292287, 0.8643395980707717, -1.78564795453379 },
-		{ 0.142375732731559, 0.8576242672707481, -1.770669870747374 },
-		{ 0.1586837051417145, 0.8413162948582856, -1.732459091390878 },
-		{ 0.1766600037427842, 0.823339996257216, -1.68727361241319 },
-		{ 0.1851778183923515, 0.8148221816078368, -1.664721585614433 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004545562094766653, 0.9954544379052381, -1.995371601382848 },
-		{ 0.005043663897860815, 0.994956336102141, -1.994854325099077 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.005672333040346987, 0.9943276669596555, -1.994198600150314 },
-		{ 0.006379108587388924, 0.9936208914126137, -1.993457599590032 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.009070475026237656, 0.9909295249739962, -1.990598936160337 },
-		{ 0.01006188925020659, 0.9899381107497967, -1.989531103560697 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01131247777675677, 0.9886875222233206, -1.988172732880796 },
-		{ 0.01271754999592279, 0.9872824500046028, -1.986631383370363 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
-		{ 0.01805867653527547, 0.9819413234651904, -1.980625047374303 },
-		{ 0.02002253688513037, 0.9799774631148763, -1.978357749125685 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.0224969834000645, 0.9775030166000891, -1.975455705079264 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 }
-	},
-	.c_bpre9600022 = {
-		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
-		{ 0.001894364029142847, 0.998105635970858, -1.998091267909992 },
-		{ 0.002130907068749297, 0.9978690929312517, -1.997850910512763 },
-		{ 0.002396949348856373, 0.9976030506511477, -1.997580041632756 },
-		{ 0.002696164987537499, 0.9973038350124629, -1.997274718573865 },
-		{ 0.002840199887875145, 0.997159800112126, -1.997127487326634 },
-		{ 0.003194657211042624, 0.9968053427889586, -1.996764454207334 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.003785145963535972, 0.9962148540365796, -1.99615743618662 },
-		{ 0.004257260338593788, 0.995742739661681, -1.995670088171102 },
-		{ 0.004788166359014112, 0.9952118336411838, -1.995119907766779 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.005672326532523983, 0.9943276734675146, -1.994198606954751 },
-		{ 0.006379121594116482, 0.9936208784061468, -1.993457585916623 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.00755596459710658, 0.9924440354031242, -1.992214801145795 },
-		{ 0.00849642885799624, 0.991503571142071, -1.991213585511545 },
-		{ 0.009553373768361585, 0.9904466262317374, -1.990079811879652 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01131247777675677, 0.9886875222233206, -1.988172732880796 },
-		{ 0.01271751768666245, 0.9872824823133458, -1.986631418997666 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01505480436051219, 0.9849451956394931, -1.984031766119855 },
-		{ 0.01692063624143919, 0.983079363758676, -1.981924416401438 },
-		{ 0.01901551268886128, 0.9809844873111879, -1.979524334495679 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02249701538867002, 0.977502984611378, -1.975455667235661 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.02988296158669045, 0.9701170384133195, -1.966491449145213 },
-		{ 0.03355490130032189, 0.9664450987018453, -1.961865412079713 },
-		{ 0.03766930968845377, 0.9623306903139788, -1.956547248401521 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04448797761532368, 0.9555120223860344, -1.947417991021247 },
-		{ 0.04990773617202676, 0.9500922638311968, -1.939878618127667 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.05887305497520531, 0.9411269450265926, -1.926851075224001 },
-		{ 0.06598417685320968, 0.9340158231488058, -1.916019984328905 },
-		{ 0.07391994554005429, 0.9260800544611401, -1.90340691047097 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.08699647629797491, 0.9130035237039048, -1.881396957396878 },
-		{ 0.09732498560796611, 0.9026750143921323, -1.862917960230873 },
-		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
-		{ 0.002022806004815553, 0.9979771939951846, -1.997960810459479 },
-		{ 0.002130907068749297, 0.9978690929312517, -1.997850910512763 },
-		{ 0.002396949348856373, 0.9976030506511477, -1.997580041632756 },
-		{ 0.002696164987537499, 0.9973038350124629, -1.997274718573865 },
-		{ 0.003032674085479701, 0.9969673259145202, -1.996930481654331 },
-		{ 0.003194657211042624, 0.9968053427889586, -1.996764454207334 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004257260338593788, 0.995742739661681, -1.995670088171102 },
-		{ 0.004788166359014112, 0.9952118336411838, -1.995119907766779 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.006056151058851262, 0.9939438489411488, -1.993796696391784 },
-		{ 0.006379121594116482, 0.9936208784061468, -1.993457585916623 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.00849642885799624, 0.991503571142071, -1.991213585511545 },
-		{ 0.009553373768361585, 0.9904466262317374, -1.990079811879652 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01207562515205425, 0.9879243748479458, -1.987337563247202 },
-		{ 0.01271751768666245, 0.9872824823133458, -1.986631418997666 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
-		{ 0.01692063624143919, 0.983079363758676, -1.981924416401438 },
-		{ 0.01901551268886128, 0.9809844873111879, -1.979524334495679 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02400542958129584, 0.9759945704187045, -1.973661754521053 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
-		{ 0.03355490130032189, 0.9664450987018453, -1.961865412079713 },
-		{ 0.03766930968845377, 0.9623306903139788, -1.956547248401521 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04743459851320932, 0.9525654014867908, -1.943350220583601 },
-		{ 0.04990773617202676, 0.9500922638311968, -1.939878618127667 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
-		{ 0.06598417685320968, 0.9340158231488058, -1.916019984328905 },
-		{ 0.07391994554005429, 0.9260800544611401, -1.90340691047097 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.09261915589030885, 0.9073808441096913, -1.871458088735904 },
-		{ 0.09732498560796611, 0.9026750143921323, -1.862917960230873 },
-		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
-		{ 0.002022806004815553, 0.9979771939951846, -1.997960810459479 },
-		{ 0.002275369701021279, 0.9977246302989812, -1.997703897500396 },
-		{ 0.002396949348856373, 0.9976030506511477, -1.997580041632756 },
-		{ 0.002696164987537499, 0.9973038350124629, -1.997274718573865 },
-		{ 0.003032674085479701, 0.9969673259145202, -1.996930481654331 },
-		{ 0.003411109063083152, 0.9965888909369266, -1.996542268850824 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004545568610112844, 0.9954544313900043, -1.99537159462988 },
-		{ 0.004788166359014112, 0.9952118336411838, -1.995119907766779 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.006056151058851262, 0.9939438489411488, -1.993796696391784 },
-		{ 0.006810582461126179, 0.9931894175388931, -1.993003248890746 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.009070475026237656, 0.9909295249739962, -1.990598936160337 },
-		{ 0.009553373768361585, 0.9904466262317374, -1.990079811879652 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01207562515205425, 0.9879243748479458, -1.987337563247202 },
-		{ 0.01357478088879262, 0.9864252191112461, -1.985683106346936 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
-		{ 0.01805864440085433, 0.9819413555991456, -1.980625084213728 },
-		{ 0.01901551268886128, 0.9809844873111879, -1.979524334495679 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02400542958129584, 0.9759945704187045, -1.973661754521053 },
-		{ 0.02696528710140779, 0.9730347128986694, -1.970086822947743 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
-		{ 0.03579117416411229, 0.9642088258358876, -1.958992579995535 },
-		{ 0.03766930968845377, 0.9623306903139788, -1.956547248401521 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04743459851320932, 0.9525654014867908, -1.943350220583601 },
-		{ 0.05320332356263128, 0.9467966764411831, -1.935170671805952 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
-		{ 0.07030134018017865, 0.9296986598198212, -1.909227482029392 },
-		{ 0.07391994554005429, 0.9260800544611401, -1.90340691047097 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.09261915589030885, 0.9073808441096913, -1.871458088735904 },
-		{ 0.1035763468339319, 0.8964236531660681, -1.851257913601676 },
-		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
-		{ 0.001894364029142847, 0.998105635970858, -1.998091267909992 },
-		{ 0.002130907068749297, 0.9978690929312517, -1.997850910512763 },
-		{ 0.002525019811454708, 0.9974749801885464, -1.997449445077191 },
-		{ 0.002696164987537499, 0.9973038350124629, -1.997274718573865 },
-		{ 0.002840199887875145, 0.997159800112126, -1.997127487326634 },
-		{ 0.003194657211042624, 0.9968053427889586, -1.996764454207334 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.003785145963535972, 0.9962148540365796, -1.99615743618662 },
-		{ 0.004257260338593788, 0.995742739661681, -1.995670088171102 },
-		{ 0.005043663897860815, 0.994956336102141, -1.994854325099077 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.005672326532523983, 0.9943276734675146, -1.994198606954751 },
-		{ 0.006379121594116482, 0.9936208784061468, -1.993457585916623 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.00755596459710658, 0.9924440354031242, -1.992214801145795 },
-		{ 0.00849642885799624, 0.991503571142071, -1.991213585511545 },
-		{ 0.01006188925020659, 0.9899381107497967, -1.989531103560697 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01131247777675677, 0.9886875222233206, -1.988172732880796 },
-		{ 0.01271751768666245, 0.9872824823133458, -1.986631418997666 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01505480436051219, 0.9849451956394931, -1.984031766119855 },
-		{ 0.01692063624143919, 0.983079363758676, -1.981924416401438 },
-		{ 0.02002253688513037, 0.9799774631148763, -1.978357749125685 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02249701538867002, 0.977502984611378, -1.975455667235661 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.02988296158669045, 0.9701170384133195, -1.966491449145213 },
-		{ 0.03355490130032189, 0.9664450987018453, -1.961865412079713 },
-		{ 0.03964404608039351, 0.9603559539233613, -1.953943968425716 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04448797761532368, 0.9555120223860344, -1.947417991021247 },
-		{ 0.04990773617202676, 0.9500922638311968, -1.939878618127667 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.05887305497520531, 0.9411269450265926, -1.926851075224001 },
-		{ 0.06598417685320968, 0.9340158231488058, -1.916019984328905 },
-		{ 0.07771674358071755, 0.92228325641951, -1.897174358961363 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.08699647629797491, 0.9130035237039048, -1.881396957396878 },
-		{ 0.09732498560796611, 0.9026750143921323, -1.862917960230873 },
-		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
-		{ 0.002022806004815553, 0.9979771939951846, -1.997960810459479 },
-		{ 0.002275369701021279, 0.9977246302989812, -1.997703897500396 },
-		{ 0.002396949348856373, 0.9976030506511477, -1.997580041632756 },
-		{ 0.002696164987537499, 0.9973038350124629, -1.997274718573865 },
-		{ 0.003032674085479701, 0.9969673259145202, -1.996930481654331 },
-		{ 0.003194657211042624, 0.9968053427889586, -1.996764454207334 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004545568610112844, 0.9954544313900043, -1.99537159462988 },
-		{ 0.004788166359014112, 0.9952118336411838, -1.995119907766779 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.006056151058851262, 0.9939438489411488, -1.993796696391784 },
-		{ 0.006379121594116482, 0.9936208784061468, -1.993457585916623 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.009070475026237656, 0.9909295249739962, -1.990598936160337 },
-		{ 0.009553373768361585, 0.9904466262317374, -1.990079811879652 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01207562515205425, 0.9879243748479458, -1.987337563247202 },
-		{ 0.01271751768666245, 0.9872824823133458, -1.986631418997666 },
-		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
-		{ 0.01606834153378098, 0.9839316584662189, -1.982890572976223 },
-		{ 0.01805864440085433, 0.9819413555991456, -1.980625084213728 },
-		{ 0.01901551268886128, 0.9809844873111879, -1.979524334495679 },
-		{ 0.02136687320919831, 0.9786331267908015, -1.976787376739774 },
-		{ 0.02400542958129584, 0.9759945704187045, -1.973661754521053 },
-		{ 0.02527330011721411, 0.9747266998828022, -1.972139324365628 },
-		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
-		{ 0.03187849146791616, 0.9681215085320839, -1.963991436560069 },
-		{ 0.03579117416411229, 0.9642088258358876, -1.958992579995535 },
-		{ 0.03766930968845377, 0.9623306903139788, -1.956547248401521 },
-		{ 0.0422772031476592, 0.9577227968523411, -1.950421227888948 },
-		{ 0.04743459851320932, 0.9525654014867908, -1.943350220583601 },
-		{ 0.04990773617202676, 0.9500922638311968, -1.939878618127667 },
-		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
-		{ 0.06274074471756194, 0.9372592552824381, -1.921015085172948 },
-		{ 0.07030134018017865, 0.9296986598198212, -1.909227482029392 },
-		{ 0.07391994554005429, 0.9260800544611401, -1.90340691047097 },
-		{ 0.08276704438933002, 0.9172329556106702, -1.888684064984612 },
-		{ 0.09261915589030885, 0.9073808441096913, -1.871458088735904 },
-		{ 0.09732498560796611, 0.9026750143921323, -1.862917960230873 },
-		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
-		{ 0.002022806004815553, 0.9979771939951846, -1.997960810459479 },
-		{ 0.002275369701021279, 0.9977246302989812, -1.997703897500396 },
-		{ 0.002525019811454708, 0.9974749801885464, -1.997449445077191 },
-		{ 0.002696164987537499, 0.9973038350124629, -1.997274718573865 },
-		{ 0.002840199887875145, 0.997159800112126, -1.997127487326634 },
-		{ 0.003194657211042624, 0.9968053427889586, -1.996764454207334 },
-		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
-		{ 0.004041520265497645, 0.9959584797345027, -1.995893012074424 },
-		{ 0.004545568610112844, 0.9954544313900043, -1.99537159462988 },
-		{ 0.005043663897860815, 0.994956336102141, -1.994854325099077 },
-		{ 0.005385060669434083, 0.994614939330566, -1.994498631217451 },
-		{ 0.005672326532523983, 0.9943276734675146, -1.994198606954751 },
-		{ 0.006379121594116482, 0.9936208784061468, -1.993457585916623 },
-		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
-		{ 0.008066706644938713, 0.9919332933550614, -1.991671955107035 },
-		{ 0.009070475026237656, 0.9909295249739962, -1.990598936160337 },
-		{ 0.01006188925020659, 0.9899381107497967, -1.989531103560697 },
-		{ 0.01074112246045445, 0.9892588775395452, -1.988794907885348 },
-		{ 0.01131247777675677, 0.9886875222233206, -1.988172732880796 },
-		{ 0.01271751768666245, 0.9872824823133458, -1.986631418997666 }
-	},
-	.c_bpre4800080040 = {
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0001896151742683226, 0.9999905192419131, -1.999932992989691 },
-		{ 0.0002133169446642636, 0.999989334153472, -1.999916527626355 },
-		{ 0.0002399812867393574, 0.9999880009388361, -1.999895855513535 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0002844220872834296, 0.9999857788965761, -1.999856345911473 },
-		{ 0.0003199745637836096, 0.9999840012728682, -1.999820188266041 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0003792310319697918, 0.9999810385409862, -1.999750937137926 },
-		{ 0.0004266346842726455, 0.9999786684861528, -1.999687451018525 },
-		{ 0.0004799640492603023, 0.9999760019562013, -1.999607428946764 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.0005688400583775125, 0.9999715580281161, -1.999453847713199 },
-		{ 0.0006399495060596978, 0.9999680027362481, -1.999312780104918 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0007584548731737433, 0.9999620774415093, -1.999041733501957 },
-		{ 0.0008532558053586712, 0.9999573372637216, -1.998792555691494 },
-		{ 0.0009599085481210023, 0.9999520046519251, -1.998477876199637 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.00113766393781931, 0.9999431168651782, -1.997872573078466 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001516870385924143, 0.9999241564847515, -1.99624371343638 },
-		{ 0.001706471638794077, 0.9999146765111627, -1.995257024177654 },
-		{ 0.001919771917388401, 0.9999040114437951, -1.994009792105015 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002275264723337204, 0.9998862368024414, -1.991608560565579 },
-		{ 0.002559651964066521, 0.9998720174150179, -1.989397595780526 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003033625727061981, 0.9998483187217421, -1.985140650443612 },
-		{ 0.003412822663662681, 0.9998293606296168, -1.981221311053711 },
-		{ 0.003839384547250172, 0.9998080327557659, -1.976267188906372 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004550297822585234, 0.999772486219773, -1.966732089709286 },
-		{ 0.005119015603549683, 0.9997440518639089, -1.95795897266415 },
-		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
-		{ 0.006066833695041764, 0.9996966597963945, -1.941086511990143 },
-		{ 0.006825058498347428, 0.9996587487413409, -1.925578454134266 },
-		{ 0.007678005282721558, 0.9996161007273368, -1.906015142564786 },
-		{ 0.008637514093946978, 0.9995681242953028, -1.881355194363324 },
-		{ 0.009099514667089447, 0.9995450258375682, -1.868491072071367 },
-		{ 0.01023664961520369, 0.9994881676018577, -1.834114188441347 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002133169446642636, 0.999989334153472, -1.999916527626355 },
-		{ 0.0002399812867393574, 0.9999880009388361, -1.999895855513535 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0003037258897424666, 0.9999848137055128, -1.999837215334487 },
-		{ 0.0003199745637836096, 0.9999840012728682, -1.999820188266041 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.0004266346842726455, 0.9999786684861528, -1.999687451018525 },
-		{ 0.0004799640492603023, 0.9999760019562013, -1.999607428946764 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.000607447167015203, 0.9999696276416493, -1.999379260425735 },
-		{ 0.0006399495060596978, 0.9999680027362481, -1.999312780104918 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
-		{ 0.0008532558053586712, 0.9999573372637216, -1.998792555691494 },
-		{ 0.0009599085481210023, 0.9999520046519251, -1.998477876199637 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001214875884426336, 0.9999392562057787, -1.997578171736715 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
-		{ 0.001706471638794077, 0.9999146765111627, -1.995257024177654 },
-		{ 0.001919771917388401, 0.9999040114437951, -1.994009792105015 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002429677972684225, 0.999878516101366, -1.990440039778731 },
-		{ 0.002559651964066521, 0.9998720174150179, -1.989397595780526 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
-		{ 0.003412822663662681, 0.9998293606296168, -1.981221311053711 },
-		{ 0.003839384547250172, 0.9998080327557659, -1.976267188906372 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004859060778610685, 0.9997570469610695, -1.962094519612651 },
-		{ 0.005119015603549683, 0.9997440518639089, -1.95795897266415 },
-		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
-		{ 0.006478485352071997, 0.9996760757323964, -1.932887098803703 },
-		{ 0.006825058498347428, 0.9996587487413409, -1.925578454134266 },
-		{ 0.007678005282721558, 0.9996161007273368, -1.906015142564786 },
-		{ 0.008637514093946978, 0.9995681242953028, -1.881355194363324 },
-		{ 0.009716941033628648, 0.9995141529483185, -1.850300807769434 },
-		{ 0.01023664961520369, 0.9994881676018577, -1.834114188441347 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002277949691518616, 0.999988610253423, -1.999905585505701 },
-		{ 0.0002399812867393574, 0.9999880009388361, -1.999895855513535 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0003037258897424666, 0.9999848137055128, -1.999837215334487 },
-		{ 0.0003416912538231586, 0.9999829154451443, -1.999796112268077 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.0004555898034985317, 0.9999772206038481, -1.999645129443198 },
-		{ 0.0004799640492603023, 0.9999760019562013, -1.999607428946764 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.000607447167015203, 0.9999696276416493, -1.999379260425735 },
-		{ 0.0006833766700059486, 0.9999658311821702, -1.99921865975217 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
-		{ 0.0009111692289442268, 0.9999544417265972, -1.998626202498037 },
-		{ 0.0009599085481210023, 0.9999520046519251, -1.998477876199637 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001214875884426336, 0.9999392562057787, -1.997578171736715 },
-		{ 0.001366729989829533, 0.9999316635318487, -1.996943587136049 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
-		{ 0.001822286152793263, 0.9999088856923602, -1.994597833085009 },
-		{ 0.001919771917388401, 0.9999040114437951, -1.994009792105015 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002429677972684225, 0.999878516101366, -1.990440039778731 },
-		{ 0.002733366582166045, 0.9998633317335703, -1.98792036312615 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
-		{ 0.003644406269246342, 0.9998177796865375, -1.978602744318658 },
-		{ 0.003839384547250172, 0.9998080327557659, -1.976267188906372 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004859060778610685, 0.9997570469610695, -1.962094519612651 },
-		{ 0.005466406680556915, 0.999726682799675, -1.952100934234069 },
-		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
-		{ 0.006478485352071997, 0.9996760757323964, -1.932887098803703 },
-		{ 0.007288148453647865, 0.9996355925773179, -1.915233259751488 },
-		{ 0.007678005282721558, 0.9996161007273368, -1.906015142564786 },
-		{ 0.008637514093946978, 0.9995681242953028, -1.881355194363324 },
-		{ 0.009716941033628648, 0.9995141529483185, -1.850300807769434 },
-		{ 0.01093122667419536, 0.9994534386662904, -1.811243578275249 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0001896151742683226, 0.9999905192419131, -1.999932992989691 },
-		{ 0.0002133169446642636, 0.999989334153472, -1.999916527626355 },
-		{ 0.0002528197205832004, 0.9999873590146456, -1.99988509075297 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0002844220872834296, 0.9999857788965761, -1.999856345911473 },
-		{ 0.0003199745637836096, 0.9999840012728682, -1.999820188266041 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0003792310319697918, 0.9999810385409862, -1.999750937137926 },
-		{ 0.0004266346842726455, 0.9999786684861528, -1.999687451018525 },
-		{ 0.0005056362452646549, 0.999974718189086, -1.999565658186709 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.0005688400583775125, 0.9999715580281161, -1.999453847713199 },
-		{ 0.0006399495060596978, 0.9999680027362481, -1.999312780104918 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0007584548731737433, 0.9999620774415093, -1.999041733501957 },
-		{ 0.0008532558053586712, 0.9999573372637216, -1.998792555691494 },
-		{ 0.001011259707132726, 0.9999494370173418, -1.998313385021214 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.00113766393781931, 0.9999431168651782, -1.997872573078466 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001516870385924143, 0.9999241564847515, -1.99624371343638 },
-		{ 0.001706471638794077, 0.9999146765111627, -1.995257024177654 },
-		{ 0.002022468281954464, 0.9998988765912992, -1.993357510716077 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002275264723337204, 0.9998862368024414, -1.991608560565579 },
-		{ 0.002559651964066521, 0.9998720174150179, -1.989397595780526 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003033625727061981, 0.9998483187217421, -1.985140650443612 },
-		{ 0.003412822663662681, 0.9998293606296168, -1.981221311053711 },
-		{ 0.004044780012794548, 0.9997977640629079, -1.973676581611369 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004550297822585234, 0.999772486219773, -1.966732089709286 },
-		{ 0.005119015603549683, 0.9997440518639089, -1.95795897266415 },
-		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
-		{ 0.006066833695041764, 0.9996966597963945, -1.941086511990143 },
-		{ 0.006825058498347428, 0.9996587487413409, -1.925578454134266 },
-		{ 0.008088655995041187, 0.9995955673896058, -1.895802885730205 },
-		{ 0.008637514093946978, 0.9995681242953028, -1.881355194363324 },
-		{ 0.009099514667089447, 0.9995450258375682, -1.868491072071367 },
-		{ 0.01023664961520369, 0.9994881676018577, -1.834114188441347 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002277949691518616, 0.999988610253423, -1.999905585505701 },
-		{ 0.0002399812867393574, 0.9999880009388361, -1.999895855513535 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0003037258897424666, 0.9999848137055128, -1.999837215334487 },
-		{ 0.0003199745637836096, 0.9999840012728682, -1.999820188266041 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.0004555898034985317, 0.9999772206038481, -1.999645129443198 },
-		{ 0.0004799640492603023, 0.9999760019562013, -1.999607428946764 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.000607447167015203, 0.9999696276416493, -1.999379260425735 },
-		{ 0.0006399495060596978, 0.9999680027362481, -1.999312780104918 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
-		{ 0.0009111692289442268, 0.9999544417265972, -1.998626202498037 },
-		{ 0.0009599085481210023, 0.9999520046519251, -1.998477876199637 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001214875884426336, 0.9999392562057787, -1.997578171736715 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
-		{ 0.001822286152793263, 0.9999088856923602, -1.994597833085009 },
-		{ 0.001919771917388401, 0.9999040114437951, -1.994009792105015 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002429677972684225, 0.999878516101366, -1.990440039778731 },
-		{ 0.002559651964066521, 0.9998720174150179, -1.989397595780526 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
-		{ 0.003644406269246342, 0.9998177796865375, -1.978602744318658 },
-		{ 0.003839384547250172, 0.9998080327557659, -1.976267188906372 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004859060778610685, 0.9997570469610695, -1.962094519612651 },
-		{ 0.005119015603549683, 0.9997440518639089, -1.95795897266415 },
-		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
-		{ 0.006478485352071997, 0.9996760757323964, -1.932887098803703 },
-		{ 0.007288148453647865, 0.9996355925773179, -1.915233259751488 },
-		{ 0.007678005282721558, 0.9996161007273368, -1.906015142564786 },
-		{ 0.008637514093946978, 0.9995681242953028, -1.881355194363324 },
-		{ 0.009716941033628648, 0.9995141529483185, -1.850300807769434 },
-		{ 0.01023664961520369, 0.9994881676018577, -1.834114188441347 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002277949691518616, 0.999988610253423, -1.999905585505701 },
-		{ 0.0002528197205832004, 0.9999873590146456, -1.99988509075297 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0002844220872834296, 0.9999857788965761, -1.999856345911473 },
-		{ 0.0003199745637836096, 0.9999840012728682, -1.999820188266041 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.0004555898034985317, 0.9999772206038481, -1.999645129443198 },
-		{ 0.0005056362452646549, 0.999974718189086, -1.999565658186709 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.0005688400583775125, 0.9999715580281161, -1.999453847713199 },
-		{ 0.0006399495060596978, 0.9999680027362481, -1.999312780104918 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
-		{ 0.0009111692289442268, 0.9999544417265972, -1.998626202498037 },
-		{ 0.001011259707132726, 0.9999494370173418, -1.998313385021214 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.00113766393781931, 0.9999431168651782, -1.997872573078466 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 }
-	},
-	.c_bpre9600080040 = {
-		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
-		{ 9.480781185426562e-05, 0.9999952596097209, -1.99998087796087 },
-		{ 0.0001066587567350699, 0.9999946670625159, -1.999976465299376 },
-		{ 0.0001199910033242581, 0.9999940004514205, -1.99997096389332 },
-		{ 0.0001349898537795897, 0.9999932505073114, -1.99996409486276 },
-		{ 0.000142211549238112, 0.9999928894230079, -1.999960530799918 },
-		{ 0.0001599879217992652, 0.9999920006044388, -1.999951046769626 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0001896164148379667, 0.9999905192255504, -1.999932992774766 },
-		{ 0.0002133184797360726, 0.9999893341861967, -1.999916528105842 },
-		{ 0.0002399834644153351, 0.9999880009061117, -1.999895854978204 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0002844220515832632, 0.9999857789129386, -1.999856346225674 },
-		{ 0.0003199773126472717, 0.9999840012401439, -1.999820187563184 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0003792310319697918, 0.9999810385409862, -1.999750937137926 },
-		{ 0.000426632453053572, 0.9999786684043422, -1.999687448702999 },
-		{ 0.0004799600330901287, 0.9999760020380116, -1.99960743154147 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.0005688400583775125, 0.9999715580281161, -1.999453847713199 },
-		{ 0.0006399437049567411, 0.9999680028180579, -1.999312783537076 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0007584495741029295, 0.9999620775233189, -1.999041737554357 },
-		{ 0.0008532540204346675, 0.9999573373455304, -1.998792560240015 },
-		{ 0.0009599089943266954, 0.9999520045701169, -1.998477871093058 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001137664718684905, 0.9999431167833703, -1.997872567042006 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001516870385924143, 0.9999241564847515, -1.99624371343638 },
-		{ 0.001706484133275549, 0.9999146766747734, -1.995257042197101 },
-		{ 0.001919784411969193, 0.999904011771013, -1.994009832599284 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002275278332943085, 0.9998862366388356, -1.991608536609007 },
-		{ 0.002559671598052096, 0.9998720177422252, -1.989397649621546 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003033646921745968, 0.9998483183945426, -1.98514058673848 },
-		{ 0.003412820431347092, 0.9998293598116335, -1.98122113210436 },
-		{ 0.003839371159686223, 0.9998080319377999, -1.976266987859402 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004550274956820207, 0.9997724870377098, -1.966732327451576 },
-		{ 0.005118979906371279, 0.9997440510459954, -1.957958705704099 },
-		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
-		{ 0.0001012424757538579, 0.9999949378762125, -1.999978537794883 },
-		{ 0.0001066587567350699, 0.9999946670625159, -1.999976465299376 },
-		{ 0.0001199910033242581, 0.9999940004514205, -1.99997096389332 },
-		{ 0.0001349898537795897, 0.9999932505073114, -1.99996409486276 },
-		{ 0.0001518635214315995, 0.9999924068239283, -1.999955506750674 },
-		{ 0.0001599879217992652, 0.9999920006044388, -1.999951046769626 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002133184797360726, 0.9999893341861967, -1.999916528105842 },
-		{ 0.0002399834644153351, 0.9999880009061117, -1.999895854978204 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0003037258897424666, 0.9999848137055128, -1.999837215334487 },
-		{ 0.0003199773126472717, 0.9999840012401439, -1.999820187563184 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.000426632453053572, 0.9999786684043422, -1.999687448702999 },
-		{ 0.0004799600330901287, 0.9999760020380116, -1.99960743154147 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.000607447167015203, 0.9999696276416493, -1.999379260425735 },
-		{ 0.0006399437049567411, 0.9999680028180579, -1.999312783537076 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
-		{ 0.0008532540204346675, 0.9999573373455304, -1.998792560240015 },
-		{ 0.0009599089943266954, 0.9999520045701169, -1.998477871093058 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001214875884426336, 0.9999392562057787, -1.997578171736715 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
-		{ 0.001706484133275549, 0.9999146766747734, -1.995257042197101 },
-		{ 0.001919784411969193, 0.999904011771013, -1.994009832599284 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002429677972684225, 0.999878516101366, -1.990440039778731 },
-		{ 0.002559671598052096, 0.9998720177422252, -1.989397649621546 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
-		{ 0.003412820431347092, 0.9998293598116335, -1.98122113210436 },
-		{ 0.003839371159686223, 0.9998080319377999, -1.976266987859402 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004859060778610685, 0.9997570469610695, -1.962094519612651 },
-		{ 0.005118979906371279, 0.9997440510459954, -1.957958705704099 },
-		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
-		{ 0.0001012424757538579, 0.9999949378762125, -1.999978537794883 },
-		{ 0.0001138978088952892, 0.9999943051104955, -1.999973548756756 },
-		{ 0.0001199910033242581, 0.9999940004514205, -1.99997096389332 },
-		{ 0.0001349898537795897, 0.9999932505073114, -1.99996409486276 },
-		{ 0.0001518635214315995, 0.9999924068239283, -1.999955506750674 },
-		{ 0.0001708463566220504, 0.9999914576860865, -1.999944756147092 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002277961990159206, 0.9999886102370609, -1.999905585250797 },
-		{ 0.0002399834644153351, 0.9999880009061117, -1.999895854978204 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0003037258897424666, 0.9999848137055128, -1.999837215334487 },
-		{ 0.0003416912538231586, 0.9999829154451443, -1.999796112268077 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.0004555898034985317, 0.9999772206038481, -1.999645129443198 },
-		{ 0.0004799600330901287, 0.9999760020380116, -1.99960743154147 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.000607447167015203, 0.9999696276416493, -1.999379260425735 },
-		{ 0.0006833766700059486, 0.9999658311821702, -1.99921865975217 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
-		{ 0.0009111638318908222, 0.9999544418084058, -1.998626207349582 },
-		{ 0.0009599089943266954, 0.9999520045701169, -1.998477871093058 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001214875884426336, 0.9999392562057787, -1.997578171736715 },
-		{ 0.001366729989829533, 0.9999316635318487, -1.996943587136049 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
-		{ 0.001822286152793263, 0.9999088856923602, -1.994597833085009 },
-		{ 0.001919784411969193, 0.999904011771013, -1.994009832599284 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002429677972684225, 0.999878516101366, -1.990440039778731 },
-		{ 0.002733390123668586, 0.9998633320607747, -1.987920420584799 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
-		{ 0.003644406269246342, 0.9998177796865375, -1.978602744318658 },
-		{ 0.003839371159686223, 0.9998080319377999, -1.976266987859402 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004859060778610685, 0.9997570469610695, -1.962094519612651 },
-		{ 0.005466360364485463, 0.9997266819817755, -1.952100649493955 },
-		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
-		{ 9.480781185426562e-05, 0.9999952596097209, -1.99998087796087 },
-		{ 0.0001066587567350699, 0.9999946670625159, -1.999976465299376 },
-		{ 0.0001264102597803574, 0.9999936794873485, -1.999968112177709 },
-		{ 0.0001349898537795897, 0.9999932505073114, -1.99996409486276 },
-		{ 0.000142211549238112, 0.9999928894230079, -1.999960530799918 },
-		{ 0.0001599879217992652, 0.9999920006044388, -1.999951046769626 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0001896164148379667, 0.9999905192255504, -1.999932992774766 },
-		{ 0.0002133184797360726, 0.9999893341861967, -1.999916528105842 },
-		{ 0.0002528197205832004, 0.9999873590146456, -1.99988509075297 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0002844220515832632, 0.9999857789129386, -1.999856346225674 },
-		{ 0.0003199773126472717, 0.9999840012401439, -1.999820187563184 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0003792310319697918, 0.9999810385409862, -1.999750937137926 },
-		{ 0.000426632453053572, 0.9999786684043422, -1.999687448702999 },
-		{ 0.0005056362452646549, 0.999974718189086, -1.999565658186709 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.0005688400583775125, 0.9999715580281161, -1.999453847713199 },
-		{ 0.0006399437049567411, 0.9999680028180579, -1.999312783537076 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0007584495741029295, 0.9999620775233189, -1.999041737554357 },
-		{ 0.0008532540204346675, 0.9999573373455304, -1.998792560240015 },
-		{ 0.001011259707132726, 0.9999494370173418, -1.998313385021214 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001137664718684905, 0.9999431167833703, -1.997872567042006 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001516870385924143, 0.9999241564847515, -1.99624371343638 },
-		{ 0.001706484133275549, 0.9999146766747734, -1.995257042197101 },
-		{ 0.002022492266727048, 0.9998988769185153, -1.993357553354437 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002275278332943085, 0.9998862366388356, -1.991608536609007 },
-		{ 0.002559671598052096, 0.9998720177422252, -1.989397649621546 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003033646921745968, 0.9998483183945426, -1.98514058673848 },
-		{ 0.003412820431347092, 0.9998293598116335, -1.98122113210436 },
-		{ 0.004044736994759796, 0.9997977632449505, -1.973676369945591 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004550274956820207, 0.9997724870377098, -1.966732327451576 },
-		{ 0.005118979906371279, 0.9997440510459954, -1.957958705704099 },
-		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
-		{ 0.0001012424757538579, 0.9999949378762125, -1.999978537794883 },
-		{ 0.0001138978088952892, 0.9999943051104955, -1.999973548756756 },
-		{ 0.0001199910033242581, 0.9999940004514205, -1.99997096389332 },
-		{ 0.0001349898537795897, 0.9999932505073114, -1.99996409486276 },
-		{ 0.0001518635214315995, 0.9999924068239283, -1.999955506750674 },
-		{ 0.0001599879217992652, 0.9999920006044388, -1.999951046769626 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002277961990159206, 0.9999886102370609, -1.999905585250797 },
-		{ 0.0002399834644153351, 0.9999880009061117, -1.999895854978204 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0003037258897424666, 0.9999848137055128, -1.999837215334487 },
-		{ 0.0003199773126472717, 0.9999840012401439, -1.999820187563184 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.0004555898034985317, 0.9999772206038481, -1.999645129443198 },
-		{ 0.0004799600330901287, 0.9999760020380116, -1.99960743154147 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.000607447167015203, 0.9999696276416493, -1.999379260425735 },
-		{ 0.0006399437049567411, 0.9999680028180579, -1.999312783537076 },
-		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
-		{ 0.0008099254560797723, 0.999959503727196, -1.998910007485226 },
-		{ 0.0009111638318908222, 0.9999544418084058, -1.998626207349582 },
-		{ 0.0009599089943266954, 0.9999520045701169, -1.998477871093058 },
-		{ 0.001079893319387914, 0.9999460053340307, -1.998080373756657 },
-		{ 0.001214875884426336, 0.9999392562057787, -1.997578171736715 },
-		{ 0.001279866933516854, 0.9999360066599351, -1.997315600777984 },
-		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
-		{ 0.001619818113198847, 0.9999190090943402, -1.995722210568475 },
-		{ 0.001822286152793263, 0.9999088856923602, -1.994597833085009 },
-		{ 0.001919784411969193, 0.999904011771013, -1.994009832599284 },
-		{ 0.002159728330297569, 0.9998920135834857, -1.992433169318045 },
-		{ 0.002429677972684225, 0.999878516101366, -1.990440039778731 },
-		{ 0.002559671598052096, 0.9998720177422252, -1.989397649621546 },
-		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
-		{ 0.003239505035861777, 0.9998380247482073, -1.983069123540141 },
-		{ 0.003644406269246342, 0.9998177796865375, -1.978602744318658 },
-		{ 0.003839371159686223, 0.9998080319377999, -1.976266987859402 },
-		{ 0.004319223439257861, 0.9997840388280373, -1.97000590694496 },
-		{ 0.004859060778610685, 0.9997570469610695, -1.962094519612651 },
-		{ 0.005118979906371279, 0.9997440510459954, -1.957958705704099 },
-		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
-		{ 0.0001012424757538579, 0.9999949378762125, -1.999978537794883 },
-		{ 0.0001138978088952892, 0.9999943051104955, -1.999973548756756 },
-		{ 0.0001264102597803574, 0.9999936794873485, -1.999968112177709 },
-		{ 0.0001349898537795897, 0.9999932505073114, -1.99996409486276 },
-		{ 0.000142211549238112, 0.9999928894230079, -1.999960530799918 },
-		{ 0.0001599879217992652, 0.9999920006044388, -1.999951046769626 },
-		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
-		{ 0.0002024844389986781, 0.9999898757780502, -1.999924275887734 },
-		{ 0.0002277961990159206, 0.9999886102370609, -1.999905585250797 },
-		{ 0.0002528197205832004, 0.9999873590146456, -1.99988509075297 },
-		{ 0.0002699787964336946, 0.9999865010601782, -1.999869879725596 },
-		{ 0.0002844220515832632, 0.9999857789129386, -1.999856346225674 },
-		{ 0.0003199773126472717, 0.9999840012401439, -1.999820187563184 },
-		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
-		{ 0.0004049668279871995, 0.9999797516586004, -1.99971735772897 },
-		{ 0.0004555898034985317, 0.9999772206038481, -1.999645129443198 },
-		{ 0.0005056362452646549, 0.999974718189086, -1.999565658186709 },
-		{ 0.0005399539484420848, 0.9999730023025777, -1.999506533713294 },
-		{ 0.0005688400583775125, 0.9999715580281161, -1.999453847713199 },
-		{ 0.0006399437049567411, 0.9999680028180579, -1.999312783537076 }
-	}
-};
+#include "Scales.hpp"
+const ScaleDef mesopotamian = {
+	.name = "Mesopotamian",
+	.description = "The Mesopotamian tuning systems have reconstructed from cuneiform tablet from the Sumerian civilisation describing a Babylonian harp. The original work was made in 1960-70s by Duchesne-Guillemin, Kilmer, Gurney and Wulstan deriving a heptatonic ascending scale. Subsequent work by Vitale and Dumbrill indicated that a descending scale was used. The reader is referred to 'NEW LIGHT ON THE BABYLONIAN TONAL SYSTEM, Leon Crickmore for an up-to-date summary of the discussion. Here the module used a Pythagorian tuning and step size suggested by West in THE BABYLONIAN MUSICAL NOTATION AND THE HURRIAN MELODIC TEXTS, p164. The frequencies have been recalculated using more accurate frequency ratios.",
+	.scalename = {
+		"Ishartum; A1-",
+		"Ishartum; A4-",
+		"Embulum; A1-",
+		"Embulum; A4-",
+		"Nid Murub; A1-",
+		"Nid Murub; A4-",
+		"Quablitum; A1-",
+		"Quablitum; A4-",
+		"Kitmun; A1-",
+		"Kitmun; A4-",
+		"Mitum; A1-"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.freq = {
+		55,
+		57.94238683127573,
+		65.18518518518518,
+		73.33333333333333,
+		82.49999999999999,
+		86.91358024691357,
+		97.77777777777777,
+		110,
+		115.8847736625515,
+		130.3703703703704,
+		146.6666666666667,
+		164.9999999999999,
+		173.8271604938271,
+		195.5555555555555,
+		220,
+		231.7695473251029,
+		260.7407407407406,
+		293.3333333333333,
+		330.0000000000001,
+		347.6543209876543,
+		391.1111111111111,
+		440,
+		463.5390946502059,
+		521.4814814814814,
+		586.6666666666666,
+		659.9999999999999,
+		695.3086419753085,
+		782.2222222222222,
+		880,
+		927.0781893004116,
+		1042.962962962963,
+		1173.333333333333,
+		1320,
+		1390.617283950617,
+		1564.444444444444,
+		1760.000000000001,
+		1854.156378600824,
+		2085.925925925926,
+		2346.666666666667,
+		2640,
+		2781.234567901235,
+		3128.888888888889,
+		55,
+		61.87500000000001,
+		65.18518518518518,
+		73.33333333333333,
+		82.49999999999999,
+		92.81250000000001,
+		97.77777777777777,
+		110,
+		123.75,
+		130.3703703703704,
+		146.6666666666667,
+		164.9999999999999,
+		185.6250000000001,
+		195.5555555555555,
+		220,
+		247.5,
+		260.7407407407406,
+		293.3333333333333,
+		330.0000000000001,
+		371.2500000000001,
+		391.1111111111111,
+		440,
+		495.0000000000002,
+		521.4814814814814,
+		586.6666666666666,
+		659.9999999999999,
+		742.5000000000002,
+		782.2222222222222,
+		880,
+		990.0000000000002,
+		1042.962962962963,
+		1173.333333333333,
+		1320,
+		1485,
+		1564.444444444444,
+		1760.000000000001,
+		1980.000000000001,
+		2085.925925925926,
+		2346.666666666667,
+		2640,
+		2970.000000000001,
+		3128.888888888889,
+		55,
+		61.87500000000001,
+		69.60937500000001,
+		73.33333333333333,
+		82.49999999999999,
+		92.81250000000001,
+		104.4140625,
+		110,
+		123.75,
+		139.21875,
+		146.6666666666667,
+		164.9999999999999,
+		185.6250000000001,
+		208.8281249999999,
+		220,
+		247.5,
+		278.4375000000001,
+		293.3333333333333,
+		330.0000000000001,
+		371.2500000000001,
+		417.6562500000001,
+		440,
+		495.0000000000002,
+		556.8750000000001,
+		586.6666666666666,
+		659.9999999999999,
+		742.5000000000002,
+		835.3125,
+		880,
+		990.0000000000002,
+		1113.75,
+		1173.333333333333,
+		1320,
+		1485,
+		1670.625,
+		1760.000000000001,
+		1980.000000000001,
+		2227.499999999999,
+		2346.666666666667,
+		2640,
+		2970.000000000001,
+		3341.25,
+		55,
+		57.94238683127573,
+		65.18518518518518,
+		77.25651577503427,
+		82.49999999999999,
+		86.91358024691357,
+		97.77777777777777,
+		110,
+		115.8847736625515,
+		130.3703703703704,
+		154.5130315500685,
+		164.9999999999999,
+		173.8271604938271,
+		195.5555555555555,
+		220,
+		231.7695473251029,
+		260.7407407407406,
+		309.0260631001372,
+		330.0000000000001,
+		347.6543209876543,
+		391.1111111111111,
+		440,
+		463.5390946502059,
+		521.4814814814814,
+		618.0521262002743,
+		659.9999999999999,
+		695.3086419753085,
+		782.2222222222222,
+		880,
+		927.0781893004116,
+		1042.962962962963,
+		1236.104252400549,
+		1320,
+		1390.617283950617,
+		1564.444444444444,
+		1760.000000000001,
+		1854.156378600824,
+		2085.925925925926,
+		2472.208504801096,
+		2640,
+		2781.234567901235,
+		3128.888888888889,
+		55,
+		61.87500000000001,
+		69.60937500000001,
+		73.33333333333333,
+		82.49999999999999,
+		92.81250000000001,
+		97.77777777777777,
+		110,
+		123.75,
+		139.21875,
+		146.6666666666667,
+		164.9999999999999,
+		185.6250000000001,
+		195.5555555555555,
+		220,
+		247.5,
+		278.4375000000001,
+		293.3333333333333,
+		330.0000000000001,
+		371.2500000000001,
+		391.1111111111111,
+		440,
+		495.0000000000002,
+		556.8750000000001,
+		586.6666666666666,
+		659.9999999999999,
+		742.5000000000002,
+		782.2222222222222,
+		880,
+		990.0000000000002,
+		1113.75,
+		1173.333333333333,
+		1320,
+		1485,
+		1564.444444444444,
+		1760.000000000001,
+		1980.000000000001,
+		2227.499999999999,
+		2346.666666666667,
+		2640,
+		2970.000000000001,
+		3128.888888888889,
+		55,
+		61.87500000000001,
+		69.60937500000001,
+		77.25651577503427,
+		82.49999999999999,
+		86.91358024691357,
+		97.77777777777777,
+		110,
+		123.75,
+		139.21875,
+		154.5130315500685,
+		164.9999999999999,
+		173.8271604938271,
+		195.5555555555555,
+		220,
+		247.5,
+		278.4375000000001,
+		309.0260631001372,
+		330.0000000000001,
+		347.6543209876543,
+		391.1111111111111
+	}
+};
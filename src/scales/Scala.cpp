@@ -0,0 +1,219 @@
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#include "Scala.hpp"
+
+// trim from both ends (in place)
+static inline void trim(std::string &s) {
+	s.erase(std::find_if(s.rbegin(), s.rend(), [](int ch) {
+		return !std::isspace(ch);
+	}).base(), s.end());
+	s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](int ch) {
+		return !std::isspace(ch);
+	}));
+}
+
+int64_t file_mtime(const std::string &path) {
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0) {
+		return -1;
+	}
+	return (int64_t)st.st_mtime;
+}
+
+float ScalaNote::ratio(void) const {
+	if (isRatio) {
+		return (float)upper / (float)lower;
+	}
+	return powf(2.0f, cents / 1200.0f);
+}
+
+static bool parse_note(const std::string &text, ScalaNote *note, std::string *error) {
+
+	size_t slash = text.find('/');
+
+	try {
+		if (slash != std::string::npos) {
+			note->upper = std::stoi(text.substr(0, slash));
+			note->lower = std::stoi(text.substr(slash + 1));
+			note->isRatio = true;
+		} else if (text.find('.') != std::string::npos) {
+			note->cents = std::stof(text);
+			note->isRatio = false;
+		} else {
+			note->upper = std::stoi(text);
+			note->lower = 1;
+			note->isRatio = true;
+		}
+	} catch (std::exception &e) {
+		*error = "Cannot convert '" + text + "' to a number";
+		return false;
+	}
+
+	if (note->isRatio && (note->upper <= 0 || note->lower <= 0)) {
+		*error = "Invalid ratio '" + text + "'";
+		return false;
+	}
+
+	return true;
+
+}
+
+bool parse_scala(std::istream &in, ScalaScale *scale, std::string *error) {
+
+	bool readNumNotes = false;
+	bool readDescription = false;
+
+	unsigned int nNotes = 0;
+
+	scale->description.clear();
+	scale->notes.clear();
+
+	std::string line;
+	while (std::getline(in, line)) {
+
+		trim(line);
+
+		if (!line.empty() && line[0] == '!') {
+			continue;
+		}
+		if (!readDescription) {
+			scale->description = line;
+			readDescription = true;
+			continue;
+		}
+		if (!readNumNotes) {
+			try {
+				nNotes = std::stoi(line);
+			} catch (std::exception &e) {
+				*error = "Invalid number of notes '" + line + "'";
+				return false;
+			}
+			readNumNotes = true;
+			scale->notes.reserve(std::min(nNotes, 4096u));
+			continue;
+		}
+		if (line.empty()) {
+			continue;
+		}
+
+		std::istringstream tokens(line);
+		std::string token;
+		tokens >> token;
+
+		ScalaNote note;
+		if (!parse_note(token, &note, error)) {
+			*error = "Failed to parse line '" + line + "': " + *error;
+			return false;
+		}
+		note.description = line;
+		scale->notes.push_back(note);
+
+	}
+
+	if (!readNumNotes) {
+		*error = "Number of notes is missing";
+		return false;
+	}
+
+	if (scale->notes.size() != nNotes) {
+		*error = "Number of notes " + std::to_string(scale->notes.size()) + " found does not match declared value of " + std::to_string(nNotes);
+		return false;
+	}
+
+	if (scale->notes.empty()) {
+		*error = "Scale has no notes";
+		return false;
+	}
+
+	return true;
+
+}
+
+bool load_scala(const char *path, ScalaScale *scale, std::string *error) {
+
+	std::ifstream file(path);
+	if (!file.is_open()) {
+		*error = "Could not load Scala file '" + std::string(path) + "'";
+		return false;
+	}
+
+	scale->path = path;
+	return parse_scala(file, scale, error);
+
+}
+
+ScalaLoader::ScalaLoader() : ready(NULL) {
+}
+
+ScalaLoader::~ScalaLoader() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	cv.notify_one();
+	if (worker.joinable()) {
+		worker.join();
+	}
+	delete ready.exchange(NULL);
+}
+
+void ScalaLoader::request(const std::string &path) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending = path;
+		hasPending = true;
+
+		// Started by the first request, so modules that never load a Scala file run no thread
+		if (!worker.joinable()) {
+			worker = std::thread(&ScalaLoader::run, this);
+		}
+	}
+	cv.notify_one();
+}
+
+std::unique_ptr<ScalaLoader::Result> ScalaLoader::take(void) {
+	return std::unique_ptr<Result>(ready.exchange(NULL, std::memory_order_acquire));
+}
+
+void ScalaLoader::run(void) {
+
+	while (true) {
+
+		std::string path;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cv.wait(lock, [this] { return hasPending || !running; });
+			if (!running) {
+				return;
+			}
+			path = pending;
+			hasPending = false;
+		}
+
+		Result *result = new Result;
+		result->path = path;
+
+		int64_t mtime = file_mtime(path);
+		if (last && last->path == path && mtime == lastMtime) {
+			result->scale = last;
+		} else {
+			std::shared_ptr<ScalaScale> scale = std::make_shared<ScalaScale>();
+			if (load_scala(path.c_str(), scale.get(), &result->error)) {
+				result->scale = scale;
+				last = scale;
+				lastMtime = mtime;
+			}
+		}
+
+		// A result nobody took yet is stale now
+		delete ready.exchange(result, std::memory_order_acq_rel);
+
+	}
+
+}
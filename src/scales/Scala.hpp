@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// One degree of a Scala scale, either a ratio or a cents value
+struct ScalaNote {
+	int upper = 1;
+	int lower = 1;
+	float cents = 0.0f;
+	bool isRatio = true;
+	std::string description;	// Whole line from the file
+
+	// Frequency ratio above the 1/1
+	float ratio(void) const;
+};
+
+struct ScalaScale {
+	std::string path;
+	std::string description;
+	std::vector<ScalaNote> notes;	// Without the implicit 1/1, the last note is the period
+};
+
+// Parse a .scl file. On failure the reason is left in error and scale is incomplete
+bool parse_scala(std::istream &in, ScalaScale *scale, std::string *error);
+bool load_scala(const char *path, ScalaScale *scale, std::string *error);
+
+// Modification time of a file in seconds, -1 if it cannot be read
+int64_t file_mtime(const std::string &path);
+
+// Parses Scala files on a thread of its own, so a large file or a slow disk never holds up
+// the UI or audio threads. A request made while another is waiting replaces it. Finished
+// loads are handed over by swapping a pointer, so take() does not lock and can be polled.
+struct ScalaLoader {
+
+	struct Result {
+		std::string path;
+		std::shared_ptr<const ScalaScale> scale;	// NULL when the load failed
+		std::string error;
+	};
+
+	ScalaLoader();
+	~ScalaLoader();
+
+	// From the UI thread
+	void request(const std::string &path);
+
+	// Newest finished load, NULL if there is none since the last call
+	std::unique_ptr<Result> take(void);
+
+private:
+	std::mutex mutex;				// Guards pending and hasPending
+	std::condition_variable cv;
+	std::string pending;
+	bool hasPending = false;
+	bool running = true;
+
+	std::atomic<Result *> ready;
+
+	// Last scale parsed, handed out again while the file is unchanged
+	std::shared_ptr<const ScalaScale> last;
+	int64_t lastMtime = 0;
+
+	std::thread worker;
+
+	void run(void);
+
+};
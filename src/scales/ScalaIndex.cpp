@@ -0,0 +1,407 @@
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <sstream>
+#include <unordered_map>
+
+#include "ScalaIndex.hpp"
+
+// Cache file:
+//
+//	magic[8] version:u32 count:u32
+//	count entries of
+//		path:str mtime:i64 description:str numNotes:u32
+//		numNotes notes of upper:i32 lower:i32 cents:f32 isRatio:u8 description:str
+//
+// str is a u32 length followed by the bytes. Native byte order, the cache never leaves the machine.
+
+static const char CACHE_MAGIC[8] = {'R', 'B', 'W', 'S', 'C', 'I', 'D', 'X'};
+static const uint32_t CACHE_VERSION = 1;
+
+static const uint32_t MAX_STRING = 1 << 16;
+static const uint32_t MAX_NOTES = 1 << 16;
+
+struct CacheReader {
+	FILE *file;
+	bool ok = true;
+
+	template <typename T>
+	T read(void) {
+		T value = T();
+		ok = ok && fread(&value, sizeof(T), 1, file) == 1;
+		return value;
+	}
+
+	std::string readString(void) {
+		uint32_t length = read<uint32_t>();
+		ok = ok && length <= MAX_STRING;
+		if (!ok) {
+			return std::string();
+		}
+		std::string s(length, '\0');
+		ok = length == 0 || fread(&s[0], 1, length, file) == length;
+		return s;
+	}
+};
+
+struct CacheWriter {
+	FILE *file;
+	bool ok = true;
+
+	template <typename T>
+	void write(const T &value) {
+		ok = ok && fwrite(&value, sizeof(T), 1, file) == 1;
+	}
+
+	void writeString(const std::string &s) {
+		write<uint32_t>(s.size());
+		ok = ok && (s.empty() || fwrite(s.data(), 1, s.size(), file) == s.size());
+	}
+};
+
+static std::string filename(const std::string &path) {
+	size_t slash = path.find_last_of("/\\");
+	return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static std::string lowercase(std::string s) {
+	std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) {
+		return std::tolower(c);
+	});
+	return s;
+}
+
+static ScalaIndexEntry make_entry(std::shared_ptr<const ScalaScale> scale, int64_t mtime) {
+	ScalaIndexEntry entry;
+	entry.scale = scale;
+	entry.name = filename(scale->path);
+	entry.key = lowercase(entry.name + " " + scale->description);
+	entry.mtime = mtime;
+	return entry;
+}
+
+static bool is_scala_file(const std::string &path) {
+	return path.size() > 4 && lowercase(path.substr(path.size() - 4)) == ".scl";
+}
+
+static bool read_cache(const std::string &cachePath, ScalaIndexEntries *entries) {
+
+	FILE *file = fopen(cachePath.c_str(), "rb");
+	if (!file) {
+		return false;
+	}
+
+	CacheReader in;
+	in.file = file;
+
+	char magic[8];
+	in.ok = fread(magic, sizeof(magic), 1, file) == 1 && memcmp(magic, CACHE_MAGIC, sizeof(magic)) == 0;
+	in.ok = in.ok && in.read<uint32_t>() == CACHE_VERSION;
+	uint32_t count = in.read<uint32_t>();
+
+	for (uint32_t i = 0; i < count && in.ok; i++) {
+
+		std::shared_ptr<ScalaScale> scale = std::make_shared<ScalaScale>();
+
+		scale->path = in.readString();
+		int64_t mtime = in.read<int64_t>();
+		scale->description = in.readString();
+
+		uint32_t numNotes = in.read<uint32_t>();
+		in.ok = in.ok && numNotes > 0 && numNotes <= MAX_NOTES;
+		if (!in.ok) {
+			break;
+		}
+
+		scale->notes.resize(numNotes);
+		for (uint32_t n = 0; n < numNotes && in.ok; n++) {
+			ScalaNote &note = scale->notes[n];
+			note.upper = in.read<int32_t>();
+			note.lower = in.read<int32_t>();
+			note.cents = in.read<float>();
+			note.isRatio = in.read<uint8_t>() != 0;
+			note.description = in.readString();
+			in.ok = in.ok && (!note.isRatio || (note.upper > 0 && note.lower > 0));
+		}
+
+		entries->push_back(make_entry(scale, mtime));
+
+	}
+
+	fclose(file);
+
+	// A damaged cache is thrown away as a whole, the scan rebuilds it
+	if (!in.ok) {
+		entries->clear();
+	}
+	return in.ok;
+
+}
+
+static bool write_cache(const std::string &cachePath, const ScalaIndexEntries &entries) {
+
+	std::string tmpPath = cachePath + ".tmp";
+
+	FILE *file = fopen(tmpPath.c_str(), "wb");
+	if (!file) {
+		return false;
+	}
+
+	CacheWriter out;
+	out.file = file;
+
+	out.ok = fwrite(CACHE_MAGIC, sizeof(CACHE_MAGIC), 1, file) == 1;
+	out.write<uint32_t>(CACHE_VERSION);
+	out.write<uint32_t>(entries.size());
+
+	for (const ScalaIndexEntry &entry : entries) {
+		const ScalaScale &scale = *entry.scale;
+		out.writeString(scale.path);
+		out.write<int64_t>(entry.mtime);
+		out.writeString(scale.description);
+		out.write<uint32_t>(scale.notes.size());
+		for (const ScalaNote &note : scale.notes) {
+			out.write<int32_t>(note.upper);
+			out.write<int32_t>(note.lower);
+			out.write<float>(note.cents);
+			out.write<uint8_t>(note.isRatio ? 1 : 0);
+			out.writeString(note.description);
+		}
+	}
+
+	bool ok = fclose(file) == 0 && out.ok;
+
+	if (ok) {
+#if defined(ARCH_WIN)
+		remove(cachePath.c_str());
+#endif
+		ok = rename(tmpPath.c_str(), cachePath.c_str()) == 0;
+	}
+
+	if (!ok) {
+		remove(tmpPath.c_str());
+	}
+	return ok;
+
+}
+
+float ScalaIndexEntry::period(void) const {
+	return 1200.0f * log2f(scale->notes.back().ratio());
+}
+
+// True if path lies inside dir, not in a sibling folder that merely starts with the same name
+static bool in_folder(const std::string &path, const std::string &dir) {
+	if (dir.empty() || path.size() <= dir.size() || path.compare(0, dir.size(), dir) != 0) {
+		return false;
+	}
+	char last = dir[dir.size() - 1];
+	char next = path[dir.size()];
+	return last == '/' || last == '\\' || next == '/' || next == '\\';
+}
+
+// Function local static, so construction is thread safe and happens once
+ScalaIndex &ScalaIndex::get(void) {
+	static ScalaIndex index;
+	return index;
+}
+
+ScalaIndex::~ScalaIndex() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	cv.notify_one();
+	if (worker.joinable()) {
+		worker.join();
+	}
+}
+
+bool ScalaIndex::known(const std::string &dir) {
+	std::lock_guard<std::mutex> lock(mutex);
+	return folders.count(dir) != 0;
+}
+
+bool ScalaIndex::scanning(const std::string &dir) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = folders.find(dir);
+	return it != folders.end() && (it->second.queued || it->second.busy);
+}
+
+std::shared_ptr<const ScalaIndexEntries> ScalaIndex::entries(const std::string &dir) {
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = folders.find(dir);
+	if (it == folders.end() || !it->second.entries) {
+		return std::make_shared<ScalaIndexEntries>();
+	}
+	return it->second.entries;
+}
+
+void ScalaIndex::publish(const std::string &dir, std::shared_ptr<const ScalaIndexEntries> entries) {
+	std::lock_guard<std::mutex> lock(mutex);
+	folders[dir].entries = entries;
+}
+
+void ScalaIndex::scan(const std::string &dir, const std::string &cachePath, Lister list) {
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	this->cachePath = cachePath;
+	this->list = list;
+
+	Folder &folder = folders[dir];
+	if (!folder.queued) {
+		folder.queued = true;
+		queue.push_back(dir);
+	}
+
+	// Started by the first scan, so nothing runs for patches without a Scala library
+	if (!worker.joinable()) {
+		worker = std::thread(&ScalaIndex::run, this);
+	}
+	cv.notify_one();
+
+}
+
+void ScalaIndex::run(void) {
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true) {
+
+		cv.wait(lock, [this] { return !queue.empty() || !running; });
+		if (!running) {
+			return;
+		}
+
+		std::string dir = queue.front();
+		queue.pop_front();
+		folders[dir].queued = false;
+		folders[dir].busy = true;
+		std::string cachePath = this->cachePath;
+		Lister list = this->list;
+
+		lock.unlock();
+		index(dir, cachePath, list);
+		lock.lock();
+
+		folders[dir].busy = false;
+
+	}
+
+}
+
+void ScalaIndex::index(const std::string &dir, const std::string &cachePath, Lister list) {
+
+	if (!cacheRead) {
+		read_cache(cachePath, &cache);
+		cacheRead = true;
+	}
+
+	std::unordered_map<std::string, const ScalaIndexEntry *> cached;
+	for (const ScalaIndexEntry &entry : cache) {
+		cached[entry.scale->path] = &entry;
+	}
+
+	// Show the cached scales of this folder while the disk is checked
+	std::shared_ptr<ScalaIndexEntries> early = std::make_shared<ScalaIndexEntries>();
+	for (const ScalaIndexEntry &entry : cache) {
+		if (in_folder(entry.scale->path, dir)) {
+			early->push_back(entry);
+		}
+	}
+	if (!early->empty()) {
+		publish(dir, early);
+	}
+
+	std::vector<std::string> paths = list(dir);
+	std::sort(paths.begin(), paths.end());
+
+	std::shared_ptr<ScalaIndexEntries> found = std::make_shared<ScalaIndexEntries>();
+	found->reserve(paths.size());
+
+	for (const std::string &path : paths) {
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!running) {
+				return;
+			}
+		}
+
+		if (!is_scala_file(path)) {
+			continue;
+		}
+
+		int64_t mtime = file_mtime(path);
+
+		auto it = cached.find(path);
+		if (it != cached.end() && it->second->mtime == mtime) {
+			found->push_back(*it->second);
+			continue;
+		}
+
+		// Files that do not parse are left out, they are looked at again on the next scan
+		std::shared_ptr<ScalaScale> scale = std::make_shared<ScalaScale>();
+		std::string error;
+		if (!load_scala(path.c_str(), scale.get(), &error)) {
+			continue;
+		}
+
+		found->push_back(make_entry(scale, mtime));
+
+	}
+
+	publish(dir, found);
+
+	// The cache keeps the scales of every other folder, so switching between folders parses nothing again
+	ScalaIndexEntries merged;
+	merged.reserve(cache.size() + found->size());
+	for (const ScalaIndexEntry &entry : cache) {
+		if (!in_folder(entry.scale->path, dir)) {
+			merged.push_back(entry);
+		}
+	}
+	merged.insert(merged.end(), found->begin(), found->end());
+	cache.swap(merged);
+
+	write_cache(cachePath, cache);
+
+}
+
+std::vector<const ScalaIndexEntry *> ScalaIndex::search(const ScalaIndexEntries &entries, const std::string &query, size_t max) {
+
+	std::vector<std::string> words;
+	std::istringstream ss(lowercase(query));
+	std::string word;
+	while (ss >> word) {
+		words.push_back(word);
+	}
+
+	std::vector<const ScalaIndexEntry *> matches;
+
+	for (const ScalaIndexEntry &entry : entries) {
+
+		if (matches.size() >= max) {
+			break;
+		}
+
+		bool match = true;
+		for (const std::string &w : words) {
+			if (entry.key.find(w) == std::string::npos) {
+				match = false;
+				break;
+			}
+		}
+
+		if (match) {
+			matches.push_back(&entry);
+		}
+
+	}
+
+	return matches;
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Scala.hpp"
+
+struct ScalaIndexEntry {
+	std::shared_ptr<const ScalaScale> scale;
+	std::string name;		// File name, without the folder
+	std::string key;		// Name and description in lower case, for searching
+	int64_t mtime;
+
+	// Interval the scale repeats at, in cents
+	float period(void) const;
+};
+
+typedef std::vector<ScalaIndexEntry> ScalaIndexEntries;
+
+// Index of folders of Scala files, built on a background thread and kept in one cache file
+// between sessions. Only files that are new or changed since the cache was written are
+// parsed, so after the first scan a library can be browsed straight away even when it
+// holds thousands of scales. Entries carry the parsed scale, so picking one reads no file.
+// Each folder has its own snapshot, so modules browsing different folders do not interfere.
+struct ScalaIndex {
+
+	// Lists the files below a folder. Passed in so this code does not depend on Rack
+	typedef std::vector<std::string> (*Lister)(const std::string &dir);
+
+	static ScalaIndex &get(void);
+
+	// Queues a scan of dir, from the UI thread. Folders are scanned one after another
+	void scan(const std::string &dir, const std::string &cachePath, Lister list);
+
+	// True once a scan of dir has been asked for
+	bool known(const std::string &dir);
+	bool scanning(const std::string &dir);
+
+	// Snapshot of the scales of dir, replaced as a whole when a scan publishes. Never NULL
+	std::shared_ptr<const ScalaIndexEntries> entries(const std::string &dir);
+
+	// Entries whose file name or description contains every word of query, ignoring case
+	static std::vector<const ScalaIndexEntry *> search(const ScalaIndexEntries &entries, const std::string &query, size_t max);
+
+private:
+	struct Folder {
+		std::shared_ptr<const ScalaIndexEntries> entries;
+		bool queued = false;
+		bool busy = false;
+	};
+
+	std::mutex mutex;				// Guards everything down to worker
+	std::condition_variable cv;
+	std::map<std::string, Folder> folders;
+	std::deque<std::string> queue;
+	std::string cachePath;
+	Lister list = NULL;
+	bool running = true;
+	std::thread worker;
+
+	// Every scale known, of all folders, as written to the cache. Only used by the worker
+	ScalaIndexEntries cache;
+	bool cacheRead = false;
+
+	ScalaIndex() {}
+	~ScalaIndex();
+	ScalaIndex(const ScalaIndex &) = delete;
+	ScalaIndex &operator=(const ScalaIndex &) = delete;
+
+	void publish(const std::string &dir, std::shared_ptr<const ScalaIndexEntries> entries);
+	void run(void);
+	void index(const std::string &dir, const std::string &cachePath, Lister list);
+
+};
@@ -0,0 +1,169 @@
+#include <sys/stat.h>
+
+#if !defined(ARCH_WIN)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "ScaleLibrary.hpp"
+
+static bool pack_stamp(const std::string &path, int64_t *mtime, int64_t *size) {
+	struct stat st;
+	if (stat(path.c_str(), &st) != 0) {
+		return false;
+	}
+	*mtime = (int64_t)st.st_mtime;
+	*size = (int64_t)st.st_size;
+	return true;
+}
+
+// Function local static, so construction is thread safe and happens once
+ScaleLibrary &ScaleLibrary::get(void) {
+	static ScaleLibrary library;
+	return library;
+}
+
+ScaleLibrary::ScaleLibrary() : numBanks(0) {
+	for (int i = 0; i < MAX_PACKS; i++) {
+		mapped[i].store(NULL, std::memory_order_relaxed);
+		packBanks[i] = 0;
+	}
+}
+
+int ScaleLibrary::add(const std::vector<std::string> &paths) {
+
+	std::lock_guard<std::mutex> lock(addMutex);
+
+	int n = numBanks.load(std::memory_order_relaxed);
+	int added = 0;
+
+	for (size_t p = 0; p < paths.size(); p++) {
+
+		PackStamp stamp;
+		if (!pack_stamp(paths[p], &stamp.mtime, &stamp.size)) {
+			continue;
+		}
+
+		int slot = -1;
+		for (int i = 0; i < numPacks && slot < 0; i++) {
+			if (packs[i]->path == paths[p]) {
+				slot = i;
+			}
+		}
+		if (slot >= 0 && stamps[slot].mtime == stamp.mtime && stamps[slot].size == stamp.size) {
+			continue;
+		}
+		if (slot < 0 && numPacks == MAX_PACKS) {
+			continue;
+		}
+
+		std::unique_ptr<ScalePack> pack(new ScalePack());
+		if (!pack->open(paths[p].c_str())) {
+			continue;
+		}
+
+		if (slot < 0) {
+			slot = numPacks++;
+		}
+
+		// Readers switch to the new mapping at once. The one it replaces is kept a while, as the
+		// audio thread may still be reading a bank of it, and the oldest kept one is released
+		mapped[slot].store(pack.get(), std::memory_order_release);
+		if (packs[slot]) {
+			retired[nextRetired] = std::move(packs[slot]);
+			nextRetired = (nextRetired + 1) % MAX_RETIRED;
+		}
+		packs[slot] = std::move(pack);
+		stamps[slot] = stamp;
+
+		for (int b = packBanks[slot]; b < packs[slot]->size() && n < MAX_BANKS; b++) {
+			refs[n].pack = slot;
+			refs[n].index = b;
+			packBanks[slot]++;
+			n++;
+			added++;
+		}
+
+	}
+
+	// Readers only look below numBanks, so the new entries are complete before they see them
+	numBanks.store(n, std::memory_order_release);
+
+	return added;
+
+}
+
+const ScalePack *ScaleLibrary::pack(int i) const {
+	if (i < 0 || i >= size()) {
+		return NULL;
+	}
+	return mapped[refs[i].pack].load(std::memory_order_acquire);
+}
+
+const ScalePackBank *ScaleLibrary::bank(int i) const {
+	const ScalePack *p = pack(i);
+	return p ? p->bank(refs[i].index) : NULL;
+}
+
+const char *ScaleLibrary::name(int i) const {
+	const ScalePack *p = pack(i);
+	const ScalePackBank *b = p ? p->bank(refs[i].index) : NULL;
+	return b ? p->string(b->name) : "";
+}
+
+std::string ScaleLibrary::packFile(int i) const {
+	const ScalePack *p = pack(i);
+	if (!p) {
+		return "";
+	}
+	size_t slash = p->path.find_last_of("/\\");
+	return slash == std::string::npos ? p->path : p->path.substr(slash + 1);
+}
+
+int ScaleLibrary::packIndex(int i) const {
+	return pack(i) ? refs[i].index : -1;
+}
+
+int ScaleLibrary::find(const std::string &file, int index, const std::string &name) const {
+
+	int byIndex = -1;
+
+	for (int i = 0; i < size(); i++) {
+
+		if (packFile(i) != file) {
+			continue;
+		}
+		if (!name.empty() && name == this->name(i)) {
+			return i;
+		}
+		if (refs[i].index == index && bank(i)) {
+			byIndex = i;
+		}
+
+	}
+
+	return byIndex;
+
+}
+
+void ScaleLibrary::prefetch(int i) const {
+
+	const ScalePackBank *b = bank(i);
+	if (b == NULL) {
+		return;
+	}
+
+#if defined(ARCH_WIN)
+	// Touch a byte per page, Windows has no portable readahead hint for a view
+	const volatile uint8_t *p = (const uint8_t *)b;
+	for (size_t offset = 0; offset < sizeof(ScalePackBank); offset += 4096) {
+		(void)p[offset];
+	}
+#else
+	uintptr_t page = sysconf(_SC_PAGESIZE);
+	uintptr_t start = (uintptr_t)b & ~(page - 1);
+	uintptr_t end = (uintptr_t)b + sizeof(ScalePackBank);
+	posix_madvise((void *)start, end - start, POSIX_MADV_WILLNEED);
+#endif
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ScalePack.hpp"
+
+// Banks from the scale packs installed by the user, numbered after the built-in presets.
+// Packs are memory mapped when found, so a bank is only read from disk when it is first
+// played and the OS drops its pages again when memory gets short; resident memory follows
+// the banks in use, not the size of the library. A mapping is only released MAX_RETIRED
+// rewrites after it was replaced, so bank pointers stay valid for the audio thread without locking.
+struct ScaleLibrary {
+
+	static const int MAX_PACKS = 256;
+	static const int MAX_BANKS = 8192;
+	static const int MAX_RETIRED = 8;
+
+	static ScaleLibrary &get(void);
+
+	// Maps the packs not seen before, from the UI thread. Returns the number of banks added.
+	// A pack rewritten since it was mapped is mapped again in its own slot: its bank numbers
+	// move to the new mapping and only the banks it gained are added after the others
+	int add(const std::vector<std::string> &paths);
+
+	// Safe from any thread
+	int size(void) const { return numBanks.load(std::memory_order_acquire); }
+
+	// NULL if out of range, or if a rewrite of its pack dropped the bank
+	const ScalePackBank *bank(int i) const;
+	const char *name(int i) const;
+
+	// Where a bank comes from: the file name of its pack, without the folder, and its index in
+	// the pack. Unlike the bank number, these do not depend on the other packs installed
+	std::string packFile(int i) const;
+	int packIndex(int i) const;
+
+	// Bank number of a bank of the pack named file, -1 if there is no such pack or bank. The
+	// bank named name is taken if the pack has one, so banks can be inserted into a pack
+	int find(const std::string &file, int index, const std::string &name) const;
+
+	// Asks the OS to start reading a bank in, so switching to it does not wait on the disk
+	void prefetch(int i) const;
+
+private:
+	// File a pack was mapped from, to tell a rewritten pack from one already mapped
+	struct PackStamp {
+		int64_t mtime;
+		int64_t size;
+	};
+
+	// Bank index of the pack in slot pack
+	struct BankRef {
+		int pack;
+		int index;
+	};
+
+	std::mutex addMutex;
+	std::unique_ptr<ScalePack> packs[MAX_PACKS];		// Only used by add()
+	std::atomic<const ScalePack *> mapped[MAX_PACKS];	// The same packs, for the readers
+	PackStamp stamps[MAX_PACKS];
+	int packBanks[MAX_PACKS];							// Bank numbers given to each pack so far
+	int numPacks = 0;
+	std::unique_ptr<ScalePack> retired[MAX_RETIRED];	// Replaced mappings, oldest released first
+	int nextRetired = 0;
+	BankRef refs[MAX_BANKS];
+	std::atomic<int> numBanks;
+
+	ScaleLibrary();
+	const ScalePack *pack(int i) const;
+	ScaleLibrary(const ScaleLibrary &) = delete;
+	ScaleLibrary &operator=(const ScaleLibrary &) = delete;
+
+};
@@ -0,0 +1,299 @@
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#if defined(ARCH_WIN)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "ScalePack.hpp"
+
+ScalePack::~ScalePack() {
+	close();
+}
+
+bool ScalePack::open(const char *path) {
+
+	close();
+
+#if defined(ARCH_WIN)
+	int wlen = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
+	std::vector<wchar_t> wpath(wlen > 0 ? wlen : 1);
+	MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath.data(), wlen);
+
+	// FILE_SHARE_DELETE lets write_scale_pack rename the file while it is mapped
+	HANDLE file = CreateFileW(wpath.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		lastError = "Could not open scale pack '" + std::string(path) + "'";
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		lastError = "Scale pack '" + std::string(path) + "' is empty";
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL) {
+		lastError = "Could not map scale pack '" + std::string(path) + "'";
+		return false;
+	}
+
+	void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == NULL) {
+		CloseHandle(mapping);
+		lastError = "Could not map scale pack '" + std::string(path) + "'";
+		return false;
+	}
+
+	handle = mapping;
+	data = (const uint8_t *)view;
+	length = (size_t)fileSize.QuadPart;
+#else
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0) {
+		lastError = "Could not open scale pack '" + std::string(path) + "'";
+		return false;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		::close(fd);
+		lastError = "Scale pack '" + std::string(path) + "' is empty";
+		return false;
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	void *view = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (view == MAP_FAILED) {
+		lastError = "Could not map scale pack '" + std::string(path) + "'";
+		return false;
+	}
+
+	data = (const uint8_t *)view;
+	length = st.st_size;
+#endif
+
+	if (!validate()) {
+		std::string error = lastError;
+		close();
+		lastError = error;
+		return false;
+	}
+
+	this->path = path;
+	return true;
+
+}
+
+void ScalePack::close(void) {
+
+	if (data) {
+#if defined(ARCH_WIN)
+		UnmapViewOfFile(data);
+		CloseHandle((HANDLE)handle);
+#else
+		munmap((void *)data, length);
+#endif
+	}
+
+	data = NULL;
+	length = 0;
+	header = NULL;
+	handle = NULL;
+	path = "";
+
+}
+
+// Checks the header against the file size once, so bank() and string() only need index checks
+bool ScalePack::validate(void) {
+
+	if (length < sizeof(ScalePackHeader)) {
+		lastError = "Not a scale pack";
+		return false;
+	}
+
+	const ScalePackHeader *h = (const ScalePackHeader *)data;
+
+	if (memcmp(h->magic, SCALEPACK_MAGIC, sizeof(SCALEPACK_MAGIC)) != 0) {
+		lastError = "Not a scale pack";
+		return false;
+	}
+
+	if (h->version != SCALEPACK_VERSION || h->bankSize != sizeof(ScalePackBank)) {
+		lastError = "Unsupported scale pack version " + std::to_string(h->version);
+		return false;
+	}
+
+	uint64_t bankEnd = (uint64_t)h->bankOffset + (uint64_t)h->numBanks * sizeof(ScalePackBank);
+	uint64_t stringEnd = (uint64_t)h->stringOffset + h->stringSize;
+
+	if (h->bankOffset % 64 != 0 || bankEnd > length || stringEnd > length) {
+		lastError = "Scale pack is truncated";
+		return false;
+	}
+
+	if (h->stringSize == 0 || data[stringEnd - 1] != '\0') {
+		lastError = "Scale pack string table is not terminated";
+		return false;
+	}
+
+	header = h;
+	return true;
+
+}
+
+const ScalePackBank *ScalePack::bank(int i) const {
+
+	if (!header || i < 0 || (uint32_t)i >= header->numBanks) {
+		return NULL;
+	}
+
+	return (const ScalePackBank *)(data + header->bankOffset) + i;
+
+}
+
+const char *ScalePack::string(uint32_t offset) const {
+
+	if (!header || offset >= header->stringSize) {
+		return "";
+	}
+
+	return (const char *)(data + header->stringOffset + offset);
+
+}
+
+// String table builder, identical strings are stored once
+struct StringTable {
+
+	std::string table;
+
+	StringTable() : table(1, '\0') {}	// Offset 0 is the empty string
+
+	uint32_t add(const std::string &s) {
+		if (s.empty()) {
+			return 0;
+		}
+		size_t pos = table.find(s + '\0');
+		while (pos != std::string::npos && pos > 0 && table[pos - 1] != '\0') {
+			pos = table.find(s + '\0', pos + 1);
+		}
+		if (pos != std::string::npos) {
+			return pos;
+		}
+		pos = table.size();
+		table += s;
+		table += '\0';
+		return pos;
+	}
+
+};
+
+#if defined(ARCH_WIN)
+// Windows will not delete or replace a file that is mapped, and the library keeps packs mapped.
+// It does let one be renamed, so the old pack is moved to a side name, and deleted from there
+// by a later rewrite once nothing maps it. The library keeps a bounded number of old mappings,
+// so a few side names are enough.
+static const int MAX_ASIDE = 16;
+
+static std::string aside_path(const char *path, int i) {
+	return std::string(path) + ".old" + std::to_string(i);
+}
+
+static bool move_aside(const char *path) {
+
+	for (int i = 0; i < MAX_ASIDE; i++) {
+		remove(aside_path(path, i).c_str());
+	}
+
+	struct stat st;
+	if (stat(path, &st) != 0) {
+		return true;	// Nothing to move
+	}
+
+	// Side names still mapped were not removed above, and rename does not overwrite them
+	for (int i = 0; i < MAX_ASIDE; i++) {
+		if (rename(path, aside_path(path, i).c_str()) == 0) {
+			return true;
+		}
+	}
+	return false;
+
+}
+#endif
+
+bool write_scale_pack(const char *path, const std::vector<ScalePackSource> &banks, std::string *error) {
+
+	StringTable strings;
+	std::vector<ScalePackBank> records(banks.size());
+
+	for (size_t b = 0; b < banks.size(); b++) {
+
+		const ScalePackSource &src = banks[b];
+		ScalePackBank &rec = records[b];
+
+		memset(&rec, 0, sizeof(rec));
+		rec.name = strings.add(src.name);
+		rec.description = strings.add(src.description);
+		for (int i = 0; i < 11; i++) {
+			rec.scalename[i] = strings.add(src.scalename[i]);
+		}
+		for (int i = 0; i < 231; i++) {
+			rec.notedesc[i] = strings.add(src.notedesc[i]);
+			rec.freq[i] = src.freq[i];
+		}
+
+		design_bank(rec.freq, rec.c_maxq48000, rec.c_maxq96000, &rec.bpre);
+
+	}
+
+	ScalePackHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, SCALEPACK_MAGIC, sizeof(SCALEPACK_MAGIC));
+	header.version = SCALEPACK_VERSION;
+	header.numBanks = records.size();
+	header.bankOffset = sizeof(ScalePackHeader);
+	header.bankSize = sizeof(ScalePackBank);
+	header.stringOffset = header.bankOffset + records.size() * sizeof(ScalePackBank);
+	header.stringSize = strings.table.size();
+
+	// Written beside the target and renamed over it, so an open pack is never seen half written
+	std::string tmpPath = std::string(path) + ".tmp";
+
+	FILE *file = fopen(tmpPath.c_str(), "wb");
+	if (!file) {
+		*error = "Could not write scale pack '" + std::string(path) + "'";
+		return false;
+	}
+
+	bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+	if (ok && !records.empty()) {
+		ok = fwrite(records.data(), sizeof(ScalePackBank), records.size(), file) == records.size();
+	}
+	ok = ok && fwrite(strings.table.data(), 1, strings.table.size(), file) == strings.table.size();
+	ok = (fclose(file) == 0) && ok;
+
+	if (ok) {
+#if defined(ARCH_WIN)
+		ok = move_aside(path);
+#endif
+		ok = ok && rename(tmpPath.c_str(), path) == 0;
+	}
+
+	if (!ok) {
+		remove(tmpPath.c_str());
+		*error = "Could not write scale pack '" + std::string(path) + "'";
+		return false;
+	}
+
+	return true;
+
+}
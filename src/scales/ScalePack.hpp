@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "Scales.hpp"
+
+// Scale pack: a file of banks that is mapped into memory and used in place, so a bank
+// can be picked from a large library without parsing or copying.
+//
+//	ScalePackHeader
+//	ScalePackBank[numBanks]		from bankOffset
+//	string table				from stringOffset, NUL terminated strings
+//
+// Text fields of a bank are offsets into the string table. Everything is little endian,
+// which covers every platform Rack runs on. Bank records start on a 64 byte boundary and
+// are a multiple of 64 bytes long, so the BpRe records of a mapped pack stay cache line aligned.
+
+const char SCALEPACK_MAGIC[8] = {'R', 'B', 'W', 'S', 'C', 'P', 'A', 'K'};
+const uint32_t SCALEPACK_VERSION = 2;
+
+struct ScalePackHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t numBanks;
+	uint32_t bankOffset;
+	uint32_t bankSize;		// sizeof(ScalePackBank) when written
+	uint32_t stringOffset;
+	uint32_t stringSize;
+	uint32_t reserved[8];
+};
+
+struct ScalePackBank {
+	uint32_t name;
+	uint32_t description;
+	uint32_t scalename[11];
+	uint32_t notedesc[231];
+	double freq[231];	// Hz
+	float c_maxq48000[231];
+	float c_maxq96000[231];
+	BpreBank bpre;
+};
+
+static_assert(sizeof(ScalePackHeader) == 64, "ScalePackHeader layout");
+static_assert(sizeof(ScalePackBank) % 64 == 0, "ScalePackBank records must stay cache line aligned");
+
+// Read-only view of a mapped pack
+struct ScalePack {
+
+	std::string path;
+	std::string lastError;
+
+	ScalePack() {}
+	~ScalePack();
+
+	bool open(const char *path);
+	void close(void);
+
+	bool isOpen(void) const { return data != NULL; }
+	int size(void) const { return header ? header->numBanks : 0; }
+
+	// NULL if out of range
+	const ScalePackBank *bank(int i) const;
+
+	// Empty string for an offset outside the string table
+	const char *string(uint32_t offset) const;
+
+private:
+	const uint8_t *data = NULL;
+	size_t length = 0;
+	const ScalePackHeader *header = NULL;
+	void *handle = NULL;	// Windows file mapping
+
+	bool validate(void);
+
+	ScalePack(const ScalePack &) = delete;
+	ScalePack &operator=(const ScalePack &) = delete;
+
+};
+
+// A bank as the writer takes it, coefficients are designed from freq
+struct ScalePackSource {
+	std::string name;
+	std::string description;
+	std::string scalename[11];
+	std::string notedesc[231];
+	double freq[231];
+};
+
+bool write_scale_pack(const char *path, const std::vector<ScalePackSource> &banks, std::string *error);
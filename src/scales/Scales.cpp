@@ -1,49 +1,116 @@
-#include "Scales.hpp"
-
-ScaleSet::ScaleSet() {
-
-	presets.push_back(&et_major);
-	presets.push_back(&et_minor);
-	presets.push_back(&et_intervals);
-	presets.push_back(&et_triads);
-	presets.push_back(&et_chromatic);
-	presets.push_back(&et_wholestep);
-	presets.push_back(&ji_intervals);
-	presets.push_back(&ji_triads);
-	presets.push_back(&ji_wholestep);
-	presets.push_back(&indian_penta);
-	presets.push_back(&indian_shrutis);
-	presets.push_back(&mesopotamian);
-	presets.push_back(&gamelan);
-	presets.push_back(&wc_alpha2);
-	presets.push_back(&wc_alpha1);
-	presets.push_back(&wc_gamma);
-	presets.push_back(&seventeen);
-	presets.push_back(&bohlenpierce);
-	presets.push_back(&buchla296);
-	presets.push_back(&userscale);
-
-	full.push_back(&et_major);
-	full.push_back(&et_minor);
-	full.push_back(&et_intervals);
-	full.push_back(&et_triads);
-	full.push_back(&et_chromatic);
-	full.push_back(&et_wholestep);
-	full.push_back(&ji_intervals);
-	full.push_back(&ji_triads);
-	full.push_back(&ji_wholestep);
-	full.push_back(&indian_penta);
-	full.push_back(&indian_shrutis);
-	full.push_back(&mesopotamian);
-	full.push_back(&gamelan);
-	full.push_back(&wc_alpha2);
-	full.push_back(&wc_alpha1);
-	full.push_back(&wc_gamma);
-	full.push_back(&seventeen);
-	full.push_back(&bohlenpierce);
-	full.push_back(&buchla296);
-	full.push_back(&userscale);
-	full.push_back(&gamma_notused);
-	full.push_back(&video_notused);
-
-}
+#include <math.h>
+
+#include "Scales.hpp"
+
+// MaxQ coefficient: the angular frequency of the note at the given sample rate
+static float maxq_coef(double freq, double samplerate) {
+	return 2.0 * M_PI * freq / samplerate;
+}
+
+// BpRe coefficients {c0, c1, c2}: a two-pole resonator with zeros at DC and Nyquist,
+// pole radius squared c1 = exp(-w/q) and the pole angle set so that the response peaks at w.
+// c0 scales the response at w to 2 * gain. Close to Nyquist the poles cannot be placed
+// far enough out, so they are held on the real axis and only the gain is corrected.
+static void bpre_coefs(double freq, double samplerate, double q, double gain, float *c) {
+
+	double w = 2.0 * M_PI * freq / samplerate;
+	double b = exp(-w / q);
+	double r = sqrt(b);
+	double a = (1.0 + b) * cos(w);
+
+	if (fabs(a) <= 2.0 * r) {
+		c[0] = gain * (1.0 - b);
+	} else {
+		a = a > 0.0 ? 2.0 * r : -2.0 * r;
+		double cw = cos(w);
+		double mag2 = (1.0 - b) * (1.0 - b) + a * a - 2.0 * a * (1.0 + b) * cw + 4.0 * b * cw * cw;
+		c[0] = gain * sqrt(mag2) / sin(w);
+	}
+
+	c[1] = b;
+	c[2] = -a;
+
+}
+
+// Low Q is q = 2 at unity gain, high Q is q = 800 at gain 20. The nudge neighbour is the next
+// note of the same scale; the 21st note of a scale is never played and is its own neighbour.
+static void design_bpre_rate(const double *freq, double samplerate, BpreRecord *r) {
+
+	float loq[231][3];
+	float hiq[231][3];
+
+	for (int i = 0; i < 231; i++) {
+		bpre_coefs(freq[i], samplerate, 2.0, 1.0, loq[i]);
+		bpre_coefs(freq[i], samplerate, 800.0, 20.0, hiq[i]);
+	}
+
+	for (int i = 0; i < 231; i++) {
+		int next = (i % 21) < 20 ? i + 1 : i;
+		for (int k = 0; k < 3; k++) {
+			r[i].loq[k]			= loq[i][k];
+			r[i].hiq[k]			= hiq[i][k];
+			r[i].loq_next[k]	= loq[next][k];
+			r[i].hiq_next[k]	= hiq[next][k];
+		}
+		r[i].loq[3] = r[i].hiq[3] = r[i].loq_next[3] = r[i].hiq_next[3] = 0.0f;
+	}
+
+}
+
+void design_bpre(const float *c_maxq96000, BpreBank *b) {
+
+	double freq[231];
+	for (int i = 0; i < 231; i++) {
+		freq[i] = c_maxq96000[i] * 96000.0 / (2.0 * M_PI);
+	}
+
+	design_bpre_rate(freq, 48000.0, b->r48000);
+	design_bpre_rate(freq, 96000.0, b->r96000);
+
+}
+
+void design_bank(const double *freq, float *c_maxq48000, float *c_maxq96000, BpreBank *b) {
+
+	for (int i = 0; i < 231; i++) {
+		c_maxq48000[i] = maxq_coef(freq[i], 48000.0);
+		c_maxq96000[i] = maxq_coef(freq[i], 96000.0);
+	}
+
+	design_bpre_rate(freq, 48000.0, b->r48000);
+	design_bpre_rate(freq, 96000.0, b->r96000);
+
+}
+
+Scale::Scale(const ScaleDef &def) : ScaleDef(def) {
+	design_bank(freq, c_maxq48000, c_maxq96000, &bpre);
+}
+
+// Function local static, so construction is thread safe and happens once
+const ScaleSet &ScaleSet::get(void) {
+	static ScaleSet scales;
+	return scales;
+}
+
+ScaleSet::ScaleSet() {
+
+	const ScaleDef *defs[] = {
+		&et_major, &et_minor, &et_intervals, &et_triads, &et_chromatic, &et_wholestep,
+		&ji_intervals, &ji_triads, &ji_wholestep, &indian_penta, &indian_shrutis,
+		&mesopotamian, &gamelan, &wc_alpha2, &wc_alpha1, &wc_gamma, &seventeen,
+		&bohlenpierce, &buchla296, &userscale,
+		&gamma_notused, &video_notused
+	};
+	const size_t NUM_PRESETS = 20;	// Up to and including the user scale
+
+	// Reserved up front, so the pointers below are not moved by a reallocation
+	size_t n = sizeof(defs) / sizeof(defs[0]);
+	banks.reserve(n);
+	for (size_t i = 0; i < n; i++) {
+		banks.emplace_back(*defs[i]);
+		full.push_back(&banks[i]);
+		if (i < NUM_PRESETS) {
+			presets.push_back(&banks[i]);
+		}
+	}
+
+}
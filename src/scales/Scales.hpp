@@ -1,48 +1,84 @@
-#pragma once
-
-#include <vector>
-#include <string>
-
-struct Scale {
-	std::string name;
-	std::string description;
-	std::string scalename[11];
-	std::string notedesc[231];
-	float c_maxq48000[231];
-	float c_maxq96000[231];
-	float c_bpre4800022[231][3];
-	float c_bpre9600022[231][3];
-	float c_bpre4800080040[231][3];
-	float c_bpre9600080040[231][3];
-};
-
-struct ScaleSet {
-
-	std::vector<Scale *> presets;
-	std::vector<Scale *> full;
-	ScaleSet();
-	
-};
-
-extern Scale et_major;
-extern Scale et_minor;
-extern Scale et_intervals;
-extern Scale et_triads;
-extern Scale et_chromatic;
-extern Scale et_wholestep;
-extern Scale ji_intervals;
-extern Scale ji_triads;
-extern Scale ji_wholestep;
-extern Scale indian_penta;
-extern Scale indian_shrutis;
-extern Scale mesopotamian;
-extern Scale gamelan;
-extern Scale wc_alpha1;
-extern Scale wc_alpha2;
-extern Scale wc_gamma;
-extern Scale seventeen;
-extern Scale bohlenpierce;
-extern Scale buchla296;
-extern Scale userscale;
-extern Scale gamma_notused;
-extern Scale video_notused;
+#pragma once
+
+#include <vector>
+
+// BpRe coefficients {c0, c1, c2, 0} of a note at low and high Q, with those of the note
+// above it that the freq nudge blends towards. 64 bytes, so an array of them that starts
+// on a cache line costs the filter one line per lookup, and each half is a 4 wide load.
+struct alignas(16) BpreRecord {
+	float loq[4];
+	float hiq[4];
+	float loq_next[4];
+	float hiq_next[4];
+};
+
+// BpRe coefficients of a bank at both sample rates
+struct BpreBank {
+	BpreRecord r48000[231];
+	BpreRecord r96000[231];
+};
+
+// A bank as written in the scale files. Text is kept as pointers into the string literals,
+// so the banks need no constructors at plugin load
+struct ScaleDef {
+	const char *name;
+	const char *description;
+	const char *scalename[11];
+	const char *notedesc[231];
+	double freq[231];	// Hz
+};
+
+// A bank with the coefficient tables generated from its frequencies, built by the ScaleSet
+struct Scale : ScaleDef {
+	float c_maxq48000[231];
+	float c_maxq96000[231];
+	BpreBank bpre;
+
+	explicit Scale(const ScaleDef &def);
+};
+
+// Designs the BpRe coefficients of a bank from its 96kHz MaxQ coefficients
+void design_bpre(const float *c_maxq96000, BpreBank *b);
+
+// Designs every coefficient table of a bank from its note frequencies
+void design_bank(const double *freq, float *c_maxq48000, float *c_maxq96000, BpreBank *b);
+
+// Read-only registry of the built-in banks, built on first use and shared by every module
+struct ScaleSet {
+
+	std::vector<const Scale *> presets;	// Banks on the Rainbow, the user scale last
+	std::vector<const Scale *> full;	// Presets followed by the unused banks, for the expander
+
+	static const ScaleSet &get(void);
+
+private:
+	std::vector<Scale> banks;		// Same order as full
+
+	ScaleSet();
+	ScaleSet(const ScaleSet &) = delete;
+	ScaleSet &operator=(const ScaleSet &) = delete;
+	
+};
+
+extern const ScaleDef et_major;
+extern const ScaleDef et_minor;
+extern const ScaleDef et_intervals;
+extern const ScaleDef et_triads;
+extern const ScaleDef et_chromatic;
+extern const ScaleDef et_wholestep;
+extern const ScaleDef ji_intervals;
+extern const ScaleDef ji_triads;
+extern const ScaleDef ji_wholestep;
+extern const ScaleDef indian_penta;
+extern const ScaleDef indian_shrutis;
+extern const ScaleDef mesopotamian;
+extern const ScaleDef gamelan;
+extern const ScaleDef wc_alpha1;
+extern const ScaleDef wc_alpha2;
+extern const ScaleDef wc_gamma;
+extern const ScaleDef seventeen;
+extern const ScaleDef bohlenpierce;
+extern const ScaleDef buchla296;
+extern const ScaleDef userscale;
+extern const ScaleDef gamma_notused;
+extern const ScaleDef video_notused;
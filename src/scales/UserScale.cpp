@@ -1,1647 +1,482 @@
-#include "Scales.hpp"
-Scale userscale = {
-	.name = "User Scale",
-	.description = "The default notes of this scale are chromatic notes from a 12-TET scale starting at 320Hz.",
-	.scalename = {
-		"User Scale 1",
-		"User Scale 2",
-		"User Scale 3",
-		"User Scale 4",
-		"User Scale 5",
-		"User Scale 6",
-		"User Scale 7",
-		"User Scale 8",
-		"User Scale 9",
-		"User Scale 10",
-		"User Scale 11"},
-	.notedesc = {
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		""},
-	.c_maxq48000 = {
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403,
-		0.0418879020478639,
-		0.04437868631984896,
-		0.04701758033202771,
-		0.04981339114785682,
-		0.05277544952603832,
-		0.05591364106105937,
-		0.05923843917544491,
-		0.06276094007383176,
-		0.0664928997755201,
-		0.07044677334909502,
-		0.07463575648006014,
-		0.07907382951021134,
-		0.08377580409572788,
-		0.08875737263969798,
-		0.09403516066405548,
-		0.0996267822957137,
-		0.1055508990520767,
-		0.1118272821221188,
-		0.1184768783508899,
-		0.1255218801476636,
-		0.1329857995510403
-	},
-	.c_maxq96000 = {
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014,
-		0.02094395102393195,
-		0.02218934315992448,
-		0.02350879016601386,
-		0.02490669557392841,
-		0.02638772476301916,
-		0.02795682053052968,
-		0.02961921958772246,
-		0.03138047003691588,
-		0.03324644988776005,
-		0.03522338667454751,
-		0.03731787824003007,
-		0.03953691475510567,
-		0.04188790204786394,
-		0.04437868631984899,
-		0.04701758033202774,
-		0.04981339114785685,
-		0.05277544952603835,
-		0.0559136410610594,
-		0.05923843917544494,
-		0.0627609400738318,
-		0.06649289977552014
-	},
-	.c_bpre4800022 = {
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 },
-		{ 0.02072614967209857, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680288, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922776, 0.9767653794608022, -1.974580809170884 },
-		{ 0.02459906532374692, 0.9754009346763574, -1.97295059079096 },
-		{ 0.02604262783730762, 0.9739573721627821, -1.971209026070745 },
-		{ 0.02756966077765751, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918484783716176, 0.9708151521629699, -1.967358183416151 },
-		{ 0.03089319638756508, 0.9691068036125102, -1.965229988242712 },
-		{ 0.03269983948803607, 0.9673001605120788, -1.962952750670609 },
-		{ 0.03461028162583141, 0.965389718374251, -1.960514862776292 },
-		{ 0.03663013631707988, 0.9633698636829496, -1.957903933033421 },
-		{ 0.03876555807380458, 0.9612344419263598, -1.955106150799154 },
-		{ 0.04102272606396769, 0.9589772739360324, -1.952106864909625 },
-		{ 0.04340833547720258, 0.9565916645229069, -1.948889842759616 },
-		{ 0.04592939348685487, 0.9540706065132046, -1.945437420487276 },
-		{ 0.04859307890206107, 0.9514069210980726, -1.941730576712336 },
-		{ 0.05140697512464227, 0.9485930248754983, -1.937748481494553 },
-		{ 0.05437923535992246, 0.945620764640223, -1.933468097378719 },
-		{ 0.0575180020161515, 0.9424819979839062, -1.928864840746052 },
-		{ 0.06083206466046098, 0.9391679353396564, -1.923911452357369 },
-		{ 0.06433064443652586, 0.9356693555689969, -1.918578082517925 }
-	},
-	.c_bpre9600022 = {
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 },
-		{ 0.01041733527314638, 0.9895826647268539, -1.989146316370315 },
-		{ 0.01103334653629596, 0.9889666534637317, -1.988477023381098 },
-		{ 0.01168558673832309, 0.9883144132616918, -1.987765004005315 },
-		{ 0.01237611679533874, 0.9876238832047136, -1.987007411208512 },
-		{ 0.0131072134407443, 0.9868927865593009, -1.986201077128791 },
-		{ 0.0138811738830137, 0.9861188261170234, -1.985342716608454 },
-		{ 0.01470047591463906, 0.9852995240854275, -1.984428739239315 },
-		{ 0.01556777601886921, 0.9844322239811687, -1.983455236394819 },
-		{ 0.01648581072159138, 0.9835141892784665, -1.982418076371366 },
-		{ 0.01745752337409408, 0.9825424766259478, -1.981312745123842 },
-		{ 0.01848593301831821, 0.9815140669816963, -1.980134475907305 },
-		{ 0.01957435675814922, 0.9804256432419339, -1.978877973981329 },
-		{ 0.02072614967209856, 0.9792738503279012, -1.977537690880311 },
-		{ 0.02194495833680287, 0.9780550416632527, -1.976107505658993 },
-		{ 0.02323462053922775, 0.9767653794608022, -1.974580809170884 },
-		{ 0.0245990972436306, 0.9754009027564373, -1.972950552472927 },
-		{ 0.02604259596460873, 0.9739574040354629, -1.971209064714458 },
-		{ 0.0275696607776575, 0.9724303392224161, -1.969347899594127 },
-		{ 0.02918487960691032, 0.970815120393119, -1.967358144065264 },
-		{ 0.03089322810149502, 0.9691067718985645, -1.965229948508037 },
-		{ 0.03269996611001345, 0.9673000338927922, -1.962952590109784 }
-	},
-	.c_bpre4800080040 = {
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.00124529594560247, 0.999937735244887, -1.997456955209468 },
-		{ 0.001319344307863962, 0.9999340328208202, -1.997149519355293 },
-		{ 0.001397793582472055, 0.9999301103507083, -1.996804695118861 },
-		{ 0.001480906106869411, 0.9999259547481415, -1.996417923305487 },
-		{ 0.001568961703392226, 0.9999215519454125, -1.995984067905962 },
-		{ 0.001662253246284515, 0.9999168873844064, -1.995497399940027 },
-		{ 0.001761093429683803, 0.9999119453622065, -1.994951462537217 },
-		{ 0.001865806524975967, 0.9999067096856005, -1.994339062151242 },
-		{ 0.001976750824043841, 0.9999011625258816, -1.993652049066018 },
-		{ 0.002094285443954835, 0.9998952857278023, -1.992881371474502 },
-		{ 0.002218810877960024, 0.9998890595007939, -1.992016804210456 },
-		{ 0.002350742289371027, 0.9998824629098942, -1.991046877708664 },
-		{ 0.002490517035256969, 0.9998754742030694, -1.989958791215016 },
-		{ 0.002638598018658183, 0.999868070156912, -1.988738164750082 },
-		{ 0.002795489473634275, 0.9998602255859801, -1.987368769732056 },
-		{ 0.00296170416647593, 0.9998519148153817, -1.985832583875076 },
-		{ 0.00313780334169097, 0.9998431098813232, -1.98410926248433 },
-		{ 0.003324425184280323, 0.9998337810221296, -1.982175958878558 }
-	},
-	.c_bpre9600080040 = {
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 },
-		{ 0.0005235919217739191, 0.9999738204039116, -1.999535193095221 },
-		{ 0.0005547257981006697, 0.9999722637212681, -1.999479924353485 },
-		{ 0.0005877114771890489, 0.9999706144322313, -1.999417984344785 },
-		{ 0.0006226576653654479, 0.9999688671378159, -1.999348566279952 },
-		{ 0.0006596830334723033, 0.9999670158664333, -1.999270754822597 },
-		{ 0.0006989090030777142, 0.9999650545647624, -1.999183534408319 },
-		{ 0.0007404667606935341, 0.9999629766887083, -1.999085760212429 },
-		{ 0.0007844962375519657, 0.9999607752034141, -1.998976142507535 },
-		{ 0.0008311438931447723, 0.9999584428287039, -1.998853242636723 },
-		{ 0.0008805660997603434, 0.999955971711858, -1.998715438966572 },
-		{ 0.0009329250212183642, 0.999953353754864, -1.998560924681557 },
-		{ 0.0009883998353641603, 0.9999505800417747, -1.998387652372128 },
-		{ 0.001047170136106817, 0.9999476414931946, -1.998193347618217 },
-		{ 0.001109436210187689, 0.9999445282118374, -1.997975440449704 },
-		{ 0.001175405684141812, 0.9999412297279745, -1.997731047256422 },
-		{ 0.001245297286747676, 0.9999377351630797, -1.997456948610104 },
-		{ 0.001319342525932598, 0.9999340329026269, -1.997149526341842 },
-		{ 0.001397793582472054, 0.9999301103507083, -1.996804695118861 },
-		{ 0.00148090691036122, 0.9999259546663352, -1.996417915474354 },
-		{ 0.001568963211965507, 0.9999215518636064, -1.995984059614644 },
-		{ 0.001662281670695924, 0.9999168870571845, -1.995497364824977 }
-	}
-};
+#include "Scales.hpp"
+const ScaleDef userscale = {
+	.name = "User Scale",
+	.description = "The default notes of this scale are chromatic notes from a 12-TET scale starting at 320Hz.",
+	.scalename = {
+		"User Scale 1",
+		"User Scale 2",
+		"User Scale 3",
+		"User Scale 4",
+		"User Scale 5",
+		"User Scale 6",
+		"User Scale 7",
+		"User Scale 8",
+		"User Scale 9",
+		"User Scale 10",
+		"User Scale 11"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.freq = {
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649,
+		319.9999999999999,
+		339.0281901949745,
+		359.1878554589995,
+		380.5462768008708,
+		403.1747359663595,
+		427.1487533344111,
+		452.5483399593907,
+		479.4582646005383,
+		507.9683366298241,
+		538.1737057623777,
+		570.1751796098174,
+		604.0795601162841,
+		640.0000000000005,
+		678.0563803899495,
+		718.3757109179993,
+		761.0925536017421,
+		806.3494719327196,
+		854.297506668823,
+		905.0966799187817,
+		958.9165292010772,
+		1015.936673259649
+	}
+};
@@ -1,1647 +1,482 @@
-#include "Scales.hpp"
-Scale video_notused = {
-	.name = "Video",
-	.description = "Scales derived from the NTSC frame rate of 59.94Hz, each note is the next multiple of base frequency. This is not used in SMR",
-	.scalename = {
-		"Video H 1; 59.94hz-",
-		"Video H 2; 119.88Hz-",
-		"Video H 3; 179.82Hz-",
-		"Video H 4; 239.76Hz-",
-		"Video H 5; 299.70Hz-",
-		"Video H 6; 359.64Hz-",
-		"Video H 7; 419.58Hz-",
-		"Video H 8; 479.52Hz-",
-		"Video H 9; 539.46Hz-",
-		"Video H 10; 599.40Hz-",
-		"Video V 1; 15729.00Hz-"},
-	.notedesc = {
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		"",
-		""},
-	.c_maxq48000 = {
-		0.007846127652340509,
-		0.01569225530468102,
-		0.02353838295702152,
-		0.03138451060936204,
-		0.03923063826170254,
-		0.04707676591404305,
-		0.05492289356638356,
-		0.06276902121872407,
-		0.07061514887106457,
-		0.07846127652340508,
-		0.08630740417574559,
-		0.0941535318280861,
-		0.1019996594804266,
-		0.1098457871327671,
-		0.1176919147851076,
-		0.1255380424374481,
-		0.1333841700897886,
-		0.1412302977421291,
-		0.1490764253944697,
-		0.1569225530468102,
-		0.1647686806991507,
-		0.01569225530468102,
-		0.03138451060936204,
-		0.04707676591404305,
-		0.06276902121872407,
-		0.07846127652340508,
-		0.0941535318280861,
-		0.1098457871327671,
-		0.1255380424374481,
-		0.1412302977421291,
-		0.1569225530468102,
-		0.1726148083514912,
-		0.1883070636561722,
-		0.2039993189608532,
-		0.2196915742655342,
-		0.2353838295702152,
-		0.2510760848748963,
-		0.2667683401795773,
-		0.2824605954842583,
-		0.2981528507889393,
-		0.3138451060936203,
-		0.3295373613983014,
-		0.02353838295702152,
-		0.04707676591404305,
-		0.07061514887106457,
-		0.0941535318280861,
-		0.1176919147851076,
-		0.1412302977421291,
-		0.1647686806991507,
-		0.1883070636561722,
-		0.2118454466131937,
-		0.2353838295702152,
-		0.2589222125272367,
-		0.2824605954842583,
-		0.3059989784412798,
-		0.3295373613983014,
-		0.3530757443553228,
-		0.3766141273123444,
-		0.4001525102693659,
-		0.4236908932263874,
-		0.447229276183409,
-		0.4707676591404305,
-		0.494306042097452,
-		0.03138451060936204,
-		0.06276902121872407,
-		0.0941535318280861,
-		0.1255380424374481,
-		0.1569225530468102,
-		0.1883070636561722,
-		0.2196915742655342,
-		0.2510760848748963,
-		0.2824605954842583,
-		0.3138451060936203,
-		0.3452296167029824,
-		0.3766141273123444,
-		0.4079986379217065,
-		0.4393831485310685,
-		0.4707676591404305,
-		0.5021521697497926,
-		0.5335366803591546,
-		0.5649211909685166,
-		0.5963057015778787,
-		0.6276902121872406,
-		0.6590747227966027,
-		0.03923063826170254,
-		0.07846127652340508,
-		0.1176919147851076,
-		0.1569225530468102,
-		0.1961531913085127,
-		0.2353838295702152,
-		0.2746144678319178,
-		0.3138451060936203,
-		0.3530757443553229,
-		0.3923063826170254,
-		0.4315370208787279,
-		0.4707676591404305,
-		0.5099982974021331,
-		0.5492289356638356,
-		0.5884595739255382,
-		0.6276902121872406,
-		0.6669208504489431,
-		0.7061514887106458,
-		0.7453821269723482,
-		0.7846127652340509,
-		0.8238434034957532,
-		0.04707676591404305,
-		0.0941535318280861,
-		0.1412302977421291,
-		0.1883070636561722,
-		0.2353838295702152,
-		0.2824605954842583,
-		0.3295373613983014,
-		0.3766141273123444,
-		0.4236908932263874,
-		0.4707676591404305,
-		0.5178444250544735,
-		0.5649211909685166,
-		0.6119979568825596,
-		0.6590747227966027,
-		0.7061514887106456,
-		0.7532282546246888,
-		0.8003050205387319,
-		0.8473817864527748,
-		0.8944585523668179,
-		0.9415353182808609,
-		0.9886120841949041,
-		0.05492289356638356,
-		0.1098457871327671,
-		0.1647686806991507,
-		0.2196915742655342,
-		0.2746144678319178,
-		0.3295373613983014,
-		0.3844602549646849,
-		0.4393831485310685,
-		0.494306042097452,
-		0.5492289356638356,
-		0.604151829230219,
-		0.6590747227966027,
-		0.7139976163629863,
-		0.7689205099293698,
-		0.8238434034957532,
-		0.8787662970621369,
-		0.9336891906285206,
-		0.9886120841949041,
-		1.043534977761287,
-		1.098457871327671,
-		1.153380764894055,
-		0.06276902121872407,
-		0.1255380424374481,
-		0.1883070636561722,
-		0.2510760848748963,
-		0.3138451060936203,
-		0.3766141273123444,
-		0.4393831485310685,
-		0.5021521697497926,
-		0.5649211909685166,
-		0.6276902121872406,
-		0.6904592334059647,
-		0.7532282546246888,
-		0.815997275843413,
-		0.8787662970621369,
-		0.9415353182808609,
-		1.004304339499585,
-		1.067073360718309,
-		1.129842381937033,
-		1.192611403155757,
-		1.255380424374481,
-		1.318149445593205,
-		0.07061514887106457,
-		0.1412302977421291,
-		0.2118454466131937,
-		0.2824605954842583,
-		0.3530757443553228,
-		0.4236908932263874,
-		0.494306042097452,
-		0.5649211909685166,
-		0.6355363398395812,
-		0.7061514887106456,
-		0.7767666375817103,
-		0.8473817864527748,
-		0.9179969353238395,
-		0.988612084194904,
-		1.059227233065969,
-		1.129842381937033,
-		1.200457530808098,
-		1.271072679679162,
-		1.341687828550227,
-		1.412302977421291,
-		1.482918126292356,
-		0.07846127652340508,
-		0.1569225530468102,
-		0.2353838295702152,
-		0.3138451060936203,
-		0.3923063826170254,
-		0.4707676591404305,
-		0.5492289356638356,
-		0.6276902121872406,
-		0.7061514887106458,
-		0.7846127652340509,
-		0.8630740417574558,
-		0.9415353182808609,
-		1.019996594804266,
-		1.098457871327671,
-		1.176919147851076,
-		1.255380424374481,
-		1.333841700897886,
-		1.412302977421292,
-		1.490764253944696,
-		1.569225530468102,
-		1.647686806991506,
-		2.058921285346411,
-		2.05905218504031,
-		2.05918308473421,
-		2.05931398442811,
-		2.059444884122009,
-		2.059575783815908,
-		2.059706683509808,
-		2.059837583203707,
-		2.059968482897607,
-		2.060099382591507,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406,
-		2.060230282285406
-	},
-	.c_maxq96000 = {
-		0.003923063826170255,
-		0.007846127652340509,
-		0.01176919147851076,
-		0.01569225530468102,
-		0.01961531913085127,
-		0.02353838295702152,
-		0.02746144678319178,
-		0.03138451060936204,
-		0.03530757443553229,
-		0.03923063826170254,
-		0.04315370208787279,
-		0.04707676591404305,
-		0.05099982974021331,
-		0.05492289356638356,
-		0.05884595739255381,
-		0.06276902121872407,
-		0.06669208504489432,
-		0.07061514887106457,
-		0.07453821269723483,
-		0.07846127652340508,
-		0.08238434034957534,
-		0.007846127652340509,
-		0.01569225530468102,
-		0.02353838295702152,
-		0.03138451060936204,
-		0.03923063826170254,
-		0.04707676591404305,
-		0.05492289356638356,
-		0.06276902121872407,
-		0.07061514887106457,
-		0.07846127652340508,
-		0.08630740417574559,
-		0.0941535318280861,
-		0.1019996594804266,
-		0.1098457871327671,
-		0.1176919147851076,
-		0.1255380424374481,
-		0.1333841700897886,
-		0.1412302977421291,
-		0.1490764253944697,
-		0.1569225530468102,
-		0.1647686806991507,
-		0.01176919147851076,
-		0.02353838295702152,
-		0.03530757443553229,
-		0.04707676591404305,
-		0.05884595739255381,
-		0.07061514887106457,
-		0.08238434034957534,
-		0.0941535318280861,
-		0.1059227233065969,
-		0.1176919147851076,
-		0.1294611062636184,
-		0.1412302977421291,
-		0.1529994892206399,
-		0.1647686806991507,
-		0.1765378721776614,
-		0.1883070636561722,
-		0.200076255134683,
-		0.2118454466131937,
-		0.2236146380917045,
-		0.2353838295702152,
-		0.247153021048726,
-		0.01569225530468102,
-		0.03138451060936204,
-		0.04707676591404305,
-		0.06276902121872407,
-		0.07846127652340508,
-		0.0941535318280861,
-		0.1098457871327671,
-		0.1255380424374481,
-		0.1412302977421291,
-		0.1569225530468102,
-		0.1726148083514912,
-		0.1883070636561722,
-		0.2039993189608532,
-		0.2196915742655342,
-		0.2353838295702152,
-		0.2510760848748963,
-		0.2667683401795773,
-		0.2824605954842583,
-		0.2981528507889393,
-		0.3138451060936203,
-		0.3295373613983014,
-		0.01961531913085127,
-		0.03923063826170254,
-		0.05884595739255381,
-		0.07846127652340508,
-		0.09807659565425636,
-		0.1176919147851076,
-		0.1373072339159589,
-		0.1569225530468102,
-		0.1765378721776615,
-		0.1961531913085127,
-		0.215768510439364,
-		0.2353838295702152,
-		0.2549991487010665,
-		0.2746144678319178,
-		0.2942297869627691,
-		0.3138451060936203,
-		0.3334604252244716,
-		0.3530757443553229,
-		0.3726910634861741,
-		0.3923063826170254,
-		0.4119217017478766,
-		0.02353838295702152,
-		0.04707676591404305,
-		0.07061514887106457,
-		0.0941535318280861,
-		0.1176919147851076,
-		0.1412302977421291,
-		0.1647686806991507,
-		0.1883070636561722,
-		0.2118454466131937,
-		0.2353838295702152,
-		0.2589222125272367,
-		0.2824605954842583,
-		0.3059989784412798,
-		0.3295373613983014,
-		0.3530757443553228,
-		0.3766141273123444,
-		0.4001525102693659,
-		0.4236908932263874,
-		0.447229276183409,
-		0.4707676591404305,
-		0.494306042097452,
-		0.02746144678319178,
-		0.05492289356638356,
-		0.08238434034957534,
-		0.1098457871327671,
-		0.1373072339159589,
-		0.1647686806991507,
-		0.1922301274823424,
-		0.2196915742655342,
-		0.247153021048726,
-		0.2746144678319178,
-		0.3020759146151095,
-		0.3295373613983014,
-		0.3569988081814932,
-		0.3844602549646849,
-		0.4119217017478766,
-		0.4393831485310685,
-		0.4668445953142603,
-		0.494306042097452,
-		0.5217674888806437,
-		0.5492289356638356,
-		0.5766903824470274,
-		0.03138451060936204,
-		0.06276902121872407,
-		0.0941535318280861,
-		0.1255380424374481,
-		0.1569225530468102,
-		0.1883070636561722,
-		0.2196915742655342,
-		0.2510760848748963,
-		0.2824605954842583,
-		0.3138451060936203,
-		0.3452296167029824,
-		0.3766141273123444,
-		0.4079986379217065,
-		0.4393831485310685,
-		0.4707676591404305,
-		0.5021521697497926,
-		0.5335366803591546,
-		0.5649211909685166,
-		0.5963057015778787,
-		0.6276902121872406,
-		0.6590747227966027,
-		0.03530757443553229,
-		0.07061514887106457,
-		0.1059227233065969,
-		0.1412302977421291,
-		0.1765378721776614,
-		0.2118454466131937,
-		0.247153021048726,
-		0.2824605954842583,
-		0.3177681699197906,
-		0.3530757443553228,
-		0.3883833187908551,
-		0.4236908932263874,
-		0.4589984676619198,
-		0.494306042097452,
-		0.5296136165329843,
-		0.5649211909685166,
-		0.6002287654040489,
-		0.6355363398395812,
-		0.6708439142751135,
-		0.7061514887106456,
-		0.741459063146178,
-		0.03923063826170254,
-		0.07846127652340508,
-		0.1176919147851076,
-		0.1569225530468102,
-		0.1961531913085127,
-		0.2353838295702152,
-		0.2746144678319178,
-		0.3138451060936203,
-		0.3530757443553229,
-		0.3923063826170254,
-		0.4315370208787279,
-		0.4707676591404305,
-		0.5099982974021331,
-		0.5492289356638356,
-		0.5884595739255382,
-		0.6276902121872406,
-		0.6669208504489431,
-		0.7061514887106458,
-		0.7453821269723482,
-		0.7846127652340509,
-		0.8238434034957532,
-		1.029460642673205,
-		1.029526092520155,
-		1.029591542367105,
-		1.029656992214055,
-		1.029722442061004,
-		1.029787891907954,
-		1.029853341754904,
-		1.029918791601854,
-		1.029984241448804,
-		1.030049691295754,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703,
-		1.030115141142703
-	},
-	.c_bpre4800022 = {
-		{ 0.003915378664356529, 0.9960846213356436, -1.99602318045043 },
-		{ 0.007815427138627033, 0.992184572861373, -1.991939293280438 },
-		{ 0.0117002054463117, 0.9882997945536881, -1.987749005794193 },
-		{ 0.01556977337589536, 0.984430226624105, -1.98345298735205 },
-		{ 0.01942419048176635, 0.9805758095182333, -1.979051909332481 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.02708780927495684, 0.9729121907250433, -1.969937269943619 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.04223583159919122, 0.9577641684008088, -1.950477032220024 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.04972116767331558, 0.9502788323266844, -1.940142342431827 },
-		{ 0.05344186913859653, 0.9465581308614033, -1.934826254914476 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.06083962524281872, 0.9391603747571811, -1.923900042275459 },
-		{ 0.06451679373655252, 0.9354832062634477, -1.918291301042256 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.07182799457451328, 0.9281720054254866, -1.906786020115412 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.07908205525503001, 0.9209179447449701, -1.894901653881822 },
-		{ 0.007815427138627033, 0.992184572861373, -1.991939293280438 },
-		{ 0.01556977337589536, 0.984430226624105, -1.98345298735205 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.05344186913859653, 0.9465581308614033, -1.934826254914476 },
-		{ 0.06083962524281872, 0.9391603747571811, -1.923900042275459 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.08268779772750733, 0.9173122022724928, -1.888819061422648 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.0969701408318332, 0.9030298591681668, -1.86356901277618 },
-		{ 0.1040277049001669, 0.8959722950998332, -1.850402052186455 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1179777904859517, 0.8820222095140483, -1.823012594685647 },
-		{ 0.1248711707990603, 0.87512882920094, -1.808801486309486 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1384967283444307, 0.8615032716555694, -1.779375104250915 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.1519101390466998, 0.8480898609533, -1.748648132039076 },
-		{ 0.0117002054463117, 0.9882997945536881, -1.987749005794193 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.07908205525503001, 0.9209179447449701, -1.894901653881822 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.1005058446756966, 0.8994941553243031, -1.857030104722727 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1214312414265713, 0.8785687585734286, -1.815949477442828 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1418698398735443, 0.8581301601264558, -1.771813492636457 },
-		{ 0.1519101390466998, 0.8480898609533, -1.748648132039076 },
-		{ 0.1618329646567882, 0.8381670353432119, -1.72477713787247 },
-		{ 0.17163969116863, 0.82836030883137, -1.700220041348026 },
-		{ 0.1813316769655271, 0.8186683230344728, -1.674996422644837 },
-		{ 0.1909102645374184, 0.8090897354625817, -1.649125903703688 },
-		{ 0.2003767806668324, 0.7996232193331674, -1.622628141090434 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.21897882829184, 0.7810211717081603, -1.567829642378306 },
-		{ 0.01556977337589536, 0.984430226624105, -1.98345298735205 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.06083962524281872, 0.9391603747571811, -1.923900042275459 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.1040277049001669, 0.8959722950998332, -1.850402052186455 },
-		{ 0.1179777904859517, 0.8820222095140483, -1.823012594685647 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.1585383235619891, 0.8414616764380108, -1.732811335102088 },
-		{ 0.17163969116863, 0.82836030883137, -1.700220041348026 },
-		{ 0.1845370734507209, 0.8154629265492791, -1.666443824086411 },
-		{ 0.1972336464135376, 0.8027663535864628, -1.631529207793871 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.2220368219239564, 0.7779631780760438, -1.558471357082591 },
-		{ 0.2341495323013916, 0.7658504676986085, -1.52042156556324 },
-		{ 0.2460736505232821, 0.7539263494767179, -1.481420204124197 },
-		{ 0.2578121129267507, 0.7421878870732496, -1.441514021182973 },
-		{ 0.2693678101308153, 0.7306321898691847, -1.400749726981239 },
-		{ 0.2807435877482129, 0.7192564122517874, -1.359173967492933 },
-		{ 0.01942419048176635, 0.9805758095182333, -1.979051909332481 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.09342053895250405, 0.9065794610474958, -1.870018068499897 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1282976315454757, 0.8717023684545241, -1.801569336653276 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.1618329646567882, 0.8381670353432119, -1.72477713787247 },
-		{ 0.178113680806832, 0.8218863191931678, -1.68347714311367 },
-		{ 0.1940781572251977, 0.8059218427748021, -1.64036203834546 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.2250828423530501, 0.7749171576469499, -1.549050676111113 },
-		{ 0.2401349808307736, 0.7598650191692264, -1.501036908729762 },
-		{ 0.2548947437035475, 0.7451052562964524, -1.451572838552629 },
-		{ 0.2693678101308153, 0.7306321898691847, -1.400749726981239 },
-		{ 0.2835597489589445, 0.7164402510410555, -1.348658694252415 },
-		{ 0.297476020863971, 0.7025239791360292, -1.295390640733644 },
-		{ 0.3111219804527173, 0.6888780195472826, -1.241036170276528 },
-		{ 0.3245028783231063, 0.6754971216768939, -1.185685515805065 },
-		{ 0.337623863084443, 0.662376136915557, -1.129428466282379 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1519101390466998, 0.8480898609533, -1.748648132039076 },
-		{ 0.17163969116863, 0.82836030883137, -1.700220041348026 },
-		{ 0.1909102645374184, 0.8090897354625817, -1.649125903703688 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.2281169364587445, 0.7718830635412556, -1.539568330109206 },
-		{ 0.2460736505232821, 0.7539263494767179, -1.481420204124197 },
-		{ 0.2636126282813431, 0.7363873717186569, -1.421236220805382 },
-		{ 0.2807435877482129, 0.7192564122517874, -1.359173967492933 },
-		{ 0.297476020863971, 0.7025239791360292, -1.295390640733644 },
-		{ 0.313819198752797, 0.686180801247203, -1.230042854013929 },
-		{ 0.3297821768599241, 0.6702178231400759, -1.163286451739291 },
-		{ 0.3453737999690896, 0.6546262000309104, -1.095276328583262 },
-		{ 0.3606027071032616, 0.6393972928967385, -1.026166254779035 },
-		{ 0.3754773363113585, 0.6245226636886416, -0.9561087063951917 },
-		{ 0.3900059293436125, 0.6099940706563877, -0.8852547010309897 },
-		{ 0.02708780927495684, 0.9729121907250433, -1.969937269943619 },
-		{ 0.05344186913859653, 0.9465581308614033, -1.934826254914476 },
-		{ 0.07908205525503001, 0.9209179447449701, -1.894901653881822 },
-		{ 0.1040277049001669, 0.8959722950998332, -1.850402052186455 },
-		{ 0.1282976315454757, 0.8717023684545241, -1.801569336653276 },
-		{ 0.1519101390466998, 0.8480898609533, -1.748648132039076 },
-		{ 0.1748830354482277, 0.8251169645517723, -1.691885258276193 },
-		{ 0.1972336464135376, 0.8027663535864628, -1.631529207793871 },
-		{ 0.21897882829184, 0.7810211717081603, -1.567829642378306 },
-		{ 0.2401349808307736, 0.7598650191692264, -1.501036908729762 },
-		{ 0.2607180595447407, 0.7392819404552594, -1.431401572157294 },
-		{ 0.2807435877482129, 0.7192564122517874, -1.359173967492933 },
-		{ 0.3002266682630787, 0.6997733317369215, -1.284603766716451 },
-		{ 0.3191819948088692, 0.6808180051911308, -1.207939562401585 },
-		{ 0.3376238630844431, 0.662376136915557, -1.129428466282379 },
-		{ 0.3555661815494941, 0.6444338184505061, -1.049315722209616 },
-		{ 0.3730224819140137, 0.6269775180859865, -0.9678443331684996 },
-		{ 0.3900059293436125, 0.6099940706563877, -0.8852547010309897 },
-		{ 0.406529332388407, 0.5934706676115931, -0.8017842789746349 },
-		{ 0.4226051526429508, 0.5773948473570492, -0.7176672358059065 },
-		{ 0.4382455141445016, 0.5617544858554986, -0.6331341316874274 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.06083962524281872, 0.9391603747571811, -1.923900042275459 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.1179777904859517, 0.8820222095140483, -1.823012594685647 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.17163969116863, 0.82836030883137, -1.700220041348026 },
-		{ 0.1972336464135376, 0.8027663535864628, -1.631529207793871 },
-		{ 0.2220368219239564, 0.7779631780760438, -1.558471357082591 },
-		{ 0.2460736505232821, 0.7539263494767179, -1.481420204124197 },
-		{ 0.2693678101308153, 0.7306321898691847, -1.400749726981239 },
-		{ 0.2919422470861323, 0.7080577529138676, -1.3168332984562 },
-		{ 0.313819198752797, 0.686180801247203, -1.230042854013929 },
-		{ 0.3350202154236845, 0.6649797845763153, -1.140748094622609 },
-		{ 0.3555661815494941, 0.6444338184505061, -1.049315722209616 },
-		{ 0.3754773363113585, 0.6245226636886416, -0.9561087063951917 },
-		{ 0.3947732935578219, 0.6052267064421781, -0.8614855805294528 },
-		{ 0.4134730611258225, 0.5865269388741774, -0.7657997657682726 },
-		{ 0.4315950595647099, 0.5684049404352901, -0.669398921141118 },
-		{ 0.4491571402817454, 0.5508428597182548, -0.5726243189882749 },
-		{ 0.4661766031269599, 0.53382339687304, -0.4758102440512311 },
-		{ 0.4826695362674829, 0.5173304637488634, -0.3792874307013618 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.1005058446756968, 0.8994941553243031, -1.857030104722727 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1618329646567882, 0.8381670353432119, -1.72477713787247 },
-		{ 0.1909102645374184, 0.8090897354625817, -1.649125903703688 },
-		{ 0.2189788282918396, 0.7810211717081603, -1.567829642378306 },
-		{ 0.2460736505232821, 0.7539263494767179, -1.481420204124197 },
-		{ 0.2722285118185212, 0.727771488181479, -1.390430041667618 },
-		{ 0.297476020863971, 0.7025239791360292, -1.295390640733644 },
-		{ 0.3218476551007042, 0.6781523448992958, -1.196831024557955 },
-		{ 0.3453737999690897, 0.6546262000309104, -1.095276328583262 },
-		{ 0.368083786791969, 0.6319162132080309, -0.9912464402240155 },
-		{ 0.3900059293436123, 0.6099940706563877, -0.8852547010309897 },
-		{ 0.4111675591500378, 0.5888324408499622, -0.7778066666444733 },
-		{ 0.4315950595647099, 0.5684049404352901, -0.669398921141118 },
-		{ 0.4513138986620991, 0.5486861013379007, -0.5605179429283611 },
-		{ 0.4703486609901156, 0.5296513390098844, -0.4516390193137022 },
-		{ 0.4887217397634551, 0.5112782603006055, -0.3432332168740627 },
-		{ 0.5064600587388801, 0.49353994126112, -0.2357263345195104 },
-		{ 0.5235829635165051, 0.4764170365405646, -0.129570241960824 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.178113680806832, 0.8218863191931678, -1.68347714311367 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.2401349808307736, 0.7598650191692264, -1.501036908729762 },
-		{ 0.2693678101308153, 0.7306321898691847, -1.400749726981239 },
-		{ 0.297476020863971, 0.7025239791360292, -1.295390640733644 },
-		{ 0.3245028783231063, 0.6754971216768939, -1.185685515805065 },
-		{ 0.3504899833384674, 0.6495100166615325, -1.072354296137942 },
-		{ 0.3754773363113585, 0.6245226636886416, -0.9561087063951917 },
-		{ 0.3995033987843722, 0.6004966012156279, -0.8376500701530164 },
-		{ 0.4226051526429508, 0.5773948473570492, -0.7176672358059065 },
-		{ 0.4448181570393981, 0.5551818429606019, -0.5968346031526011 },
-		{ 0.4661766031269599, 0.53382339687304, -0.4758102440512311 },
-		{ 0.4867133666882297, 0.5132866333117704, -0.3552341118440203 },
-		{ 0.5064600587388801, 0.49353994126112, -0.2357263345195104 },
-		{ 0.5254470741846139, 0.474552925815386, -0.1178855876122904 },
-		{ 0.5437036386062316, 0.4562963613937685, -0.002287544037755 },
-		{ 0.5612578532448234, 0.4387421467551768, 0.1105166009753431 },
-		{ 0.6428004331738243, 0.3571995668261758, 0.6364867645606009 },
-		{ 0.6428238110657555, 0.3571761889342446, 0.6366327020203447 },
-		{ 0.6428471874276572, 0.3571528125723427, 0.6367786237868472 },
-		{ 0.6428705622596298, 0.3571294377403701, 0.6369245300378819 },
-		{ 0.6428939355617733, 0.3571060644382266, 0.6370704206737481 },
-		{ 0.6429173073341878, 0.3570826926658121, 0.6372162956872381 },
-		{ 0.6429406775769735, 0.3570593224230264, 0.6373621550711462 },
-		{ 0.6429640462902303, 0.3570359537097696, 0.6375079989106845 },
-		{ 0.6429874134740586, 0.3570125865259414, 0.6376538271061977 },
-		{ 0.6430107791285583, 0.3569892208714417, 0.6377996397428716 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 },
-		{ 0.6430341432538293, 0.3569658567461704, 0.6379454367210766 }
-	},
-	.c_bpre9600022 = {
-		{ 0.001959609366613055, 0.9980403906333871, -1.998025015302938 },
-		{ 0.003915378664356529, 0.9960846213356436, -1.99602318045043 },
-		{ 0.005867315418264873, 0.9941326845817352, -1.993994578660093 },
-		{ 0.007815427138627033, 0.992184572861373, -1.991939293280438 },
-		{ 0.009759721321015191, 0.9902402786789847, -1.98985740778957 },
-		{ 0.0117002054463117, 0.9882997945536881, -1.987749005794193 },
-		{ 0.01363688698074101, 0.9863631130192591, -1.985614171028354 },
-		{ 0.01556977337589536, 0.984430226624105, -1.98345298735205 },
-		{ 0.01749887206876456, 0.9825011279312351, -1.981265538750396 },
-		{ 0.01942419048176635, 0.9805758095182333, -1.979051909332481 },
-		{ 0.02134573602277234, 0.9786542639772275, -1.976812183329812 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.02517753804773013, 0.97482246195227, -1.972254779102374 },
-		{ 0.02708780927495684, 0.9729121907250433, -1.969937269943619 },
-		{ 0.02899433711679328, 0.9710056628832066, -1.967594002329303 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.03279619197221469, 0.9672038080277849, -1.962830531160423 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.03658316112625126, 0.9634168388737486, -1.957965045596708 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.04035530286205936, 0.9596446971379406, -1.952998227454241 },
-		{ 0.003915378664356529, 0.9960846213356436, -1.99602318045043 },
-		{ 0.007815427138627033, 0.992184572861373, -1.991939293280438 },
-		{ 0.0117002054463117, 0.9882997945536881, -1.987749005794193 },
-		{ 0.01556977337589536, 0.984430226624105, -1.98345298735205 },
-		{ 0.01942419048176635, 0.9805758095182333, -1.979051909332481 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.02708780927495684, 0.9729121907250433, -1.969937269943619 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.04223583159919122, 0.9577641684008088, -1.950477032220024 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.04972116767331558, 0.9502788323266844, -1.940142342431827 },
-		{ 0.05344186913859653, 0.9465581308614033, -1.934826254914476 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.06083962524281872, 0.9391603747571811, -1.923900042275459 },
-		{ 0.06451679373655252, 0.9354832062634477, -1.918291301042256 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.07182799457451328, 0.9281720054254866, -1.906786020115412 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.07908205525503001, 0.9209179447449701, -1.894901653881822 },
-		{ 0.005867315418264873, 0.9941326845817352, -1.993994578660093 },
-		{ 0.0117002054463117, 0.9882997945536881, -1.987749005794193 },
-		{ 0.01749887206876456, 0.9825011279312351, -1.981265538750396 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.02899433711679328, 0.9710056628832066, -1.967594002329303 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.04035530286205936, 0.9596446971379406, -1.952998227454241 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.05158334297403717, 0.948416657025963, -1.937496622171374 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.06268001270994501, 0.9373199872900546, -1.921107735680889 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.07364684913017332, 0.9263531508698267, -1.903850249626293 },
-		{ 0.07908205525503001, 0.9209179447449701, -1.894901653881822 },
-		{ 0.08448537131118838, 0.9155146286888112, -1.885742969534048 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.09519708055595154, 0.9048029194440481, -1.866804816374285 },
-		{ 0.1005058446756966, 0.8994941553243031, -1.857030104722727 },
-		{ 0.1057834606018702, 0.8942165393981298, -1.847054818268442 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1162459778263181, 0.8837540221736817, -1.826512102313779 },
-		{ 0.007815427138627033, 0.992184572861373, -1.991939293280438 },
-		{ 0.01556977337589536, 0.984430226624105, -1.98345298735205 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.05344186913859653, 0.9465581308614033, -1.934826254914476 },
-		{ 0.06083962524281872, 0.9391603747571811, -1.923900042275459 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.08268779772750733, 0.9173122022724928, -1.888819061422648 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.0969701408318332, 0.9030298591681668, -1.86356901277618 },
-		{ 0.1040277049001669, 0.8959722950998332, -1.850402052186455 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1179777904859517, 0.8820222095140483, -1.823012594685647 },
-		{ 0.1248711707990603, 0.87512882920094, -1.808801486309486 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1384967283444307, 0.8615032716555694, -1.779375104250915 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.1519101390466998, 0.8480898609533, -1.748648132039076 },
-		{ 0.009759721321015191, 0.9902402786789847, -1.98985740778957 },
-		{ 0.01942419048176635, 0.9805758095182333, -1.979051909332481 },
-		{ 0.02899433711679328, 0.9710056628832066, -1.967594002329303 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.0478553360715104, 0.9521446639284892, -1.942763329551091 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.0663499753898556, 0.9336500246101448, -1.915450825192452 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.08448537131118838, 0.9155146286888112, -1.885742969534048 },
-		{ 0.09342053895250405, 0.9065794610474958, -1.870018068499897 },
-		{ 0.102268501847684, 0.8977314981523159, -1.853727177225208 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1197062094692761, 0.8802937905307238, -1.819491689972875 },
-		{ 0.1282976315454757, 0.8717023684545241, -1.801569336653276 },
-		{ 0.1368052037364609, 0.8631947962635389, -1.783125472043868 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.1535720638819535, 0.8464279361180462, -1.744718108532645 },
-		{ 0.1618329646567882, 0.8381670353432119, -1.72477713787247 },
-		{ 0.1700132413421992, 0.8299867586578009, -1.704359706374719 },
-		{ 0.178113680806832, 0.8218863191931678, -1.68347714311367 },
-		{ 0.1861350622397122, 0.8138649377602877, -1.662140797893033 },
-		{ 0.0117002054463117, 0.9882997945536881, -1.987749005794193 },
-		{ 0.02326351608513801, 0.9767364839148619, -1.974546445095275 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.07908205525503001, 0.9209179447449701, -1.894901653881822 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.1005058446756966, 0.8994941553243031, -1.857030104722727 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1214312414265713, 0.8785687585734286, -1.815949477442828 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1418698398735443, 0.8581301601264558, -1.771813492636457 },
-		{ 0.1519101390466998, 0.8480898609533, -1.748648132039076 },
-		{ 0.1618329646567882, 0.8381670353432119, -1.72477713787247 },
-		{ 0.17163969116863, 0.82836030883137, -1.700220041348026 },
-		{ 0.1813316769655271, 0.8186683230344728, -1.674996422644837 },
-		{ 0.1909102645374184, 0.8090897354625817, -1.649125903703688 },
-		{ 0.2003767806668324, 0.7996232193331674, -1.622628141090434 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.21897882829184, 0.7810211717081603, -1.567829642378306 },
-		{ 0.01363688698074101, 0.9863631130192591, -1.985614171028354 },
-		{ 0.02708780927495684, 0.9729121907250433, -1.969937269943619 },
-		{ 0.04035530286205936, 0.9596446971379406, -1.952998227454241 },
-		{ 0.05344186913859653, 0.9465581308614033, -1.934826254914476 },
-		{ 0.0663499753898556, 0.9336500246101448, -1.915450825192452 },
-		{ 0.07908205525503001, 0.9209179447449701, -1.894901653881822 },
-		{ 0.09164050918605349, 0.9083594908139464, -1.873208680862913 },
-		{ 0.1040277049001669, 0.8959722950998332, -1.850402052186455 },
-		{ 0.1162459778263181, 0.8837540221736817, -1.826512102313779 },
-		{ 0.1282976315454757, 0.8717023684545241, -1.801569336653276 },
-		{ 0.1401849382249345, 0.8598150617750653, -1.775604414463666 },
-		{ 0.1519101390466998, 0.8480898609533, -1.748648132039076 },
-		{ 0.1634754446300325, 0.8365245553699673, -1.720731406235089 },
-		{ 0.1748830354482277, 0.8251169645517723, -1.691885258276193 },
-		{ 0.1861350622397124, 0.8138649377602877, -1.662140797893033 },
-		{ 0.1972336464135376, 0.8027663535864628, -1.631529207793871 },
-		{ 0.2081808804493374, 0.7918191195506625, -1.600081728284961 },
-		{ 0.21897882829184, 0.7810211717081603, -1.567829642378306 },
-		{ 0.22962952573999, 0.7703704742600102, -1.534804261034256 },
-		{ 0.2401349808307736, 0.7598650191692264, -1.501036908729762 },
-		{ 0.2504971742178032, 0.7495028257821971, -1.466558909331793 },
-		{ 0.01556977337589536, 0.984430226624105, -1.98345298735205 },
-		{ 0.0308971289088138, 0.9691028710911862, -1.965225061087312 },
-		{ 0.0459858409896326, 0.9540141590103675, -1.945359497494661 },
-		{ 0.06083962524281872, 0.9391603747571811, -1.923900042275459 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.08985698440774124, 0.9101430155922585, -1.876376565243707 },
-		{ 0.1040277049001669, 0.8959722950998332, -1.850402052186455 },
-		{ 0.1179777904859517, 0.8820222095140483, -1.823012594685647 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.1585383235619891, 0.8414616764380108, -1.732811335102088 },
-		{ 0.17163969116863, 0.82836030883137, -1.700220041348026 },
-		{ 0.1845370734507209, 0.8154629265492791, -1.666443824086411 },
-		{ 0.1972336464135376, 0.8027663535864628, -1.631529207793871 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.2220368219239564, 0.7779631780760438, -1.558471357082591 },
-		{ 0.2341495323013916, 0.7658504676986085, -1.52042156556324 },
-		{ 0.2460736505232821, 0.7539263494767179, -1.481420204124197 },
-		{ 0.2578121129267507, 0.7421878870732496, -1.441514021182973 },
-		{ 0.2693678101308153, 0.7306321898691847, -1.400749726981239 },
-		{ 0.2807431170048579, 0.7192568830041625, -1.35917571781987 },
-		{ 0.01749887206876456, 0.9825011279312351, -1.981265538750396 },
-		{ 0.03469153361385011, 0.9653084663861496, -1.960410497606804 },
-		{ 0.05158334297403717, 0.948416657025963, -1.937496622171374 },
-		{ 0.06817956472321966, 0.9318204352767802, -1.912586395057924 },
-		{ 0.08448537131118838, 0.9155146286888112, -1.885742969534048 },
-		{ 0.1005058446756968, 0.8994941553243031, -1.857030104722727 },
-		{ 0.1162459778263181, 0.8837540221736817, -1.826512102313779 },
-		{ 0.1317106764005916, 0.8682893235994082, -1.794253744791288 },
-		{ 0.1469047601929318, 0.8530952398070681, -1.760320235117344 },
-		{ 0.1618329646567882, 0.8381670353432119, -1.72477713787247 },
-		{ 0.1764999423805145, 0.8235000576194855, -1.687690321784255 },
-		{ 0.1909102645374184, 0.8090897354625817, -1.649125903703688 },
-		{ 0.2050684223104287, 0.7949315776895711, -1.609150193834861 },
-		{ 0.2189788282918396, 0.7810211717081603, -1.567829642378306 },
-		{ 0.2326458178585575, 0.7673541821414426, -1.525230787426803 },
-		{ 0.2460736505232821, 0.7539263494767179, -1.481420204124197 },
-		{ 0.2592665112620458, 0.7407334887379541, -1.43646445504281 },
-		{ 0.2722285118185212, 0.727771488181479, -1.390430041667618 },
-		{ 0.2849627560399248, 0.7150372439954478, -1.343386881628725 },
-		{ 0.297476020863971, 0.7025239791360292, -1.295390640733644 },
-		{ 0.3097703016408702, 0.6902296983907348, -1.24651427640806 },
-		{ 0.01942419048176635, 0.9805758095182333, -1.979051909332481 },
-		{ 0.03847108178766077, 0.9615289182123391, -1.955494260414375 },
-		{ 0.0571480026487442, 0.9428519973512556, -1.929411924478315 },
-		{ 0.07546213944140921, 0.9245378605585906, -1.900890873486253 },
-		{ 0.09342053895250405, 0.9065794610474958, -1.870018068499897 },
-		{ 0.111030111090748, 0.8889698889092521, -1.836881350933238 },
-		{ 0.1282976315454757, 0.8717023684545241, -1.801569336653276 },
-		{ 0.1452297443937436, 0.8547702556062562, -1.764171312896187 },
-		{ 0.1618329646567882, 0.8381670353432119, -1.72477713787247 },
-		{ 0.178113680806832, 0.8218863191931678, -1.68347714311367 },
-		{ 0.1940781572251977, 0.8059218427748021, -1.64036203834546 },
-		{ 0.2097325366126722, 0.7902674633873279, -1.595522819009638 },
-		{ 0.2250828423530501, 0.7749171576469499, -1.549050676111113 },
-		{ 0.2401349808307736, 0.7598650191692264, -1.501036908729762 },
-		{ 0.2548947437035475, 0.7451052562964524, -1.451572838552629 },
-		{ 0.2693678101308153, 0.7306321898691847, -1.400749726981239 },
-		{ 0.2835597489589445, 0.7164402510410555, -1.348658694252415 },
-		{ 0.297476020863971, 0.7025239791360292, -1.295390640733644 },
-		{ 0.3111219804527173, 0.6888780195472826, -1.241036170276528 },
-		{ 0.3245028783231063, 0.6754971216768939, -1.185685515805065 },
-		{ 0.337623863084443, 0.662376136915557, -1.129428466282379 },
-		{ 0.4023382504909859, 0.5976617495090142, -0.8232450004800163 },
-		{ 0.4023578086059815, 0.5976421913940185, -0.8231453059740665 },
-		{ 0.4023773660809501, 0.5976226339190498, -0.8230456105186917 },
-		{ 0.4023969229159121, 0.5976030770840879, -0.8229459139946634 },
-		{ 0.4024164791108888, 0.5975835208891112, -0.8228462165220953 },
-		{ 0.4024360346659012, 0.5975639653340988, -0.8227465180415916 },
-		{ 0.4024555895809698, 0.5975444104190303, -0.8226468184937527 },
-		{ 0.4024751438561155, 0.5975248561438844, -0.8225471179986991 },
-		{ 0.4024946974913601, 0.59750530250864, -0.822447416497034 },
-		{ 0.4025142504867236, 0.5974857495132764, -0.8223477140490423 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 },
-		{ 0.4025338028422274, 0.5974661971577726, -0.8222480105354752 }
-	},
-	.c_bpre4800080040 = {
-		{ 0.0001961522294091117, 0.9999901923885295, -1.999928631287098 },
-		{ 0.0003923025350368566, 0.9999803848732483, -1.999734145464819 },
-		{ 0.000588450916890369, 0.9999705774541554, -1.999416555713392 },
-		{ 0.0007845973750132851, 0.9999607701312497, -1.998975882791318 },
-		{ 0.0009807419093790894, 0.9999509629045307, -1.998412155034017 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.001373025207043048, 0.9999313487396476, -1.996915686228644 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002157568718456605, 0.9998921215640773, -1.992448177869759 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.002549828932506449, 0.9998725085533747, -1.989478257670493 },
-		{ 0.002745956154181503, 0.9998627021922908, -1.987809560412518 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.00313820482694066, 0.999843089758653, -1.984105211211982 },
-		{ 0.003334326278067103, 0.9998332836860971, -1.982069789711819 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.003726563409859423, 0.999813671829507, -1.977633085405595 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004118792847878324, 0.9997940603576061, -1.972709496916333 },
-		{ 0.0003923025350368566, 0.9999803848732483, -1.999734145464819 },
-		{ 0.0007845973750132851, 0.9999607701312497, -1.998975882791318 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.002745956154181503, 0.9998627021922908, -1.987809560412518 },
-		{ 0.00313820482694066, 0.999843089758653, -1.984105211211982 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004314904681765208, 0.9997842547659118, -1.970065498281898 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.005099332783629567, 0.9997450333608185, -1.95827872046835 },
-		{ 0.00549153529460407, 0.9997254232352698, -1.951661443856279 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006275917237404954, 0.9996862041381298, -1.936987309255257 },
-		{ 0.006668096669518312, 0.9996665951665238, -1.928934083424492 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.00745243245597747, 0.9996273783772013, -1.911405276065982 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.008236737473028973, 0.9995881631263484, -1.891994637367637 },
-		{ 0.000588450916890369, 0.9999705774541554, -1.999416555713392 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.004118792847878324, 0.9997940603576061, -1.972709496916333 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.005295435000766508, 0.9997352282499619, -1.955030243142108 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006472007915050371, 0.9996763996042474, -1.933020176314585 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.0076485115948169, 0.9996175744202591, -1.906728319950658 },
-		{ 0.008236737473028973, 0.9995881631263484, -1.891994637367637 },
-		{ 0.008824946044145616, 0.9995587526977929, -1.876213182032296 },
-		{ 0.009413137308651611, 0.9995293431345673, -1.85939272802872 },
-		{ 0.0100013112670873, 0.9994999344366459, -1.841542624809912 },
-		{ 0.0105894679199345, 0.9994705266040032, -1.822672792001006 },
-		{ 0.01117760726772622, 0.9994411196366138, -1.802793713886777 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01235383405014535, 0.9993823082974931, -1.760052546920101 },
-		{ 0.0007845973750132851, 0.9999607701312497, -1.998975882791318 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.00313820482694066, 0.999843089758653, -1.984105211211982 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.00549153529460407, 0.9997254232352698, -1.951661443856279 },
-		{ 0.006275917237404954, 0.9996862041381298, -1.936987309255257 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.008628878443426505, 0.9995685560778291, -1.881589556615707 },
-		{ 0.009413137308651611, 0.9995293431345673, -1.85939272802872 },
-		{ 0.01019736540751861, 0.9994901317296241, -1.835365477649509 },
-		{ 0.01098156274122523, 0.999450921862939, -1.809531541384065 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01254986511794105, 0.9993725067441028, -1.752547421861646 },
-		{ 0.01333397016339224, 0.9993333014918305, -1.721453500138859 },
-		{ 0.01411804444849482, 0.9992940977775753, -1.688665360050621 },
-		{ 0.01490208797447047, 0.9992548956012766, -1.654215360637066 },
-		{ 0.0156861007425265, 0.9992156949628739, -1.618137496411179 },
-		{ 0.0164700827538604, 0.9991764958623073, -1.580467363813628 },
-		{ 0.0009807419093790894, 0.9999509629045307, -1.998412155034017 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004903228643182047, 0.9997548385678408, -1.961406674673442 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006864183500827764, 0.9996567908249582, -1.924729283295682 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.008824946044145616, 0.9995587526977929, -1.876213182032296 },
-		{ 0.009805255203812528, 0.9995097372398094, -1.847606464034768 },
-		{ 0.0107855162919539, 0.999460724185402, -1.816158037098683 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01274589426315604, 0.9993627052868421, -1.74493448163772 },
-		{ 0.01372601115091166, 0.9993136994424545, -1.705269223663988 },
-		{ 0.01470607997657838, 0.9992646960011708, -1.662981828367571 },
-		{ 0.0156861007425265, 0.9992156949628739, -1.618137496411179 },
-		{ 0.01666607345109005, 0.9991666963274454, -1.570805359889604 },
-		{ 0.017645998104647, 0.9991177000947677, -1.521058375756434 },
-		{ 0.01862587470554066, 0.999068706264723, -1.468973213369614 },
-		{ 0.01960570325613344, 0.9990197148371933, -1.414630136330687 },
-		{ 0.0205854837587803, 0.998970725812061, -1.358112878798575 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.008236737473028973, 0.9995881631263484, -1.891994637367637 },
-		{ 0.009413137308651611, 0.9995293431345673, -1.85939272802872 },
-		{ 0.0105894679199345, 0.9994705266040032, -1.822672792001006 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01294192148578762, 0.9993529039257105, -1.737214195965929 },
-		{ 0.01411804444849482, 0.9992940977775753, -1.688665360050621 },
-		{ 0.01529409820316209, 0.999235295089842, -1.636377723989338 },
-		{ 0.0164700827538604, 0.9991764958623073, -1.580467363813628 },
-		{ 0.017645998104647, 0.9991177000947677, -1.521058375756434 },
-		{ 0.01882184425960823, 0.9990589077870196, -1.458282600814977 },
-		{ 0.01999762122281088, 0.9990001189388595, -1.392279332169474 },
-		{ 0.02117332899832902, 0.9989413335500835, -1.323195006107512 },
-		{ 0.0223489675902448, 0.9988825516204878, -1.251182877138338 },
-		{ 0.02352453700260215, 0.9988237731498699, -1.176402678019487 },
-		{ 0.02470003723949383, 0.9987649981380253, -1.099020265449094 },
-		{ 0.001373025207043048, 0.9999313487396476, -1.996915686228644 },
-		{ 0.002745956154181503, 0.9998627021922908, -1.987809560412518 },
-		{ 0.004118792847878324, 0.9997940603576061, -1.972709496916333 },
-		{ 0.00549153529460407, 0.9997254232352698, -1.951661443856279 },
-		{ 0.006864183500827764, 0.9996567908249582, -1.924729283295682 },
-		{ 0.008236737473028973, 0.9995881631263484, -1.891994637367637 },
-		{ 0.009609197217674248, 0.9995195401391163, -1.853556620913115 },
-		{ 0.01098156274122523, 0.999450921862939, -1.809531541384065 },
-		{ 0.01235383405014535, 0.9993823082974931, -1.760052546920101 },
-		{ 0.01372601115091166, 0.9993136994424545, -1.705269223663988 },
-		{ 0.0150980940499898, 0.9992450952975004, -1.645347143532887 },
-		{ 0.0164700827538604, 0.9991764958623073, -1.580467363813628 },
-		{ 0.01784197726896576, 0.9991079011365519, -1.510825880093671 },
-		{ 0.01921377760178506, 0.9990393111199108, -1.436633034180281 },
-		{ 0.02058548375877952, 0.998970725812061, -1.358112878798575 },
-		{ 0.0219570957464262, 0.9989021452126787, -1.275502500983978 },
-		{ 0.02332861357117364, 0.9988335693214414, -1.18905130621557 },
-		{ 0.02470003723949383, 0.9987649981380253, -1.099020265449094 },
-		{ 0.02607136675785728, 0.9986964316621072, -1.005681127326376 },
-		{ 0.02744260213271573, 0.9986278698933644, -0.9093155979337808 },
-		{ 0.02881374337054166, 0.998559312831473, -0.8102144905919795 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.00313820482694066, 0.999843089758653, -1.984105211211982 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.006275917237404954, 0.9996862041381298, -1.936987309255257 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.009413137308651611, 0.9995293431345673, -1.85939272802872 },
-		{ 0.01098156274122523, 0.999450921862939, -1.809531541384065 },
-		{ 0.01254986511794105, 0.9993725067441028, -1.752547421861646 },
-		{ 0.01411804444849482, 0.9992940977775753, -1.688665360050621 },
-		{ 0.0156861007425265, 0.9992156949628739, -1.618137496411179 },
-		{ 0.01725403400967788, 0.9991372982995161, -1.541242126091873 },
-		{ 0.01882184425960823, 0.9990589077870196, -1.458282600814977 },
-		{ 0.02038953150197254, 0.9989805234249013, -1.369586132162227 },
-		{ 0.0219570957464262, 0.9989021452126787, -1.275502500983978 },
-		{ 0.02352453700260215, 0.9988237731498699, -1.176402678019487 },
-		{ 0.02509185528016606, 0.9987454072359917, -1.072677361169253 },
-		{ 0.02665905058876456, 0.9986670474705617, -0.9647354351877292 },
-		{ 0.02822612293804297, 0.998588693853098, -0.8530023598681602 },
-		{ 0.02979307233763807, 0.9985103463831181, -0.7379184930707625 },
-		{ 0.03135989879721966, 0.9984320050601388, -0.6199373552098664 },
-		{ 0.03292670323540423, 0.9983536731507843, -0.4995289084435604 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.005295435000768729, 0.9997352282499619, -1.955030243142108 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.008824946044145616, 0.9995587526977929, -1.876213182032296 },
-		{ 0.01058946791993451, 0.9994705266040032, -1.822672792001006 },
-		{ 0.01235383405013933, 0.9993823082974931, -1.760052546920101 },
-		{ 0.01411804444849482, 0.9992940977775753, -1.688665360050621 },
-		{ 0.01588209912875295, 0.9992058950435625, -1.608867813232149 },
-		{ 0.017645998104647, 0.9991177000947677, -1.521058375756434 },
-		{ 0.01940974138992658, 0.9990295129305036, -1.425675414622024 },
-		{ 0.02117332899833065, 0.9989413335500835, -1.323195006107512 },
-		{ 0.02293676094360941, 0.9988531619528195, -1.214128559587156 },
-		{ 0.02470003723949167, 0.9987649981380253, -1.099020265449094 },
-		{ 0.02646315789972628, 0.9986768421050136, -0.97844437985207 },
-		{ 0.02822612293804297, 0.998588693853098, -0.8530023598681602 },
-		{ 0.02998893236817659, 0.998500553381591, -0.7233198633028575 },
-		{ 0.03175158620386843, 0.9984124206898066, -0.5900436281607052 },
-		{ 0.03351460710268745, 0.9983243023110753, -0.4538484385831414 },
-		{ 0.03527642714683395, 0.9982361786426582, -0.315382854474594 },
-		{ 0.03703933598726974, 0.9981480627530572, -0.1753573154797995 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.009805255203812528, 0.9995097372398094, -1.847606464034768 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01372601115091166, 0.9993136994424545, -1.705269223663988 },
-		{ 0.0156861007425265, 0.9992156949628739, -1.618137496411179 },
-		{ 0.017645998104647, 0.9991177000947677, -1.521058375756434 },
-		{ 0.01960570325613344, 0.9990197148371933, -1.414630136330687 },
-		{ 0.02156521621583183, 0.9989217391892083, -1.299508516469329 },
-		{ 0.02352453700260215, 0.9988237731498699, -1.176402678019487 },
-		{ 0.02548366563528226, 0.9987258167182359, -1.046070837844046 },
-		{ 0.02744260213271573, 0.9986278698933644, -0.9093155979337808 },
-		{ 0.02940134651374901, 0.9985299326743127, -0.7669790028895719 },
-		{ 0.03135989879721966, 0.9984320050601388, -0.6199373552098664 },
-		{ 0.03331825900196407, 0.9983340870499017, -0.4690958203079429 },
-		{ 0.03527642714683395, 0.9982361786426582, -0.315382854474594 },
-		{ 0.03723440325065122, 0.9981382798374674, -0.1597444900831274 },
-		{ 0.03919218733225956, 0.998040390633387, -0.003138513215839723 },
-		{ 0.04114977941048309, 0.9979425110294758, 0.1534714304568538 },
-		{ 0.05140685209469765, 0.9974296573952651, 0.9367358870568807 },
-		{ 0.05141011617535229, 0.9974294941912325, 0.9369667301296448 },
-		{ 0.05141338025547036, 0.9974293309872264, 0.9371975571099144 },
-		{ 0.05141664433505351, 0.9974291677832472, 0.9374283679940486 },
-		{ 0.05141990841410569, 0.9974290045792946, 0.9376591627777803 },
-		{ 0.05142317249262812, 0.9974288413753687, 0.9378899414574737 },
-		{ 0.05142643657060618, 0.9974286781714695, 0.9381207040285509 },
-		{ 0.05142970064805742, 0.997428514967597, 0.9383514504876866 },
-		{ 0.05143296472496932, 0.9974283517637514, 0.938582180830612 },
-		{ 0.051436228801354, 0.9974281885599324, 0.9388128950536946 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 },
-		{ 0.05143949287719833, 0.9974280253561399, 0.9390435931526684 }
-	},
-	.c_bpre9600080040 = {
-		{ 9.807635518627921e-05, 0.9999950961822409, -1.999979705809931 },
-		{ 0.0001961522294091117, 0.9999901923885295, -1.999928631287098 },
-		{ 0.0002942276227004713, 0.9999852886188654, -1.999846777368494 },
-		{ 0.0003923025350368566, 0.9999803848732483, -1.999734145464819 },
-		{ 0.0004903769664301153, 0.9999754811516782, -1.999590737460445 },
-		{ 0.000588450916890369, 0.9999705774541554, -1.999416555713392 },
-		{ 0.0006865243864138122, 0.999965673780679, -1.999211603055287 },
-		{ 0.0007845973750132851, 0.9999607701312497, -1.998975882791318 },
-		{ 0.0008826698826580904, 0.999955866505867, -1.99870939870018 },
-		{ 0.0009807419093790894, 0.9999509629045307, -1.998412155034017 },
-		{ 0.001078813455195971, 0.9999460593272403, -1.998084156518352 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.001274955104017389, 0.9999362522447993, -1.997335916207049 },
-		{ 0.001373025207043048, 0.9999313487396476, -1.996915686228644 },
-		{ 0.001471094829156418, 0.999926445258542, -1.996464725035015 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.001667232630634929, 0.999916638368468, -1.99547063783951 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.00186336850848489, 0.9999068315745757, -1.994353717022858 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002059502462697219, 0.9998970248768652, -1.993114032548532 },
-		{ 0.0001961522294091117, 0.9999901923885295, -1.999928631287098 },
-		{ 0.0003923025350368566, 0.9999803848732483, -1.999734145464819 },
-		{ 0.000588450916890369, 0.9999705774541554, -1.999416555713392 },
-		{ 0.0007845973750132851, 0.9999607701312497, -1.998975882791318 },
-		{ 0.0009807419093790894, 0.9999509629045307, -1.998412155034017 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.001373025207043048, 0.9999313487396476, -1.996915686228644 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002157568718456605, 0.9998921215640773, -1.992448177869759 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.002549828932506449, 0.9998725085533747, -1.989478257670493 },
-		{ 0.002745956154181503, 0.9998627021922908, -1.987809560412518 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.00313820482694066, 0.999843089758653, -1.984105211211982 },
-		{ 0.003334326278067103, 0.9998332836860971, -1.982069789711819 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.003726563409859423, 0.999813671829507, -1.977633085405595 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004118792847878324, 0.9997940603576061, -1.972709496916333 },
-		{ 0.0002942276227004713, 0.9999852886188654, -1.999846777368494 },
-		{ 0.000588450916890369, 0.9999705774541554, -1.999416555713392 },
-		{ 0.0008826698826580904, 0.999955866505867, -1.99870939870018 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.001471094829156418, 0.999926445258542, -1.996464725035015 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.002059502462697219, 0.9998970248768652, -1.993114032548532 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.002647892783791308, 0.9998676053608105, -1.988659210136231 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.003236265792929978, 0.9998381867103534, -1.983102758349068 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.003824621490649461, 0.9998087689254676, -1.976447787990105 },
-		{ 0.004118792847878324, 0.9997940603576061, -1.972709496916333 },
-		{ 0.004412959877437153, 0.9997793520061279, -1.968698018373099 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.005001280953816022, 0.9997499359523089, -1.95985777524403 },
-		{ 0.005295435000766508, 0.9997352282499619, -1.955030243142108 },
-		{ 0.005589584720298593, 0.9997205207639852, -1.949931988366717 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006177871177381318, 0.999691106441131, -1.938926188773847 },
-		{ 0.0003923025350368566, 0.9999803848732483, -1.999734145464819 },
-		{ 0.0007845973750132851, 0.9999607701312497, -1.998975882791318 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.002745956154181503, 0.9998627021922908, -1.987809560412518 },
-		{ 0.00313820482694066, 0.999843089758653, -1.984105211211982 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004314904681765208, 0.9997842547659118, -1.970065498281898 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.005099332783629567, 0.9997450333608185, -1.95827872046835 },
-		{ 0.00549153529460407, 0.9997254232352698, -1.951661443856279 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006275917237404954, 0.9996862041381298, -1.936987309255257 },
-		{ 0.006668096669518312, 0.9996665951665238, -1.928934083424492 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.00745243245597747, 0.9996273783772013, -1.911405276065982 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.008236737473028973, 0.9995881631263484, -1.891994637367637 },
-		{ 0.0004903769664301153, 0.9999754811516782, -1.999590737460445 },
-		{ 0.0009807419093790894, 0.9999509629045307, -1.998412155034017 },
-		{ 0.001471094829156418, 0.999926445258542, -1.996464725035015 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002451764600329167, 0.9998774117699835, -1.99026669025975 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.003432386282305334, 0.9998283806858845, -1.98100632134763 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004412959877437153, 0.9997793520061279, -1.968698018373099 },
-		{ 0.004903228643182047, 0.9997548385678408, -1.961406674673442 },
-		{ 0.005393485388096547, 0.9997303257305952, -1.953360870882135 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006373962816625801, 0.9996813018591687, -1.935018628287228 },
-		{ 0.006864183500827764, 0.9996567908249582, -1.924729283295682 },
-		{ 0.007354392165388799, 0.9996322803917304, -1.913699663093206 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.008334773436753606, 0.9995832613281622, -1.889436927010863 },
-		{ 0.008824946044145616, 0.9995587526977929, -1.876213182032296 },
-		{ 0.009315106633060533, 0.9995342446683471, -1.862267900026137 },
-		{ 0.009805255203812528, 0.9995097372398094, -1.847606464034768 },
-		{ 0.01029539175666947, 0.9994852304121663, -1.832234532503876 },
-		{ 0.000588450916890369, 0.9999705774541554, -1.999416555713392 },
-		{ 0.001176884520067145, 0.9999411557739968, -1.997725408352013 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.004118792847878324, 0.9997940603576061, -1.972709496916333 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.005295435000766508, 0.9997352282499619, -1.955030243142108 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006472007915050371, 0.9996763996042474, -1.933020176314585 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.0076485115948169, 0.9996175744202591, -1.906728319950658 },
-		{ 0.008236737473028973, 0.9995881631263484, -1.891994637367637 },
-		{ 0.008824946044145616, 0.9995587526977929, -1.876213182032296 },
-		{ 0.009413137308651611, 0.9995293431345673, -1.85939272802872 },
-		{ 0.0100013112670873, 0.9994999344366459, -1.841542624809912 },
-		{ 0.0105894679199345, 0.9994705266040032, -1.822672792001006 },
-		{ 0.01117760726772622, 0.9994411196366138, -1.802793713886777 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01235383405014535, 0.9993823082974931, -1.760052546920101 },
-		{ 0.0006865243864138122, 0.999965673780679, -1.999211603055287 },
-		{ 0.001373025207043048, 0.9999313487396476, -1.996915686228644 },
-		{ 0.002059502462697219, 0.9998970248768652, -1.993114032548532 },
-		{ 0.002745956154181503, 0.9998627021922908, -1.987809560412518 },
-		{ 0.003432386282305334, 0.9998283806858845, -1.98100632134763 },
-		{ 0.004118792847878324, 0.9997940603576061, -1.972709496916333 },
-		{ 0.00480517585170708, 0.9997597412074146, -1.962925394770482 },
-		{ 0.00549153529460407, 0.9997254232352698, -1.951661443856279 },
-		{ 0.006177871177381318, 0.999691106441131, -1.938926188773847 },
-		{ 0.006864183500827764, 0.9996567908249582, -1.924729283295682 },
-		{ 0.007550472265777732, 0.9996224763867108, -1.909081483049061 },
-		{ 0.008236737473028973, 0.9995881631263484, -1.891994637367637 },
-		{ 0.008922979123392988, 0.9995538510438304, -1.873481680318779 },
-		{ 0.009609197217674248, 0.9995195401391163, -1.853556620913115 },
-		{ 0.01029539175667678, 0.9994852304121663, -1.832234532503876 },
-		{ 0.01098156274122523, 0.999450921862939, -1.809531541384065 },
-		{ 0.01166771017209686, 0.999416614491395, -1.785464814589887 },
-		{ 0.01235383405014535, 0.9993823082974931, -1.760052546920101 },
-		{ 0.01303993437614209, 0.9993480032811929, -1.733313947180402 },
-		{ 0.01372601115091166, 0.9993136994424545, -1.705269223663988 },
-		{ 0.01441206437526137, 0.9992793967812371, -1.67593956887869 },
-		{ 0.0007845973750132851, 0.9999607701312497, -1.998975882791318 },
-		{ 0.00156916397034879, 0.999921541801482, -1.995983039717314 },
-		{ 0.002353699787277284, 0.9998823150106364, -1.991024495619554 },
-		{ 0.00313820482694066, 0.999843089758653, -1.984105211211982 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004707122579402023, 0.99976464387103, -1.964413912013417 },
-		{ 0.00549153529460407, 0.9997254232352698, -1.951661443856279 },
-		{ 0.006275917237404954, 0.9996862041381298, -1.936987309255257 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.008628878443426505, 0.9995685560778291, -1.881589556615707 },
-		{ 0.009413137308651611, 0.9995293431345673, -1.85939272802872 },
-		{ 0.01019736540751861, 0.9994901317296241, -1.835365477649509 },
-		{ 0.01098156274122523, 0.999450921862939, -1.809531541384065 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01254986511794105, 0.9993725067441028, -1.752547421861646 },
-		{ 0.01333397016339224, 0.9993333014918305, -1.721453500138859 },
-		{ 0.01411804444849482, 0.9992940977775753, -1.688665360050621 },
-		{ 0.01490208797447047, 0.9992548956012766, -1.654215360637066 },
-		{ 0.0156861007425265, 0.9992156949628739, -1.618137496411179 },
-		{ 0.01647013321556532, 0.9991764974972057, -1.580468967666511 },
-		{ 0.0008826698826580904, 0.999955866505867, -1.99870939870018 },
-		{ 0.001765300810021495, 0.9999117349594991, -1.994927527438275 },
-		{ 0.002647892783791309, 0.9998676053608105, -1.988659210136231 },
-		{ 0.003530445805695238, 0.9998234777097155, -1.979912369773206 },
-		{ 0.004412959877437153, 0.9997793520061279, -1.968698018373099 },
-		{ 0.005295435000768729, 0.9997352282499619, -1.955030243142108 },
-		{ 0.006177871177381319, 0.999691106441131, -1.938926188773847 },
-		{ 0.00706026840899481, 0.99964698657955, -1.92040603594413 },
-		{ 0.007942626697352403, 0.9996028686651326, -1.899492976022543 },
-		{ 0.008824946044145616, 0.9995587526977929, -1.876213182032296 },
-		{ 0.009707226451100493, 0.9995146386774451, -1.850595775894995 },
-		{ 0.01058946791993451, 0.9994705266040032, -1.822672792001006 },
-		{ 0.01147167045237553, 0.9994264164773812, -1.792479137151177 },
-		{ 0.01235383405013933, 0.9993823082974931, -1.760052546920101 },
-		{ 0.01323595871494306, 0.9993382020642528, -1.725433538495211 },
-		{ 0.01411804444849482, 0.9992940977775753, -1.688665360050621 },
-		{ 0.01500009125253028, 0.9992499954373735, -1.649793936719562 },
-		{ 0.01588209912875295, 0.9992058950435625, -1.608867813232149 },
-		{ 0.01676432948217579, 0.9991617998658052, -1.565941349419493 },
-		{ 0.017645998104647, 0.9991177000947677, -1.521058375756434 },
-		{ 0.01852825025869224, 0.9990736022701516, -1.474281150753956 },
-		{ 0.0009807419093790894, 0.9999509629045307, -1.998412155034017 },
-		{ 0.001961435726037924, 0.9999019282136981, -1.993749215574946 },
-		{ 0.002942081452320637, 0.9998528959273839, -1.986018507773341 },
-		{ 0.003922679090575435, 0.9998038660454709, -1.975232078119226 },
-		{ 0.004903228643182047, 0.9997548385678408, -1.961406674673442 },
-		{ 0.005883730112479221, 0.9997058134943761, -1.94456372106512 },
-		{ 0.006864183500827764, 0.9996567908249582, -1.924729283295682 },
-		{ 0.007844588810594194, 0.9996077705594699, -1.901934029400738 },
-		{ 0.008824946044145616, 0.9995587526977929, -1.876213182032296 },
-		{ 0.009805255203812528, 0.9995097372398094, -1.847606464034768 },
-		{ 0.0107855162919539, 0.999460724185402, -1.816158037098683 },
-		{ 0.01176572931095405, 0.9994117135344521, -1.781916433586677 },
-		{ 0.01274589426315604, 0.9993627052868421, -1.74493448163772 },
-		{ 0.01372601115091166, 0.9993136994424545, -1.705269223663988 },
-		{ 0.01470607997657838, 0.9992646960011708, -1.662981828367571 },
-		{ 0.0156861007425265, 0.9992156949628739, -1.618137496411179 },
-		{ 0.01666607345109005, 0.9991666963274454, -1.570805359889604 },
-		{ 0.017645998104647, 0.9991177000947677, -1.521058375756434 },
-		{ 0.01862587470554066, 0.999068706264723, -1.468973213369614 },
-		{ 0.01960570325613344, 0.9990197148371933, -1.414630136330687 },
-		{ 0.0205854837587803, 0.998970725812061, -1.358112878798575 },
-		{ 0.02571996396101009, 0.9987140018019496, -1.029899670469129 },
-		{ 0.02572159810290099, 0.9987139200948549, -1.029787514488053 },
-		{ 0.02572323224466444, 0.9987138383877667, -1.029675354104866 },
-		{ 0.02572486638629046, 0.9987137566806854, -1.029563189320052 },
-		{ 0.02572650052778754, 0.9987136749736106, -1.029451020134092 },
-		{ 0.02572813466915243, 0.9987135932665423, -1.029338846547311 },
-		{ 0.0257297688103777, 0.9987135115594812, -1.029226668560498 },
-		{ 0.02573140295147384, 0.9987134298524263, -1.029114486173981 },
-		{ 0.02573303709243952, 0.998713348145378, -1.029002299388086 },
-		{ 0.02573467123325842, 0.998713266438337, -1.02889010820345 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 },
-		{ 0.02573630537395638, 0.9987131847313022, -1.028777912620704 }
-	}
-};
+#include "Scales.hpp"
+const ScaleDef video_notused = {
+	.name = "Video",
+	.description = "Scales derived from the NTSC frame rate of 59.94Hz, each note is the next multiple of base frequency. This is not used in SMR",
+	.scalename = {
+		"Video H 1; 59.94hz-",
+		"Video H 2; 119.88Hz-",
+		"Video H 3; 179.82Hz-",
+		"Video H 4; 239.76Hz-",
+		"Video H 5; 299.70Hz-",
+		"Video H 6; 359.64Hz-",
+		"Video H 7; 419.58Hz-",
+		"Video H 8; 479.52Hz-",
+		"Video H 9; 539.46Hz-",
+		"Video H 10; 599.40Hz-",
+		"Video V 1; 15729.00Hz-"},
+	.notedesc = {
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		"",
+		""},
+	.freq = {
+		59.94000000000001,
+		119.88,
+		179.82,
+		239.76,
+		299.7,
+		359.6399999999999,
+		419.58,
+		479.5200000000001,
+		539.46,
+		599.4,
+		659.3399999999999,
+		719.28,
+		779.2200000000001,
+		839.16,
+		899.0999999999999,
+		959.0400000000002,
+		1018.98,
+		1078.92,
+		1138.86,
+		1198.8,
+		1258.74,
+		119.88,
+		239.76,
+		359.6399999999999,
+		479.5200000000001,
+		599.4,
+		719.28,
+		839.16,
+		959.0400000000002,
+		1078.92,
+		1198.8,
+		1318.68,
+		1438.56,
+		1558.44,
+		1678.32,
+		1798.2,
+		1918.079999999999,
+		2037.959999999999,
+		2157.84,
+		2277.720000000001,
+		2397.6,
+		2517.48,
+		179.82,
+		359.6399999999999,
+		539.46,
+		719.28,
+		899.0999999999999,
+		1078.92,
+		1258.74,
+		1438.56,
+		1618.380000000001,
+		1798.2,
+		1978.02,
+		2157.84,
+		2337.66,
+		2517.48,
+		2697.3,
+		2877.12,
+		3056.940000000001,
+		3236.76,
+		3416.58,
+		3596.399999999999,
+		3776.22,
+		239.76,
+		479.5200000000001,
+		719.28,
+		959.0400000000002,
+		1198.8,
+		1438.56,
+		1678.32,
+		1918.079999999999,
+		2157.84,
+		2397.6,
+		2637.36,
+		2877.12,
+		3116.88,
+		3356.639999999999,
+		3596.399999999999,
+		3836.160000000001,
+		4075.920000000001,
+		4315.679999999999,
+		4555.440000000001,
+		4795.2,
+		5034.960000000001,
+		299.7,
+		599.4,
+		899.0999999999999,
+		1198.8,
+		1498.5,
+		1798.2,
+		2097.9,
+		2397.6,
+		2697.300000000001,
+		2997,
+		3296.7,
+		3596.399999999999,
+		3896.099999999999,
+		4195.8,
+		4495.5,
+		4795.2,
+		5094.900000000001,
+		5394.6,
+		5694.299999999999,
+		5993.999999999999,
+		6293.699999999999,
+		359.6399999999999,
+		719.28,
+		1078.92,
+		1438.56,
+		1798.2,
+		2157.84,
+		2517.48,
+		2877.12,
+		3236.76,
+		3596.399999999999,
+		3956.039999999999,
+		4315.679999999999,
+		4675.32,
+		5034.960000000001,
+		5394.599999999999,
+		5754.24,
+		6113.879999999999,
+		6473.52,
+		6833.160000000001,
+		7192.799999999999,
+		7552.44,
+		419.58,
+		839.16,
+		1258.74,
+		1678.32,
+		2097.9,
+		2517.48,
+		2937.059999999999,
+		3356.639999999999,
+		3776.22,
+		4195.8,
+		4615.379999999999,
+		5034.960000000001,
+		5454.540000000001,
+		5874.12,
+		6293.699999999999,
+		6713.280000000002,
+		7132.860000000001,
+		7552.44,
+		7972.02,
+		8391.6,
+		8811.18,
+		479.5200000000001,
+		959.0400000000002,
+		1438.56,
+		1918.079999999999,
+		2397.6,
+		2877.12,
+		3356.639999999999,
+		3836.160000000001,
+		4315.679999999999,
+		4795.2,
+		5274.72,
+		5754.24,
+		6233.760000000001,
+		6713.280000000002,
+		7192.799999999999,
+		7672.320000000002,
+		8151.840000000001,
+		8631.359999999999,
+		9110.880000000001,
+		9590.4,
+		10069.92,
+		539.46,
+		1078.92,
+		1618.380000000001,
+		2157.84,
+		2697.3,
+		3236.76,
+		3776.22,
+		4315.679999999999,
+		4855.14,
+		5394.599999999999,
+		5934.059999999999,
+		6473.52,
+		7012.980000000001,
+		7552.44,
+		8091.9,
+		8631.359999999999,
+		9170.82,
+		9710.280000000001,
+		10249.74,
+		10789.2,
+		11328.66,
+		599.4,
+		1198.8,
+		1798.2,
+		2397.6,
+		2997,
+		3596.399999999999,
+		4195.8,
+		4795.2,
+		5394.6,
+		5993.999999999999,
+		6593.4,
+		7192.799999999999,
+		7792.200000000001,
+		8391.6,
+		8991,
+		9590.4,
+		10189.8,
+		10789.2,
+		11388.6,
+		11988,
+		12587.4,
+		15728.99999999999,
+		15730,
+		15731,
+		15732.00000000001,
+		15732.99999999999,
+		15733.99999999999,
+		15735,
+		15736,
+		15737.00000000001,
+		15738.00000000001,
+		15739,
+		15739,
+		15739,
+		15739,
+		15739,
+		15739,
+		15739,
+		15739,
+		15739,
+		15739,
+		15739
+	}
+};
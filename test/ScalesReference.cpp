@@ -0,0 +1,5612 @@
+// Coefficient tables of some of the scales as they were written out before design_bank computed them,
+// kept as the reference for ScalesTest
+#include "ScalesReference.hpp"
+
+extern const ScaleReference REFERENCE_SCALES[] = {
+{
+	.name = "Major (ET)",
+	.c_maxq48000 = {
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2739736513132124,
+		0.3451851704060745,
+		0.4104966606403305,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.02879793265790643,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.05759586531581287,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1151917306316257,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2303834612632515,
+		0.2739736513132124,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2585966918261523,
+		0.2739736513132124,
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006795407223533782,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01359081444706756,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02718162889413513,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05436325778827026,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1087265155765405,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.217453031153081,
+		0.2739736513132124,
+		0.3451851704060745,
+		0.4349060623061621,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01359081444706756,
+		0.01616229323913452,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02718162889413513,
+		0.03232458647826904,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05436325778827026,
+		0.06464917295653808,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1087265155765405,
+		0.1292983459130762,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.217453031153081,
+		0.2585966918261523,
+		0.2739736513132124,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2440827747591693,
+		0.2739736513132124,
+		0.004280838301768944,
+		0.004805078528684788,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.007199483164476608,
+		0.008561676603537889,
+		0.009610157057369575,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.02879793265790643,
+		0.03424670641415156,
+		0.0384406282294783,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.05759586531581287,
+		0.06849341282830311,
+		0.06849341282830311,
+		0.0768812564589566,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1151917306316257,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2303834612632515,
+		0.2739736513132124,
+		0.3075250258358264,
+		0.3451851704060745,
+		0.4104966606403305,
+		0.4607669225265029,
+		0.5479473026264249,
+		0.6150500516716528,
+		0.690370340812149,
+		0.820993321280661,
+		0.9215338450530058,
+		1.09589460525285,
+		0.004280838301768944,
+		0.004805078528684788,
+		0.005393518287594914,
+		0.005714233574458755,
+		0.006414010322505164,
+		0.007199483164476608,
+		0.008081146619567259,
+		0.008561676603537889,
+		0.009610157057369575,
+		0.01078703657518983,
+		0.01142846714891751,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01616229323913452,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02157407315037966,
+		0.02285693429783502,
+		0.02565604129002066,
+		0.02879793265790643,
+		0.03232458647826904,
+		0.03232458647826904,
+		0.03424670641415156,
+		0.0384406282294783,
+		0.04314814630075931,
+		0.04571386859567005,
+		0.05131208258004132,
+		0.05759586531581288,
+		0.06464917295653809,
+		0.06849341282830312,
+		0.0768812564589566,
+		0.08629629260151862,
+		0.09142773719134011,
+		0.1026241651600826,
+		0.1151917306316258,
+		0.1292983459130762,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.1725925852030372,
+		0.1828554743826802,
+		0.2052483303201653,
+		0.2303834612632515,
+		0.2303834612632515,
+		0.2585966918261524,
+		0.2739736513132124,
+		0.3075250258358264,
+		0.3451851704060745,
+		0.3657109487653603,
+		0.4104966606403305,
+		0.460766922526503,
+		0.5171933836523047,
+		0.5479473026264249,
+		0.6150500516716528,
+		0.690370340812149,
+		0.7314218975307206,
+		0.820993321280661,
+		0.9215338450530061,
+		1.034386767304609,
+		1.09589460525285,
+		1.230100103343306,
+		1.380740681624298,
+		1.462843795061441,
+		1.641986642561322
+	},
+	.c_maxq96000 = {
+		0.002140419150884472,
+		0.002696759143797457,
+		0.003207005161252582,
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.007199483164476608,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.02879793265790643,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.05759586531581287,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1151917306316257,
+		0.1369868256566062,
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.008081146619567259,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01616229323913452,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03232458647826904,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06464917295653808,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1292983459130762,
+		0.1369868256566062,
+		0.002140419150884472,
+		0.002696759143797457,
+		0.003397703611766891,
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006795407223533782,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01359081444706756,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02718162889413513,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05436325778827026,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1087265155765405,
+		0.1369868256566062,
+		0.1725925852030372,
+		0.217453031153081,
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006795407223533782,
+		0.008081146619567259,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01359081444706756,
+		0.01616229323913452,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02718162889413513,
+		0.03232458647826904,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05436325778827026,
+		0.06464917295653808,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1087265155765405,
+		0.1292983459130762,
+		0.1369868256566062,
+		0.004280838301768944,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.007627586711224039,
+		0.008561676603537889,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01525517342244808,
+		0.01712335320707578,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.03051034684489616,
+		0.03424670641415156,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.06102069368979231,
+		0.06849341282830311,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1220413873795846,
+		0.1369868256566062,
+		0.002140419150884472,
+		0.002402539264342394,
+		0.002696759143797457,
+		0.003207005161252582,
+		0.003599741582238304,
+		0.004280838301768944,
+		0.004805078528684788,
+		0.005393518287594914,
+		0.006414010322505164,
+		0.007199483164476608,
+		0.008561676603537889,
+		0.009610157057369575,
+		0.01078703657518983,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02157407315037966,
+		0.02565604129002066,
+		0.02879793265790643,
+		0.03424670641415156,
+		0.03424670641415156,
+		0.0384406282294783,
+		0.04314814630075931,
+		0.05131208258004132,
+		0.05759586531581287,
+		0.06849341282830311,
+		0.0768812564589566,
+		0.08629629260151862,
+		0.1026241651600826,
+		0.1151917306316257,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.1725925852030372,
+		0.2052483303201653,
+		0.2303834612632515,
+		0.2739736513132124,
+		0.3075250258358264,
+		0.3451851704060745,
+		0.4104966606403305,
+		0.4607669225265029,
+		0.5479473026264249,
+		0.002140419150884472,
+		0.002402539264342394,
+		0.002696759143797457,
+		0.002857116787229377,
+		0.003207005161252582,
+		0.003599741582238304,
+		0.00404057330978363,
+		0.004280838301768944,
+		0.004805078528684788,
+		0.005393518287594914,
+		0.005714233574458755,
+		0.006414010322505164,
+		0.007199483164476608,
+		0.008081146619567259,
+		0.008561676603537889,
+		0.009610157057369575,
+		0.01078703657518983,
+		0.01142846714891751,
+		0.01282802064501033,
+		0.01439896632895322,
+		0.01616229323913452,
+		0.01616229323913452,
+		0.01712335320707578,
+		0.01922031411473915,
+		0.02157407315037966,
+		0.02285693429783503,
+		0.02565604129002066,
+		0.02879793265790644,
+		0.03232458647826904,
+		0.03424670641415156,
+		0.0384406282294783,
+		0.04314814630075931,
+		0.04571386859567005,
+		0.05131208258004132,
+		0.05759586531581288,
+		0.06464917295653809,
+		0.06849341282830312,
+		0.0768812564589566,
+		0.08629629260151862,
+		0.09142773719134011,
+		0.1026241651600826,
+		0.1151917306316258,
+		0.1151917306316258,
+		0.1292983459130762,
+		0.1369868256566062,
+		0.1537625129179132,
+		0.1725925852030372,
+		0.1828554743826802,
+		0.2052483303201653,
+		0.2303834612632515,
+		0.2585966918261524,
+		0.2739736513132124,
+		0.3075250258358264,
+		0.3451851704060745,
+		0.3657109487653603,
+		0.4104966606403305,
+		0.460766922526503,
+		0.5171933836523047,
+		0.5479473026264249,
+		0.6150500516716528,
+		0.690370340812149,
+		0.7314218975307206,
+		0.820993321280661
+	},
+	.c_bpre4800022 = {
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693123243259216, 0.9973068767567663, -1.997277826022114 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05596861381858909, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693123243259216, 0.9973068767567663, -1.997277826022114 },
+		{ 0.003391938783785411, 0.9966080612162165, -1.996561962127267 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01349885378464802, 0.9865011462156569, -1.98576733966659 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02681555221008397, 0.9731844477900297, -1.970269422622682 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05291196859294583, 0.9470880314071498, -1.935590668385107 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1954347338599746, 0.8045652661408609, -1.636577367339129 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01349885378464802, 0.9865011462156569, -1.98576733966659 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02681555221008397, 0.9731844477900297, -1.970269422622682 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05291196859294583, 0.9470880314071498, -1.935590668385107 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05919625849621272, 0.9408037415039114, -1.926368394147137 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.1148885517004107, 0.8851114483060925, -1.829235310265093 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002399655738662763, 0.9976003442613375, -1.997577283223565 },
+		{ 0.002693123243259216, 0.9973068767567663, -1.997277826022114 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.003593270279843709, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.004793553129661451, 0.995206446870339, -1.995114313795211 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564102178687455, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05596861381858909, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2057710119479239, 0.7942289880520762, -1.607112005154733 },
+		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
+		{ 0.2919107336402809, 0.7080892663597902, -1.316954421651064 },
+		{ 0.3366794082814893, 0.6633205917191545, -1.133543532973203 },
+		{ 0.3692003145377751, 0.630799685462225, -0.9859800463694947 },
+		{ 0.4218647422055749, 0.5781352577946095, -0.7216036473971494 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002399655738662763, 0.9976003442613375, -1.997577283223565 },
+		{ 0.002693123243259216, 0.9973068767567663, -1.997277826022114 },
+		{ 0.002853037225454236, 0.9971469627745557, -1.9971143570205 },
+		{ 0.003201866288643763, 0.9967981337113654, -1.996757060234848 },
+		{ 0.003593270279843709, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004032420351849574, 0.995967579648152, -1.99590240676733 },
+		{ 0.004271689139652995, 0.9957283108603474, -1.995655165543826 },
+		{ 0.004793553129661451, 0.995206446870339, -1.995114313795211 },
+		{ 0.005379000083443858, 0.9946209999165567, -1.994504953804058 },
+		{ 0.005697941137181246, 0.9943020588628291, -1.994171822396902 },
+		{ 0.006393487132687735, 0.9936065128673215, -1.993442482915876 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564102178687455, 0.9904358978218357, -1.990068257175529 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01136340279995649, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274611051097516, 0.9872538894892359, -1.986599885979389 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01603240669539133, 0.9839675933048655, -1.982931177691716 },
+		{ 0.01697760978050481, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134304580296828, 0.9786569541973403, -1.976815340305844 },
+		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532969389660592, 0.9746703061036448, -1.972071298045083 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180771195789074, 0.9681922880422043, -1.964080680251197 },
+		{ 0.03366691708007948, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04468470227186335, 0.9553152977282937, -1.947148728928402 },
+		{ 0.05001785657602598, 0.9499821434239846, -1.939722816583335 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260375472812528, 0.9373962452719558, -1.921224026261177 },
+		{ 0.0662002506228301, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.08737256246672774, 0.9126274375363427, -1.880741141441922 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1212880493063797, 0.8787119506961812, -1.816244584825735 },
+		{ 0.1280180280633102, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1671117053831056, 0.8328882946198586, -1.711678582026151 },
+		{ 0.1855547741814696, 0.8144452258203794, -1.663706411638779 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2278658130660425, 0.772134186935479, -1.54035689744841 },
+		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2647357119875735, 0.7352642880137701, -1.417267194837147 },
+		{ 0.2919107336402809, 0.7080892663597902, -1.316954421651064 },
+		{ 0.3062966346578139, 0.6937033653424187, -1.260497365967171 },
+		{ 0.3366794082814893, 0.6633205917191545, -1.133543532973203 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.4038084071595591, 0.5961915928408708, -0.8157392198398624 },
+		{ 0.4218647422055749, 0.5781352577946095, -0.7216036473971494 },
+		{ 0.4593860729410246, 0.5406139270592686, -0.5147864327225303 },
+		{ 0.4986102471969354, 0.5013897528158646, -0.2836293424370332 },
+		{ 0.5187756409130231, 0.4812243590873971, -0.15959218096542 },
+		{ 0.5600069445692514, 0.4399930554980156, 0.1024356493099694 }
+	},
+	.c_bpre9600022 = {
+		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001347469458600167, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003593270279843709, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05596861381858909, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001347469458600167, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001697409992233136, 0.9983025900077674, -1.998291055421122 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003391932261075263, 0.9966080677390012, -1.996561968827503 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01349888606757408, 0.9865011139324832, -1.985767303861751 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02681552036263177, 0.9731844796374167, -1.970269461440493 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.0529120305798396, 0.9470879694203849, -1.935590579107296 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.1030243781796103, 0.8969756218208279, -1.852301984921573 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003391932261075263, 0.9966080677390012, -1.996561968827503 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006772359317687171, 0.9932276406824655, -1.993043559359074 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01349888606757408, 0.9865011139324832, -1.985767303861751 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02681552036263177, 0.9731844796374167, -1.970269461440493 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.0529120305798396, 0.9470879694203849, -1.935590579107296 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003806532025864093, 0.9961934679741439, -1.9961353988494 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007598574365664685, 0.9924014256343514, -1.992169593748362 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01513941039893861, 0.9848605896010932, -1.983936825550939 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.03004961905065011, 0.969950380949413, -1.966283935281568 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05919638165034714, 0.9408036183529976, -1.926368210056912 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001200548527715424, 0.9987994514722851, -1.998793682743783 },
+		{ 0.001347469458600167, 0.9986525305414123, -1.998645262951418 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002399655738662763, 0.9976003442613375, -1.997577283223565 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003593270279843709, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008525143929762899, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564134590150012, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05596861381858909, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1280183134139537, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1855550407065016, 0.8144449592938457, -1.66370569333951 },
+		{ 0.2057710119479239, 0.7942289880520762, -1.607112005154733 },
+		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
+		{ 0.001069637247203934, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001200548527715424, 0.9987994514722851, -1.998793682743783 },
+		{ 0.001347469458600167, 0.9986525305414123, -1.998645262951418 },
+		{ 0.00142753754444755, 0.9985724624555575, -1.99856430518216 },
+		{ 0.001602216693488222, 0.9983977833065164, -1.998387506684898 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.002018246836070207, 0.9979817531639302, -1.99796544343532 },
+		{ 0.002138130370567426, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002399655738662763, 0.9976003442613375, -1.997577283223565 },
+		{ 0.002693126506913034, 0.9973068734930874, -1.997277822687978 },
+		{ 0.002853040488605587, 0.9971469595113996, -1.997114353682704 },
+		{ 0.003201869550653083, 0.9967981304493513, -1.996757056889078 },
+		{ 0.003593270279843709, 0.9964067297201568, -1.996354990509996 },
+		{ 0.004032426870504835, 0.9959675731295595, -1.995902400037819 },
+		{ 0.004271695656773346, 0.995728304343321, -1.995655158803373 },
+		{ 0.004793540102701143, 0.9952064598975611, -1.995114327323801 },
+		{ 0.005379006593300037, 0.9946209934067776, -1.994504947013024 },
+		{ 0.005697934629499153, 0.9943020653705209, -1.994171829202509 },
+		{ 0.006393493635923263, 0.9936065063641825, -1.993442476078507 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.008048593274544517, 0.9919514067255844, -1.991691243155729 },
+		{ 0.008525143929762896, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009564134590150012, 0.9904358654098977, -1.990068222265821 },
+		{ 0.01072907947466966, 0.9892709205254852, -1.988807993479254 },
+		{ 0.01136340279995648, 0.9886365972000836, -1.988117149403563 },
+		{ 0.01274607820308212, 0.9872539217970443, -1.986599921613149 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01603237449491755, 0.9839676255051303, -1.982931214071721 },
+		{ 0.01697757761080473, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01903679650984312, 0.9809632034902522, -1.979499764664712 },
+		{ 0.02134301377619052, 0.9786569862238147, -1.976815377888588 },
+		{ 0.02259767867671927, 0.9774023213233605, -1.975336537903339 },
+		{ 0.02532972579237131, 0.9746702742076341, -1.972071259562314 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.03180774364185535, 0.9681922563581861, -1.964080640311271 },
+		{ 0.03366685383496548, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03771119339833018, 0.9622888066018583, -1.956492376078495 },
+		{ 0.04223050331532973, 0.9577694966846801, -1.950484218257796 },
+		{ 0.04468463974803307, 0.9553153602535356, -1.94714881456053 },
+		{ 0.05001779440032295, 0.9499822056001724, -1.939722904581009 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.06260363202447335, 0.9373963679768456, -1.921224213340504 },
+		{ 0.06620025062283011, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07400025268914177, 0.9259997473112286, -1.903276415136619 },
+		{ 0.08267759122039423, 0.9173224087796253, -1.88883644405978 },
+		{ 0.08737286112178209, 0.912627138879761, -1.880740620136492 },
+		{ 0.09753380904399873, 0.9024661909569682, -1.862534279738735 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1212883368623883, 0.8787116631384149, -1.816243992388378 },
+		{ 0.1280183134139537, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1425244679802553, 0.8574755320204597, -1.770333165268908 },
+		{ 0.1585195983507837, 0.8414804016492542, -1.732856688975128 },
+		{ 0.1671114328181645, 0.8328885671819604, -1.711679265563538 },
+		{ 0.1855550407065016, 0.8144449592938457, -1.66370569333951 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2278655603843925, 0.7721344396158423, -1.540357690571506 },
+		{ 0.239647938258562, 0.7603520617415391, -1.502628737008348 },
+		{ 0.264735471371676, 0.7352645286284852, -1.417268046675904 },
+		{ 0.2919111970904739, 0.7080888029166006, -1.316952640465122 },
+		{ 0.3062966346578139, 0.6937033653424187, -1.260497365967171 },
+		{ 0.3366802766022222, 0.6633197234350987, -1.133539754460812 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375590084989, 0.999993258132167, -1.999964168324223 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003599709187077814, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.000719935358460072, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.00287958594550287, 0.9998560207027247, -1.986602506088068 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257836, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.0064638838212084, 0.9996768068977846, -1.933187347098545 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375590084989, 0.999993258132167, -1.999964168324223 },
+		{ 0.0001698845141879116, 0.9999915057749519, -1.99994532856666 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006795304907018602, 0.999966023598164, -1.999227243170693 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001359037180215036, 0.9999320481871105, -1.996977508250568 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002717977681979694, 0.9998641011552721, -1.988055100639989 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.01086971201995787, 0.9994565147678818, -1.813326090461238 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006795304907018602, 0.999966023598164, -1.999227243170693 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001359037180215036, 0.9999320481871105, -1.996977508250568 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002717977681979694, 0.9998641011552721, -1.988055100639989 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
+		{ 0.0064638838212084, 0.9996768068977846, -1.933187347098545 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.003050804558647559, 0.9998474598231686, -1.984972955964274 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.006101209910639277, 0.9996949422605439, -1.940422462249227 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001201266174158889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001348375590084989, 0.999993258132167, -1.999964168324223 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0001799862692379034, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002402525133026302, 0.999987987374518, -1.999895633501168 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003599709187077814, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805050298573803, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.000719935358460072, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008561537828800881, 0.9999571924621234, -1.998784491390396 },
+		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.001712261729676578, 0.9999143869203432, -1.99522507617636 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.00287958594550287, 0.9998560207027247, -1.986602506088068 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257836, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.0115158564162415, 0.999424207179188, -1.790907776077773 },
+		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537036650894682, 0.9992314822889434, -1.632860892900521 },
+		{ 0.01725181129280895, 0.9991374094682743, -1.541355538462134 },
+		{ 0.0205143209067085, 0.9989742842599332, -1.362289617375435 },
+		{ 0.02302508208503286, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02737861637457866, 0.998631069272508, -0.9138757038124511 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001201266174158889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001348375590084989, 0.999993258132167, -1.999964168324223 },
+		{ 0.0001428553148019067, 0.9999928572382751, -1.999960205021671 },
+		{ 0.0001603495931073119, 0.9999919825240636, -1.999950843351133 },
+		{ 0.0001799862692379034, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002020276145478931, 0.9999898986198159, -1.999924594401133 },
+		{ 0.0002140408029515046, 0.9999892979600933, -1.999915996474394 },
+		{ 0.0002402525133026302, 0.999987987374518, -1.999895633501168 },
+		{ 0.0002696741374074437, 0.9999865162934245, -1.999870158017709 },
+		{ 0.0002857098610605676, 0.9999857145112071, -1.999855106878225 },
+		{ 0.0003206981509704915, 0.9999839650960449, -1.999819410420593 },
+		{ 0.0003599709187077814, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805050298573803, 0.9999759749587874, -1.999606572226021 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0005714151369485633, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413933699626556, 0.9999679304164839, -1.999309742726944 },
+		{ 0.000719935358460072, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0008081015496520695, 0.9999595950260391, -1.998914825264178 },
+		{ 0.0008561537828800878, 0.9999571924621234, -1.998784491390396 },
+		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078678512694529, 0.999946066199104, -1.998084637693308 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761530290752, 0.99993586202504, -1.997303600119783 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616163804652782, 0.999919191848252, -1.995741305683054 },
+		{ 0.001712261729676577, 0.9999143869203432, -1.99522507617636 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00228556259513827, 0.9998857219344829, -1.991533000325126 },
+		{ 0.00256544008444602, 0.9998717280001567, -1.989349920009726 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003232199412693112, 0.9998383900628629, -1.98314494157025 },
+		{ 0.003424390514337299, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004570880552454798, 0.9997714572556161, -1.966432342927127 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.0064638838212084, 0.9996768068977846, -1.933187347098545 },
+		{ 0.006848194709681473, 0.9996575923107331, -1.925077468264887 },
+		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009140723647193772, 0.9995429651075202, -1.867312305528995 },
+		{ 0.01025978887345443, 0.9994870113685824, -1.833375465653553 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01292568137550575, 0.9993537166141615, -1.737858402905473 },
+		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537036650894682, 0.9992314822889434, -1.632860892900521 },
+		{ 0.01725181129280895, 0.9991374094682743, -1.541355538462134 },
+		{ 0.01827718755929216, 0.9990861407306839, -1.487771038503012 },
+		{ 0.0205143209067085, 0.9989742842599332, -1.362289617375435 },
+		{ 0.02302508208503236, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02584295331959977, 0.9987078525446702, -1.021446542884322 },
+		{ 0.02737861637457866, 0.998631069272508, -0.9138757038124511 },
+		{ 0.03072886632770732, 0.9984635568310913, -0.6677740005200434 },
+		{ 0.03448893647756474, 0.9982755597321242, -0.3774966373698755 },
+		{ 0.03653767234131036, 0.9981731166001321, -0.2152900089678612 },
+		{ 0.04100842573648528, 0.997949614081081, 0.1421265646500948 }
+	},
+	.c_bpre9600080040 = {
+		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.74188931358207e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001799862692379034, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003599709187077814, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.000719935358460072, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.00287958594550287, 0.9998560207027247, -1.986602506088068 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.74188931358207e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.494243747129484e-05, 0.999995752878457, -1.999984208518551 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001698847872253687, 0.999991505791314, -1.999945328760923 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006795301341335686, 0.9999660235163544, -1.999227239531347 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001359035015382198, 0.9999320482689169, -1.996977515444642 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00271798201138089, 0.9998641009916696, -1.988055072070793 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005435594651706547, 0.9997282204518797, -1.952634767385599 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001698847872253687, 0.999991505791314, -1.999945328760923 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003397681314033846, 0.99998301165478, -1.999798306450004 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006795301341335686, 0.9999660235163544, -1.999227239531347 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001359035015382198, 0.9999320482689169, -1.996977515444642 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.00271798201138089, 0.9998641009916696, -1.988055072070793 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001906889201534229, 0.9999904655571863, -1.999932285978054 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003813760221932181, 0.9999809312052784, -1.999748217383028 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007627447720074379, 0.9999618627741754, -1.999031070515955 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001525460455043487, 0.9999237270027994, -1.996201495338461 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.003050837643482306, 0.9998474594959691, -1.984972891902056 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.006339890483412e-05, 0.999996996830101, -1.999991224645367 },
+		{ 6.74188931358207e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001201266174158889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001799862692379034, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002402539579671924, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003599709187077814, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805028445858338, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.000719935358460072, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.0008561491896146907, 0.9999571925439324, -1.998784495954072 },
+		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.00287958594550287, 0.9998560207027247, -1.986602506088068 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257836, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006848170598617235, 0.9996575914928905, -1.925077113377608 },
+		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.01025979203588549, 0.999487010550879, -1.833374942663341 },
+		{ 0.0115158564162415, 0.999424207179188, -1.790907776077773 },
+		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
+		{ 5.351041548815546e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.006339890483412e-05, 0.999996996830101, -1.999991224645367 },
+		{ 6.74188931358207e-05, 0.9999966290604018, -1.999989356582936 },
+		{ 7.142778495035297e-05, 0.9999964286127602, -1.999988265527374 },
+		{ 8.017495725848303e-05, 0.9999959912539967, -1.999985706413705 },
+		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 0.0001010140623681478, 0.999994949297153, -1.999978623134617 },
+		{ 0.000107020687815012, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001201266174158889, 0.9999939936692211, -1.999970904998273 },
+		{ 0.0001348375232386477, 0.9999932581239859, -1.999964168245442 },
+		{ 0.0001428554407236486, 0.9999928572300939, -1.999960204938692 },
+		{ 0.0001603497182797666, 0.9999919825158824, -1.999950843258994 },
+		{ 0.0001799862692379034, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0002020284485491571, 0.9999898986034534, -1.99992459417321 },
+		{ 0.0002140418817224206, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002402539579671924, 0.9999879874072427, -1.999895634037066 },
+		{ 0.0002696750824575389, 0.9999865162770624, -1.999870157718951 },
+		{ 0.0002857096092226997, 0.9999857145275692, -1.999855107193774 },
+		{ 0.0003206992561748759, 0.9999839650796827, -1.999819410068407 },
+		{ 0.0003599709187077814, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004040548563145437, 0.9999797973089454, -1.999718585171967 },
+		{ 0.0004280814727634833, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004805028445858338, 0.9999759748769773, -1.99960656962848 },
+		{ 0.0005393465286912327, 0.9999730327359353, -1.999507615180677 },
+		{ 0.0005714151369485632, 0.999971429259213, -1.999449020713854 },
+		{ 0.0006413910496939774, 0.9999679304982937, -1.999309746166673 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0008080982278907826, 0.9999595951078482, -1.998914829576402 },
+		{ 0.0008561491896146904, 0.9999571925439324, -1.998784495954072 },
+		{ 0.000960994145049706, 0.9999519503311609, -1.998474483547209 },
+		{ 0.001078674422920264, 0.9999460662809119, -1.998084643421218 },
+		{ 0.001142813948150686, 0.9999428593347134, -1.997853527914739 },
+		{ 0.001282761179125894, 0.9999358619432331, -1.997303593324514 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001616165006075819, 0.9999191917664461, -1.995741297145098 },
+		{ 0.00171226855332445, 0.9999143870839539, -1.995225094256315 },
+		{ 0.00192194211463787, 0.9999039029710927, -1.993996360723552 },
+		{ 0.002157290668922532, 0.9998921354706697, -1.99245010970846 },
+		{ 0.002285570871343191, 0.9998857220980886, -1.991533024389042 },
+		{ 0.002565440786858962, 0.9998717281637601, -1.989349946990546 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.003232203088139012, 0.9998383903900593, -1.983145009401197 },
+		{ 0.0034243905143373, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003843699536351091, 0.9998078151768245, -1.976213680582106 },
+		{ 0.00431434864271283, 0.9997842825760958, -1.970073168649486 },
+		{ 0.004570884146666729, 0.9997714564376801, -1.966432104124481 },
+		{ 0.005130552499903791, 0.9997434727811843, -1.957769755091089 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.006463885231962107, 0.9996768060799256, -1.93318701161995 },
+		{ 0.006848170598617235, 0.9996575914928905, -1.925077113377608 },
+		{ 0.00768666037197667, 0.9996156672886553, -1.905804880099845 },
+		{ 0.008627766605244069, 0.9995686116861983, -1.881619723307976 },
+		{ 0.009140682581348598, 0.9995429659252693, -1.867312774300711 },
+		{ 0.01025979203588549, 0.999487010550879, -1.833374942663341 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01292565347205853, 0.9993537174317561, -1.737859050630892 },
+		{ 0.01369399632535796, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01537033934657654, 0.9992314831064377, -1.632861648568635 },
+		{ 0.01725190891956686, 0.9991374078334393, -1.541353870721555 },
+		{ 0.01827718755929216, 0.9990861407306839, -1.487771038503012 },
+		{ 0.02051473404555641, 0.9989742809907974, -1.362285785289611 }
+	},
+},
+{
+	.name = "Indian Shrutis",
+	.c_maxq48000 = {
+		0.00214041915088612,
+		0.002283113760945195,
+		0.002378243500984578,
+		0.002407971544746885,
+		0.002536793067716883,
+		0.002568502981063344,
+		0.00267552393860765,
+		0.002708967987840245,
+		0.002853892201181493,
+		0.002889565853696262,
+		0.003009964430933606,
+		0.003047588986320276,
+		0.00321062872632918,
+		0.003382390756955843,
+		0.003424670641417792,
+		0.003567365251476867,
+		0.003611957317120327,
+		0.003805189601575324,
+		0.003852754471595016,
+		0.004013285907911474,
+		0.004063451981760367,
+		0.004280838301772239,
+		0.004566227521890389,
+		0.004756487001969155,
+		0.004815943089493771,
+		0.005073586135433765,
+		0.005137005962126687,
+		0.0053510478772153,
+		0.005417935975680491,
+		0.005707784402362985,
+		0.005779131707392524,
+		0.006019928861867212,
+		0.006095177972640553,
+		0.006421257452658361,
+		0.006764781513911687,
+		0.006849341282835584,
+		0.007134730502953733,
+		0.007223914634240654,
+		0.007610379203150648,
+		0.007705508943190032,
+		0.008026571815822949,
+		0.008126903963520735,
+		0.008561676603544479,
+		0.009132455043780779,
+		0.00951297400393831,
+		0.009631886178987541,
+		0.01014717227086753,
+		0.01027401192425337,
+		0.0107020957544306,
+		0.01083587195136098,
+		0.01141556880472597,
+		0.01155826341478505,
+		0.01203985772373442,
+		0.01219035594528111,
+		0.01284251490531672,
+		0.01352956302782337,
+		0.01369868256567117,
+		0.01426946100590747,
+		0.01444782926848131,
+		0.0152207584063013,
+		0.01541101788638006,
+		0.0160531436316459,
+		0.01625380792704147,
+		0.01712335320708896,
+		0.01826491008756156,
+		0.01902594800787662,
+		0.01926377235797508,
+		0.02029434454173506,
+		0.02054802384850675,
+		0.0214041915088612,
+		0.02167174390272196,
+		0.02283113760945194,
+		0.02311652682957009,
+		0.02407971544746885,
+		0.02438071189056221,
+		0.02568502981063344,
+		0.02705912605564675,
+		0.02739736513134234,
+		0.02853892201181493,
+		0.02889565853696262,
+		0.03044151681260259,
+		0.03082203577276013,
+		0.0321062872632918,
+		0.03250761585408294,
+		0.03424670641417792,
+		0.03652982017512311,
+		0.03805189601575324,
+		0.03852754471595016,
+		0.04058868908347012,
+		0.0410960476970135,
+		0.0428083830177224,
+		0.04334348780544393,
+		0.04566227521890388,
+		0.04623305365914019,
+		0.0481594308949377,
+		0.04876142378112442,
+		0.05137005962126689,
+		0.05411825211129349,
+		0.05479473026268467,
+		0.05707784402362986,
+		0.05779131707392524,
+		0.06088303362520518,
+		0.06164407154552026,
+		0.06421257452658359,
+		0.06501523170816588,
+		0.06849341282835583,
+		0.07305964035024623,
+		0.07610379203150648,
+		0.07705508943190033,
+		0.08117737816694025,
+		0.082192095394027,
+		0.0856167660354448,
+		0.08668697561088785,
+		0.09132455043780777,
+		0.09246610731828038,
+		0.09631886178987539,
+		0.09752284756224884,
+		0.1027401192425338,
+		0.108236504222587,
+		0.1095894605253693,
+		0.1141556880472597,
+		0.1155826341478505,
+		0.1217660672504104,
+		0.1232881430910405,
+		0.1284251490531672,
+		0.1300304634163318,
+		0.1369868256567117,
+		0.1461192807004925,
+		0.152207584063013,
+		0.1541101788638007,
+		0.1623547563338805,
+		0.164384190788054,
+		0.1712335320708896,
+		0.1733739512217757,
+		0.1826491008756155,
+		0.1849322146365608,
+		0.1926377235797508,
+		0.1950456951244977,
+		0.2054802384850676,
+		0.216473008445174,
+		0.2191789210507387,
+		0.2283113760945195,
+		0.2311652682957009,
+		0.2435321345008207,
+		0.246576286182081,
+		0.2568502981063344,
+		0.2600609268326635,
+		0.2739736513134233,
+		0.2922385614009849,
+		0.3044151681260259,
+		0.3082203577276013,
+		0.324709512667761,
+		0.328768381576108,
+		0.3424670641417792,
+		0.3467479024435514,
+		0.3652982017512311,
+		0.3698644292731215,
+		0.3852754471595016,
+		0.3900913902489954,
+		0.4109604769701351,
+		0.432946016890348,
+		0.4383578421014774,
+		0.4566227521890389,
+		0.4623305365914019,
+		0.4870642690016415,
+		0.493152572364162,
+		0.5137005962126687,
+		0.520121853665327,
+		0.5479473026268467,
+		0.5844771228019698,
+		0.6088303362520519,
+		0.6164407154552026,
+		0.649419025335522,
+		0.657536763152216,
+		0.6849341282835584,
+		0.6934958048871028,
+		0.7305964035024621,
+		0.739728858546243,
+		0.7705508943190031,
+		0.7801827804979907,
+		0.8219209539402702,
+		0.8658920337806959,
+		0.8767156842029548,
+		0.9132455043780778,
+		0.9246610731828038,
+		0.9741285380032829,
+		0.9863051447283241,
+		1.027401192425337,
+		1.040243707330654,
+		1.095894605253693,
+		1.16895424560394,
+		1.217660672504104,
+		1.232881430910405,
+		1.298838050671044,
+		1.315073526304432,
+		1.369868256567117,
+		1.386991609774206,
+		1.461192807004924,
+		1.479457717092486,
+		1.541101788638006,
+		1.560365560995981,
+		1.64384190788054,
+		1.731784067561392,
+		1.75343136840591,
+		1.826491008756156,
+		1.849322146365608,
+		1.948257076006566,
+		1.972610289456648,
+		2.054802384850675,
+		2.080487414661308,
+		2.191789210507387,
+		2.337908491207879,
+		2.435321345008207,
+		2.465762861820811,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088,
+		2.597676101342088
+	},
+	.c_maxq96000 = {
+		0.00107020957544306,
+		0.001141556880472597,
+		0.001189121750492289,
+		0.001203985772373443,
+		0.001268396533858441,
+		0.001284251490531672,
+		0.001337761969303825,
+		0.001354483993920123,
+		0.001426946100590746,
+		0.001444782926848131,
+		0.001504982215466803,
+		0.001523794493160138,
+		0.00160531436316459,
+		0.001691195378477922,
+		0.001712335320708896,
+		0.001783682625738433,
+		0.001805978658560164,
+		0.001902594800787662,
+		0.001926377235797508,
+		0.002006642953955737,
+		0.002031725990880184,
+		0.00214041915088612,
+		0.002283113760945195,
+		0.002378243500984578,
+		0.002407971544746885,
+		0.002536793067716883,
+		0.002568502981063344,
+		0.00267552393860765,
+		0.002708967987840245,
+		0.002853892201181493,
+		0.002889565853696262,
+		0.003009964430933606,
+		0.003047588986320276,
+		0.00321062872632918,
+		0.003382390756955843,
+		0.003424670641417792,
+		0.003567365251476867,
+		0.003611957317120327,
+		0.003805189601575324,
+		0.003852754471595016,
+		0.004013285907911474,
+		0.004063451981760367,
+		0.004280838301772239,
+		0.004566227521890389,
+		0.004756487001969155,
+		0.004815943089493771,
+		0.005073586135433765,
+		0.005137005962126687,
+		0.0053510478772153,
+		0.005417935975680491,
+		0.005707784402362985,
+		0.005779131707392524,
+		0.006019928861867212,
+		0.006095177972640553,
+		0.006421257452658361,
+		0.006764781513911687,
+		0.006849341282835584,
+		0.007134730502953733,
+		0.007223914634240654,
+		0.007610379203150648,
+		0.007705508943190032,
+		0.008026571815822949,
+		0.008126903963520735,
+		0.008561676603544479,
+		0.009132455043780779,
+		0.00951297400393831,
+		0.009631886178987541,
+		0.01014717227086753,
+		0.01027401192425337,
+		0.0107020957544306,
+		0.01083587195136098,
+		0.01141556880472597,
+		0.01155826341478505,
+		0.01203985772373442,
+		0.01219035594528111,
+		0.01284251490531672,
+		0.01352956302782337,
+		0.01369868256567117,
+		0.01426946100590747,
+		0.01444782926848131,
+		0.0152207584063013,
+		0.01541101788638006,
+		0.0160531436316459,
+		0.01625380792704147,
+		0.01712335320708896,
+		0.01826491008756156,
+		0.01902594800787662,
+		0.01926377235797508,
+		0.02029434454173506,
+		0.02054802384850675,
+		0.0214041915088612,
+		0.02167174390272196,
+		0.02283113760945194,
+		0.02311652682957009,
+		0.02407971544746885,
+		0.02438071189056221,
+		0.02568502981063344,
+		0.02705912605564675,
+		0.02739736513134234,
+		0.02853892201181493,
+		0.02889565853696262,
+		0.03044151681260259,
+		0.03082203577276013,
+		0.0321062872632918,
+		0.03250761585408294,
+		0.03424670641417792,
+		0.03652982017512311,
+		0.03805189601575324,
+		0.03852754471595016,
+		0.04058868908347012,
+		0.0410960476970135,
+		0.0428083830177224,
+		0.04334348780544393,
+		0.04566227521890388,
+		0.04623305365914019,
+		0.0481594308949377,
+		0.04876142378112442,
+		0.05137005962126689,
+		0.05411825211129349,
+		0.05479473026268467,
+		0.05707784402362986,
+		0.05779131707392524,
+		0.06088303362520518,
+		0.06164407154552026,
+		0.06421257452658359,
+		0.06501523170816588,
+		0.06849341282835583,
+		0.07305964035024623,
+		0.07610379203150648,
+		0.07705508943190033,
+		0.08117737816694025,
+		0.082192095394027,
+		0.0856167660354448,
+		0.08668697561088785,
+		0.09132455043780777,
+		0.09246610731828038,
+		0.09631886178987539,
+		0.09752284756224884,
+		0.1027401192425338,
+		0.108236504222587,
+		0.1095894605253693,
+		0.1141556880472597,
+		0.1155826341478505,
+		0.1217660672504104,
+		0.1232881430910405,
+		0.1284251490531672,
+		0.1300304634163318,
+		0.1369868256567117,
+		0.1461192807004925,
+		0.152207584063013,
+		0.1541101788638007,
+		0.1623547563338805,
+		0.164384190788054,
+		0.1712335320708896,
+		0.1733739512217757,
+		0.1826491008756155,
+		0.1849322146365608,
+		0.1926377235797508,
+		0.1950456951244977,
+		0.2054802384850676,
+		0.216473008445174,
+		0.2191789210507387,
+		0.2283113760945195,
+		0.2311652682957009,
+		0.2435321345008207,
+		0.246576286182081,
+		0.2568502981063344,
+		0.2600609268326635,
+		0.2739736513134233,
+		0.2922385614009849,
+		0.3044151681260259,
+		0.3082203577276013,
+		0.324709512667761,
+		0.328768381576108,
+		0.3424670641417792,
+		0.3467479024435514,
+		0.3652982017512311,
+		0.3698644292731215,
+		0.3852754471595016,
+		0.3900913902489954,
+		0.4109604769701351,
+		0.432946016890348,
+		0.4383578421014774,
+		0.4566227521890389,
+		0.4623305365914019,
+		0.4870642690016415,
+		0.493152572364162,
+		0.5137005962126687,
+		0.520121853665327,
+		0.5479473026268467,
+		0.5844771228019698,
+		0.6088303362520519,
+		0.6164407154552026,
+		0.649419025335522,
+		0.657536763152216,
+		0.6849341282835584,
+		0.6934958048871028,
+		0.7305964035024621,
+		0.739728858546243,
+		0.7705508943190031,
+		0.7801827804979907,
+		0.8219209539402702,
+		0.8658920337806959,
+		0.8767156842029548,
+		0.9132455043780778,
+		0.9246610731828038,
+		0.9741285380032829,
+		0.9863051447283241,
+		1.027401192425337,
+		1.040243707330654,
+		1.095894605253693,
+		1.16895424560394,
+		1.217660672504104,
+		1.232881430910405,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044,
+		1.298838050671044
+	},
+	.c_bpre4800022 = {
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001140905267680372, 0.9988590947323202, -1.998853885102284 },
+		{ 0.001188412277528982, 0.9988115877225215, -1.998805935070047 },
+		{ 0.001203258163296067, 0.9987967418367679, -1.998790947031014 },
+		{ 0.001267594321704521, 0.9987324056783171, -1.998725974422472 },
+		{ 0.0012834260552942, 0.9987165739447134, -1.998709980985979 },
+		{ 0.001336867741827628, 0.9986631322581723, -1.998655978617132 },
+		{ 0.001353567682408427, 0.9986464323175938, -1.998639098774728 },
+		{ 0.001425926507539671, 0.9985740734924826, -1.998565934626911 },
+		{ 0.001443742536054898, 0.9985562574639889, -1.998547913873851 },
+		{ 0.001503848046295663, 0.9984961519537313, -1.998487098914163 },
+		{ 0.001522636402870661, 0.9984773635971572, -1.998468082848682 },
+		{ 0.001604026747847973, 0.9983959732521525, -1.998385673388713 },
+		{ 0.001689768596002947, 0.9983102314040267, -1.998298800480031 },
+		{ 0.001710872951283081, 0.9982891270487548, -1.99827740868514 },
+		{ 0.001782095223213279, 0.9982179047768128, -1.998205190000539 },
+		{ 0.001804347466185049, 0.9981956525338234, -1.998182618102466 },
+		{ 0.001900785540633137, 0.9980992144593678, -1.998084748777321 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002004627991681216, 0.9979953720083546, -1.997979281758119 },
+		{ 0.002029664313985725, 0.9979703356860169, -1.997953840808912 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002280508870531002, 0.99771949112947, -1.997698664517072 },
+		{ 0.002375418760656867, 0.9976245812393466, -1.997601983964474 },
+		{ 0.002405075025500493, 0.9975949249744996, -1.99757175959611 },
+		{ 0.00253357531962396, 0.9974664246804011, -1.99744071612506 },
+		{ 0.002565204928149782, 0.9974347950718664, -1.997408440192681 },
+		{ 0.002671948268296747, 0.9973280517317038, -1.997299456332867 },
+		{ 0.002705303219345619, 0.9972946967806587, -1.997265382502424 },
+		{ 0.002849826274980878, 0.9971501737250377, -1.997117641374173 },
+		{ 0.002885394153414351, 0.9971146058465878, -1.997081255781208 },
+		{ 0.003005441058915976, 0.9969945589410949, -1.996958373915837 },
+		{ 0.00304294785901175, 0.9969570521409983, -1.996919957633316 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.003376675351159931, 0.9966233246488458, -1.996577639858749 },
+		{ 0.003418812293628005, 0.9965811877063737, -1.996534354631018 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.003605439262592181, 0.9963945607374252, -1.996342470176706 },
+		{ 0.003797958095595352, 0.9962020419044065, -1.996144234325483 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004005243968676354, 0.9959947560313239, -1.995930459524986 },
+		{ 0.004055209090744792, 0.9959447909092616, -1.995878878563031 },
+		{ 0.004271689139653243, 0.9957283108603474, -1.995655165543826 },
+		{ 0.004555817020353541, 0.9954441829796491, -1.995360971845917 },
+		{ 0.004745194907025379, 0.995254805092982, -1.995164523732451 },
+		{ 0.004804365665122996, 0.9951956343348778, -1.995103084652738 },
+		{ 0.005060738147161915, 0.9949392618528398, -1.994836558131651 },
+		{ 0.00512383609139882, 0.9948761639086072, -1.994770879856201 },
+		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
+		{ 0.005403287773181772, 0.9945967122268264, -1.994479614366412 },
+		{ 0.00569152453239668, 0.9943084754676063, -1.994178532578583 },
+		{ 0.005762462807408955, 0.9942375371925961, -1.994104330221415 },
+		{ 0.006001842936157173, 0.9939981570638513, -1.993853635762538 },
+		{ 0.006076642691553303, 0.9939233573084559, -1.993775205745359 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.00674193576447449, 0.9932580642358362, -1.993075635870998 },
+		{ 0.00682592330939016, 0.9931740766908648, -1.992987066975018 },
+		{ 0.007109361338607747, 0.9928906386619714, -1.992687747087931 },
+		{ 0.007197866337508856, 0.9928021336628763, -1.992594149826156 },
+		{ 0.007581491705494782, 0.9924185082945092, -1.992187719586632 },
+		{ 0.007675929804751687, 0.9923240701963366, -1.992087484929245 },
+		{ 0.007994445958105334, 0.9920055540418963, -1.991748886163474 },
+		{ 0.008093973460719397, 0.9919060265392927, -1.99164291498941 },
+		{ 0.008525143929763187, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009090904514417318, 0.9909090954860811, -1.990577012434074 },
+		{ 0.00946789887217191, 0.9905321011285994, -1.990171836626721 },
+		{ 0.009585623472325765, 0.9904143765281869, -1.990045075511484 },
+		{ 0.01009583930856181, 0.9899041606919032, -1.989494395340542 },
+		{ 0.01022139257453293, 0.989778607425849, -1.989358560581442 },
+		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01077738002760371, 0.9892226199724123, -1.988755504241616 },
+		{ 0.01135065561329091, 0.9886493443867153, -1.988131064640887 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01196763788768067, 0.9880323621129593, -1.987456029859763 },
+		{ 0.01211635979670587, 0.9878836402033123, -1.987292850940948 },
+		{ 0.01276039045869732, 0.9872396095413829, -1.98658413513159 },
+		{ 0.0134384178310987, 0.9865615821695203, -1.985834353511192 },
+		{ 0.01360525338975688, 0.9863947466107515, -1.985649287005155 },
+		{ 0.01416811513509982, 0.9858318848651213, -1.985023241693475 },
+		{ 0.01434398790591168, 0.9856560120945222, -1.984827095788174 },
+		{ 0.0151055043945085, 0.9848944956054988, -1.983974880167563 },
+		{ 0.0152928752600474, 0.9847071247399526, -1.983764465651186 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01612243451505617, 0.9838775654849683, -1.982829430442941 },
+		{ 0.01697760978050467, 0.9830223902198703, -1.98185961909105 },
+		{ 0.01809910021783067, 0.9819008997823047, -1.980578697588161 },
+		{ 0.01884609241740112, 0.9811539075826085, -1.979719778635349 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02008981677994113, 0.9799101832201682, -1.97827951113565 },
+		{ 0.02033837240102352, 0.9796616275991471, -1.977990148889893 },
+		{ 0.0211767502229378, 0.9788232497770653, -1.977010372323061 },
+		{ 0.02143860813494901, 0.9785613918650833, -1.97670316116258 },
+		{ 0.02257247384372903, 0.9774275261562821, -1.975366374270423 },
+		{ 0.02285141802706583, 0.9771485819732816, -1.975035879661568 },
+		{ 0.02379211531014787, 0.9762078846898554, -1.973916587098443 },
+		{ 0.02408591341868893, 0.9759140865813477, -1.973565507747321 },
+		{ 0.0253579533527373, 0.9746420466474223, -1.972037199476861 },
+		{ 0.02669630828975239, 0.9733036917102477, -1.970414705469504 },
+		{ 0.02702546753975829, 0.972974532460253, -1.970013381127019 },
+		{ 0.02813555839184389, 0.971864441608337, -1.968653258655241 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.02998283252600512, 0.97001716747401, -1.966367122542472 },
+		{ 0.03035187848637586, 0.9696481215136245, -1.965906983592711 },
+		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03198493613542029, 0.9680150638646278, -1.963857144674253 },
+		{ 0.0336669170800795, 0.9663330829199375, -1.961722512131246 },
+		{ 0.03587068610901398, 0.9641293138911817, -1.958889659140922 },
+		{ 0.03733700963539661, 0.9626629903646221, -1.956982072728441 },
+		{ 0.03779482940156732, 0.9622051705986322, -1.956382759213956 },
+		{ 0.03977596997509963, 0.9602240300250973, -1.953768876640452 },
+		{ 0.04026303259525816, 0.9597369674048457, -1.953121159356398 },
+		{ 0.0419050456958703, 0.9580949543041354, -1.950922691401318 },
+		{ 0.04241760235113531, 0.9575823976489289, -1.950231740702229 },
+		{ 0.04463543111203278, 0.9553645688879895, -1.947216198660475 },
+		{ 0.04518058625482295, 0.9548194137451774, -1.946468532475902 },
+		{ 0.0470181658693646, 0.9529818341306421, -1.943929611565316 },
+		{ 0.04759169561216562, 0.9524083043879062, -1.943131261934363 },
+		{ 0.05007294307956665, 0.9499270569204934, -1.939644839428779 },
+		{ 0.05267992370320282, 0.9473200762967972, -1.935924642822358 },
+		{ 0.05332055918377449, 0.9466794408162477, -1.935001466165577 },
+		{ 0.0554794453186195, 0.9445205546814081, -1.931864283832681 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0590666948057279, 0.9409333051943015, -1.926561997532561 },
+		{ 0.05978252044509952, 0.9402174795549011, -1.925490528852913 },
+		{ 0.06219438323302607, 0.9378056167669827, -1.921847431514289 },
+		{ 0.06294683613125548, 0.9370531638688396, -1.92070043869114 },
+		{ 0.06620025062283003, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07045466609610292, 0.9295453339042812, -1.908983213042984 },
+		{ 0.07327996698228047, 0.9267200330177563, -1.90444479377794 },
+		{ 0.07416145206777842, 0.9258385479427459, -1.903014300417245 },
+		{ 0.07796993285624779, 0.9220300671441777, -1.896754159879905 },
+		{ 0.07890483282843277, 0.9210951671745174, -1.895197602729788 },
+		{ 0.08205417869760596, 0.9179458213042083, -1.889896394547758 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.08727877946814266, 0.9127212205366463, -1.880904799510105 },
+		{ 0.08832000647530014, 0.9116799935260445, -1.879083307830163 },
+		{ 0.09182538606238837, 0.9081746139425293, -1.872878644988852 },
+		{ 0.09291842173309428, 0.9070815782670465, -1.870921019058288 },
+		{ 0.09763835029632684, 0.9023616497073262, -1.862342050870689 },
+		{ 0.1025845555747964, 0.8974154444263687, -1.853131906715319 },
+		{ 0.1037978017145651, 0.8962021982893195, -1.850838228784563 },
+		{ 0.1078809217843794, 0.8921190782156745, -1.843018565121339 },
+		{ 0.109152895585477, 0.8908471044163706, -1.840550866389203 },
+		{ 0.1146446310695083, 0.885355368931118, -1.829722814184669 },
+		{ 0.1159908597107511, 0.8840091402935922, -1.827025233579297 },
+		{ 0.1205205100374709, 0.8794794899632891, -1.817823105450646 },
+		{ 0.1219313680835824, 0.8780686319166024, -1.814917229795779 },
+		{ 0.1280180280633103, 0.8719819719414862, -1.802163694945135 },
+		{ 0.1359454722175226, 0.8640545277832211, -1.785021009225222 },
+		{ 0.1411899804036392, 0.8588100195964314, -1.773346457806082 },
+		{ 0.1428224221220405, 0.8571775778779611, -1.769658010693557 },
+		{ 0.1498605552829239, 0.8501394447178966, -1.753457366555208 },
+		{ 0.1515842482987786, 0.8484157517052598, -1.749415583690459 },
+		{ 0.1573754691536355, 0.8426245308498574, -1.735621246300642 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.166939428346658, 0.833060571654596, -1.712110474345765 },
+		{ 0.1688395894069323, 0.8311604105956486, -1.707330343490485 },
+		{ 0.1752194104090779, 0.8247805895918523, -1.691014744150961 },
+		{ 0.1772030103688335, 0.8227969896314359, -1.685857991414579 },
+		{ 0.1857439860685323, 0.8142560139330381, -1.6631962986446 },
+		{ 0.1946455201072463, 0.8053544798949771, -1.638781489564825 },
+		{ 0.1968221454613213, 0.8031778545397602, -1.63268693628976 },
+		{ 0.2041235502837177, 0.7958764497163848, -1.611883084501303 },
+		{ 0.2063919559715538, 0.7936080440316116, -1.605306360901414 },
+		{ 0.2161458707060334, 0.783854129295156, -1.576410619664972 },
+		{ 0.2185283513499805, 0.78147164865045, -1.569199822561555 },
+		{ 0.2265158267353526, 0.7734841732660874, -1.544584495489581 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2534097730187154, 0.7465902269826855, -1.45665701461964 },
+		{ 0.2624453502409098, 0.7375546497592229, -1.4253466709472 },
+		{ 0.2652465999832749, 0.7347534000167282, -1.415457082705361 },
+		{ 0.2772629245362842, 0.7227370754652536, -1.372047995867147 },
+		{ 0.2801902411442336, 0.7198097588558323, -1.361229688367437 },
+		{ 0.2899834353056022, 0.7100165646945451, -1.324340846003185 },
+		{ 0.293016571933351, 0.7069834280671006, -1.31269740491967 },
+		{ 0.306010538171412, 0.6939894618302931, -1.261642939422601 },
+		{ 0.3091719197130863, 0.6908280802873006, -1.248932789115144 },
+		{ 0.3197369790342457, 0.6802630209674833, -1.205633459365805 },
+		{ 0.3230051138539472, 0.6769948861465533, -1.191982377224266 },
+		{ 0.3369867098337329, 0.663013290167162, -1.132205713578635 },
+		{ 0.3514045862182348, 0.6485954137820649, -1.068225076216675 },
+		{ 0.3549049117646045, 0.6450950882367019, -1.052333608543035 },
+		{ 0.3665806767870317, 0.6334193232131574, -0.9983138168177181 },
+		{ 0.3701858602360683, 0.629814139763936, -0.9813196652404923 },
+		{ 0.3855723018459378, 0.6144276981549239, -0.90713008315289 },
+		{ 0.389302062356337, 0.6106979376444528, -0.8887423668000664 },
+		{ 0.4017226252791354, 0.5982773747213684, -0.8263808750438928 },
+		{ 0.4055520265074005, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.421864742205575, 0.5781352577946095, -0.7216036473971494 },
+		{ 0.4426026681586857, 0.5573973318416389, -0.6091209380521765 },
+		{ 0.4560131386187914, 0.54398686138145, -0.533975427136668 },
+		{ 0.4601374411638632, 0.5398625588361424, -0.5104962677098522 },
+		{ 0.477650777871414, 0.5223492221287224, -0.408931136842927 },
+		{ 0.4818732328493087, 0.5181267671699999, -0.3840063997132224 },
+		{ 0.4958758179827635, 0.5041241820372223, -0.3001956854520381 },
+		{ 0.5001731239447729, 0.499826876103498, -0.2741324629120475 },
+		{ 0.5183786268715802, 0.4816213731315, -0.1620642046602609 },
+		{ 0.5227559387972855, 0.4772440612240433, -0.1347465860348699 },
+		{ 0.5372434338834495, 0.4627565662003634, -0.04342001197299912 },
+		{ 0.5416773241962149, 0.4583226758111719, -0.01521397519340812 },
+		{ 0.5604128016671207, 0.439587198356206, 0.1050568965232047 },
+		{ 0.5793250906051042, 0.4206749094533486, 0.2277327264016849 },
+		{ 0.5838517824211475, 0.4161482176035046, 0.2571975712478258 },
+		{ 0.5987810114078777, 0.4012189886295836, 0.3543993761197944 },
+		{ 0.6033346685979624, 0.3966653314125422, 0.3840006055737145 },
+		{ 0.6224790979180121, 0.3775209020859294, 0.507702766010537 },
+		{ 0.6270470525968631, 0.3729529474304429, 0.536940683128211 },
+		{ 0.6420632458498091, 0.3579367541784974, 0.6318817624605987 },
+		{ 0.6466325319782557, 0.353367468075141, 0.6603255571073567 },
+		{ 0.6657587486843425, 0.334241251345644, 0.7763137408249879 },
+		{ 0.6893082144564122, 0.3106917855441781, 0.9096969519576674 },
+		{ 0.7040786820095314, 0.2959213179952881, 0.9859218932776043 },
+		{ 0.7085476545808449, 0.2914523454525645, 1.00757150912454 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 },
+		{ 0.7322104281351459, 0.272848352700589, 1.044697760504135 }
+	},
+	.c_bpre9600022 = {
+		{ 0.0005349617156208133, 0.9994650382843794, -1.999463893242008 },
+		{ 0.0005706154348276653, 0.9994293845651727, -1.999428081785652 },
+		{ 0.0005943827842119868, 0.9994056172158137, -1.999404203632215 },
+		{ 0.0006018101693883827, 0.9993981898306439, -1.999396740692759 },
+		{ 0.0006339981376719009, 0.9993660018623391, -1.999364393538055 },
+		{ 0.0006419190576857418, 0.9993580809423184, -1.999356432172937 },
+		{ 0.0006686574222882169, 0.9993313425777119, -1.999329553568735 },
+		{ 0.0006770130145149731, 0.9993229869854859, -1.999321152978315 },
+		{ 0.0007132175934374753, 0.9992867824065736, -1.999284746963547 },
+		{ 0.0007221320053439594, 0.9992778679946778, -1.999275781342908 },
+		{ 0.0007522069307808499, 0.9992477930692325, -1.999245528956839 },
+		{ 0.0007616082249791413, 0.9992383917750345, -1.999236070703032 },
+		{ 0.0008023352448461595, 0.9991976647551538, -1.999195088754642 },
+		{ 0.000845241514610185, 0.9991547584854044, -1.999151899544625 },
+		{ 0.0008558026747503422, 0.9991441973252683, -1.999141266478641 },
+		{ 0.0008914449486552697, 0.9991085550513581, -1.999105374937946 },
+		{ 0.0009025810593771615, 0.9990974189406271, -1.999094158859551 },
+		{ 0.0009508448232558262, 0.9990491551767446, -1.999045537033632 },
+		{ 0.0009627256821338171, 0.9990372743178716, -1.999033565170043 },
+		{ 0.001002816816624251, 0.9989971831833936, -1.998993158599838 },
+		{ 0.001015347622389953, 0.9989846523776115, -1.998980526560574 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001140905267680372, 0.9988590947323202, -1.998853885102284 },
+		{ 0.001188415546083563, 0.9988115844539183, -1.99880593177034 },
+		{ 0.001203261431787018, 0.9987967385682132, -1.998790943730967 },
+		{ 0.001267591053350762, 0.9987324089466613, -1.99872597772399 },
+		{ 0.0012834260552942, 0.9987165739447134, -1.998709980985979 },
+		{ 0.001336867741827628, 0.9986631322581723, -1.998655978617132 },
+		{ 0.001353567682408427, 0.9986464323175938, -1.998639098774728 },
+		{ 0.001425929775352711, 0.9985740702246565, -1.998565931321768 },
+		{ 0.00144373926824459, 0.9985562607317564, -1.998547917179401 },
+		{ 0.001503851313845102, 0.9984961486861605, -1.998487095607237 },
+		{ 0.001522633135338475, 0.9984773668646668, -1.99846808615604 },
+		{ 0.001604026747847973, 0.9983959732521525, -1.998385673388713 },
+		{ 0.001689765329013734, 0.9983102346709892, -1.998298803791213 },
+		{ 0.001710869684352431, 0.9982891303156485, -1.998277411996805 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.001804347466185049, 0.9981956525338234, -1.998182618102466 },
+		{ 0.001900785540633137, 0.9980992144593678, -1.998084748777321 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002004631257578115, 0.9979953687424225, -1.997979278439732 },
+		{ 0.002029664313985725, 0.9979703356860169, -1.997953840808912 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002280508870531002, 0.99771949112947, -1.997698664517072 },
+		{ 0.002375418760656867, 0.9976245812393466, -1.997601983964474 },
+		{ 0.002405075025500493, 0.9975949249744996, -1.99757175959611 },
+		{ 0.002533578583801143, 0.9974664214161997, -1.997440712794571 },
+		{ 0.002565208192234029, 0.997434791807769, -1.997408436861471 },
+		{ 0.002671948268296747, 0.9973280517317038, -1.997299456332867 },
+		{ 0.002705303219345619, 0.9972946967806587, -1.997265382502424 },
+		{ 0.002849823011797788, 0.9971501769882036, -1.997117644711892 },
+		{ 0.002885394153414351, 0.9971146058465878, -1.997081255781208 },
+		{ 0.003005437796251825, 0.9969945622037523, -1.996958377257116 },
+		{ 0.003042951121540986, 0.9969570488784637, -1.996919954291179 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.003376668828425839, 0.99662333117173, -1.996577646558282 },
+		{ 0.003418805771145307, 0.9965811942289824, -1.996534361332483 },
+		{ 0.003561021104958328, 0.9964389788953318, -1.996388165043087 },
+		{ 0.003605432741380599, 0.9963945672588124, -1.996342476886699 },
+		{ 0.003797958095595352, 0.9962020419044065, -1.996144234325483 },
+		{ 0.003845358292574048, 0.9961546417079712, -1.996095380792998 },
+		{ 0.004005243968676354, 0.9959947560313239, -1.995930459524986 },
+		{ 0.004055209090744792, 0.9959447909092616, -1.995878878563031 },
+		{ 0.00427169565677319, 0.995728304343321, -1.995655158803373 },
+		{ 0.004555830050934474, 0.9954441699493149, -1.995360958339043 },
+		{ 0.004745207935259034, 0.9952547920651272, -1.995164510208279 },
+		{ 0.00480435263829865, 0.9951956473619583, -1.995103098182323 },
+		{ 0.005060725123668472, 0.9949392748765644, -1.994836571684653 },
+		{ 0.00512382306868581, 0.9948761769315059, -1.994770893414968 },
+		{ 0.005336757229044919, 0.994663242770956, -1.994549014599737 },
+		{ 0.005403287773181772, 0.9945967122268264, -1.994479614366412 },
+		{ 0.00569152453239668, 0.9943084754676063, -1.994178532578583 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.006001829925064254, 0.9939981700752569, -1.993853649401502 },
+		{ 0.006076642691553303, 0.9939233573084559, -1.993775205745359 },
+		{ 0.006400679578884212, 0.993599320421156, -1.993434920615793 },
+		{ 0.00674193576447449, 0.9932580642358362, -1.993075635870998 },
+		{ 0.00682592330939016, 0.9931740766908648, -1.992987066975018 },
+		{ 0.007109328845868803, 0.992890671154242, -1.992687781438059 },
+		{ 0.007197898826715353, 0.9928021011735026, -1.992594115455831 },
+		{ 0.007581491705494782, 0.9924185082945092, -1.992187719586632 },
+		{ 0.007675897329933457, 0.9923241026700667, -1.992087519408595 },
+		{ 0.007994445958105334, 0.9920055540418963, -1.991748886163474 },
+		{ 0.008093973460719397, 0.9919060265392927, -1.99164291498941 },
+		{ 0.008525143929763187, 0.9914748560704251, -1.991182902834333 },
+		{ 0.009090872086562115, 0.9909091279135058, -1.990577047235952 },
+		{ 0.009467866456318075, 0.990532133543687, -1.990171871514483 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01009587170268893, 0.9899041282973662, -1.989494360309736 },
+		{ 0.01022142496466544, 0.9897785750354202, -1.989358525522077 },
+		{ 0.010645033480368, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01077738002760371, 0.9892226199724123, -1.988755504241616 },
+		{ 0.01135065561329091, 0.9886493443867153, -1.988131064640887 },
+		{ 0.01149173904669069, 0.9885082609534841, -1.987976979777587 },
+		{ 0.01196767022032501, 0.9880323297796766, -1.987455994402967 },
+		{ 0.01211635979670587, 0.9878836402033123, -1.987292850940948 },
+		{ 0.01276039045869732, 0.9872396095413829, -1.98658413513159 },
+		{ 0.01343845011563134, 0.9865615498843687, -1.98583431772001 },
+		{ 0.01360528566894622, 0.9863947143310596, -1.985649251176066 },
+		{ 0.01416814739624236, 0.9858318526038489, -1.985023205736528 },
+		{ 0.01434395564997145, 0.9856560443500404, -1.984827131784976 },
+		{ 0.0151055043945085, 0.9848944956054988, -1.983974880167563 },
+		{ 0.0152928752600474, 0.9847071247399526, -1.983764465651186 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01612243451505617, 0.9838775654849683, -1.982829430442941 },
+		{ 0.01697757761080529, 0.9830224223892035, -1.981859655685487 },
+		{ 0.01809913235042532, 0.9819008676496734, -1.980578660739472 },
+		{ 0.01884609241740112, 0.9811539075826085, -1.979719778635349 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.0200897847124454, 0.9799102152876543, -1.978279548434996 },
+		{ 0.02033834034155276, 0.9796616596584996, -1.977990186245466 },
+		{ 0.0211767502229378, 0.9788232497770653, -1.977010372323061 },
+		{ 0.02143860813494901, 0.9785613918650833, -1.97670316116258 },
+		{ 0.02257247384372903, 0.9774275261562821, -1.975366374270423 },
+		{ 0.02285138604960579, 0.9771486139503947, -1.975035917585081 },
+		{ 0.02379211531014787, 0.9762078846898554, -1.973916587098443 },
+		{ 0.02408591341868893, 0.9759140865813477, -1.973565507747321 },
+		{ 0.02535798524769428, 0.974642014752336, -1.972037160987721 },
+		{ 0.02669630828975239, 0.9733036917102477, -1.970414705469504 },
+		{ 0.02702546753975829, 0.972974532460253, -1.970013381127019 },
+		{ 0.02813552658748722, 0.9718644734125268, -1.968653297769843 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.02998283252600512, 0.97001716747401, -1.966367122542472 },
+		{ 0.03035187848637586, 0.9696481215136245, -1.965906983592711 },
+		{ 0.03159635648817693, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03198493613542029, 0.9680150638646278, -1.963857144674253 },
+		{ 0.03366685383496579, 0.9663331461662921, -1.961722592845494 },
+		{ 0.03587068610901398, 0.9641293138911817, -1.958889659140922 },
+		{ 0.03733700963539661, 0.9626629903646221, -1.956982072728441 },
+		{ 0.03779495535908165, 0.9622050446462781, -1.956382594090897 },
+		{ 0.03977603282163308, 0.9602239671785838, -1.953768793194234 },
+		{ 0.04026296978201866, 0.9597370302194856, -1.953121243019777 },
+		{ 0.0419051084039563, 0.9580948915969693, -1.950922607005879 },
+		{ 0.04241760235113531, 0.9575823976489289, -1.950231740702229 },
+		{ 0.04463555617137816, 0.9553644438310684, -1.947216027439419 },
+		{ 0.04518064874829227, 0.9548193512523949, -1.9464684466235 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.04759169561216562, 0.9524083043879062, -1.943131261934363 },
+		{ 0.05007281873620895, 0.9499271812656622, -1.939645015473931 },
+		{ 0.0526798617018442, 0.9473201382987531, -1.935924731997757 },
+		{ 0.05332043526568792, 0.9466795647363048, -1.935001645081576 },
+		{ 0.0554794453186195, 0.9445205546814081, -1.931864283832681 },
+		{ 0.05615302913312293, 0.9438469708678259, -1.930877195717097 },
+		{ 0.05906675638995908, 0.9409332436103627, -1.926561905544307 },
+		{ 0.05978239737314497, 0.9402176026290892, -1.925490713458613 },
+		{ 0.06219432185417278, 0.9378056781462188, -1.921847524874209 },
+		{ 0.06294683613125548, 0.9370531638688396, -1.92070043869114 },
+		{ 0.06620025062283003, 0.9337997493796442, -1.915683929838771 },
+		{ 0.07045466609610292, 0.9295453339042812, -1.908983213042984 },
+		{ 0.07327996698228047, 0.9267200330177563, -1.90444479377794 },
+		{ 0.07416114907724942, 0.9258388509227515, -1.903014793289067 },
+		{ 0.07796993285624779, 0.9220300671441777, -1.896754159879905 },
+		{ 0.07890513425521681, 0.9210948657468784, -1.895197099605682 },
+		{ 0.08205417869760596, 0.9179458213042083, -1.889896394547758 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.0872784807766369, 0.912721519224016, -1.880905320613017 },
+		{ 0.08832000647530014, 0.9116799935260445, -1.879083307830163 },
+		{ 0.09182568325735462, 0.9081743167431304, -1.872878114190059 },
+		{ 0.09291842173309428, 0.9070815782670465, -1.870921019058288 },
+		{ 0.09763864559060596, 0.9023613544102154, -1.862341507741079 },
+		{ 0.1025845555747964, 0.8974154444263687, -1.853131906715319 },
+		{ 0.1037980949926829, 0.896201905007884, -1.850837672677801 },
+		{ 0.1078809217843794, 0.8921190782156745, -1.843018565121339 },
+		{ 0.1091531871142777, 0.8908468128873851, -1.840550299076196 },
+		{ 0.1146446310695083, 0.885355368931118, -1.829722814184669 },
+		{ 0.1159911489979021, 0.8840088510023246, -1.827024652060433 },
+		{ 0.1205205100374709, 0.8794794899632891, -1.817823105450646 },
+		{ 0.1219313680835824, 0.8780686319166024, -1.814917229795779 },
+		{ 0.1280183134139535, 0.8719816865860999, -1.802163088738755 },
+		{ 0.1359454722175226, 0.8640545277832211, -1.785021009225222 },
+		{ 0.1411899804036392, 0.8588100195964314, -1.773346457806082 },
+		{ 0.1428224221220405, 0.8571775778779611, -1.769658010693557 },
+		{ 0.1498605552829239, 0.8501394447178966, -1.753457366555208 },
+		{ 0.1515839706513244, 0.8484160293487106, -1.749416237072139 },
+		{ 0.1573751934019431, 0.8426248065981354, -1.735621911030412 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.1669397009647084, 0.8330602990362063, -1.712109791141151 },
+		{ 0.1688393174079064, 0.8311606825923015, -1.707331030335645 },
+		{ 0.1752194104090779, 0.8247805895918523, -1.691014744150961 },
+		{ 0.1772030103688335, 0.8227969896314359, -1.685857991414579 },
+		{ 0.1857437196027436, 0.8142562803977395, -1.663197017279807 },
+		{ 0.1946457836567788, 0.8053542163433832, -1.638780754598021 },
+		{ 0.1968218826215659, 0.8031781173791415, -1.632687675193852 },
+		{ 0.2041235502837177, 0.7958764497163848, -1.611883084501303 },
+		{ 0.2063916962607233, 0.793608303739279, -1.605307116958412 },
+		{ 0.2161456141896071, 0.783854385810862, -1.576411392789127 },
+		{ 0.2185283513499805, 0.78147164865045, -1.569199822561555 },
+		{ 0.2265160798562503, 0.773483920144025, -1.544583704647202 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.2396479382585619, 0.7603520617415391, -1.502628737008348 },
+		{ 0.2534095286963725, 0.7465904713038056, -1.456657849139329 },
+		{ 0.2624453502409098, 0.7375546497592229, -1.4253466709472 },
+		{ 0.2652465999832749, 0.7347534000167282, -1.415457082705361 },
+		{ 0.2772626880196282, 0.722737311980447, -1.372048866094363 },
+		{ 0.280189770040282, 0.7198102299703719, -1.361231437130568 },
+		{ 0.2899829706115911, 0.7100170293994521, -1.324342621948745 },
+		{ 0.2930156465198328, 0.7069843535068494, -1.312700973200037 },
+		{ 0.306010538171412, 0.6939894618302931, -1.261642939422601 },
+		{ 0.3091714675784416, 0.6908285324333698, -1.248934615025634 },
+		{ 0.3197378695406019, 0.6802621305058538, -1.205629756424184 },
+		{ 0.32300467076528, 0.6769953292388153, -1.191984236310432 },
+		{ 0.3369862759044548, 0.6630137241084877, -1.132207603475486 },
+		{ 0.3514054352592323, 0.648594564773209, -1.06822123872503 },
+		{ 0.3549044895630941, 0.6450955104505882, -1.052335533823167 },
+		{ 0.3665815059510431, 0.6334184940697449, -0.9983099254146518 },
+		{ 0.3701862724541478, 0.6298137275516804, -0.9813177136971202 },
+		{ 0.3855727039891179, 0.6144272960130672, -0.9071281091071478 },
+		{ 0.3893012629684265, 0.6106987370467072, -0.8887463246681315 },
+		{ 0.4017218421505355, 0.5982781578651332, -0.8263848615712317 },
+		{ 0.4055528046663713, 0.5944471953631718, -0.8068021114921052 },
+		{ 0.4218639854441633, 0.5781360145723876, -0.7216076677912432 },
+		{ 0.4426026681586857, 0.5573973318416389, -0.6091209380521765 },
+		{ 0.4560134946596421, 0.5439865053429984, -0.5339734076172157 },
+		{ 0.4601367345032426, 0.5398632655150419, -0.510500305315691 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 },
+		{ 0.4776511197507207, 0.5223488802520677, -0.4089291254547753 }
+	},
+	.c_bpre4800080040 = {
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 5.707775288569886e-05, 0.9999971461125834, -1.999991933516442 },
+		{ 5.945626896164841e-05, 0.9999970272069204, -1.999991371202015 },
+		{ 6.019955743878447e-05, 0.999996990047881, -1.999991191762431 },
+		{ 6.341999490161164e-05, 0.9999968290090301, -1.999990393684691 },
+		{ 6.421247911523708e-05, 0.9999967893792746, -1.999990192197627 },
+		{ 6.688799698921024e-05, 0.9999966556002257, -1.999989497186221 },
+		{ 6.772413084975596e-05, 0.9999966137942766, -1.999989275297251 },
+		{ 7.134725619029857e-05, 0.9999964326460926, -1.999988287988197 },
+		{ 7.223950603522835e-05, 0.9999963880421822, -1.999988038439774 },
+		{ 7.524907266241078e-05, 0.9999962375571765, -1.999987177722332 },
+		{ 7.618991636659063e-05, 0.9999961905152769, -1.999986902713507 },
+		{ 8.026556954503774e-05, 0.9999959867216131, -1.9999856786116 },
+		{ 8.455994852350821e-05, 0.9999957720142748, -1.99998433144849 },
+		{ 8.56170275761881e-05, 0.9999957191637481, -1.999983990792338 },
+		{ 8.918426317748259e-05, 0.9999955407973323, -1.999982814709858 },
+		{ 9.029872837902971e-05, 0.9999954850670376, -1.999982438895191 },
+		{ 9.512949763785123e-05, 0.9999952435254973, -1.999980764116728 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.000100332033972573, 0.9999949834127143, -1.999978877059215 },
+		{ 0.0001015861102606197, 0.9999949206957149, -1.999978409104007 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001141553428740544, 0.9999942922333115, -1.999973441905671 },
+		{ 0.0001189119029278971, 0.9999940544063163, -1.99997143032779 },
+		{ 0.0001203982335274824, 0.9999939800884594, -1.999970786889104 },
+		{ 0.0001268393103347369, 0.9999936580444779, -1.999967916962172 },
+		{ 0.0001284247520880769, 0.9999935787688569, -1.999967190128151 },
+		{ 0.0001337757702817552, 0.9999933112116364, -1.999964677654743 },
+		{ 0.0001354480323569916, 0.9999932276000196, -1.99996387371547 },
+		{ 0.0001426943760118488, 0.9999928652885487, -1.999960286631982 },
+		{ 0.00014447774352468, 0.9999927761137726, -1.999959377985468 },
+		{ 0.0001504978451766618, 0.9999924751121461, -1.999956235765422 },
+		{ 0.0001523788511243053, 0.999992381061428, -1.999955230170944 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0001691187909674532, 0.999991544062788, -1.999945782204374 },
+		{ 0.0001712327699628911, 0.9999914383621847, -1.999944525293828 },
+		{ 0.000178367434140717, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0001805970490660872, 0.99999097015446, -1.999938785755083 },
+		{ 0.0001902585427956318, 0.9999904870736187, -1.999932569785937 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002006633198707925, 0.9999899668342321, -1.999925541631114 },
+		{ 0.000203171704556286, 0.999989841417229, -1.999923795490765 },
+		{ 0.0002140408029571688, 0.9999892979600933, -1.999915996474394 },
+		{ 0.000228310034175833, 0.9999885844992018, -1.999905183861393 },
+		{ 0.0002378230988697134, 0.9999881088479821, -1.999897613314754 },
+		{ 0.0002407957422590524, 0.9999879602131582, -1.999895188232903 },
+		{ 0.0002536777542818017, 0.9999873161128144, -1.999884352507044 },
+		{ 0.0002568487976863675, 0.9999871575625837, -1.99988160376605 },
+		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0002708951474157991, 0.9999864552459046, -1.999869040966948 },
+		{ 0.0002853871354825546, 0.9999857306443637, -1.999855417843191 },
+		{ 0.0002889544433750187, 0.9999855522797299, -1.999851961364473 },
+		{ 0.0003009941195070155, 0.9999849502972785, -1.999839995084257 },
+		{ 0.0003047567828463676, 0.9999847621645425, -1.999836160229763 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0003382378968830565, 0.999983088229803, -1.999800044372587 },
+		{ 0.0003424654386490728, 0.999982876830395, -1.999795228278334 },
+		{ 0.0003567391296011746, 0.9999821632759116, -1.999778549730198 },
+		{ 0.0003611946267087568, 0.9999819404231826, -1.999773207247765 },
+		{ 0.0003805152756813137, 0.999980974237733, -1.999749309543339 },
+		{ 0.0003852820973979059, 0.9999807363320938, -1.999743241848262 },
+		{ 0.0004013246264698192, 0.9999799337691286, -1.999722238400035 },
+		{ 0.0004063413451585637, 0.999979682937655, -1.999715504935722 },
+		{ 0.0004280814727609967, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004566227377528523, 0.9999771690632689, -1.999643573459251 },
+		{ 0.0004756507587851876, 0.9999762177719155, -1.999614243988385 },
+		{ 0.0004815913860323758, 0.9999759206367215, -1.99960484557337 },
+		{ 0.0005073547002414787, 0.9999746324519577, -1.999562793367351 },
+		{ 0.0005136959589358272, 0.9999743153555438, -1.999552116173722 },
+		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0005417866256076224, 0.9999729106752698, -1.999503270526228 },
+		{ 0.0005707701986741852, 0.9999714614923424, -1.99945023098801 },
+		{ 0.0005779055430794498, 0.99997110480092, -1.999436764056811 },
+		{ 0.0006019874206012352, 0.9999699008864983, -1.999390107930775 },
+		{ 0.0006095089218488926, 0.9999695245612764, -1.999375143433401 },
+		{ 0.0006421155140426252, 0.9999678942566038, -1.999308221528274 },
+		{ 0.0006764700735534339, 0.9999661767456141, -1.999234041012943 },
+		{ 0.0006849250132112075, 0.9999657539539929, -1.999215201383949 },
+		{ 0.0007134611086017462, 0.9999643270335906, -1.999149929043009 },
+		{ 0.0007223833188336273, 0.9999638810088949, -1.999128991852354 },
+		{ 0.000761023311765466, 0.9999619488374458, -1.999035352543512 },
+		{ 0.0007705360234567621, 0.9999614731988953, -1.999011568884837 },
+		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0008126744346443001, 0.999959366288093, -1.998902734804912 },
+		{ 0.0008561537828897495, 0.9999571924621234, -1.998784491390396 },
+		{ 0.0009132248632596821, 0.9999543388114068, -1.998620092474825 },
+		{ 0.0009512746150121417, 0.9999524362730423, -1.99850469934004 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.00101469320865016, 0.9999492653838118, -1.998302088928483 },
+		{ 0.001027377236784231, 0.9999486312071723, -1.998260023664356 },
+		{ 0.001070181108262045, 0.9999464909457915, -1.998114261663522 },
+		{ 0.001083558574583829, 0.9999458220843713, -1.998067507494197 },
+		{ 0.001141524108413177, 0.9999429237991311, -1.997858303212896 },
+		{ 0.001155797347729746, 0.999942210273157, -1.99780515159712 },
+		{ 0.001203949720337874, 0.9999398025153384, -1.997620989151649 },
+		{ 0.001218999268648669, 0.9999390500513053, -1.997561915056227 },
+		{ 0.001284210412497621, 0.9999357895439864, -1.997297576156662 },
+		{ 0.001352910568090637, 0.9999323544716272, -1.997004382928787 },
+		{ 0.001369821748022286, 0.9999315089171638, -1.996929899034883 },
+		{ 0.001426897947238077, 0.9999286551761292, -1.996671769626806 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.00152201766572143, 0.9999238991227826, -1.996218443042531 },
+		{ 0.001541042360630608, 0.9999229478821053, -1.996124306136216 },
+		{ 0.00160525018807507, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001625315847309666, 0.9999187342272845, -1.995693410632624 },
+		{ 0.001712261729673017, 0.9999143869203432, -1.99522507617636 },
+		{ 0.001826410709794119, 0.9999086795441485, -1.994573577146226 },
+		{ 0.001902503983861199, 0.9999048748083929, -1.994116160734863 },
+		{ 0.001926287656166788, 0.9999036856985055, -1.993969412279075 },
+		{ 0.002029331504598626, 0.9998985335052328, -1.993312729234924 },
+		{ 0.002054696514754673, 0.9998972652167053, -1.993145881411851 },
+		{ 0.002140304952153661, 0.9998929847548015, -1.992567620766334 },
+		{ 0.002167058444225417, 0.9998916471039889, -1.992382120329821 },
+		{ 0.002282983062950283, 0.9998858508559548, -1.991551952111663 },
+		{ 0.002311519012658675, 0.9998844240495721, -1.991341027529162 },
+		{ 0.002407826965934198, 0.9998796086544139, -1.990610011260134 },
+		{ 0.002437924239346702, 0.9998781038175072, -1.990375504371664 },
+		{ 0.002568339546457089, 0.9998715830473518, -1.989326001611416 },
+		{ 0.002705729617834832, 0.9998647135191715, -1.988161796480142 },
+		{ 0.00273954967546968, 0.9998630225253557, -1.987866003811073 },
+		{ 0.002853688108686574, 0.9998573156059436, -1.98684087523726 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.003043919504561965, 0.9998478040369082, -1.985040274076141 },
+		{ 0.003081965980692818, 0.9998459017012391, -1.984666349761049 },
+		{ 0.003210371534745037, 0.9998394814268773, -1.983370435902031 },
+		{ 0.003250499612085536, 0.9998374750586944, -1.982954720760028 },
+		{ 0.003424390514358489, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003652654630921126, 0.9998173674277224, -1.978506395517164 },
+		{ 0.00380482699165725, 0.9998097586655874, -1.976689512834859 },
+		{ 0.003852487003425909, 0.9998073800190838, -1.97610648427529 },
+		{ 0.004058463964617003, 0.9997970769787324, -1.973498484501744 },
+		{ 0.004109198255735472, 0.9997945413150283, -1.972836060082579 },
+		{ 0.004280402431744895, 0.9997859806346864, -1.970539664199966 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.004565758275449458, 0.9997717140875881, -1.966507285309539 },
+		{ 0.004622788647089528, 0.9997688611297714, -1.965670143118048 },
+		{ 0.004815392055299514, 0.9997592324572451, -1.962769200588452 },
+		{ 0.004875551305043191, 0.9997562224936934, -1.961838440626878 },
+		{ 0.005136365895631378, 0.9997431832399478, -1.957674988699425 },
+		{ 0.005411096453258486, 0.9997294456679355, -1.953058014497314 },
+		{ 0.005478743383419195, 0.9997260644678598, -1.951885432130258 },
+		{ 0.005706969040621805, 0.9997146515707231, -1.947822032037516 },
+		{ 0.005778304047438303, 0.9997110855782673, -1.946519082633143 },
+		{ 0.006087387103067512, 0.9996956309102784, -1.940689154733952 },
+		{ 0.00616348077133826, 0.9996918278030612, -1.939208972312558 },
+		{ 0.006420227518090532, 0.9996789889471115, -1.934079456041472 },
+		{ 0.006500470936909455, 0.9996749765317453, -1.932434474023008 },
+		{ 0.006848194709701493, 0.9996575923107331, -1.925077468264887 },
+		{ 0.007304642168143501, 0.9996347682101013, -1.914852821539776 },
+		{ 0.007608930147950567, 0.99961955352294, -1.907681911988136 },
+		{ 0.007704024488874238, 0.9996147987762403, -1.905382871892993 },
+		{ 0.008116104373472002, 0.9995941951352175, -1.895102113297306 },
+		{ 0.008217570716430294, 0.9995891232077541, -1.892492189535821 },
+		{ 0.00855988877446783, 0.9995720070736617, -1.883454605585992 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.009130372409092553, 0.9995434819251329, -1.867608409816096 },
+		{ 0.009244508788035446, 0.9995377756847199, -1.864321387479757 },
+		{ 0.009629583168974188, 0.9995185212480414, -1.852943482581711 },
+		{ 0.009749914060346903, 0.9995125044148597, -1.849297619901652 },
+		{ 0.01027139781241304, 0.9994864307993379, -1.833003945061082 },
+		{ 0.01082072891094206, 0.9994589645355174, -1.814976713279369 },
+		{ 0.01095596273347256, 0.9994522023410451, -1.810403495287652 },
+		{ 0.01141230960658726, 0.9994293845651727, -1.794581361178249 },
+		{ 0.01155496824587437, 0.9994222529927768, -1.789513194673186 },
+		{ 0.01217292139366928, 0.9993913544610991, -1.766883128094894 },
+		{ 0.01232502502424766, 0.9993837489409875, -1.761146536603933 },
+		{ 0.01283839407219861, 0.9993580809423184, -1.741305357737381 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 0.01369399632535179, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01460661644874286, 0.9992696698144632, -1.667391780666945 },
+		{ 0.01521496550522532, 0.9992392517854021, -1.640011157277238 },
+		{ 0.01540508137808651, 0.9992297459324639, -1.631254277295424 },
+		{ 0.01622891519230186, 0.9991885549480233, -1.592223612792206 },
+		{ 0.01643166320463701, 0.9991784168701481, -1.582350024113791 },
+		{ 0.01711602216258372, 0.9991441989601142, -1.548258873257762 },
+		{ 0.01732989438065723, 0.9991335054904866, -1.537365460945775 },
+		{ 0.01825660343574346, 0.9990871706242659, -1.488872434526308 },
+		{ 0.01848467051038387, 0.9990757666554915, -1.476620421676324 },
+		{ 0.01925452989825914, 0.9990372743178714, -1.434362474404255 },
+		{ 0.01949507508063808, 0.9990252464816647, -1.420876643777872 },
+		{ 0.02053746875333805, 0.9989731269865654, -1.360932476609053 },
+		{ 0.021635599743861, 0.9989182201559326, -1.295220495114529 },
+		{ 0.02190588452263806, 0.998904706398819, -1.278658369248598 },
+		{ 0.02281810717315457, 0.9988590947323202, -1.221663429457817 },
+		{ 0.0231031718107536, 0.9988448414115139, -1.203514991544666 },
+		{ 0.02433838825349413, 0.9987830810058453, -1.123095363513268 },
+		{ 0.02464245473877935, 0.9987678776473425, -1.102869540399949 },
+		{ 0.02566855872077779, 0.9987165723105675, -1.033425847197282 },
+		{ 0.02598920966063914, 0.9987005398311792, -1.011361816575309 },
+		{ 0.02737861637456414, 0.998631069272508, -0.9138757038124511 },
+		{ 0.029202510340193, 0.9985398746449632, -0.7816582565524766 },
+		{ 0.03041835625262062, 0.99847908230865, -0.6911579031300052 },
+		{ 0.03079829692957477, 0.9984600851562562, -0.6625308270281016 },
+		{ 0.032444601927579, 0.9983777699727107, -0.5368012026175845 },
+		{ 0.03284995618453285, 0.9983575120062522, -0.5054795753234451 },
+		{ 0.03421753283133658, 0.998289133582542, -0.3988219744993046 },
+		{ 0.03464512827743095, 0.9982677683273552, -0.3652355305875898 },
+		{ 0.03649654170754918, 0.9981751745060014, -0.2185664139873872 },
+		{ 0.03695240513161675, 0.9981523907847037, -0.1822611578956234 },
+		{ 0.03849149420916198, 0.9980754689440932, -0.05931025219977079 },
+		{ 0.03897114961596116, 0.9980514463738671, -0.02084470438900135 },
+		{ 0.04105401119502478, 0.9979473117070917, 0.1458043973671458 },
+		{ 0.04324853880043088, 0.9978376040286647, 0.3202513126014485 },
+		{ 0.04378794705409299, 0.997810615731039, 0.3628377536458661 },
+		{ 0.04561070787174522, 0.9977194845994114, 0.5052675883283164 },
+		{ 0.04617983331902856, 0.9976910139494558, 0.5492472260747285 },
+		{ 0.0486472496439048, 0.9975676396389963, 0.7362288400805693 },
+		{ 0.049254695363442, 0.9975372799490434, 0.7812059645763143 },
+		{ 0.05130433987381382, 0.9974347983359644, 0.9294561155763529 },
+		{ 0.0519453445215216, 0.9974027617311032, 0.9745587377387659 },
+		{ 0.05471994613645774, 0.9972640190434308, 1.162086317256758 },
+		{ 0.0583623813546218, 0.9970818812559786, 1.386091925091135 },
+		{ 0.06079056210604199, 0.9969604745453784, 1.519264344590776 },
+		{ 0.06154940431744864, 0.9969225481750811, 1.557968648720469 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 },
+		{ 0.06483669026607485, 0.9967581683137994, 1.708605152947726 }
+	},
+	.c_bpre9600080040 = {
+		{ 2.675522564807299e-05, 0.9999986622387479, -1.999997516890784 },
+		{ 2.853889680146557e-05, 0.9999985730552736, -1.999997269904884 },
+		{ 2.972815657166637e-05, 0.9999985136023557, -1.999997099599579 },
+		{ 3.009980136551308e-05, 0.9999984950228079, -1.999997045449829 },
+		{ 3.171002260133804e-05, 0.9999984145032582, -1.999996805670251 },
+		{ 3.210626533721097e-05, 0.9999983946883486, -1.999996745390933 },
+		{ 3.344402645941078e-05, 0.9999983277987147, -1.999996538192917 },
+		{ 3.386209408654081e-05, 0.9999983068957051, -1.999996472269054 },
+		{ 3.56736599054945e-05, 0.9999982163214556, -1.999996180154129 },
+		{ 3.611978564452553e-05, 0.9999981940194603, -1.999996106615884 },
+		{ 3.762457172694356e-05, 0.9999981187768185, -1.999995853814694 },
+		{ 3.809499445719922e-05, 0.9999980952558245, -1.999995773301823 },
+		{ 4.013282503878434e-05, 0.999997993358793, -1.999995416327044 },
+		{ 4.228001895425983e-05, 0.9999978860049028, -1.999995025858388 },
+		{ 4.280855960542794e-05, 0.9999978595795834, -1.999994927481444 },
+		{ 4.45921813008597e-05, 0.9999977703961807, -1.999994588868235 },
+		{ 4.51494151514959e-05, 0.9999977425309707, -1.999994480981668 },
+		{ 4.75648053768047e-05, 0.9999976217599208, -1.999994001900148 },
+		{ 4.8159452691642e-05, 0.9999975920293988, -1.999993881099732 },
+		{ 5.016607990088579e-05, 0.9999974917032112, -1.999993465105733 },
+		{ 5.079311963490773e-05, 0.9999974603446324, -1.999993332437204 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 5.707775288569886e-05, 0.9999971461125834, -1.999991933516442 },
+		{ 5.945603983921473e-05, 0.9999970271987394, -1.999991371162703 },
+		{ 6.01992073542403e-05, 0.9999969900396999, -1.99999119172273 },
+		{ 6.341975571700887e-05, 0.9999968290172114, -1.999990393726079 },
+		{ 6.421247911523708e-05, 0.9999967893792746, -1.999990192197627 },
+		{ 6.688799698921024e-05, 0.9999966556002257, -1.999989497186221 },
+		{ 6.772413084975596e-05, 0.9999966137942766, -1.999989275297251 },
+		{ 7.134731526951769e-05, 0.9999964326379114, -1.999988287942658 },
+		{ 7.223900222397565e-05, 0.9999963880503632, -1.999988038485779 },
+		{ 7.524906414649108e-05, 0.9999962375489951, -1.99998717767475 },
+		{ 7.6189570685437e-05, 0.9999961905234579, -1.999986902761581 },
+		{ 8.026556954503774e-05, 0.9999959867216131, -1.9999856786116 },
+		{ 8.455957425045155e-05, 0.9999957720224558, -1.999984331500946 },
+		{ 8.561656824233252e-05, 0.9999957191719294, -1.999983990845348 },
+		{ 8.918391591496197e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 9.029872837902971e-05, 0.9999954850670376, -1.999982438895191 },
+		{ 9.512949763785123e-05, 0.9999952435254973, -1.999980764116728 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001003319116039944, 0.999994983404533, -1.9999788769985 },
+		{ 0.0001015861102606197, 0.9999949206957149, -1.999978409104007 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001141553428740544, 0.9999942922333115, -1.999973441905671 },
+		{ 0.0001189119029278971, 0.9999940544063163, -1.99997143032779 },
+		{ 0.0001203982335274824, 0.9999939800884594, -1.999970786889104 },
+		{ 0.0001268392793493511, 0.999993658036297, -1.999967916887578 },
+		{ 0.0001284248111656334, 0.9999935787606755, -1.999967190052727 },
+		{ 0.0001337757702817552, 0.9999933112116364, -1.999964677654743 },
+		{ 0.0001354480323569916, 0.9999932276000196, -1.99996387371547 },
+		{ 0.0001426940767712871, 0.9999928652967303, -1.999960286714877 },
+		{ 0.00014447774352468, 0.9999927761137726, -1.999959377985468 },
+		{ 0.0001504976259986189, 0.9999924751203272, -1.999956235852403 },
+		{ 0.0001523789719009338, 0.9999923810532472, -1.999955230082978 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0001691196634678111, 0.9999915440791504, -1.999945782397836 },
+		{ 0.0001712334523479517, 0.9999914383785468, -1.999944525489502 },
+		{ 0.000178370360190369, 0.9999910815981871, -1.999940177336956 },
+		{ 0.000180598128737175, 0.9999909701708225, -1.999938785960564 },
+		{ 0.0001902585427956318, 0.9999904870736187, -1.999932569785937 },
+		{ 0.0001926419764465632, 0.9999903681196604, -1.999930993331417 },
+		{ 0.0002006633198707925, 0.9999899668342321, -1.999925541631114 },
+		{ 0.000203171704556286, 0.999989841417229, -1.999923795490765 },
+		{ 0.0002140418817274501, 0.999989297943731, -1.999915996233891 },
+		{ 0.0002283126720322718, 0.9999885844664773, -1.999905183350505 },
+		{ 0.0002378267934076185, 0.9999881088152578, -1.999897612783943 },
+		{ 0.0002407971425936614, 0.9999879602458827, -1.999895188769939 },
+		{ 0.0002536789589334511, 0.9999873161455388, -1.999884353071058 },
+		{ 0.0002568496287530024, 0.9999871575953083, -1.999881604336706 },
+		{ 0.0002675506457704426, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0002708951474157991, 0.9999864552459046, -1.999869040966948 },
+		{ 0.0002853871354825546, 0.9999857306443637, -1.999855417843191 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003009959752412928, 0.999984950330003, -1.999839995747363 },
+		{ 0.0003047567828463676, 0.9999847621645425, -1.999836160229763 },
+		{ 0.0003210603340123206, 0.9999839469994526, -1.999819020693428 },
+		{ 0.0003382378968830565, 0.999983088229803, -1.999800044372587 },
+		{ 0.0003424654386490728, 0.999982876830395, -1.999795228278334 },
+		{ 0.0003567337357669565, 0.9999821633577224, -1.99977855167979 },
+		{ 0.0003611949209502634, 0.9999819403413718, -1.99977320527483 },
+		{ 0.0003805152756813137, 0.999980974237733, -1.999749309543339 },
+		{ 0.0003852717225862434, 0.9999807364139048, -1.999743243947266 },
+		{ 0.0004013246264698192, 0.9999799337691286, -1.999722238400035 },
+		{ 0.0004063413451585637, 0.999979682937655, -1.999715504935722 },
+		{ 0.0004280814727609967, 0.9999785960019963, -1.999685396104728 },
+		{ 0.0004566176441167561, 0.9999771691450796, -1.999643575931761 },
+		{ 0.0004756429634125831, 0.999976217853726, -1.999614246560495 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0005073530394988365, 0.9999746323701476, -1.999562790629252 },
+		{ 0.0005136952154511888, 0.9999743152737336, -1.999552113402424 },
+		{ 0.0005350977123748493, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0005417866256076224, 0.9999729106752698, -1.999503270526228 },
+		{ 0.0005707701986741852, 0.9999714614923424, -1.99945023098801 },
+		{ 0.0005779070232612934, 0.9999711047191098, -1.999436760949389 },
+		{ 0.0006019839197813993, 0.9999699008046884, -1.999390104697317 },
+		{ 0.0006095089218488926, 0.9999695245612764, -1.999375143433401 },
+		{ 0.0006421155140426252, 0.9999678942566038, -1.999308221528274 },
+		{ 0.0006764667242294318, 0.9999661766638044, -1.999234037389628 },
+		{ 0.0006849226019958762, 0.9999657538721831, -1.999215197716376 },
+		{ 0.0007134616993024724, 0.9999643269517813, -1.999149925226071 },
+		{ 0.0007223782808232838, 0.9999638810907043, -1.999128995715971 },
+		{ 0.000761023311765466, 0.9999619488374458, -1.999035352543512 },
+		{ 0.0007705360234567621, 0.9999614731988953, -1.999011568884837 },
+		{ 0.0008026411998669712, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0008126744346443001, 0.999959366288093, -1.998902734804912 },
+		{ 0.0008561491896194267, 0.9999571925439324, -1.998784495954072 },
+		{ 0.0009132262044308695, 0.9999543387295984, -1.998620087612502 },
+		{ 0.0009512746150121417, 0.9999524362730423, -1.99850469934004 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001014691492247178, 0.99994926546562, -1.998302094321678 },
+		{ 0.001027374644832786, 0.9999486312889803, -1.998260029123904 },
+		{ 0.001070181108262045, 0.9999464909457915, -1.998114261663522 },
+		{ 0.001083558574583829, 0.9999458220843713, -1.998067507494197 },
+		{ 0.001141524108413177, 0.9999429237991311, -1.997858303212896 },
+		{ 0.001155792902760762, 0.9999422103549646, -1.997805157728407 },
+		{ 0.001203949720337874, 0.9999398025153384, -1.997620989151649 },
+		{ 0.001218999268648669, 0.9999390500513053, -1.997561915056227 },
+		{ 0.001284211003174573, 0.9999357894621792, -1.997297569353812 },
+		{ 0.001352910568090637, 0.9999323544716272, -1.997004382928787 },
+		{ 0.001369821748022286, 0.9999315089171638, -1.996929899034883 },
+		{ 0.001426894955067957, 0.9999286552579357, -1.996671777175632 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.00152201766572143, 0.9999238991227826, -1.996218443042531 },
+		{ 0.001541042360630608, 0.9999229478821053, -1.996124306136216 },
+		{ 0.00160525018807507, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001625315847309666, 0.9999187342272845, -1.995693410632624 },
+		{ 0.001712268553331768, 0.9999143870839539, -1.995225094256315 },
+		{ 0.001826410709794119, 0.9999086795441485, -1.994573577146226 },
+		{ 0.001902503983861199, 0.9999048748083929, -1.994116160734863 },
+		{ 0.001926336268891952, 0.9999036853712879, -1.993969371648631 },
+		{ 0.002029334937227048, 0.9998985333416249, -1.993312707844078 },
+		{ 0.00205470467251888, 0.9998972653803131, -1.993145903067395 },
+		{ 0.002140315739249093, 0.9998929845911944, -1.992567598217461 },
+		{ 0.002167058444225417, 0.9998916471039889, -1.992382120329821 },
+		{ 0.00228300943988037, 0.9998858505287431, -1.991551904037502 },
+		{ 0.002311527902252336, 0.9998844238859664, -1.991341003194546 },
+		{ 0.002407840968865237, 0.999879608981624, -1.990610061937231 },
+		{ 0.002437924239346702, 0.9998781038175072, -1.990375504371664 },
+		{ 0.002568347857096391, 0.9998715833745591, -1.989326055633414 },
+		{ 0.00270573125083632, 0.999864713682774, -1.988161824921814 },
+		{ 0.002739559320222182, 0.9998630228525605, -1.987866061398457 },
+		{ 0.002853688108686574, 0.9998573156059436, -1.98684087523726 },
+		{ 0.00288936073328693, 0.9998555323536832, -1.986512055744461 },
+		{ 0.00304392518834468, 0.9998478038733086, -1.985040242116599 },
+		{ 0.003081977848941141, 0.9998459020284381, -1.984666414470842 },
+		{ 0.003210371420908163, 0.9998394815904758, -1.983370469590857 },
+		{ 0.003250499612085536, 0.9998374750586944, -1.982954720760028 },
+		{ 0.003424390514358489, 0.9998287814974788, -1.98109440254788 },
+		{ 0.003652654630921126, 0.9998173674277224, -1.978506395517164 },
+		{ 0.00380482699165725, 0.9998097586655874, -1.976689512834859 },
+		{ 0.003852383265855143, 0.9998073808370493, -1.976106685996817 },
+		{ 0.004058463964617003, 0.9997970769787324, -1.973498484501744 },
+		{ 0.004109207496078834, 0.9997945404970734, -1.972835845087075 },
+		{ 0.004280402431744895, 0.9997859806346864, -1.970539664199966 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.004565707346012931, 0.9997717149055243, -1.966507523846898 },
+		{ 0.004622788647089528, 0.9997688611297714, -1.965670143118048 },
+		{ 0.004815371279004653, 0.9997592316393189, -1.962768949210551 },
+		{ 0.004875551305043191, 0.9997562224936934, -1.961838440626878 },
+		{ 0.005136358459782836, 0.9997431824220345, -1.957674720848942 },
+		{ 0.005411096453258486, 0.9997294456679355, -1.953058014497314 },
+		{ 0.005478731778631801, 0.9997260636499606, -1.951885146758174 },
+		{ 0.005706969040621805, 0.9997146515707231, -1.947822032037516 },
+		{ 0.00577831884512846, 0.9997110847603804, -1.946518781973501 },
+		{ 0.006087387103067512, 0.9996956309102784, -1.940689154733952 },
+		{ 0.006163462218492916, 0.9996918269851901, -1.939208652062085 },
+		{ 0.006420227518090532, 0.9996789889471115, -1.934079456041472 },
+		{ 0.006500470936909455, 0.9996749765317453, -1.932434474023008 },
+		{ 0.006848170598607193, 0.9996575914928905, -1.925077113377608 },
+		{ 0.007304642168143501, 0.9996347682101013, -1.914852821539776 },
+		{ 0.007608930147950567, 0.99961955352294, -1.907681911988136 },
+		{ 0.007704024488874238, 0.9996147987762403, -1.905382871892993 },
+		{ 0.008116104373472002, 0.9995941951352175, -1.895102113297306 },
+		{ 0.008217519793043245, 0.9995891240255406, -1.892492612869118 },
+		{ 0.00855984285388944, 0.9995720078914345, -1.883455045839285 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.009130385814681325, 0.9995434811073832, -1.867607941548946 },
+		{ 0.009244471761227448, 0.9995377765024649, -1.864321861321117 },
+		{ 0.009629583168974188, 0.9995185212480414, -1.852943482581711 },
+		{ 0.009749914060346903, 0.9995125044148597, -1.849297619901652 },
+		{ 0.01027137190259931, 0.9994864316170408, -1.833004468607755 },
+		{ 0.01082072707489991, 0.9994589637178372, -1.814976163500448 },
+		{ 0.01095594307681139, 0.9994522031587202, -1.810404051483756 },
+		{ 0.01141230960658726, 0.9994293845651727, -1.794581361178249 },
+		{ 0.01155492381198395, 0.9994222538104269, -1.789513779095394 },
+		{ 0.01217289861198704, 0.9993913552787242, -1.766883741285598 },
+		{ 0.01232502502424766, 0.9993837489409875, -1.761146536603933 },
+		{ 0.01283839997244521, 0.9993580801247205, -1.741304713986138 },
+		{ 0.01299882906822196, 0.9993500587037454, -1.734953036344066 },
+		{ 0.01369399632535179, 0.9993153002293662, -1.70660670088199 },
+		{ 0.01460658898054228, 0.9992696706319886, -1.6673925033418 },
+		{ 0.01521496550522532, 0.9992392517854021, -1.640011157277238 },
+		{ 0.01540508137808651, 0.9992297459324639, -1.631254277295424 },
+		{ 0.01622888538152909, 0.9991885557654823, -1.592224404703838 },
+		{ 0.01643172809397999, 0.9991784185050498, -1.582351624785743 },
+		{ 0.01711609038548329, 0.9991442005949602, -1.548260530013976 },
+		{ 0.01733007231606983, 0.999133508760143, -1.537368809003415 },
+		{ 0.01825660343574346, 0.9990871706242659, -1.488872434526308 },
+		{ 0.01848474465917962, 0.9990757682902252, -1.476622186823735 },
+		{ 0.01925501578633604, 0.9990372710485296, -1.434358826780869 },
+		{ 0.01949507623906387, 0.9990252481163162, -1.42087848556302 },
+		{ 0.02053755030851989, 0.9989731286211316, -1.360934394298138 },
+		{ 0.02163597211572971, 0.9989182168869806, -1.295216507034651 },
+		{ 0.02190597024329101, 0.9989047080332734, -1.278660381490443 },
+		{ 0.02281837077335729, 0.9988590914635616, -1.22165928558084 },
+		{ 0.02310326064342762, 0.9988448397771577, -1.203512901516769 },
+		{ 0.02433843379303366, 0.9987830793715906, -1.123093198275008 },
+		{ 0.02464252894623508, 0.9987678809158029, -1.102873906287602 },
+		{ 0.02566864181710677, 0.9987165755788598, -1.033430327795327 },
+		{ 0.02598955850253184, 0.9987005365629396, -1.011357301667456 },
+		{ 0.02737871280319348, 0.9986310725405206, -0.9138803586780401 },
+		{ 0.029202510340193, 0.9985398746449632, -0.7816582565524766 },
+		{ 0.03041841302917224, 0.9984790806748923, -0.6911554479877058 },
+		{ 0.03079841557544585, 0.998460088423709, -0.6625357641875309 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 },
+		{ 0.03244466151167364, 0.9983777683391188, -0.5367986824499553 }
+	},
+},
+{
+	.name = "17 TET",
+	.c_maxq48000 = {
+		0.001799870791119152,
+		0.001874774233132042,
+		0.001952794857585505,
+		0.002034062389177188,
+		0.002118711951229139,
+		0.002206884290357009,
+		0.002298726010489113,
+		0.002394389816624402,
+		0.002494034768734693,
+		0.002597826546233282,
+		0.002705937723449696,
+		0.002818548056568595,
+		0.002935844782509935,
+		0.00305802293024733,
+		0.003185285645082233,
+		0.003317844526413127,
+		0.003455919979561317,
+		0.003599741582238305,
+		0.003749548466264084,
+		0.003905589715171011,
+		0.004068124778354378,
+		0.003599741582238305,
+		0.003749548466264083,
+		0.003905589715171009,
+		0.004068124778354377,
+		0.004237423902458277,
+		0.004413768580714019,
+		0.004597452020978226,
+		0.004788779633248804,
+		0.004988069537469385,
+		0.005195653092466564,
+		0.005411875446899392,
+		0.005637096113137189,
+		0.005871689565019871,
+		0.00611604586049466,
+		0.006370571290164466,
+		0.006635689052826253,
+		0.006911839959122633,
+		0.007199483164476611,
+		0.007499096932528169,
+		0.007811179430342021,
+		0.008136249556708755,
+		0.00719948316447661,
+		0.007499096932528167,
+		0.007811179430342019,
+		0.008136249556708754,
+		0.008474847804916554,
+		0.008827537161428037,
+		0.009194904041956452,
+		0.009577559266497608,
+		0.009976139074938771,
+		0.01039130618493313,
+		0.01082375089379878,
+		0.01127419222627438,
+		0.01174337913003974,
+		0.01223209172098932,
+		0.01274114258032893,
+		0.01327137810565251,
+		0.01382367991824527,
+		0.01439896632895322,
+		0.01499819386505634,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01439896632895322,
+		0.01499819386505633,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01694969560983311,
+		0.01765507432285607,
+		0.0183898080839129,
+		0.01915511853299522,
+		0.01995227814987754,
+		0.02078261236986625,
+		0.02164750178759757,
+		0.02254838445254876,
+		0.02348675826007948,
+		0.02446418344197864,
+		0.02548228516065786,
+		0.02654275621130501,
+		0.02764735983649053,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136809,
+		0.03254499822683502,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136807,
+		0.03254499822683501,
+		0.03389939121966622,
+		0.03531014864571215,
+		0.03677961616782581,
+		0.03831023706599043,
+		0.03990455629975508,
+		0.04156522473973251,
+		0.04329500357519513,
+		0.04509676890509751,
+		0.04697351652015896,
+		0.04892836688395728,
+		0.05096457032131572,
+		0.05308551242261002,
+		0.05529471967298107,
+		0.05759586531581289,
+		0.05999277546022535,
+		0.06248943544273617,
+		0.06508999645367004,
+		0.05759586531581288,
+		0.05999277546022534,
+		0.06248943544273615,
+		0.06508999645367003,
+		0.06779878243933243,
+		0.0706202972914243,
+		0.07355923233565162,
+		0.07662047413198086,
+		0.07980911259951017,
+		0.08313044947946502,
+		0.08659000715039027,
+		0.09019353781019503,
+		0.09394703304031793,
+		0.09785673376791457,
+		0.1019291406426314,
+		0.10617102484522,
+		0.1105894393459621,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1355975648786649,
+		0.1412405945828486,
+		0.1471184646713032,
+		0.1532409482639617,
+		0.1596182251990203,
+		0.16626089895893,
+		0.1731800143007805,
+		0.1803870756203901,
+		0.1878940660806359,
+		0.1957134675358291,
+		0.2038582812852629,
+		0.2123420496904401,
+		0.2211788786919243,
+		0.2303834612632515,
+		0.2399711018409014,
+		0.2499577417709447,
+		0.2603599858146802,
+		0.2303834612632515,
+		0.2399711018409013,
+		0.2499577417709446,
+		0.2603599858146801,
+		0.2711951297573297,
+		0.2824811891656972,
+		0.2942369293426065,
+		0.3064818965279235,
+		0.3192364503980407,
+		0.3325217979178601,
+		0.3463600286015611,
+		0.3607741512407801,
+		0.3757881321612717,
+		0.3914269350716583,
+		0.4077165625705258,
+		0.4246840993808802,
+		0.4423577573838485,
+		0.4607669225265031,
+		0.4799422036818028,
+		0.4999154835418894,
+		0.5207199716293603,
+		0.460766922526503,
+		0.4799422036818027,
+		0.4999154835418892,
+		0.5207199716293602,
+		0.5423902595146595,
+		0.5649623783313944,
+		0.588473858685213,
+		0.6129637930558469,
+		0.6384729007960813,
+		0.6650435958357201,
+		0.6927200572031221,
+		0.7215483024815602,
+		0.7515762643225434,
+		0.7828538701433165,
+		0.8154331251410516,
+		0.8493681987617604,
+		0.8847155147676971,
+		0.9215338450530062,
+		0.9598844073636056,
+		0.9998309670837787,
+		1.041439943258721,
+		0.9215338450530061,
+		0.9598844073636054,
+		0.9998309670837784,
+		1.04143994325872,
+		1.084780519029319,
+		1.129924756662789,
+		1.176947717370426,
+		1.225927586111694,
+		1.276945801592163,
+		1.33008719167144,
+		1.385440114406244,
+		1.44309660496312,
+		1.503152528645087,
+		1.565707740286633,
+		1.630866250282103,
+		1.698736397523521,
+		1.769431029535394,
+		1.843067690106012,
+		1.919768814727211,
+		1.999661934167557,
+		2.082879886517441,
+		1.843067690106012,
+		1.919768814727211,
+		1.999661934167557,
+		2.082879886517441,
+		2.169561038058638,
+		2.259849513325578,
+		2.353895434740852,
+		2.451855172223388,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325,
+		2.553891603184325
+	},
+	.c_maxq96000 = {
+		0.0008999353955595762,
+		0.0009373871165660209,
+		0.0009763974287927523,
+		0.001017031194588594,
+		0.001059355975614569,
+		0.001103442145178505,
+		0.001149363005244557,
+		0.001197194908312201,
+		0.001247017384367346,
+		0.001298913273116641,
+		0.001352968861724848,
+		0.001409274028284297,
+		0.001467922391254968,
+		0.001529011465123665,
+		0.001592642822541116,
+		0.001658922263206563,
+		0.001727959989780658,
+		0.001799870791119153,
+		0.001874774233132042,
+		0.001952794857585505,
+		0.002034062389177189,
+		0.001799870791119152,
+		0.001874774233132042,
+		0.001952794857585505,
+		0.002034062389177188,
+		0.002118711951229139,
+		0.002206884290357009,
+		0.002298726010489113,
+		0.002394389816624402,
+		0.002494034768734693,
+		0.002597826546233282,
+		0.002705937723449696,
+		0.002818548056568595,
+		0.002935844782509935,
+		0.00305802293024733,
+		0.003185285645082233,
+		0.003317844526413127,
+		0.003455919979561317,
+		0.003599741582238305,
+		0.003749548466264084,
+		0.003905589715171011,
+		0.004068124778354378,
+		0.003599741582238305,
+		0.003749548466264083,
+		0.003905589715171009,
+		0.004068124778354377,
+		0.004237423902458277,
+		0.004413768580714019,
+		0.004597452020978226,
+		0.004788779633248804,
+		0.004988069537469385,
+		0.005195653092466564,
+		0.005411875446899392,
+		0.005637096113137189,
+		0.005871689565019871,
+		0.00611604586049466,
+		0.006370571290164466,
+		0.006635689052826253,
+		0.006911839959122633,
+		0.007199483164476611,
+		0.007499096932528169,
+		0.007811179430342021,
+		0.008136249556708755,
+		0.00719948316447661,
+		0.007499096932528167,
+		0.007811179430342019,
+		0.008136249556708754,
+		0.008474847804916554,
+		0.008827537161428037,
+		0.009194904041956452,
+		0.009577559266497608,
+		0.009976139074938771,
+		0.01039130618493313,
+		0.01082375089379878,
+		0.01127419222627438,
+		0.01174337913003974,
+		0.01223209172098932,
+		0.01274114258032893,
+		0.01327137810565251,
+		0.01382367991824527,
+		0.01439896632895322,
+		0.01499819386505634,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01439896632895322,
+		0.01499819386505633,
+		0.01562235886068404,
+		0.01627249911341751,
+		0.01694969560983311,
+		0.01765507432285607,
+		0.0183898080839129,
+		0.01915511853299522,
+		0.01995227814987754,
+		0.02078261236986625,
+		0.02164750178759757,
+		0.02254838445254876,
+		0.02348675826007948,
+		0.02446418344197864,
+		0.02548228516065786,
+		0.02654275621130501,
+		0.02764735983649053,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136809,
+		0.03254499822683502,
+		0.02879793265790644,
+		0.02999638773011267,
+		0.03124471772136807,
+		0.03254499822683501,
+		0.03389939121966622,
+		0.03531014864571215,
+		0.03677961616782581,
+		0.03831023706599043,
+		0.03990455629975508,
+		0.04156522473973251,
+		0.04329500357519513,
+		0.04509676890509751,
+		0.04697351652015896,
+		0.04892836688395728,
+		0.05096457032131572,
+		0.05308551242261002,
+		0.05529471967298107,
+		0.05759586531581289,
+		0.05999277546022535,
+		0.06248943544273617,
+		0.06508999645367004,
+		0.05759586531581288,
+		0.05999277546022534,
+		0.06248943544273615,
+		0.06508999645367003,
+		0.06779878243933243,
+		0.0706202972914243,
+		0.07355923233565162,
+		0.07662047413198086,
+		0.07980911259951017,
+		0.08313044947946502,
+		0.08659000715039027,
+		0.09019353781019503,
+		0.09394703304031793,
+		0.09785673376791457,
+		0.1019291406426314,
+		0.10617102484522,
+		0.1105894393459621,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1151917306316258,
+		0.1199855509204507,
+		0.1249788708854723,
+		0.1301799929073401,
+		0.1355975648786649,
+		0.1412405945828486,
+		0.1471184646713032,
+		0.1532409482639617,
+		0.1596182251990203,
+		0.16626089895893,
+		0.1731800143007805,
+		0.1803870756203901,
+		0.1878940660806359,
+		0.1957134675358291,
+		0.2038582812852629,
+		0.2123420496904401,
+		0.2211788786919243,
+		0.2303834612632515,
+		0.2399711018409014,
+		0.2499577417709447,
+		0.2603599858146802,
+		0.2303834612632515,
+		0.2399711018409013,
+		0.2499577417709446,
+		0.2603599858146801,
+		0.2711951297573297,
+		0.2824811891656972,
+		0.2942369293426065,
+		0.3064818965279235,
+		0.3192364503980407,
+		0.3325217979178601,
+		0.3463600286015611,
+		0.3607741512407801,
+		0.3757881321612717,
+		0.3914269350716583,
+		0.4077165625705258,
+		0.4246840993808802,
+		0.4423577573838485,
+		0.4607669225265031,
+		0.4799422036818028,
+		0.4999154835418894,
+		0.5207199716293603,
+		0.460766922526503,
+		0.4799422036818027,
+		0.4999154835418892,
+		0.5207199716293602,
+		0.5423902595146595,
+		0.5649623783313944,
+		0.588473858685213,
+		0.6129637930558469,
+		0.6384729007960813,
+		0.6650435958357201,
+		0.6927200572031221,
+		0.7215483024815602,
+		0.7515762643225434,
+		0.7828538701433165,
+		0.8154331251410516,
+		0.8493681987617604,
+		0.8847155147676971,
+		0.9215338450530062,
+		0.9598844073636056,
+		0.9998309670837787,
+		1.041439943258721,
+		0.9215338450530061,
+		0.9598844073636054,
+		0.9998309670837784,
+		1.04143994325872,
+		1.084780519029319,
+		1.129924756662789,
+		1.176947717370426,
+		1.225927586111694,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163,
+		1.276945801592163
+	},
+	.c_bpre4800022 = {
+		{ 0.0008995305751479957, 0.9991004694248521, -1.999097231347892 },
+		{ 0.000936946589178597, 0.9990630534108362, -1.999059540289903 },
+		{ 0.0009759239280101074, 0.9990240760720649, -1.999020264502717 },
+		{ 0.001016514715266994, 0.9989834852847351, -1.998979349974981 },
+		{ 0.001058797211058034, 0.9989412027889769, -1.99893671620849 },
+		{ 0.001102836577993728, 0.9988971634220717, -1.998892295744862 },
+		{ 0.001148704495614554, 0.9988512955044067, -1.998846014384273 },
+		{ 0.001196479157793343, 0.998803520842209, -1.998797791166358 },
+		{ 0.001246238732672441, 0.9987537612673409, -1.998747544951529 },
+		{ 0.001298067897692951, 0.998701932102336, -1.998695187805886 },
+		{ 0.001352051300155678, 0.9986479486998878, -1.998640631584689 },
+		{ 0.001408280091134744, 0.9985917199088761, -1.998583781310357 },
+		{ 0.001466845386468042, 0.9985331546135322, -1.998524541758208 },
+		{ 0.001527844799466663, 0.9984721552005483, -1.998462810826886 },
+		{ 0.001591375902098215, 0.9984086240979039, -1.998398486126478 },
+		{ 0.00165754929100008, 0.9983424507090248, -1.998331451719774 },
+		{ 0.001726468979129127, 0.9982735310208759, -1.998261597945224 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.001873015309446514, 0.998126984690583, -1.998112938799321 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367665, 0.9979680038716366, -1.99795147105265 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.001873015309446515, 0.998126984690583, -1.998112938799321 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367666, 0.9979680038716366, -1.99795147105265 },
+		{ 0.00211646683939791, 0.9978835331606207, -1.997865596465287 },
+		{ 0.002204450376783931, 0.9977955496232174, -1.997776089784016 },
+		{ 0.002296082939243565, 0.9977039170607881, -1.997682804854216 },
+		{ 0.002391526753212004, 0.9976084732467931, -1.997585568278887 },
+		{ 0.002490924354366275, 0.9975090756456609, -1.997484225905423 },
+		{ 0.002594457343080303, 0.9974055426569352, -1.997378582878603 },
+		{ 0.002702281084807908, 0.9972977189151958, -1.99726847013939 },
+		{ 0.002814576929453697, 0.9971854230705678, -1.997153691083297 },
+		{ 0.00293153913754799, 0.9970684608624524, -1.997034034764247 },
+		{ 0.003053348764197754, 0.9969466512358285, -1.996909302519921 },
+		{ 0.003180219326934557, 0.9968197806730698, -1.996779261131095 },
+		{ 0.003312344589002135, 0.9966876554110075, -1.996643696180762 },
+		{ 0.003449957263122795, 0.9965500427368876, -1.996502351745247 },
+		{ 0.003593270279843707, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742528952977893, 0.9962574710470257, -1.996201340050508 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059863248469488, 0.9959401367515391, -1.995874072869844 },
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742528952977894, 0.9962574710470257, -1.996201340050508 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059863248469489, 0.9959401367515391, -1.995874072869844 },
+		{ 0.004228460764194265, 0.9957715392358137, -1.995699868399449 },
+		{ 0.004404041152104466, 0.995595958847898, -1.995518205571611 },
+		{ 0.004586900396523728, 0.9954130996034766, -1.995328747822349 },
+		{ 0.004777334106212605, 0.9952226658937975, -1.995131155971336 },
+		{ 0.00497565051695906, 0.9950243494830419, -1.994925074522673 },
+		{ 0.005182176966163581, 0.9948178230338428, -1.994710124628603 },
+		{ 0.005397259846554576, 0.9946027401534527, -1.994485903768676 },
+		{ 0.005621238523768734, 0.9943787614762329, -1.994252012612664 },
+		{ 0.005854484353380799, 0.9941455156466195, -1.994008013985576 },
+		{ 0.006097381094744865, 0.9939026189052553, -1.993753452846373 },
+		{ 0.006350324858901704, 0.9936496751411069, -1.993487855926646 },
+		{ 0.006613730554805089, 0.9933862694452953, -1.993210724498435 },
+		{ 0.006887999321392209, 0.9931120006786986, -1.992921568201773 },
+		{ 0.007173628968382154, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417558, 0.9925289356248421, -1.992304833364674 },
+		{ 0.00778074946525167, 0.9922192505347522, -1.991976146984428 },
+		{ 0.008103256991515841, 0.9918967430087761, -1.991633026329162 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417558, 0.9925289356248421, -1.992304833364674 },
+		{ 0.007780749465251671, 0.9922192505347522, -1.991976146984428 },
+		{ 0.008103256991515845, 0.9918967430087761, -1.991633026329162 },
+		{ 0.008439028668510392, 0.9915609713315646, -1.991274898835128 },
+		{ 0.008788699700768043, 0.9912113002993399, -1.990900975667367 },
+		{ 0.009152774108130134, 0.9908472258920404, -1.990510596974171 },
+		{ 0.0095318193612253, 0.9904681806391537, -1.990103023568315 },
+		{ 0.009926530975925789, 0.9900734690241816, -1.989677365526276 },
+		{ 0.01033747306560616, 0.989662526935098, -1.989232860397162 },
+		{ 0.01076540222852019, 0.9892345977717061, -1.988768522539147 },
+		{ 0.01121087872499539, 0.9887891212750074, -1.988283562840984 },
+		{ 0.01167471959443971, 0.9883252804059874, -1.987776895506818 },
+		{ 0.01215760999538567, 0.9878423900050715, -1.987247558963848 },
+		{ 0.01266029724375205, 0.9873397027565198, -1.986694503390106 },
+		{ 0.01318371967775932, 0.9868162803224406, -1.986116445661256 },
+		{ 0.01372855410813354, 0.9862714458920473, -1.985512366580672 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488631194793535, 0.9851136880525818, -1.984220665243689 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614078681561511, 0.9838592131848509, -1.982808680971217 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488631194793535, 0.9851136880525818, -1.984220665243689 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614078681561511, 0.9838592131848509, -1.982808680971217 },
+		{ 0.01680684013215305, 0.9831931598679958, -1.982053759609596 },
+		{ 0.0175001581591071, 0.9824998418411081, -1.981264070240801 },
+		{ 0.01822177494238871, 0.9817782250579523, -1.98043795655464 },
+		{ 0.01897284734965794, 0.981027152650556, -1.979573575712098 },
+		{ 0.01975452593463602, 0.9802454740655775, -1.978669041617926 },
+		{ 0.02056814688411143, 0.979431853115897, -1.9777221980495 },
+		{ 0.02141484652354152, 0.9785851534767955, -1.976731061595853 },
+		{ 0.02229607364820514, 0.9777039263518009, -1.975693219823106 },
+		{ 0.0232130761799521, 0.9767869238201261, -1.974606426336418 },
+		{ 0.02416734864102299, 0.9758326513590272, -1.973468068594102 },
+		{ 0.02516037516394745, 0.9748396248362265, -1.972275463341662 },
+		{ 0.02619356515535091, 0.9738064348448978, -1.971025930012044 },
+		{ 0.02726869868338374, 0.9727313013168727, -1.969716244194001 },
+		{ 0.02838722415696336, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570377, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069007, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536121, 0.9679788880146419, -1.963811483145857 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570378, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069007, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536122, 0.9679788880146419, -1.963811483145857 },
+		{ 0.03333127365731363, 0.9666687263428921, -1.962150381202561 },
+		{ 0.03469399760317399, 0.9653060023969304, -1.960407331835349 },
+		{ 0.03611145371571874, 0.963888546284299, -1.958577682501845 },
+		{ 0.03758566277255563, 0.9624143372275261, -1.95665679076443 },
+		{ 0.03911887346354807, 0.9608811265365238, -1.954639523894589 },
+		{ 0.04071324510197728, 0.9592867548980401, -1.952520655958879 },
+		{ 0.04237116007146376, 0.9576288399285402, -1.950294439242548 },
+		{ 0.0440950323962841, 0.9559049676037278, -1.947954835844621 },
+		{ 0.04588730545416957, 0.9541126945459848, -1.945495503192185 },
+		{ 0.04775063654170923, 0.9522493634583886, -1.942909517926148 },
+		{ 0.04968764365141843, 0.9503123563486313, -1.940189698637297 },
+		{ 0.05170108952069895, 0.9482989104793094, -1.937328326680328 },
+		{ 0.05379375350933564, 0.9462062464906683, -1.934317298479534 },
+		{ 0.05596861381858929, 0.9440313861814109, -1.931147834504842 },
+		{ 0.0582286570670332, 0.941771342932971, -1.927810719377508 },
+		{ 0.06057699764827985, 0.9394230023517521, -1.924296094954655 },
+		{ 0.06301687235794362, 0.9369831276420629, -1.920593427320807 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.0582286570670332, 0.941771342932971, -1.927810719377508 },
+		{ 0.06057699764827986, 0.9394230023517521, -1.924296094954655 },
+		{ 0.0630168723579432, 0.9369831276420629, -1.920593427320807 },
+		{ 0.06555157351101504, 0.9344484264893895, -1.916691566792619 },
+		{ 0.06818444371167576, 0.9318155562891636, -1.912578716953224 },
+		{ 0.07091874872783806, 0.9290812512745028, -1.908242596787696 },
+		{ 0.07375840101861356, 0.9262415989905504, -1.903669238785097 },
+		{ 0.07670721895327545, 0.9232927810515522, -1.898844087518889 },
+		{ 0.07976892187722157, 0.9202310781228121, -1.893751973596757 },
+		{ 0.08294712498081241, 0.9170528750209334, -1.888377087794027 },
+		{ 0.08624593213738026, 0.9137540678691967, -1.882701917784639 },
+		{ 0.08966872779053919, 0.9103312722179383, -1.876709254935716 },
+		{ 0.09322114979328593, 0.9067788502069059, -1.870376903235397 },
+		{ 0.09690630715851639, 0.9030936928435681, -1.863686008997014 },
+		{ 0.1007289409595295, 0.8992710590448268, -1.856613646306116 },
+		{ 0.1046936219081004, 0.8953063780932825, -1.849135894605458 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130665054363244, 0.8869334945683867, -1.832863365506763 },
+		{ 0.1174846536976151, 0.8825153463055724, -1.824011968816291 },
+		{ 0.122062388674133, 0.8779376113294015, -1.814646414294974 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130665054363244, 0.8869334945683867, -1.832863365506763 },
+		{ 0.1174846536976152, 0.8825153463055724, -1.824011968816291 },
+		{ 0.1220623886741329, 0.8779376113294015, -1.814646414294974 },
+		{ 0.1268061382322884, 0.8731938617684958, -1.804731184334108 },
+		{ 0.1317197690591421, 0.8682802309424833, -1.794234105991737 },
+		{ 0.1368080285347321, 0.8631919714697956, -1.783119232143488 },
+		{ 0.1420770618089881, 0.8579229381911376, -1.771345348039089 },
+		{ 0.1475309983999238, 0.8524690016020705, -1.758873373132283 },
+		{ 0.1531747628569917, 0.8468252371430733, -1.745660103276102 },
+		{ 0.1590140244192004, 0.8409859755841593, -1.731657982621227 },
+		{ 0.1650529569815036, 0.8349470430188874, -1.716820306614263 },
+		{ 0.1712975172067573, 0.8287024827932459, -1.701093164217308 },
+		{ 0.1777521168178093, 0.8222478831825584, -1.684423421754474 },
+		{ 0.1844223157443595, 0.8155776842593123, -1.666751833611736 },
+		{ 0.1913120916504563, 0.8086879083504329, -1.648020003678405 },
+		{ 0.1984264893481252, 0.8015735106545115, -1.628163287543272 },
+		{ 0.2057710119479239, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747775, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211661537908476, 0.7788338462102381, -1.561145967728438 },
+		{ 0.2292260550844565, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747776, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211661537908473, 0.7788338462102381, -1.561145967728438 },
+		{ 0.2292260550844564, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2375324797713032, 0.7624675202301793, -1.509513014389912 },
+		{ 0.2460889471233131, 0.753911052879001, -1.481369181177151 },
+		{ 0.2549001080570635, 0.7450998919430143, -1.451554428495523 },
+		{ 0.2639682321257222, 0.7360317678745144, -1.41998100894763 },
+		{ 0.2732961256824122, 0.7267038743188488, -1.386555445657577 },
+		{ 0.2828870177376995, 0.7171129822624225, -1.351178671864113 },
+		{ 0.2927421259718873, 0.7072578740282851, -1.313755191211295 },
+		{ 0.3028634353547456, 0.6971365646459843, -1.274183250566904 },
+		{ 0.3132521950123157, 0.6867478049876903, -1.232360705255298 },
+		{ 0.3239084186024848, 0.676091581398198, -1.188187787429394 },
+		{ 0.3348326055873215, 0.6651673944126816, -1.141560756718462 },
+		{ 0.3460238668894467, 0.6539761331121982, -1.092380428661221 },
+		{ 0.357480327545395, 0.6425196724547184, -1.040551831391004 },
+		{ 0.3692003145377752, 0.630799685462225, -0.9859800463694947 },
+		{ 0.3811809768077802, 0.6188190231928554, -0.9285777772985855 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059075258395327, 0.5940924741617473, -0.8049806216386769 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.3811809768077802, 0.6188190231928554, -0.9285777772985855 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059075258395327, 0.5940924741617473, -0.8049806216386769 },
+		{ 0.4186429000972142, 0.581357099903166, -0.7386631192807608 },
+		{ 0.4316184963518462, 0.5683815036481779, -0.6692719485521235 },
+		{ 0.4448261510266505, 0.5551738489734913, -0.5967901785796024 },
+		{ 0.4582572366799468, 0.5417427633204831, -0.5212212408356107 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4857482975298472, 0.5142517024827693, -0.3609879477207224 },
+		{ 0.4997869544141209, 0.5002130455972356, -0.2764809359651593 },
+		{ 0.5139993379663381, 0.4860006621114971, -0.1892554157347474 },
+		{ 0.5283762176926744, 0.4716237823619693, -0.09947790573747185 },
+		{ 0.5428995752425775, 0.4571004247801815, -0.007419520559819773 },
+		{ 0.5575523374102497, 0.4424476625897558, 0.08659554259106524 },
+		{ 0.5723152173225803, 0.4276847826803836, 0.1821620151328361 },
+		{ 0.5871695513506595, 0.4128304487023168, 0.2788030678429608 },
+		{ 0.6020917568207583, 0.3979082431792417, 0.3759252339653893 },
+		{ 0.6170640191175952, 0.3829359809399938, 0.472878554857637 },
+		{ 0.6320585648027305, 0.367941435198932, 0.5688452782835196 },
+		{ 0.6470532081551925, 0.3529467918669572, 0.6629319566391624 },
+		{ 0.6020917568207582, 0.3979082431792417, 0.3759252339653893 },
+		{ 0.617064019117595, 0.3829359809399938, 0.472878554857637 },
+		{ 0.6320585648027306, 0.367941435198932, 0.5688452782835196 },
+		{ 0.6470532081551927, 0.3529467918669572, 0.6629319566391624 },
+		{ 0.6620234799972453, 0.3379765200177605, 0.7541100093510735 },
+		{ 0.6769428892018348, 0.3230571108083177, 0.8412113986213084 },
+		{ 0.6917811905303123, 0.308218809497941, 0.9229167753147318 },
+		{ 0.7065147783906723, 0.2934852216101129, 0.99781210354276 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 },
+		{ 0.7212608851831206, 0.2788876827662423, 1.056196350620929 }
+	},
+	.c_bpre9600022 = {
+		{ 0.000449866477498041, 0.9995501335225021, -1.99954932382101 },
+		{ 0.0004685830796407516, 0.9995314169203667, -1.999530538434167 },
+		{ 0.0004880810755732001, 0.9995119189244643, -1.999510965799356 },
+		{ 0.0005083865860938951, 0.9994916134139072, -1.999490579323409 },
+		{ 0.0005295388112049212, 0.9994704611888123, -1.999469339246398 },
+		{ 0.0005515704039519241, 0.9994484295960806, -1.999447212340799 },
+		{ 0.0005745172828613223, 0.9994254827171491, -1.999424162057418 },
+		{ 0.0005984186313259486, 0.9994015813686753, -1.999400148520606 },
+		{ 0.0006233136262743911, 0.9993766863737324, -1.999375131809836 },
+		{ 0.0006492447081918504, 0.9993507552918224, -1.999349068669661 },
+		{ 0.0006762543100237277, 0.9993237456899982, -1.999321915791832 },
+		{ 0.0007043881268840418, 0.9992956118731214, -1.999293626523524 },
+		{ 0.0007336918450952471, 0.9992663081549046, -1.999264154150016 },
+		{ 0.0007642144115664648, 0.9992357855884407, -1.999233448601021 },
+		{ 0.0007960047628399543, 0.999203995237161, -1.999201459733963 },
+		{ 0.0008291183641307669, 0.9991708816358814, -1.999168130746743 },
+		{ 0.0008636073984339201, 0.9991363926015686, -1.999133408042241 },
+		{ 0.0008995305751479957, 0.9991004694248521, -1.999097231347892 },
+		{ 0.0009369465891785968, 0.9990630534108362, -1.999059540289903 },
+		{ 0.0009759206586367797, 0.9990240793413636, -1.999020267797559 },
+		{ 0.001016514715266993, 0.9989834852847351, -1.998979349974981 },
+		{ 0.0008995305751479957, 0.9991004694248521, -1.999097231347892 },
+		{ 0.000936946589178597, 0.9990630534108362, -1.999059540289903 },
+		{ 0.0009759206586367799, 0.9990240793413636, -1.999020267797559 },
+		{ 0.001016514715266994, 0.9989834852847351, -1.998979349974981 },
+		{ 0.001058793942004759, 0.9989412060580045, -1.998936719505229 },
+		{ 0.001102833309046016, 0.9988971666909547, -1.998892299042609 },
+		{ 0.001148701226876106, 0.9988512987731399, -1.99884601768307 },
+		{ 0.001196479157793343, 0.998803520842209, -1.998797791166358 },
+		{ 0.001246238732672441, 0.9987537612673409, -1.998747544951529 },
+		{ 0.001298071165916174, 0.9987019288340918, -1.99869518450367 },
+		{ 0.001352054568181282, 0.9986479454318203, -1.998640628281236 },
+		{ 0.001408280091134744, 0.9985917199088761, -1.998583781310357 },
+		{ 0.001466845386468042, 0.9985331546135322, -1.998524541758208 },
+		{ 0.001527841531972331, 0.9984721584680409, -1.998462814134361 },
+		{ 0.001591375902098215, 0.9984086240979039, -1.998398486126478 },
+		{ 0.001657546023911705, 0.998342453976093, -1.998331455030219 },
+		{ 0.001726468979129127, 0.9982735310208759, -1.998261597945224 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.001873018575781619, 0.9981269814242201, -1.998112935483946 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367665, 0.9979680038716366, -1.99795147105265 },
+		{ 0.001798251995040575, 0.9982017480049598, -1.998188801530481 },
+		{ 0.00187301857578162, 0.9981269814242201, -1.998112935483946 },
+		{ 0.001950888896142439, 0.9980491111038586, -1.998033872379065 },
+		{ 0.002031996128367666, 0.9979680038716366, -1.99795147105265 },
+		{ 0.002116470104949421, 0.9978835298950544, -1.997865593144341 },
+		{ 0.002204450376783931, 0.9977955496232174, -1.997776089784016 },
+		{ 0.002296086204190738, 0.9977039137958097, -1.997682801529161 },
+		{ 0.002391526753212004, 0.9976084732467931, -1.997585568278887 },
+		{ 0.002490927618680479, 0.9975090723813202, -1.99748422257591 },
+		{ 0.002594454079066154, 0.9974055459209373, -1.997378586210484 },
+		{ 0.002702281084807908, 0.9972977189151958, -1.99726847013939 },
+		{ 0.002814580192714809, 0.9971854198072861, -1.997153687746383 },
+		{ 0.00293153913754799, 0.9970684608624524, -1.997034034764247 },
+		{ 0.003053352026671727, 0.996946647973328, -1.996909299177545 },
+		{ 0.003180219326934557, 0.9968197806730698, -1.996779261131095 },
+		{ 0.003312351112348141, 0.9966876488877021, -1.996643689484166 },
+		{ 0.003449950740753052, 0.9965500492592926, -1.996502358448131 },
+		{ 0.003593270279843707, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742535473594668, 0.9962574645265356, -1.996201333334248 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059869767020171, 0.9959401302331262, -1.995874066139078 },
+		{ 0.003593270279843708, 0.9964067297201568, -1.996354990509996 },
+		{ 0.003742535473594669, 0.9962574645265356, -1.996201333334248 },
+		{ 0.003897971824799342, 0.9961020281752024, -1.996041132908309 },
+		{ 0.004059869767020172, 0.9959401302331262, -1.995874066139078 },
+		{ 0.004228454246913706, 0.9957715457531237, -1.99569987513792 },
+		{ 0.004404047668316701, 0.9955959523317377, -1.99551819882511 },
+		{ 0.004586906911572386, 0.995413093088513, -1.995328741067492 },
+		{ 0.004777321078958096, 0.9952226789212322, -1.995131169498445 },
+		{ 0.0049756440045931, 0.9950243559954609, -1.994925081295283 },
+		{ 0.005182163944375644, 0.9948178360559777, -1.994710138192706 },
+		{ 0.005397266356320597, 0.9946027336437929, -1.9944858969768 },
+		{ 0.005621238523768734, 0.9943787614762329, -1.994252012612664 },
+		{ 0.005854497366929071, 0.9941455026332852, -1.994008000360075 },
+		{ 0.006097394105129091, 0.9939026058951003, -1.993753439198684 },
+		{ 0.00635031185218561, 0.9936496881479507, -1.993487869597426 },
+		{ 0.006613730554805089, 0.9933862694452953, -1.993210724498435 },
+		{ 0.006887999321392209, 0.9931120006786986, -1.992921568201773 },
+		{ 0.007173628968382154, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417558, 0.9925289356248421, -1.992304833364674 },
+		{ 0.00778074946525167, 0.9922192505347522, -1.991976146984428 },
+		{ 0.008103224531711684, 0.991896775468522, -1.991633060905968 },
+		{ 0.007173628968382158, 0.9928263710316179, -1.992619788024624 },
+		{ 0.007471064375417558, 0.9925289356248421, -1.992304833364674 },
+		{ 0.007780749465251671, 0.9922192505347522, -1.991976146984428 },
+		{ 0.008103224531711686, 0.991896775468522, -1.991633060905968 },
+		{ 0.008439028668510392, 0.9915609713315646, -1.991274898835128 },
+		{ 0.008788699700768043, 0.9912113002993399, -1.990900975667367 },
+		{ 0.009152774108130134, 0.9908472258920404, -1.990510596974171 },
+		{ 0.009531851773948476, 0.9904681482261588, -1.990102988665986 },
+		{ 0.009926530975925789, 0.9900734690241816, -1.989677365526276 },
+		{ 0.01033750545153603, 0.9896624945484682, -1.98923282531137 },
+		{ 0.01076536985583658, 0.989234630144333, -1.988768557722373 },
+		{ 0.01121087872499539, 0.9887891212750074, -1.988283562840984 },
+		{ 0.01167468725118217, 0.9883253127488572, -1.987776930896949 },
+		{ 0.01215757766788677, 0.9878424223321385, -1.98724759446384 },
+		{ 0.01266032955418352, 0.9873396704459042, -1.98669446777581 },
+		{ 0.01318368738419706, 0.9868163126159284, -1.986116481394479 },
+		{ 0.01372858638373879, 0.9862714136163903, -1.985512330723571 },
+		{ 0.01429579698418818, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488627970964883, 0.9851137202903523, -1.984220701363705 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614081901186786, 0.9838591809881342, -1.982808644566532 },
+		{ 0.01429579698418819, 0.9857042030158116, -1.98488086689542 },
+		{ 0.01488627970964883, 0.9851137202903523, -1.984220701363705 },
+		{ 0.01550095886826282, 0.9844990411317455, -1.983530454311394 },
+		{ 0.01614081901186787, 0.9838591809881342, -1.982808644566532 },
+		{ 0.01680687230702828, 0.9831931276930754, -1.982053723053868 },
+		{ 0.01750012600671179, 0.9824998739933408, -1.981264106953678 },
+		{ 0.01822174281343975, 0.98177825718657, -1.98043799343101 },
+		{ 0.01897281524544698, 0.9810271847545949, -1.979573612758656 },
+		{ 0.01975455801291627, 0.9802454419871196, -1.978669004394543 },
+		{ 0.02056814688411143, 0.979431853115897, -1.9777221980495 },
+		{ 0.02141487854733045, 0.9785851214526716, -1.976731023996873 },
+		{ 0.02229607364820514, 0.9777039263518009, -1.975693219823106 },
+		{ 0.0232130761799521, 0.9767869238201261, -1.974606426336418 },
+		{ 0.02416734864102299, 0.9758326513590272, -1.973468068594102 },
+		{ 0.02516034326224591, 0.9748396567377793, -1.972275501786255 },
+		{ 0.02619359702284694, 0.9738064029771571, -1.971025891334608 },
+		{ 0.02726866685057158, 0.9727313331494305, -1.969716283113535 },
+		{ 0.02838722415696336, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570377, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069007, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536121, 0.9679788880146419, -1.963811483145857 },
+		{ 0.02838722415696337, 0.9716127758430366, -1.968343480294637 },
+		{ 0.02955095809570378, 0.9704490419042983, -1.966904151806321 },
+		{ 0.03076163801069007, 0.9692383619893261, -1.965394746424608 },
+		{ 0.03202111198536122, 0.9679788880146419, -1.963811483145857 },
+		{ 0.03333127365731363, 0.9666687263428921, -1.962150381202561 },
+		{ 0.03469406078262421, 0.9653059392178024, -1.960407250661008 },
+		{ 0.03611139063053191, 0.9638886093706588, -1.958577764310488 },
+		{ 0.03758553679738992, 0.9624144632072765, -1.956656955700495 },
+		{ 0.03911874768688291, 0.9608812523155773, -1.954639690200659 },
+		{ 0.04071324510197728, 0.9592867548980401, -1.952520655958879 },
+		{ 0.0423712227490095, 0.9576287772518814, -1.950294354639613 },
+		{ 0.04409515752729105, 0.9559048424760682, -1.94795466510432 },
+		{ 0.04588718056528106, 0.9541128194390526, -1.945495675526398 },
+		{ 0.04775063654170923, 0.9522493634583886, -1.942909517926148 },
+		{ 0.04968758145463611, 0.9503124185464314, -1.940189786489457 },
+		{ 0.05170096539087798, 0.9482990346113545, -1.937328504165722 },
+		{ 0.05379369158098473, 0.9462063084197243, -1.934317388146192 },
+		{ 0.05596861381858929, 0.9440313861814109, -1.931147834504842 },
+		{ 0.05822853379186219, 0.9417714662105595, -1.927810902618242 },
+		{ 0.06057712062006344, 0.9394228793815768, -1.924295909651035 },
+		{ 0.06301674970894544, 0.9369832502928757, -1.920593614762799 },
+		{ 0.05596861381858907, 0.9440313861814109, -1.931147834504842 },
+		{ 0.05822853379186219, 0.9417714662105595, -1.927810902618242 },
+		{ 0.06057712062006346, 0.9394228793815768, -1.924295909651035 },
+		{ 0.06301674970894502, 0.9369832502928757, -1.920593614762799 },
+		{ 0.06555157351101504, 0.9344484264893895, -1.916691566792619 },
+		{ 0.06818444371167576, 0.9318155562891636, -1.912578716953224 },
+		{ 0.07091874872783806, 0.9290812512745028, -1.908242596787696 },
+		{ 0.07375870412131956, 0.9262412958787454, -1.903668746787548 },
+		{ 0.07670752109628774, 0.923292478904746, -1.898843589139039 },
+		{ 0.07976892187722157, 0.9202310781228121, -1.893751973596757 },
+		{ 0.08294712498081241, 0.9170528750209334, -1.888377087794027 },
+		{ 0.08624563310563844, 0.9137543668945651, -1.882702436680172 },
+		{ 0.08966902568722655, 0.9103309743127749, -1.876708728729417 },
+		{ 0.09322114979328593, 0.9067788502069059, -1.870376903235397 },
+		{ 0.09690660269502287, 0.9030933973068966, -1.863685467414657 },
+		{ 0.1007292352413565, 0.8992707647591091, -1.856613096651077 },
+		{ 0.1046936219081004, 0.8953063780932825, -1.849135894605458 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130667956800551, 0.8869332043201269, -1.832862790048035 },
+		{ 0.1174843648924807, 0.8825156351080915, -1.824012553420859 },
+		{ 0.1220626759753323, 0.8779373240250368, -1.814645820266008 },
+		{ 0.108804741904404, 0.891195258095596, -1.84122780449662 },
+		{ 0.1130667956800549, 0.8869332043201269, -1.832862790048035 },
+		{ 0.1174843648924807, 0.8825156351080915, -1.824012553420859 },
+		{ 0.1220626759753323, 0.8779373240250368, -1.814645820266008 },
+		{ 0.1268061382322884, 0.8731938617684958, -1.804731184334108 },
+		{ 0.131719484914655, 0.8682805150865709, -1.794234719716502 },
+		{ 0.1368083110091111, 0.86319168899093, -1.783118608157518 },
+		{ 0.1420770618089881, 0.8579229381911376, -1.771345348039089 },
+		{ 0.1475307194287278, 0.8524692805719446, -1.758874018521028 },
+		{ 0.1531747628569917, 0.8468252371430733, -1.745660103276102 },
+		{ 0.1590137492038707, 0.8409862507962215, -1.731658650531943 },
+		{ 0.1650529569815036, 0.8349470430188874, -1.716820306614263 },
+		{ 0.1712975172067573, 0.8287024827932459, -1.701093164217308 },
+		{ 0.1777521168178093, 0.8222478831825584, -1.684423421754474 },
+		{ 0.1844220488434724, 0.8155779511565291, -1.666752549806137 },
+		{ 0.1913120916504563, 0.8086879083504329, -1.648020003678405 },
+		{ 0.198426751659825, 0.8015732483402365, -1.628162545731018 },
+		{ 0.2057710119479239, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747775, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211664086630026, 0.7788335913374995, -1.561145185955997 },
+		{ 0.2292260550844565, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2057710119479237, 0.7942289880520762, -1.607112005154733 },
+		{ 0.2133494910747776, 0.7866505089255681, -1.58479743435177 },
+		{ 0.2211664086630027, 0.7788335913374995, -1.561145185955997 },
+		{ 0.2292260550844564, 0.7707739449162427, -1.536077436434516 },
+		{ 0.2375322302530757, 0.7624677697471323, -1.509513823536844 },
+		{ 0.2460891938377868, 0.7539108061622264, -1.48136835819877 },
+		{ 0.2549001080570635, 0.7450998919430143, -1.451554428495523 },
+		{ 0.2639682321257222, 0.7360317678745144, -1.41998100894763 },
+		{ 0.2732963634945635, 0.726703636505601, -1.386554581176235 },
+		{ 0.2828865483950386, 0.7171134516119255, -1.351180428247727 },
+		{ 0.2927425888770371, 0.7072574111292403, -1.313753407777827 },
+		{ 0.3028625228468643, 0.6971374771962104, -1.274186870571892 },
+		{ 0.3132512960912185, 0.6867487039390532, -1.232364377183032 },
+		{ 0.3239079761133699, 0.6760920238992482, -1.188189648570492 },
+		{ 0.3348326055873215, 0.6651673944126816, -1.141560756718462 },
+		{ 0.3460238668894467, 0.6539761331121982, -1.092380428661221 },
+		{ 0.3574811686304177, 0.6425188313989846, -1.04054797138508 },
+		{ 0.3692003145377752, 0.630799685462225, -0.9859800463694947 },
+		{ 0.3811817868707558, 0.6188182131611785, -0.9285738411574956 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059067481847682, 0.5940932518274863, -0.8049846165043452 },
+		{ 0.369200314537775, 0.630799685462225, -0.9859800463694947 },
+		{ 0.381181786870756, 0.6188182131611785, -0.9285738411574956 },
+		{ 0.3934182370052536, 0.6065817629956674, -0.8682676166858876 },
+		{ 0.4059067481847681, 0.5940932518274863, -0.8049846165043452 },
+		{ 0.418642519607664, 0.5813574804006226, -0.7386651272684353 },
+		{ 0.431618868362118, 0.5683811316434754, -0.6692699330956701 },
+		{ 0.4448254243206872, 0.555174575694836, -0.5967942171449162 },
+		{ 0.4582572366799468, 0.5417427633204831, -0.5212212408356107 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 },
+		{ 0.4719018246898338, 0.5280981753104647, -0.4425976003987792 }
+	},
+	.c_bpre4800080040 = {
+		{ 4.499671915625447e-05, 0.999997750164042, -1.999994510633696 },
+		{ 4.686935368716234e-05, 0.9999976565382509, -1.999994141774862 },
+		{ 4.882056198055387e-05, 0.9999975590018497, -1.999993745576347 },
+		{ 5.085153835617516e-05, 0.9999974574239404, -1.999993320016575 },
+		{ 5.296811760752003e-05, 0.999997351608175, -1.999992862657185 },
+		{ 5.517270494235848e-05, 0.9999972413909308, -1.999992371034832 },
+		{ 5.746832745655984e-05, 0.9999971265922224, -1.999991842444714 },
+		{ 5.985970532064574e-05, 0.9999970070157029, -1.999991273918661 },
+		{ 6.235080747487387e-05, 0.9999968824650247, -1.999990662282987 },
+		{ 6.494567936864695e-05, 0.9999967527274786, -1.999990004061866 },
+		{ 6.76485417180004e-05, 0.9999966175903551, -1.999989295537635 },
+		{ 7.046359467484106e-05, 0.9999964768245827, -1.999988532646234 },
+		{ 7.339597896995367e-05, 0.9999963302010904, -1.999987711040082 },
+		{ 7.645062915424243e-05, 0.9999961774744447, -1.999986825974821 },
+		{ 7.963203342467056e-05, 0.9999960183992123, -1.999985872374899 },
+		{ 8.294625627246813e-05, 0.9999958526972359, -1.999984844607568 },
+		{ 8.639790678595357e-05, 0.9999956801067199, -1.999983736746922 },
+		{ 8.999333708739175e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373859753946576e-05, 0.9999953130819936, -1.999981254057264 },
+		{ 9.763948775199811e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373859753946577e-05, 0.9999953130819936, -1.999981254057264 },
+		{ 9.763948775199812e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 0.0001059353557761301, 0.9999947032397266, -1.999976747590628 },
+		{ 0.0001103438916420705, 0.9999944828058341, -1.999975001547581 },
+		{ 0.000114936074481406, 0.9999942532090639, -1.999973116797679 },
+		{ 0.0001197192314890594, 0.9999940140403637, -1.999971081719381 },
+		{ 0.0001247014205741901, 0.9999937649397687, -1.999968884289091 },
+		{ 0.0001298911401604373, 0.9999935054491392, -1.999966510740042 },
+		{ 0.0001352965135768067, 0.9999932351757883, -1.999963946926372 },
+		{ 0.0001409269411048847, 0.9999929536615779, -1.999961177067269 },
+		{ 0.0001467916885982812, 0.9999926604156483, -1.999958183909166 },
+		{ 0.00015290061520003, 0.9999923549798632, -1.999954949300428 },
+		{ 0.000159263749789898, 0.999992036814278, -1.999951452900762 },
+		{ 0.0001658915149440341, 0.9999917054280338, -1.999947673455566 },
+		{ 0.0001727954403348496, 0.9999913602321018, -1.999943587038741 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874766357148346, 0.9999906261695923, -1.999934390203793 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.0002034053776208592, 0.99998982973455, -1.999923631811542 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874766357148346, 0.9999906261695923, -1.999934390203793 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.0002034053776208592, 0.99998982973455, -1.999923631811542 },
+		{ 0.0002118702426395709, 0.9999894064911465, -1.999917584185503 },
+		{ 0.000220687174514657, 0.9999889656421075, -1.999911041203579 },
+		{ 0.000229871307419087, 0.9999885064347913, -1.999903961238216 },
+		{ 0.0002394377463538371, 0.9999880281165592, -1.999896299633064 },
+		{ 0.0002494019660830216, 0.9999875299020503, -1.999888007967483 },
+		{ 0.0002597809167399866, 0.9999870109568201, -1.999879033471817 },
+		{ 0.0002705921119028918, 0.9999864703973395, -1.999869318653735 },
+		{ 0.0002818528831591431, 0.9999859073564445, -1.999858802141629 },
+		{ 0.0002935822998114913, 0.9999853208851655, -1.999847416553949 },
+		{ 0.0003057999641030258, 0.9999847100018108, -1.999835088934965 },
+		{ 0.0003185262313331256, 0.9999840736919678, -1.999821740331312 },
+		{ 0.0003317829610873914, 0.9999834108921437, -1.999807284976678 },
+		{ 0.0003455892973605578, 0.9999827205715733, -1.999791631629679 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551714, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689904, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068115490601398, 0.9999796595398104, -1.99971487272446 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551715, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689905, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068115490601399, 0.9999796595398104, -1.99971487272446 },
+		{ 0.0004237380564409135, 0.9999788131272397, -1.999691531472231 },
+		{ 0.0004413734036862649, 0.9999779313732476, -1.999666240486679 },
+		{ 0.0004597419960136752, 0.99997701296896, -1.999638840311172 },
+		{ 0.000478874211725266, 0.9999760564418928, -1.999609155124097 },
+		{ 0.0004988010171748789, 0.9999750599923286, -1.999576985685363 },
+		{ 0.0005195627111254864, 0.9999740221478034, -1.999542128848105 },
+		{ 0.0005411829201435282, 0.9999729409450047, -1.999504349731778 },
+		{ 0.0005637017942441619, 0.9999718149114918, -1.999463413790437 },
+		{ 0.0005871650286238691, 0.9999706419203596, -1.999419045202445 },
+		{ 0.0006116002419875165, 0.9999694201719577, -1.999370960304841 },
+		{ 0.0006370481281532397, 0.9999681477030309, -1.999318848451374 },
+		{ 0.0006635604181922894, 0.9999668220594856, -1.999262355261456 },
+		{ 0.0006911726231413597, 0.9999654414417252, -1.999201128792889 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.000749901367816997, 0.9999625051401307, -1.999062802445679 },
+		{ 0.0007811025552878788, 0.9999609448755009, -1.998984811467349 },
+		{ 0.0008136106195169079, 0.9999593196569728, -1.99890026179779 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.000749901367816997, 0.9999625051401307, -1.999062802445679 },
+		{ 0.0007811025552878789, 0.9999609448755009, -1.998984811467349 },
+		{ 0.0008136106195169081, 0.9999593196569728, -1.99890026179779 },
+		{ 0.0008474671352060378, 0.9999576267033626, -1.998808594787146 },
+		{ 0.0008827370668849758, 0.9999558632335189, -1.998709210595482 },
+		{ 0.0009194734239327943, 0.9999540264663239, -1.99860146574291 },
+		{ 0.0009577358560011288, 0.9999521132934627, -1.998484650181713 },
+		{ 0.0009975895942539717, 0.999950120606661, -1.998358001697659 },
+		{ 0.001039103933596543, 0.99994804480684, -1.998220669700717 },
+		{ 0.001082347008419428, 0.9999458827858174, -1.998071774200171 },
+		{ 0.001127387700501486, 0.9999436306173833, -1.997910313263122 },
+		{ 0.001174303307601742, 0.9999412848662315, -1.997735246933261 },
+		{ 0.001223171549119158, 0.9999388414426555, -1.997545409533172 },
+		{ 0.001274076270405958, 0.9999362962570164, -1.997339548866515 },
+		{ 0.001327094350712418, 0.9999336453833612, -1.997116335099989 },
+		{ 0.001382323795404625, 0.9999308839141307, -1.996874255850787 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001694900899627918, 0.9999152550386111, -1.995320527287612 },
+		{ 0.001765429276745449, 0.9999117285787024, -1.994926800685129 },
+		{ 0.001838895951590787, 0.9999080552098232, -1.994499785336898 },
+		{ 0.001915419794907561, 0.9999042290436707, -1.994036690623382 },
+		{ 0.001995129827803556, 0.9999002435376675, -1.993534440697936 },
+		{ 0.002078153880367763, 0.9998960923130215, -1.992989755200841 },
+		{ 0.002164633299084153, 0.9998917683367007, -1.992399026475649 },
+		{ 0.002254711850854597, 0.9998872644122738, -1.991758358601923 },
+		{ 0.00234853766582068, 0.9998825731799299, -1.991063547099435 },
+		{ 0.002446268290822035, 0.9998776866256802, -1.990309980252789 },
+		{ 0.002548065692977258, 0.9998725967358033, -1.989492707741597 },
+		{ 0.002654099948361495, 0.9998672950060543, -1.988606337239949 },
+		{ 0.002764544657398641, 0.9998617727688968, -1.987645054890669 },
+		{ 0.002879585945502868, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999413582508283, 0.9998500293226995, -1.985471841320368 },
+		{ 0.003124227189556842, 0.9998437886535817, -1.984245617566512 },
+		{ 0.003254235456146544, 0.9998372882297679, -1.98291575010368 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999413582508284, 0.9998500293226995, -1.985471841320368 },
+		{ 0.003124227189556843, 0.9998437886535817, -1.984245617566512 },
+		{ 0.003254235456138064, 0.9998372882297679, -1.98291575010368 },
+		{ 0.003389658164956216, 0.9998305172589307, -1.981473496505128 },
+		{ 0.003530714507457886, 0.9998234646220567, -1.979909408870388 },
+		{ 0.003677635391018463, 0.9998161192006798, -1.97821336031361 },
+		{ 0.003830717798340062, 0.9998084679137906, -1.976374025888429 },
+		{ 0.003990086513640891, 0.9998004976810547, -1.974379246182437 },
+		{ 0.004156091824553682, 0.9997921954228509, -1.972215979635027 },
+		{ 0.004329053354214209, 0.9997835480603157, -1.969870253403232 },
+		{ 0.004509237352376205, 0.9997745408795091, -1.967326641631998 },
+		{ 0.004696854879048645, 0.9997651608032626, -1.964569098332933 },
+		{ 0.004892237370315301, 0.9997553882119217, -1.961578444099699 },
+		{ 0.005095816900949486, 0.9997452100303644, -1.958336146826276 },
+		{ 0.005307871116851473, 0.9997346082770491, -1.954820795607911 },
+		{ 0.005528712225319319, 0.9997235649717198, -1.951009433631121 },
+		{ 0.005758757290257834, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005998404074598651, 0.9997000817909053, -1.942398623198602 },
+		{ 0.006248005954810736, 0.9996876010548541, -1.937542833513939 },
+		{ 0.006507958288666066, 0.9996746035889418, -1.932280565270122 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005998404074598652, 0.9997000817909053, -1.942398623198602 },
+		{ 0.006248005954810737, 0.9996876010548541, -1.937542833513939 },
+		{ 0.006507958288661898, 0.9996746035889418, -1.932280565270122 },
+		{ 0.006778741841354946, 0.9996610632422608, -1.926576182309485 },
+		{ 0.007060805718871754, 0.9996469604088535, -1.920394337471791 },
+		{ 0.007354594535503339, 0.9996322722135079, -1.913695859795342 },
+		{ 0.007660583551433226, 0.999616970876502, -1.906436562252011 },
+		{ 0.007979346630575585, 0.999601033527691, -1.898571588364312 },
+		{ 0.00831131999421033, 0.999584434028444, -1.890051478299322 },
+		{ 0.008657169676425217, 0.9995671429720734, -1.880821717731157 },
+		{ 0.009017318875893417, 0.999549134226342, -1.870825956951137 },
+		{ 0.009392497617914877, 0.999530375120496, -1.860000456480908 },
+		{ 0.009783278041699633, 0.9995108362587707, -1.848279213669953 },
+		{ 0.01019036537612634, 0.9994904833432451, -1.835589001936597 },
+		{ 0.01061430080614358, 0.9994692853514866, -1.821854043355935 },
+		{ 0.01105589612091595, 0.9994472063597648, -1.806990676496434 },
+		{ 0.01151585641624153, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.01249398295043062, 0.9993753013380333, -1.754698279602624 },
+		{ 0.0130137777684661, 0.9993493114255263, -1.734357665267466 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.01249398295042656, 0.9993753013380333, -1.754698279602624 },
+		{ 0.01301377776846833, 0.9993493114255263, -1.734357665267466 },
+		{ 0.01355518611792147, 0.9993222413626475, -1.712373651513881 },
+		{ 0.01411907916722377, 0.9992940470897509, -1.68862188341075 },
+		{ 0.01470644039503845, 0.9992646780156977, -1.662965833945175 },
+		{ 0.01531823287628394, 0.9992340884643134, -1.635266410783617 },
+		{ 0.01595545429114809, 0.9992022278645689, -1.605373554346886 },
+		{ 0.01661918608665999, 0.9991690407519644, -1.573125704162999 },
+		{ 0.01731050271522907, 0.9991344749441833, -1.538357698824008 },
+		{ 0.01803057215135357, 0.9990984717326297, -1.500891467419215 },
+		{ 0.01878058428527886, 0.9990609707885193, -1.46054091816194 },
+		{ 0.01956177045850921, 0.9990219117987069, -1.417114344340026 },
+		{ 0.02037544146268551, 0.998981227928293, -1.370407882637247 },
+		{ 0.02122296844736804, 0.9989388523610117, -1.320213536771923 },
+		{ 0.02210566776870077, 0.9988947166659007, -1.266318810681261 },
+		{ 0.02302508208503631, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398273630577163, 0.9988008634927419, -1.146540803171145 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601908762042738, 0.9986990462466736, -1.009297783425636 },
+		{ 0.02302508208503236, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398273630577297, 0.9988008634927419, -1.146540803171145 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601908762042664, 0.9986990462466736, -1.009297783425636 },
+		{ 0.02710112942923977, 0.9986449437160945, -0.9335812313071329 },
+		{ 0.02822818193842893, 0.9985885909150765, -0.8528532614165121 },
+		{ 0.02940206682115862, 0.998529896729816, -0.7669258422335631 },
+		{ 0.03062473334130196, 0.9984687635491072, -0.6756278631583817 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03322462320804359, 0.9983387752642569, -0.4763912182352628 },
+		{ 0.03460620129271959, 0.9982696957551591, -0.3682700116581712 },
+		{ 0.03604554772705865, 0.9981977627516653, -0.2544882770582875 },
+		{ 0.0375439693782614, 0.9981228298855975, -0.1350678596205327 },
+		{ 0.03910456724308132, 0.9980447835200371, -0.01017399626087403 },
+		{ 0.04073012499466135, 0.9979634937531203, 0.1199452411649807 },
+		{ 0.04242341619187515, 0.997878830756335, 0.2549145569002364 },
+		{ 0.04418759397561111, 0.9977906484525256, 0.3942370878355403 },
+		{ 0.04602365644981978, 0.997698817177509, 0.5372208075587583 },
+		{ 0.04793745098861595, 0.997603158384549, 0.6830567051848644 },
+		{ 0.04992916588328088, 0.9975035426033223, 0.8306426205385871 },
+		{ 0.05200441022785206, 0.9973997915019822, 0.9787082241320342 },
+		{ 0.04602365644981905, 0.997698817177509, 0.5372208075587583 },
+		{ 0.04793745098861536, 0.997603158384549, 0.6830567051848644 },
+		{ 0.04992916588328493, 0.9975035426033223, 0.8306426205385871 },
+		{ 0.05200441022785283, 0.9973997915019822, 0.9787082241320342 },
+		{ 0.05416562600815365, 0.9972917268733514, 1.12571309012118 },
+		{ 0.05641669818012116, 0.9971791706424973, 1.269824159255335 },
+		{ 0.05876108626838765, 0.9970619611890126, 1.408878982599491 },
+		{ 0.06120257297461763, 0.9969398717832831, 1.540466594325911 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 },
+		{ 0.06374550987822711, 0.996812724807962, 1.661783319030018 }
+	},
+	.c_bpre9600080040 = {
+		{ 2.249837222979395e-05, 0.9999988750813886, -1.999998065198183 },
+		{ 2.343469057952056e-05, 0.9999988282684389, -1.999997949576884 },
+		{ 2.441029589297938e-05, 0.99999877950018, -1.999997826142995 },
+		{ 2.542578533180206e-05, 0.9999987287111621, -1.999997694358396 },
+		{ 2.648407634028509e-05, 0.9999986758032107, -1.999997553564405 },
+		{ 2.758637149721998e-05, 0.9999986206945142, -1.999997403104279 },
+		{ 2.873418437253289e-05, 0.9999985632950792, -1.999997242256817 },
+		{ 2.992987504660822e-05, 0.9999985035067317, -1.999997070230885 },
+		{ 3.117542803610932e-05, 0.9999984412312974, -1.999996886183971 },
+		{ 3.247286603809363e-05, 0.9999983763624212, -1.999996689193937 },
+		{ 3.382429946956905e-05, 0.9999983087937474, -1.999996478278182 },
+		{ 3.523182837478338e-05, 0.9999982384107398, -1.999996252363417 },
+		{ 3.669802315705788e-05, 0.9999981650988616, -1.999996010305472 },
+		{ 3.822535111346011e-05, 0.999998088735396, -1.99999575085689 },
+		{ 3.981605633916915e-05, 0.9999980091976245, -1.999995472687413 },
+		{ 4.147317113681064e-05, 0.9999979263464677, -1.999995174319304 },
+		{ 4.319900005173533e-05, 0.9999978400510272, -1.999994854205624 },
+		{ 4.499671915625446e-05, 0.999997750164042, -1.999994510633696 },
+		{ 4.686935368716232e-05, 0.9999976565382509, -1.999994141774862 },
+		{ 4.881980346249815e-05, 0.9999975590100311, -1.99999374561009 },
+		{ 5.085153835617516e-05, 0.9999974574239404, -1.999993320016575 },
+		{ 4.499671915625447e-05, 0.999997750164042, -1.999994510633696 },
+		{ 4.686935368716234e-05, 0.9999976565382509, -1.999994141774862 },
+		{ 4.881980346249815e-05, 0.9999975590100311, -1.99999374561009 },
+		{ 5.085153835617516e-05, 0.9999974574239404, -1.999993320016575 },
+		{ 5.296774802757162e-05, 0.9999973516163563, -1.9999928626931 },
+		{ 5.517202192183139e-05, 0.9999972413991121, -1.999992371071901 },
+		{ 5.746811980089937e-05, 0.9999971266004037, -1.999991842482985 },
+		{ 5.985970532064574e-05, 0.9999970070157029, -1.999991273918661 },
+		{ 6.235080747487387e-05, 0.9999968824650247, -1.999990662282987 },
+		{ 6.494567552710307e-05, 0.9999967527192972, -1.999990004019679 },
+		{ 6.764837119641584e-05, 0.9999966175821737, -1.999989295494033 },
+		{ 7.046359467484106e-05, 0.9999964768245827, -1.999988532646234 },
+		{ 7.339597896995367e-05, 0.9999963302010904, -1.999987711040082 },
+		{ 7.645045371986217e-05, 0.9999961774826258, -1.999986826023032 },
+		{ 7.963203342467056e-05, 0.9999960183992123, -1.999985872374899 },
+		{ 8.294592946823393e-05, 0.999995852705417, -1.999984844659179 },
+		{ 8.639790678595357e-05, 0.9999956801067199, -1.999983736746922 },
+		{ 8.999333708739175e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373853752766959e-05, 0.9999953130738126, -1.999981254000001 },
+		{ 9.763948775199811e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 8.999333708739178e-05, 0.9999955003331457, -1.999982542236833 },
+		{ 9.373853752766961e-05, 0.9999953130738126, -1.999981254000001 },
+		{ 9.763948775199812e-05, 0.9999951180260205, -1.999979864459417 },
+		{ 0.0001017029473911201, 0.9999949148543459, -1.999978365263043 },
+		{ 0.0001059354018788903, 0.9999947032315452, -1.999976747526979 },
+		{ 0.0001103438916420705, 0.9999944828058341, -1.999975001547581 },
+		{ 0.0001149359839683642, 0.9999942532008828, -1.999973116729318 },
+		{ 0.0001197192314890594, 0.9999940140403637, -1.999971081719381 },
+		{ 0.0001247013718044642, 0.9999937649315872, -1.999968884215616 },
+		{ 0.0001298908801728584, 0.9999935054573205, -1.999966510816233 },
+		{ 0.0001352965135768067, 0.9999932351757883, -1.999963946926372 },
+		{ 0.0001409269380855939, 0.9999929536533967, -1.999961176985299 },
+		{ 0.0001467916885982812, 0.9999926604156483, -1.999958183909166 },
+		{ 0.0001529005665104481, 0.999992354971682, -1.999954949212189 },
+		{ 0.000159263749789898, 0.999992036814278, -1.999951452900762 },
+		{ 0.0001658921685440353, 0.9999917054116716, -1.999947673265484 },
+		{ 0.0001727953951409747, 0.9999913602484639, -1.999943587236052 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874779780324805, 0.9999906261532298, -1.999934389991108 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.0002034068088802921, 0.9999898297181881, -1.999923631582177 },
+		{ 0.0001799862692379033, 0.9999910006865385, -1.999939168585815 },
+		{ 0.0001874779780324805, 0.9999906261532298, -1.999934389991108 },
+		{ 0.0001952784988263437, 0.9999902360758749, -1.999929222191067 },
+		{ 0.0002034068088802921, 0.9999898297181881, -1.999923631582177 },
+		{ 0.0002118701504423012, 0.9999894065075086, -1.999917584423732 },
+		{ 0.0002206879194301173, 0.9999889656257448, -1.999911040956116 },
+		{ 0.0002298723190304334, 0.9999885064184287, -1.999903960981137 },
+		{ 0.0002394385391350099, 0.9999880281492839, -1.999896300167256 },
+		{ 0.000249402063627384, 0.9999875299184128, -1.999888008245013 },
+		{ 0.0002597830427248894, 0.9999870109895445, -1.999879034048613 },
+		{ 0.0002705932905894983, 0.999986470380977, -1.999869318354015 },
+		{ 0.0002818528831591431, 0.9999859073564445, -1.999858802141629 },
+		{ 0.0002935846690945491, 0.9999853208524412, -1.999847415906363 },
+		{ 0.0003058024588594119, 0.9999847099690864, -1.999835088261792 },
+		{ 0.0003185266005518662, 0.9999840737246922, -1.999821741031135 },
+		{ 0.0003317829610873914, 0.9999834108921437, -1.999807284976678 },
+		{ 0.0003455892973605578, 0.9999827205715733, -1.999791631629679 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551714, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689904, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068094470843135, 0.9999796596216209, -1.99971487493621 },
+		{ 0.0003599709187077813, 0.9999820014540647, -1.999774676670639 },
+		{ 0.0003749541986551715, 0.9999812523943289, -1.999756311962639 },
+		{ 0.0003905550909689905, 0.9999804722470838, -1.999736421622012 },
+		{ 0.0004068094470843136, 0.9999796596216209, -1.99971487493621 },
+		{ 0.0004237380564409135, 0.9999788131272397, -1.999691531472231 },
+		{ 0.0004413734036862649, 0.9999779313732476, -1.999666240486679 },
+		{ 0.0004597419960136752, 0.99997701296896, -1.999638840311172 },
+		{ 0.0004788736609898295, 0.9999760563600822, -1.999609152535087 },
+		{ 0.0004988010171748789, 0.9999750599923286, -1.999576985685363 },
+		{ 0.0005195587153288446, 0.9999740220659933, -1.999542126046109 },
+		{ 0.0005411808261003594, 0.9999729410268147, -1.999504352646961 },
+		{ 0.0005637017942441619, 0.9999718149114918, -1.999463413790437 },
+		{ 0.0005871602727206251, 0.9999706420021699, -1.999419048358317 },
+		{ 0.0006115951257697394, 0.9999694202537674, -1.999370963588615 },
+		{ 0.0006370482809605812, 0.9999681476212213, -1.999318845034382 },
+		{ 0.0006635581830799407, 0.9999668221412954, -1.99926235881721 },
+		{ 0.0006911738407115388, 0.9999654413599156, -1.999201125092603 },
+		{ 0.0007199353584600716, 0.9999640032320768, -1.999134754544961 },
+		{ 0.0007498955703247088, 0.9999625052219399, -1.999062806453311 },
+		{ 0.0007811025552878788, 0.9999609448755009, -1.998984811467349 },
+		{ 0.000813608509600322, 0.999959319575164, -1.998900257456737 },
+		{ 0.0007199353584600718, 0.9999640032320768, -1.999134754544961 },
+		{ 0.000749895570324709, 0.9999625052219399, -1.999062806453311 },
+		{ 0.0007811025552878789, 0.9999609448755009, -1.998984811467349 },
+		{ 0.0008136085096003222, 0.999959319575164, -1.998900257456737 },
+		{ 0.0008474684048716788, 0.9999576266215539, -1.998808590268909 },
+		{ 0.0008827341188541127, 0.9999558633153277, -1.998709215298266 },
+		{ 0.000919469111387989, 0.9999540265481326, -1.998601470637911 },
+		{ 0.0009577328287511275, 0.9999521133752711, -1.998484655276915 },
+		{ 0.0009975897935297223, 0.9999501205248527, -1.99835799639394 },
+		{ 0.001039103933596543, 0.99994804480684, -1.998220669700717 },
+		{ 0.001082345936360347, 0.9999458827040095, -1.998071768453064 },
+		{ 0.001127387700501486, 0.9999436306173833, -1.997910313263122 },
+		{ 0.001174303307601742, 0.9999412848662315, -1.997735246933261 },
+		{ 0.001223171549119158, 0.9999388414426555, -1.997545409533172 },
+		{ 0.001274073428058094, 0.9999362963388234, -1.997339555616364 },
+		{ 0.001327094003646902, 0.999933645301554, -1.997116328072918 },
+		{ 0.001382320098926278, 0.9999308839959374, -1.996874263166596 },
+		{ 0.001439844801581977, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001439844801581978, 0.999928007759921, -1.996611760364314 },
+		{ 0.001499763023479209, 0.9999250118497384, -1.996327093699842 },
+		{ 0.001562174604513887, 0.9999218912763045, -1.99601838672466 },
+		{ 0.001627183921257191, 0.9999186408052249, -1.995683600108529 },
+		{ 0.001694900899627918, 0.9999152550386111, -1.995320527287612 },
+		{ 0.00176543517260569, 0.9999117284150919, -1.994926782049748 },
+		{ 0.001838902234102751, 0.9999080553734327, -1.994499804739558 },
+		{ 0.001915450621122455, 0.9999042293708885, -1.994036731026774 },
+		{ 0.001995142770695815, 0.9999002438648841, -1.993534482765587 },
+		{ 0.002078153880367763, 0.9998960923130215, -1.992989755200841 },
+		{ 0.002164643818785887, 0.9998917681730934, -1.992399003672967 },
+		{ 0.002254745771603515, 0.9998872640850612, -1.991758311117397 },
+		{ 0.00234856533141611, 0.9998825735071406, -1.991063596540442 },
+		{ 0.002446268290822035, 0.9998776866256802, -1.990309980252789 },
+		{ 0.002548070766526764, 0.9998725968994073, -1.989492734541432 },
+		{ 0.002654111664927493, 0.9998672953332601, -1.988606393048207 },
+		{ 0.002764547180277843, 0.9998617729324989, -1.987645083944524 },
+		{ 0.002879585945502868, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999426949854144, 0.9998500296498994, -1.985471904314097 },
+		{ 0.003124246999331507, 0.9998437883263837, -1.984245551978353 },
+		{ 0.003254243895698514, 0.9998372885569642, -1.982915818392245 },
+		{ 0.002879585945502869, 0.9998560207027247, -1.986602506088068 },
+		{ 0.002999426949854144, 0.9998500296498994, -1.985471904314097 },
+		{ 0.003124246999331508, 0.9998437883263837, -1.984245551978353 },
+		{ 0.00325424389569003, 0.9998372885569642, -1.982915818392245 },
+		{ 0.003389658164956216, 0.9998305172589307, -1.981473496505128 },
+		{ 0.003530714507457886, 0.9998234646220567, -1.979909408870388 },
+		{ 0.003677635391018463, 0.9998161192006798, -1.97821336031361 },
+		{ 0.003830658624312898, 0.9998084670958243, -1.976373825291763 },
+		{ 0.003990071331158019, 0.9998004968630947, -1.974379037342116 },
+		{ 0.004156091824553682, 0.9997921954228509, -1.972215979635027 },
+		{ 0.004329053354214209, 0.9997835480603157, -1.969870253403232 },
+		{ 0.00450916775260186, 0.9997745416974479, -1.967326877258122 },
+		{ 0.004696800307285219, 0.9997651599853317, -1.964568853050405 },
+		{ 0.004892237370315301, 0.9997553882119217, -1.961578444099699 },
+		{ 0.005095831873565652, 0.99974520921245, -1.958335881053669 },
+		{ 0.00530785473559287, 0.9997346074591432, -1.954820518974196 },
+		{ 0.005528712225319319, 0.9997235649717198, -1.951009433631121 },
+		{ 0.005758757290257834, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005998382080297502, 0.9997000809730274, -1.942398311335835 },
+		{ 0.006247967401874891, 0.9996876018727217, -1.937543158053412 },
+		{ 0.006507947718310494, 0.9996746027710849, -1.932280227561847 },
+		{ 0.005758757290257835, 0.9997120621354871, -1.946877475516094 },
+		{ 0.005998382080297503, 0.9997000809730274, -1.942398311335835 },
+		{ 0.006247967401874892, 0.9996876018727217, -1.937543158053412 },
+		{ 0.006507947718306328, 0.9996746027710849, -1.932280227561847 },
+		{ 0.006778741841354946, 0.9996610632422608, -1.926576182309485 },
+		{ 0.007060785949208019, 0.9996469612266877, -1.9203947030618 },
+		{ 0.007354572440850088, 0.9996322713956853, -1.913695479461061 },
+		{ 0.007660583551433226, 0.999616970876502, -1.906436562252011 },
+		{ 0.007979318882664968, 0.999601034345488, -1.898571999876733 },
+		{ 0.00831131999421033, 0.999584434028444, -1.890051478299322 },
+		{ 0.00865712500277434, 0.9995671437898423, -1.880822162777837 },
+		{ 0.009017318875893417, 0.999549134226342, -1.870825956951137 },
+		{ 0.009392497617914877, 0.999530375120496, -1.860000456480908 },
+		{ 0.009783278041699633, 0.9995108362587707, -1.848279213669953 },
+		{ 0.0101903167952465, 0.9994904841609515, -1.835589521591182 },
+		{ 0.01061430080614358, 0.9994692853514866, -1.821854043355935 },
+		{ 0.01105588970163358, 0.999447205542094, -1.806990115568385 },
+		{ 0.01151585641624153, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.01249399408321126, 0.9993753005204216, -1.754697651611612 },
+		{ 0.0130137777684661, 0.9993493114255263, -1.734357665267466 },
+		{ 0.01151585641623928, 0.999424207179188, -1.790907776077773 },
+		{ 0.01199496513167562, 0.9994002518974776, -1.773511032852925 },
+		{ 0.0124939940832072, 0.9993753005204216, -1.754697651611612 },
+		{ 0.01301377776846833, 0.9993493114255263, -1.734357665267466 },
+		{ 0.0135551582718786, 0.9993222421802159, -1.712374327669403 },
+		{ 0.01411907467591776, 0.9992940462722053, -1.688621182151861 },
+		{ 0.01470644039503845, 0.9992646780156977, -1.662965833945175 },
+		{ 0.01531823287628394, 0.9992340884643134, -1.635266410783617 },
+		{ 0.01595546056920448, 0.9992022270470986, -1.605372773879137 },
+		{ 0.01661921653619924, 0.999169042386851, -1.573127320324115 },
+		{ 0.01731059203612167, 0.9991344733093532, -1.538356026352165 },
+		{ 0.01803090151652032, 0.9990984750021721, -1.500894926928912 },
+		{ 0.01878080251871108, 0.9990609740579386, -1.460544493953721 },
+		{ 0.01956185021273523, 0.9990219134333527, -1.417116191079102 },
+		{ 0.02037544146268551, 0.998981227928293, -1.370407882637247 },
+		{ 0.02122296844736804, 0.9989388523610117, -1.320213536771923 },
+		{ 0.02210601372901829, 0.9988947133970254, -1.266314759578515 },
+		{ 0.02302508208503631, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398310504304197, 0.9988008602241736, -1.146536514932702 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601912991326261, 0.9986990495149086, -1.009302301484565 },
+		{ 0.02302508208503236, 0.9988487458957483, -1.208502182512338 },
+		{ 0.02398310504304334, 0.9988008602241736, -1.146536514932702 },
+		{ 0.02498018317482285, 0.9987509912902826, -1.080213157859834 },
+		{ 0.02601912991326183, 0.9986990495149086, -1.009302301484565 },
+		{ 0.02710117479020728, 0.9986449453501234, -0.9335835453333717 },
+		{ 0.02822826993155479, 0.99858858928114, -0.8528508947276944 },
+		{ 0.0294021551873294, 0.9985298999974976, -0.7669306750465569 },
+		{ 0.03062473334130196, 0.9984687635491072, -0.6756278631583817 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 },
+		{ 0.03189819230351135, 0.9984050905358817, -0.5788170629664604 }
+	},
+},
+{
+	.name = "Bohlen Pierce",
+	.c_maxq48000 = {
+		0.004280838301772239,
+		0.005503934959421452,
+		0.007705508943190032,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.01651180487826436,
+		0.02311652682957009,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.04953541463479307,
+		0.06934958048871027,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1486062439043792,
+		0.2080487414661308,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.4458187317131376,
+		0.6241462243983925,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005503934959421452,
+		0.007705508943190032,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.01651180487826436,
+		0.02311652682957009,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.04953541463479307,
+		0.06934958048871027,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1486062439043792,
+		0.2080487414661308,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.4458187317131376,
+		0.6241462243983925,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007134730502953733,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.0214041915088612,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.0642125745265836,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.1926377235797508,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.485447063420972,
+		0.5779131707392524,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007705508943190032,
+		0.009173224932369085,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.02311652682957009,
+		0.02751967479710725,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.06934958048871027,
+		0.08255902439132178,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.2080487414661308,
+		0.2476770731739653,
+		0.3467479024435514,
+		0.485447063420972,
+		0.6241462243983925,
+		0.7430312195218959,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007705508943190032,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.02311652682957009,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.06934958048871027,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.2080487414661308,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.485447063420972,
+		0.6241462243983925,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.005993173622481135,
+		0.007705508943190032,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.01797952086744341,
+		0.02311652682957009,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.05393856260233022,
+		0.06934958048871027,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1618156878069907,
+		0.2080487414661308,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.485447063420972,
+		0.6241462243983925,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.007705508943190032,
+		0.009988622704135227,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02311652682957009,
+		0.02996586811240568,
+		0.03852754471595016,
+		0.0642125745265836,
+		0.06934958048871027,
+		0.08989760433721702,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.2080487414661308,
+		0.2696928130116511,
+		0.3467479024435514,
+		0.5779131707392524,
+		0.6241462243983925,
+		0.8090784390349532,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.007705508943190032,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02311652682957009,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.0642125745265836,
+		0.06934958048871027,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.2080487414661308,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.5779131707392524,
+		0.6241462243983925,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.009988622704135227,
+		0.01078771252046604,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02996586811240568,
+		0.03236313756139814,
+		0.03852754471595016,
+		0.0642125745265836,
+		0.08989760433721702,
+		0.0970894126841944,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.2696928130116511,
+		0.2912682380525832,
+		0.3467479024435514,
+		0.5779131707392524,
+		0.8090784390349532,
+		0.8738047141577496,
+		1.040243707330654,
+		0.004280838301772239,
+		0.007134730502953733,
+		0.00839044307147359,
+		0.01189121750492289,
+		0.01284251490531672,
+		0.0214041915088612,
+		0.02517132921442077,
+		0.03567365251476867,
+		0.03852754471595016,
+		0.0642125745265836,
+		0.07551398764326231,
+		0.107020957544306,
+		0.1155826341478505,
+		0.1926377235797508,
+		0.2265419629297869,
+		0.3210628726329179,
+		0.3467479024435514,
+		0.5779131707392524,
+		0.6796258887893606,
+		0.9631886178987539,
+		1.040243707330654,
+		0.004280838301772239,
+		0.006552303523120775,
+		0.009173224932369085,
+		0.01189121750492289,
+		0.01284251490531672,
+		0.01965691056936232,
+		0.02751967479710725,
+		0.03567365251476867,
+		0.03852754471595016,
+		0.05897073170808697,
+		0.08255902439132178,
+		0.107020957544306,
+		0.1155826341478505,
+		0.1769121951242609,
+		0.2476770731739653,
+		0.3210628726329179,
+		0.3467479024435514,
+		0.5307365853727827,
+		0.7430312195218959,
+		0.9631886178987539,
+		1.040243707330654
+	},
+	.c_maxq96000 = {
+		0.00214041915088612,
+		0.002751967479710726,
+		0.003852754471595016,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.008255902439132178,
+		0.01155826341478505,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.02476770731739653,
+		0.03467479024435514,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.0743031219521896,
+		0.1040243707330654,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.2229093658565688,
+		0.3120731121991963,
+		0.4045392195174766,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.002751967479710726,
+		0.003852754471595016,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.008255902439132178,
+		0.01155826341478505,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.02476770731739653,
+		0.03467479024435514,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.0743031219521896,
+		0.1040243707330654,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.2229093658565688,
+		0.3120731121991963,
+		0.4369023570788748,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003567365251476867,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.0107020957544306,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.0321062872632918,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.09631886178987541,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.242723531710486,
+		0.2889565853696262,
+		0.4045392195174766,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003852754471595016,
+		0.004586612466184543,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.01155826341478505,
+		0.01375983739855363,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.03467479024435514,
+		0.04127951219566089,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.1040243707330654,
+		0.1238385365869826,
+		0.1733739512217757,
+		0.242723531710486,
+		0.3120731121991963,
+		0.3715156097609479,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003852754471595016,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.01155826341478505,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.03467479024435514,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.1040243707330654,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.242723531710486,
+		0.3120731121991963,
+		0.4045392195174766,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.002996586811240568,
+		0.003852754471595016,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.008989760433721704,
+		0.01155826341478505,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.02696928130116511,
+		0.03467479024435514,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.08090784390349534,
+		0.1040243707330654,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.242723531710486,
+		0.3120731121991963,
+		0.4369023570788748,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.003852754471595016,
+		0.004994311352067613,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01155826341478505,
+		0.01498293405620284,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.03467479024435514,
+		0.04494880216860851,
+		0.05779131707392524,
+		0.09631886178987541,
+		0.1040243707330654,
+		0.1348464065058256,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.3120731121991963,
+		0.4045392195174766,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.003852754471595016,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01155826341478505,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.03467479024435514,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.09631886178987541,
+		0.1040243707330654,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.3120731121991963,
+		0.4369023570788748,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.004994311352067613,
+		0.005393856260233022,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01498293405620284,
+		0.01618156878069907,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.04494880216860851,
+		0.0485447063420972,
+		0.05779131707392524,
+		0.09631886178987541,
+		0.1348464065058256,
+		0.1456341190262916,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.4045392195174766,
+		0.4369023570788748,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.003567365251476867,
+		0.004195221535736795,
+		0.005945608752461444,
+		0.006421257452658361,
+		0.0107020957544306,
+		0.01258566460721039,
+		0.01783682625738433,
+		0.01926377235797508,
+		0.0321062872632918,
+		0.03775699382163115,
+		0.05351047877215299,
+		0.05779131707392524,
+		0.09631886178987541,
+		0.1132709814648934,
+		0.160531436316459,
+		0.1733739512217757,
+		0.2889565853696262,
+		0.3398129443946803,
+		0.4815943089493769,
+		0.5201218536653271,
+		0.00214041915088612,
+		0.003276151761560387,
+		0.004586612466184543,
+		0.005945608752461444,
+		0.006421257452658361,
+		0.009828455284681162,
+		0.01375983739855363,
+		0.01783682625738433,
+		0.01926377235797508,
+		0.02948536585404348,
+		0.04127951219566089,
+		0.05351047877215299,
+		0.05779131707392524,
+		0.08845609756213046,
+		0.1238385365869826,
+		0.160531436316459,
+		0.1733739512217757,
+		0.2653682926863913,
+		0.3715156097609479,
+		0.4815943089493769,
+		0.5201218536653271
+	},
+	.c_bpre4800022 = {
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002748186517267884, 0.9972518134827467, -1.99722156183576 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004981863345433094, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008221922720160707, 0.9917780772798828, -1.99150656411867 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02446352392291807, 0.9755364760772108, -1.973113224180117 },
+		{ 0.03408052293083974, 0.965919477069212, -1.961193955824454 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.07160988106328864, 0.928390118938355, -1.907136098338473 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.1998124079535939, 0.800187592048897, -1.624233966742962 },
+		{ 0.2680721816824919, 0.7319278183190978, -1.405393705037292 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002748186517267884, 0.9972518134827467, -1.99722156183576 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008221922720160707, 0.9917780772798828, -1.99150656411867 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02446352392291807, 0.9755364760772108, -1.973113224180117 },
+		{ 0.03408052293083974, 0.965919477069212, -1.961193955824454 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.07160988106328864, 0.928390118938355, -1.907136098338473 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.1998124079535939, 0.800187592048897, -1.624233966742962 },
+		{ 0.2680721816824919, 0.7319278183190978, -1.405393705037292 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.004981863345433094, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.01064503348036799, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03159635648817692, 0.9684036435118276, -1.964346921817052 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09182538606238863, 0.9081746139425293, -1.872878644988852 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315437, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2509552064603366, 0.7490447935398723, -1.465007896944705 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004576111558501068, 0.9954238884415031, -1.995339933453512 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01366561456754154, 0.9863343854325303, -1.985582273885323 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03408052293083974, 0.965919477069212, -1.961193955824454 },
+		{ 0.040439085875119, 0.9595609141250745, -1.952886540525939 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1164773138082877, 0.8835226861948419, -1.826046274758217 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315437, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2680721816824919, 0.7319278183190978, -1.405393705037292 },
+		{ 0.3103117425184871, 0.689688257481525, -1.244322404749831 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004981863345433094, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03408052293083974, 0.965919477069212, -1.961193955824454 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315437, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2680721816824919, 0.7319278183190978, -1.405393705037292 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.002992103227616398, 0.9970078967723913, -1.996972032444201 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.008949445993621973, 0.9910505540070533, -1.990728747995121 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02660884072074166, 0.9733911592793467, -1.97052119781779 },
+		{ 0.03408052293083974, 0.965919477069212, -1.961193955824454 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.0777212708169847, 0.9222787291832732, -1.897166850488962 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2155115074315437, 0.7844884925691782, -1.578320437408007 },
+		{ 0.2680721816824919, 0.7319278183190978, -1.405393705037292 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.004981863345433094, 0.9950181366545799, -1.994918613311871 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.01064503348036799, 0.9893549665196336, -1.988899282836953 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817692, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03408052293083974, 0.965919477069212, -1.961193955824454 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238863, 0.9081746139425293, -1.872878644988852 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603366, 0.7490447935398723, -1.465007896944705 },
+		{ 0.2680721816824919, 0.7319278183190978, -1.405393705037292 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.003845345252415304, 0.9961546547476051, -1.996095394234924 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.01064503348036799, 0.9893549665196336, -1.988899282836953 },
+		{ 0.0114917066978524, 0.9885082933023419, -1.987977015126093 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817692, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03408052293083974, 0.965919477069212, -1.961193955824454 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238863, 0.9081746139425293, -1.872878644988852 },
+		{ 0.09879694251940001, 0.9012030574874965, -1.860204915716481 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603366, 0.7490447935398723, -1.465007896944705 },
+		{ 0.2680721816824919, 0.7319278183190978, -1.405393705037292 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.004981863345433094, 0.9950181366545799, -1.994918613311871 },
+		{ 0.005379338591919128, 0.9946206614080949, -1.994504600669607 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.01064503348036799, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01487122455580887, 0.9851287754445013, -1.984237568594551 },
+		{ 0.01605134026837022, 0.9839486597316831, -1.982909784943262 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817692, 0.9684036435118276, -1.964346921817052 },
+		{ 0.04395356510094009, 0.956046434899069, -1.948147786861718 },
+		{ 0.04738521978786064, 0.9526147802122965, -1.94341899989187 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238863, 0.9081746139425293, -1.872878644988852 },
+		{ 0.1261498050452322, 0.8738501949551878, -1.806115820130426 },
+		{ 0.1355263185150873, 0.8644736814894968, -1.785942567984391 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603366, 0.7490447935398723, -1.465007896944705 },
+		{ 0.3327156145979807, 0.6672843854031534, -1.150702981609485 },
+		{ 0.353965647476904, 0.6460343525239944, -1.056611610501834 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.00356100806131926, 0.9964389919386875, -1.996388178459016 },
+		{ 0.004186436265890606, 0.9958135637341204, -1.995743311892902 },
+		{ 0.005927967936610307, 0.99407203206339, -1.993931051812916 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.01064503348036799, 0.9893549665196336, -1.988899282836953 },
+		{ 0.01250680988758247, 0.9874931901125362, -1.986863588301248 },
+		{ 0.01767871542918787, 0.9823212845710725, -1.981060054480943 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.03159635648817692, 0.9684036435118276, -1.964346921817052 },
+		{ 0.03705306207597796, 0.9629469379241449, -1.957352886825251 },
+		{ 0.05210399856180996, 0.9478960014381975, -1.936751542323232 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.09182538606238863, 0.9081746139425293, -1.872878644988852 },
+		{ 0.1070911523598911, 0.8929088476428892, -1.844543168082686 },
+		{ 0.1483089690117508, 0.8516910309882705, -1.757070590226838 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2509552064603366, 0.7490447935398723, -1.465007896944705 },
+		{ 0.2880965547495923, 0.7119034452504451, -1.331531936150793 },
+		{ 0.3822023935535329, 0.6177976064465229, -0.9236085502484143 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 },
+		{ 0.00213813037056729, 0.9978618696294329, -1.997843563667202 },
+		{ 0.003270790267049781, 0.996729209732952, -1.996686347436827 },
+		{ 0.004576111558501068, 0.9954238884415031, -1.995339933453512 },
+		{ 0.005927967936610307, 0.99407203206339, -1.993931051812916 },
+		{ 0.006400686081937342, 0.9935993139180634, -1.993434913778113 },
+		{ 0.009780331028531207, 0.9902196689717119, -1.989835175394499 },
+		{ 0.01366561456754154, 0.9863343854325303, -1.985582273885323 },
+		{ 0.01767871542918787, 0.9823212845710725, -1.981060054480943 },
+		{ 0.01907942696748694, 0.980920573032614, -1.979450541276753 },
+		{ 0.02905490044798032, 0.970945099552068, -1.96751906839557 },
+		{ 0.040439085875119, 0.9595609141250745, -1.952886540525939 },
+		{ 0.05210399856180996, 0.9478960014381975, -1.936751542323232 },
+		{ 0.05615309090685808, 0.943846909093188, -1.930877105010223 },
+		{ 0.08465672730903115, 0.9153432726910237, -1.88544821416823 },
+		{ 0.1164773138082877, 0.8835226861948419, -1.826046274758217 },
+		{ 0.1483089690117508, 0.8516910309882705, -1.757070590226838 },
+		{ 0.1591769341492267, 0.8408230658510152, -1.731262485254997 },
+		{ 0.2330766120632692, 0.7669233879368824, -1.52385549748784 },
+		{ 0.3103117425184871, 0.689688257481525, -1.244322404749831 },
+		{ 0.3822023935535329, 0.6177976064465229, -0.9236085502484143 },
+		{ 0.4055520265074006, 0.5944479734932402, -0.8068061056672411 }
+	},
+	.c_bpre9600022 = {
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001375038624242552, 0.9986249613757645, -1.998617393250046 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.00411944627890273, 0.9958805537211192, -1.995812534462474 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01230749923010782, 0.987692500769957, -1.987082866571412 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03646996988327159, 0.9635300301175647, -1.958112225661992 },
+		{ 0.0506828467362514, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1054679480049028, 0.894532051996404, -1.847658433198611 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001375038624242552, 0.9986249613757645, -1.998617393250046 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.00411944627890273, 0.9958805537211192, -1.995812534462474 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.008058136919491768, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01230749923010782, 0.987692500769957, -1.987082866571412 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03646996988327159, 0.9635300301175647, -1.958112225661992 },
+		{ 0.0506828467362514, 0.9493171532672823, -1.938779749978804 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1054679480049028, 0.894532051996404, -1.847658433198611 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1962373780006859, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005336757229044918, 0.994663242770956, -1.994549014599737 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1142864500480391, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1345262606296595, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002290679385273405, 0.9977093206147285, -1.997688307718037 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.006856311789447812, 0.9931436882105881, -1.992955006819352 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02042819858629897, 0.9795718014137987, -1.977885450183161 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.0506828467362514, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06004112526567734, 0.9399588747359331, -1.92510234201768 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1142864500480391, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1695252818528946, 0.8304747181471117, -1.705596468027286 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.0506828467362514, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1142864500480391, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001497172376370285, 0.9985028276236334, -1.998493854809566 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004484779620934166, 0.9955152203794041, -1.995434586845518 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.008058136919491768, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.0133941216071846, 0.9866058783928602, -1.985883452033073 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.03964656027948734, 0.9603534397206444, -1.953940632910485 },
+		{ 0.0506828467362514, 0.9493171532672823, -1.938779749978804 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1142864500480391, 0.8857135499523409, -1.830437666508658 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1962373780006859, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044918, 0.994663242770956, -1.994549014599737 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.0506828467362514, 0.9493171532672823, -1.938779749978804 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296595, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.001924524523528158, 0.9980754754764819, -1.998060646037268 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044918, 0.994663242770956, -1.994549014599737 },
+		{ 0.005762456300231793, 0.9942375436998655, -1.994104337029959 },
+		{ 0.008058136919491768, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01718797470260833, 0.9828120252974176, -1.981620135515566 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.0506828467362514, 0.9493171532672823, -1.938779749978804 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296595, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1444721989802731, 0.8555278010205735, -1.765903992144223 },
+		{ 0.1962373780006859, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.002494041794954015, 0.9975059582050525, -1.997481046187205 },
+		{ 0.002693296218219336, 0.9973067037817878, -1.997277649312739 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044918, 0.994663242770956, -1.994549014599737 },
+		{ 0.007463463924782311, 0.9925365360753734, -1.99231289039875 },
+		{ 0.008058136919491768, 0.9919418630805351, -1.991681080922646 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.02222372962979911, 0.9777762703702053, -1.975778662905154 },
+		{ 0.02398013329023842, 0.9760198667098412, -1.973691994054368 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.06520045199263018, 0.9347995480075864, -1.917235444262919 },
+		{ 0.07022923175382008, 0.9297707682485489, -1.909342288530238 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296595, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1831252327301608, 0.8168747672704507, -1.670223827743031 },
+		{ 0.1962373780006859, 0.8037626219998008, -1.634329113474992 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001782091956530137, 0.998217908043473, -1.998205193313834 },
+		{ 0.00209541351183734, 0.9979045864881677, -1.997887005049713 },
+		{ 0.002968389636823072, 0.997031610363177, -1.996996312678305 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.005336757229044918, 0.994663242770956, -1.994549014599737 },
+		{ 0.00627308071461736, 0.9937269192854421, -1.993569018896777 },
+		{ 0.008878774028719344, 0.9911212259714108, -1.990804493540739 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01592498075003302, 0.9840750192499694, -1.983052500980955 },
+		{ 0.01870140226125689, 0.981298597738805, -1.9798865070137 },
+		{ 0.02640049227714218, 0.9735995077228612, -1.970774606999846 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04701804112683493, 0.9529819588756806, -1.943929784902842 },
+		{ 0.05506145827350674, 0.9449385417279206, -1.932474833940748 },
+		{ 0.07712891962731305, 0.9228710803726979, -1.898147713707466 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1345262606296595, 0.8654737393704512, -1.788134457020435 },
+		{ 0.1562562917269183, 0.8437437082731019, -1.738312940086215 },
+		{ 0.2139989780881487, 0.7860010219118818, -1.582856885595029 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 },
+		{ 0.001069637247203921, 0.9989303627527961, -1.998925783809403 },
+		{ 0.001636734583572939, 0.9983632654164276, -1.998352541044356 },
+		{ 0.002290679385273405, 0.9977093206147285, -1.997688307718037 },
+		{ 0.002968389636823072, 0.997031610363177, -1.996996312678305 },
+		{ 0.003205480593886903, 0.9967945194061132, -1.996753353074436 },
+		{ 0.004902181204546266, 0.9950978187955756, -1.995001457469892 },
+		{ 0.006856311789447812, 0.9931436882105881, -1.992955006819352 },
+		{ 0.008878774028719344, 0.9911212259714108, -1.990804493540739 },
+		{ 0.009585655883097306, 0.9904143441169532, -1.9900450405969 },
+		{ 0.01463453503178843, 0.9853654649682361, -1.98450250301531 },
+		{ 0.02042819858629897, 0.9795718014137987, -1.977885450183161 },
+		{ 0.02640049227714218, 0.9735995077228612, -1.970774606999846 },
+		{ 0.0284821622362549, 0.9715178377637685, -1.968226482625675 },
+		{ 0.04326426183037841, 0.9567357381696494, -1.949085503047812 },
+		{ 0.06004112526567734, 0.9399588747359331, -1.92510234201768 },
+		{ 0.07712891962731305, 0.9228710803726979, -1.898147713707466 },
+		{ 0.08303595171305381, 0.9169640482870719, -1.888225560245654 },
+		{ 0.1242583783234111, 0.8757416216766691, -1.810083080211179 },
+		{ 0.1695252818528946, 0.8304747181471117, -1.705596468027286 },
+		{ 0.2139989780881487, 0.7860010219118818, -1.582856885595029 },
+		{ 0.2289954776444562, 0.7710045223558938, -1.536804252994784 }
+	},
+	.c_bpre4800080040 = {
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001375981285725969, 0.9999931200993797, -1.999962826930819 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004127915457362341, 0.9999793604401385, -1.99970672930481 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001238349077864997, 0.9999380825983807, -1.997484898963806 },
+		{ 0.001733665540765598, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.00371483097662807, 0.9998142591326046, -1.977773027411333 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.011142371526983, 0.9994428825257495, -1.804013680965982 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001375981285725969, 0.9999931200993797, -1.999962826930819 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004127915457362341, 0.9999793604401385, -1.99970672930481 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0008090619825076945, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001238349077864997, 0.9999380825983807, -1.997484898963806 },
+		{ 0.001733665540765598, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.00371483097662807, 0.9998142591326046, -1.977773027411333 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.011142371526983, 0.9994428825257495, -1.804013680965982 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02183321265847713, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.000178367434140717, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005350977123748492, 0.9999732451149836, -1.999515129198531 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.004815392055305209, 0.9997592324572451, -1.962769200588452 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003616, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01444260930265887, 0.9992778696297425, -1.674604262866392 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002293294188978367, 0.9999885335307168, -1.999904386490939 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0006879811762912414, 0.9999656009702266, -1.999208328059108 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001733665540765598, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002063869097579954, 0.9998968066241262, -1.993085046728886 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006190983648956903, 0.999690452145046, -1.938669137131863 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003616, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.01856715550472057, 0.9990716422303736, -1.472158915747857 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001733665540765598, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003616, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001498289268545128, 0.9999925085567669, -1.999956590627838 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004494870157425383, 0.9999775259204756, -1.99965427707565 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0008090619825076945, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001348418454625628, 0.999932579113055, -1.997024017675215 },
+		{ 0.001733665540765598, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004044982635310271, 0.9997977509755862, -1.973673194857432 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01213249379003616, 0.9993933756324886, -1.768396624752651 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02183321265847713, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.000178367434140717, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748492, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001733665540765598, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055305209, 0.9997592324572451, -1.962769200588452 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265887, 0.9992778696297425, -1.674604262866392 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.000178367434140717, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0001926371149365061, 0.9999903681523851, -1.999930993767595 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748492, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0005779055430794499, 0.99997110480092, -1.999436764056811 },
+		{ 0.0008090619825076945, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001733665540765598, 0.9999133167439224, -1.995106083804795 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055305209, 0.9997592324572451, -1.962769200588452 },
+		{ 0.005200615607480529, 0.9997399721187489, -1.956616949272647 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265887, 0.9992778696297425, -1.674604262866392 },
+		{ 0.01559759822103543, 0.9992201208171313, -1.622291265876923 },
+		{ 0.02183321265847713, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.000178367434140717, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0002497142545187204, 0.9999875142924568, -1.999887743047706 },
+		{ 0.0002696912601901127, 0.9999865154425878, -1.999870142481835 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748492, 0.9999732451149836, -1.999515129198531 },
+		{ 0.000749133962907502, 0.9999625434268561, -1.999064677081657 },
+		{ 0.0008090619825076945, 0.9999595469223466, -1.998912288193666 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.002247313554449345, 0.9998876343258949, -1.99181195255472 },
+		{ 0.002427087761703799, 0.9998786456763282, -1.990460277609724 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055305209, 0.9997592324572451, -1.962769200588452 },
+		{ 0.006741183218765366, 0.9996629410179696, -1.927380791926447 },
+		{ 0.007280434730446718, 0.9996359802264226, -1.915411868248778 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265887, 0.9992778696297425, -1.674604262866392 },
+		{ 0.02021673389308701, 0.9989891638418877, -1.379634339036823 },
+		{ 0.02183321265847713, 0.9989083397966778, -1.283126173459151 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.000178367434140717, 0.9999910816309115, -1.999940177743249 },
+		{ 0.0002097601833153738, 0.9999895119951877, -1.999919113162254 },
+		{ 0.0002972781997127801, 0.9999851360902526, -1.999843737785229 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0005350977123748492, 0.9999732451149836, -1.999515129198531 },
+		{ 0.0006292749721931283, 0.9999685362991947, -1.999334982524384 },
+		{ 0.0008918247359064992, 0.999955408868115, -1.998682959260549 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001605250188075069, 0.9999197374924035, -1.995798063661091 },
+		{ 0.001887760380897262, 0.9999056120310551, -1.99420623525709 },
+		{ 0.00267534540092856, 0.9998662327329656, -1.988424437354783 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004815392055305209, 0.9997592324572451, -1.962769200588452 },
+		{ 0.00566276053883011, 0.9997168631467475, -1.948622133922139 },
+		{ 0.008024962629718494, 0.9995987518775488, -1.897420304134652 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01444260930265887, 0.9992778696297425, -1.674604262866392 },
+		{ 0.01698343470526984, 0.9991508282821204, -1.55495520523531 },
+		{ 0.02406522917758147, 0.9987967385682133, -1.141122814478123 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 },
+		{ 0.0001070206878125991, 0.9999946489657299, -1.999976323461319 },
+		{ 0.0001638068903970985, 0.9999918096560561, -1.999948877324133 },
+		{ 0.0002293294188978367, 0.9999885335307168, -1.999904386490939 },
+		{ 0.0002972781997127801, 0.9999851360902526, -1.999843737785229 },
+		{ 0.0003210603454233985, 0.9999839469830901, -1.999819020340863 },
+		{ 0.0004914195495488072, 0.999975429120327, -1.999589050812929 },
+		{ 0.0006879811762912414, 0.9999656009702266, -1.999208328059108 },
+		{ 0.0008918247359064992, 0.999955408868115, -1.998682959260549 },
+		{ 0.0009631670203265881, 0.9999518416896416, -1.998467686919606 },
+		{ 0.001474213677588006, 0.9999262893357636, -1.996449881099182 },
+		{ 0.002063869097579954, 0.9998968066241262, -1.993085046728886 },
+		{ 0.00267534540092856, 0.9998662327329656, -1.988424437354783 },
+		{ 0.002889356577960396, 0.9998555321900823, -1.986512025392025 },
+		{ 0.004422317593624389, 0.9997788841430876, -1.968565937811832 },
+		{ 0.006190983648956903, 0.999690452145046, -1.938669137131863 },
+		{ 0.008024962629718494, 0.9995987518775488, -1.897420304134652 },
+		{ 0.00866682503628508, 0.9995666588529682, -1.880558108737762 },
+		{ 0.01326401946345747, 0.9993367990951183, -1.724296816384703 },
+		{ 0.01856715550472057, 0.9990716422303736, -1.472158915747857 },
+		{ 0.02406522917758147, 0.9987967385682133, -1.141122814478123 },
+		{ 0.02598920966063859, 0.9987005398311792, -1.011361816575309 }
+	},
+	.c_bpre9600080040 = {
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.879918261637076e-05, 0.9999965600437735, -1.999988986724268 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002063968378580633, 0.9999896801668197, -1.999921520869871 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006191841236475288, 0.9999690408199551, -1.999355641351559 },
+		{ 0.0008668515561691687, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.00185750174580942, 0.9999071252534431, -1.994388948516752 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.005571961930946093, 0.9997214024545787, -1.950245238340118 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 6.879918261637076e-05, 0.9999965600437735, -1.999988986724268 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002063968378580633, 0.9999896801668197, -1.999921520869871 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006191841236475288, 0.9999690408199551, -1.999355641351559 },
+		{ 0.0008668515561691687, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.00185750174580942, 0.9999071252534431, -1.994388948516752 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.005571961930946093, 0.9997214024545787, -1.950245238340118 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 8.918391591496197e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002675506457704425, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383024, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008026411998669711, 0.9999598679409105, -1.998929163213287 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002407840968865236, 0.999879608981624, -1.990610061937231 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460934, 0.9996966418031464, -1.941079574276902 },
+		{ 0.007222608803103867, 0.999638869607291, -1.916737335335853 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001146650381506545, 0.9999942667489234, -1.999973229818036 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003439935464365713, 0.999982800337199, -1.999793471519887 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383024, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008668515561691687, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001031961172360522, 0.9999484019808854, -1.998244692397603 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003095731412274959, 0.9998452140931845, -1.984530061672989 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460934, 0.9996966418031464, -1.941079574276902 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.009285733373454425, 0.9995357133341326, -1.863123820583315 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383024, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008668515561691687, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460934, 0.9996966418031464, -1.941079574276902 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 7.491460373136694e-05, 0.9999962542713682, -1.999987274752161 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002247447705970371, 0.9999887628971018, -1.999907948599101 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0006742205916383024, 0.9999662889883114, -1.999239004134489 },
+		{ 0.0008668515561691687, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002022593589723311, 0.9998988703741923, -1.993356700561298 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006067167157460934, 0.9996966418031464, -1.941079574276902 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.918391591496197e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704425, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669711, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0008668515561691687, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865236, 0.999879608981624, -1.990610061937231 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.007222608803103867, 0.999638869607291, -1.916737335335853 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.918391591496197e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 9.631878940227642e-05, 0.9999951840645958, -1.999980340377572 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704425, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0002889548589148728, 0.999985552296092, -1.99985196168342 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669711, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0008668515561691687, 0.9999566574326721, -1.998754461826764 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865236, 0.999879608981624, -1.990610061937231 },
+		{ 0.002600476863858049, 0.9998699776064631, -1.989059301445751 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.007222608803103867, 0.999638869607291, -1.916737335335853 },
+		{ 0.007800320233993908, 0.9996099843524628, -1.903026865002523 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.918391591496197e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 0.0001248575169938711, 0.9999937571267417, -1.999968814082157 },
+		{ 0.0001348460846822813, 0.9999932576985645, -1.999964164148689 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704425, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0003745704890205105, 0.9999812715380505, -1.999756790251714 },
+		{ 0.0004045350824713036, 0.9999797732566128, -1.999717938787118 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669711, 0.9999598679409105, -1.998929163213287 },
+		{ 0.001123688344113333, 0.9999438155846032, -1.997923818299962 },
+		{ 0.001213580700282687, 0.9999393209971936, -1.997583269756928 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865236, 0.999879608981624, -1.990610061937231 },
+		{ 0.003370875679306612, 0.9998314563054962, -1.981676993117409 },
+		{ 0.003640548703308562, 0.9998179735463963, -1.978647976786009 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.007222608803103867, 0.999638869607291, -1.916737335335853 },
+		{ 0.01011092271413867, 0.9994944541326319, -1.83810317634653 },
+		{ 0.01091958726271276, 0.9994540208517237, -1.811638559021681 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.918391591496197e-05, 0.9999955408055136, -1.999982814764736 },
+		{ 0.0001048803666481015, 0.999994755983844, -1.999977156152025 },
+		{ 0.0001486396522029892, 0.9999925680175092, -1.999957217997487 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.0002675506457704425, 0.9999866224680127, -1.999872089443367 },
+		{ 0.0003146399610436026, 0.9999842680258499, -1.999825872063896 },
+		{ 0.000445917338989405, 0.9999777041855058, -1.999659562933581 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0008026411998669711, 0.9999598679409105, -1.998929163213287 },
+		{ 0.0009439024642344614, 0.9999528049018388, -1.99852741914239 },
+		{ 0.001337717437656104, 0.999933114129623, -1.997070520944823 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002407840968865236, 0.999879608981624, -1.990610061937231 },
+		{ 0.002831580714816426, 0.999858421551145, -1.987042771879988 },
+		{ 0.00401288389578005, 0.999799355809729, -1.974086881771594 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.007222608803103867, 0.999638869607291, -1.916737335335853 },
+		{ 0.008493520850007381, 0.9995753239661933, -1.885233638890376 },
+		{ 0.01203623636336285, 0.9993981881953824, -1.771981734830587 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 },
+		{ 5.351041548811428e-05, 0.9999973244792858, -1.999992743091807 },
+		{ 8.190361289476763e-05, 0.9999959048196428, -1.999985171685885 },
+		{ 0.0001146650381506545, 0.9999942667489234, -1.999973229818036 },
+		{ 0.0001486396522029892, 0.9999925680175092, -1.999957217997487 },
+		{ 0.0001605308169597262, 0.9999919734593324, -1.999950741208276 },
+		{ 0.000245711284121601, 0.9999877144846965, -1.999891116981706 },
+		{ 0.0003439935464365713, 0.999982800337199, -1.999793471519887 },
+		{ 0.000445917338989405, 0.9999777041855058, -1.999659562933581 },
+		{ 0.0004815893083607977, 0.9999759205549109, -1.999604842970141 },
+		{ 0.0007371204224551656, 0.9999631439886988, -1.999093836986588 },
+		{ 0.001031961172360522, 0.9999484019808854, -1.998244692397603 },
+		{ 0.001337717437656104, 0.999933114129623, -1.997070520944823 },
+		{ 0.001444730470133754, 0.999927763485984, -1.996588979329848 },
+		{ 0.002211281040894106, 0.9998894359593402, -1.992070483147097 },
+		{ 0.003095731412274959, 0.9998452140931845, -1.984530061672989 },
+		{ 0.00401288389578005, 0.999799355809729, -1.974086881771594 },
+		{ 0.004333882081379363, 0.9997833059483281, -1.969803219113973 },
+		{ 0.006633109685225794, 0.9996683445498903, -1.929671866678435 },
+		{ 0.009285733373454425, 0.9995357133341326, -1.863123820583315 },
+		{ 0.01203623636336285, 0.9993981881953824, -1.771981734830587 },
+		{ 0.01299882906822584, 0.9993500587037454, -1.734953036344066 }
+	},
+},
+};
+
+extern const int NUM_REFERENCE_SCALES = sizeof(REFERENCE_SCALES) / sizeof(REFERENCE_SCALES[0]);
@@ -0,0 +1,15 @@
+#pragma once
+
+// One bank as the scale files held it before the tables were generated
+struct ScaleReference {
+	const char *name;
+	float c_maxq48000[231];
+	float c_maxq96000[231];
+	float c_bpre4800022[231][3];		// Low Q
+	float c_bpre9600022[231][3];
+	float c_bpre4800080040[231][3];		// High Q
+	float c_bpre9600080040[231][3];
+};
+
+extern const ScaleReference REFERENCE_SCALES[];
+extern const int NUM_REFERENCE_SCALES;
@@ -0,0 +1,90 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "scales/Scales.hpp"
+#include "ScalesReference.hpp"
+
+// Compares the tables design_bank generates with the literals the scale files held before,
+// for the scales in ScalesReference.cpp.
+// Run with `make test-scales`
+
+// Worst deviation allowed. MaxQ is relative, BpRe absolute, as its c2 passes through zero.
+// The largest BpRe deviation over all the old scale files was 1.3e-5
+static const double MAXQ_TOLERANCE	= 1e-6;
+static const double BPRE_TOLERANCE	= 1.5e-5;
+
+struct Worst {
+	double deviation = 0.0;
+	int note = 0;
+
+	void update(double d, int i) {
+		if (d > deviation) {
+			deviation = d;
+			note = i;
+		}
+	}
+};
+
+static bool check(const char *scale, const char *table, const Worst &worst, double tolerance) {
+	bool ok = worst.deviation <= tolerance;
+	printf("%-24s %-18s worst deviation %.3g at note %d, tolerance %.3g: %s\n", scale, table, worst.deviation, worst.note, tolerance, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+static Worst compare_maxq(const float *value, const float *reference) {
+	Worst worst;
+	for (int i = 0; i < 231; i++) {
+		worst.update(fabs(value[i] - reference[i]) / fabs(reference[i]), i);
+	}
+	return worst;
+}
+
+// The nudge neighbour of a note is the next one of its scale, the 21st is its own
+static Worst compare_bpre(const BpreRecord *r, bool hiq, const float (*reference)[3]) {
+	Worst worst;
+	for (int i = 0; i < 231; i++) {
+		int next = (i % 21) < 20 ? i + 1 : i;
+		const float *c = hiq ? r[i].hiq : r[i].loq;
+		const float *n = hiq ? r[i].hiq_next : r[i].loq_next;
+		for (int k = 0; k < 3; k++) {
+			worst.update(fabs(c[k] - reference[i][k]), i);
+			worst.update(fabs(n[k] - reference[next][k]), i);
+		}
+	}
+	return worst;
+}
+
+int main(void) {
+
+	const ScaleSet &scales = ScaleSet::get();
+	bool ok = true;
+
+	for (int s = 0; s < NUM_REFERENCE_SCALES; s++) {
+
+		const ScaleReference &ref = REFERENCE_SCALES[s];
+
+		const Scale *scale = NULL;
+		for (const Scale *candidate : scales.full) {
+			if (strcmp(candidate->name, ref.name) == 0) {
+				scale = candidate;
+			}
+		}
+		if (!scale) {
+			printf("%-24s not in the scale set: FAILED\n", ref.name);
+			ok = false;
+			continue;
+		}
+
+		ok &= check(ref.name, "c_maxq48000", compare_maxq(scale->c_maxq48000, ref.c_maxq48000), MAXQ_TOLERANCE);
+		ok &= check(ref.name, "c_maxq96000", compare_maxq(scale->c_maxq96000, ref.c_maxq96000), MAXQ_TOLERANCE);
+		ok &= check(ref.name, "c_bpre4800022", compare_bpre(scale->bpre.r48000, false, ref.c_bpre4800022), BPRE_TOLERANCE);
+		ok &= check(ref.name, "c_bpre9600022", compare_bpre(scale->bpre.r96000, false, ref.c_bpre9600022), BPRE_TOLERANCE);
+		ok &= check(ref.name, "c_bpre4800080040", compare_bpre(scale->bpre.r48000, true, ref.c_bpre4800080040), BPRE_TOLERANCE);
+		ok &= check(ref.name, "c_bpre9600080040", compare_bpre(scale->bpre.r96000, true, ref.c_bpre9600080040), BPRE_TOLERANCE);
+
+	}
+
+	return ok ? 0 : 1;
+
+}
@@ -1,6 +1,7 @@
+// Firmware lookup tables as they were before src/Tables.cpp computed them, kept as the reference for TablesTest
 #include <inttypes.h>
 
-float exp_4096[4096] = {
+extern const float REFERENCE_EXP_4096[4096] = {
 0.999999,
 0.998,
 0.997,
@@ -4099,7 +4100,7 @@ float exp_4096[4096] = {
 0.0001630267
 };
 
-float log_4096[4096]={
+extern const float REFERENCE_LOG_4096[4096]={
 0.25,
 0.25,
 0.25,
@@ -8198,4106 +8199,7 @@ float log_4096[4096]={
 1
 };
 
-float exp_1voct[4096]={
-1,
-1.0016768025,
-1.0033564168,
-1.0050388474,
-1.0067240991,
-1.0084121766,
-1.0101030847,
-1.0117968281,
-1.0134934116,
-1.01519284,
-1.0168951179,
-1.0186002502,
-1.0203082417,
-1.0220190972,
-1.0237328214,
-1.0254494192,
-1.0271688954,
-1.0288912548,
-1.0306165023,
-1.0323446427,
-1.0340756808,
-1.0358096215,
-1.0375464698,
-1.0392862303,
-1.0410289081,
-1.042774508,
-1.044523035,
-1.0462744939,
-1.0480288896,
-1.0497862271,
-1.0515465114,
-1.0533097472,
-1.0550759397,
-1.0568450937,
-1.0586172143,
-1.0603923063,
-1.0621703748,
-1.0639514248,
-1.0657354613,
-1.0675224892,
-1.0693125136,
-1.0711055396,
-1.0729015721,
-1.0747006162,
-1.0765026769,
-1.0783077593,
-1.0801158685,
-1.0819270096,
-1.0837411875,
-1.0855584075,
-1.0873786746,
-1.089201994,
-1.0910283706,
-1.0928578098,
-1.0946903166,
-1.0965258961,
-1.0983645535,
-1.100206294,
-1.1020511227,
-1.1038990448,
-1.1057500655,
-1.1076041901,
-1.1094614236,
-1.1113217713,
-1.1131852385,
-1.1150518304,
-1.1169215521,
-1.118794409,
-1.1206704063,
-1.1225495493,
-1.1244318433,
-1.1263172935,
-1.1282059052,
-1.1300976837,
-1.1319926344,
-1.1338907625,
-1.1357920734,
-1.1376965725,
-1.139604265,
-1.1415151563,
-1.1434292518,
-1.1453465569,
-1.1472670769,
-1.1491908173,
-1.1511177834,
-1.1530479806,
-1.1549814144,
-1.1569180902,
-1.1588580134,
-1.1608011895,
-1.1627476239,
-1.164697322,
-1.1666502895,
-1.1686065316,
-1.1705660541,
-1.1725288622,
-1.1744949616,
-1.1764643577,
-1.1784370562,
-1.1804130624,
-1.1823923821,
-1.1843750206,
-1.1863609837,
-1.1883502768,
-1.1903429056,
-1.1923388756,
-1.1943381924,
-1.1963408618,
-1.1983468892,
-1.2003562803,
-1.2023690408,
-1.2043851762,
-1.2064046924,
-1.2084275948,
-1.2104538893,
-1.2124835815,
-1.214516677,
-1.2165531817,
-1.2185931011,
-1.2206364412,
-1.2226832075,
-1.2247334058,
-1.2267870419,
-1.2288441215,
-1.2309046505,
-1.2329686345,
-1.2350360795,
-1.2371069911,
-1.2391813753,
-1.2412592377,
-1.2433405844,
-1.2454254211,
-1.2475137536,
-1.2496055878,
-1.2517009297,
-1.253799785,
-1.2559021596,
-1.2580080596,
-1.2601174907,
-1.2622304589,
-1.2643469702,
-1.2664670304,
-1.2685906455,
-1.2707178216,
-1.2728485644,
-1.2749828802,
-1.2771207747,
-1.2792622541,
-1.2814073243,
-1.2835559913,
-1.2857082613,
-1.2878641402,
-1.2900236341,
-1.292186749,
-1.294353491,
-1.2965238662,
-1.2986978808,
-1.3008755407,
-1.3030568521,
-1.3052418211,
-1.307430454,
-1.3096227567,
-1.3118187354,
-1.3140183964,
-1.3162217458,
-1.3184287898,
-1.3206395346,
-1.3228539863,
-1.3250721512,
-1.3272940356,
-1.3295196456,
-1.3317489875,
-1.3339820676,
-1.3362188922,
-1.3384594674,
-1.3407037997,
-1.3429518952,
-1.3452037604,
-1.3474594015,
-1.3497188248,
-1.3519820368,
-1.3542490437,
-1.356519852,
-1.3587944679,
-1.3610728979,
-1.3633551484,
-1.3656412258,
-1.3679311365,
-1.3702248869,
-1.3725224835,
-1.3748239327,
-1.377129241,
-1.3794384148,
-1.3817514606,
-1.384068385,
-1.3863891944,
-1.3887138953,
-1.3910424943,
-1.3933749979,
-1.3957114127,
-1.3980517451,
-1.4003960019,
-1.4027441894,
-1.4050963145,
-1.4074523836,
-1.4098124033,
-1.4121763803,
-1.4145443213,
-1.4169162328,
-1.4192921216,
-1.4216719942,
-1.4240558574,
-1.4264437179,
-1.4288355824,
-1.4312314575,
-1.4336313501,
-1.4360352668,
-1.4384432144,
-1.4408551996,
-1.4432712293,
-1.4456913102,
-1.448115449,
-1.4505436527,
-1.452975928,
-1.4554122817,
-1.4578527208,
-1.4602972519,
-1.4627458821,
-1.4651986181,
-1.4676554669,
-1.4701164353,
-1.4725815303,
-1.4750507587,
-1.4775241276,
-1.4800016438,
-1.4824833144,
-1.4849691462,
-1.4874591462,
-1.4899533215,
-1.492451679,
-1.4949542258,
-1.4974609688,
-1.4999719152,
-1.5024870719,
-1.5050064461,
-1.5075300447,
-1.510057875,
-1.5125899438,
-1.5151262585,
-1.5176668261,
-1.5202116537,
-1.5227607485,
-1.5253141176,
-1.5278717682,
-1.5304337074,
-1.5329999426,
-1.5355704808,
-1.5381453293,
-1.5407244953,
-1.5433079861,
-1.5458958088,
-1.5484879708,
-1.5510844794,
-1.5536853418,
-1.5562905654,
-1.5589001574,
-1.5615141251,
-1.564132476,
-1.5667552173,
-1.5693823564,
-1.5720139008,
-1.5746498577,
-1.5772902346,
-1.5799350389,
-1.582584278,
-1.5852379593,
-1.5878960904,
-1.5905586786,
-1.5932257314,
-1.5958972564,
-1.598573261,
-1.6012537527,
-1.6039387391,
-1.6066282276,
-1.6093222259,
-1.6120207415,
-1.614723782,
-1.617431355,
-1.620143468,
-1.6228601287,
-1.6255813447,
-1.6283071236,
-1.6310374732,
-1.6337724009,
-1.6365119147,
-1.639256022,
-1.6420047307,
-1.6447580484,
-1.6475159829,
-1.6502785419,
-1.6530457332,
-1.6558175645,
-1.6585940436,
-1.6613751783,
-1.6641609764,
-1.6669514458,
-1.6697465942,
-1.6725464296,
-1.6753509597,
-1.6781601924,
-1.6809741357,
-1.6837927974,
-1.6866161855,
-1.6894443078,
-1.6922771723,
-1.695114787,
-1.6979571598,
-1.7008042987,
-1.7036562117,
-1.7065129067,
-1.7093743919,
-1.7122406753,
-1.7151117648,
-1.7179876686,
-1.7208683947,
-1.7237539512,
-1.7266443462,
-1.7295395878,
-1.7324396842,
-1.7353446435,
-1.7382544738,
-1.7411691833,
-1.7440887803,
-1.7470132728,
-1.7499426691,
-1.7528769774,
-1.755816206,
-1.7587603631,
-1.7617094569,
-1.7646634958,
-1.7676224881,
-1.770586442,
-1.7735553658,
-1.776529268,
-1.7795081568,
-1.7824920406,
-1.7854809278,
-1.7884748268,
-1.7914737459,
-1.7944776937,
-1.7974866784,
-1.8005007087,
-1.8035197928,
-1.8065439394,
-1.8095731569,
-1.8126074538,
-1.8156468386,
-1.8186913198,
-1.8217409061,
-1.8247956059,
-1.8278554278,
-1.8309203804,
-1.8339904724,
-1.8370657123,
-1.8401461087,
-1.8432316704,
-1.846322406,
-1.8494183241,
-1.8525194335,
-1.8556257428,
-1.8587372607,
-1.8618539961,
-1.8649759576,
-1.8681031541,
-1.8712355942,
-1.8743732868,
-1.8775162407,
-1.8806644647,
-1.8838179677,
-1.8869767585,
-1.8901408459,
-1.8933102389,
-1.8964849463,
-1.8996649771,
-1.9028503402,
-1.9060410445,
-1.909237099,
-1.9124385126,
-1.9156452944,
-1.9188574533,
-1.9220749984,
-1.9252979386,
-1.9285262831,
-1.9317600409,
-1.934999221,
-1.9382438327,
-1.9414938849,
-1.9447493868,
-1.9480103475,
-1.9512767762,
-1.9545486821,
-1.9578260743,
-1.961108962,
-1.9643973545,
-1.967691261,
-1.9709906907,
-1.9742956529,
-1.9776061569,
-1.980922212,
-1.9842438274,
-1.9875710125,
-1.9909037766,
-1.9942421292,
-1.9975860794,
-2.0009356369,
-2.0042908108,
-2.0076516108,
-2.0110180461,
-2.0143901263,
-2.0177678608,
-2.0211512591,
-2.0245403307,
-2.027935085,
-2.0313355318,
-2.0347416804,
-2.0381535404,
-2.0415711214,
-2.0449944331,
-2.048423485,
-2.0518582867,
-2.0552988479,
-2.0587451782,
-2.0621972874,
-2.0656551851,
-2.0691188809,
-2.0725883848,
-2.0760637062,
-2.0795448552,
-2.0830318413,
-2.0865246744,
-2.0900233643,
-2.0935279208,
-2.0970383537,
-2.100554673,
-2.1040768884,
-2.1076050099,
-2.1111390473,
-2.1146790107,
-2.1182249098,
-2.1217767547,
-2.1253345554,
-2.1288983218,
-2.1324680639,
-2.1360437918,
-2.1396255155,
-2.143213245,
-2.1468069904,
-2.1504067619,
-2.1540125694,
-2.1576244232,
-2.1612423333,
-2.16486631,
-2.1684963633,
-2.1721325035,
-2.1757747408,
-2.1794230855,
-2.1830775477,
-2.1867381376,
-2.1904048657,
-2.1940777422,
-2.1977567773,
-2.2014419815,
-2.205133365,
-2.2088309383,
-2.2125347116,
-2.2162446955,
-2.2199609002,
-2.2236833363,
-2.2274120142,
-2.2311469443,
-2.2348881372,
-2.2386356033,
-2.2423893532,
-2.2461493974,
-2.2499157464,
-2.2536884109,
-2.2574674014,
-2.2612527284,
-2.2650444028,
-2.268842435,
-2.2726468358,
-2.2764576158,
-2.2802747857,
-2.2840983563,
-2.2879283382,
-2.2917647423,
-2.2956075793,
-2.2994568599,
-2.303312595,
-2.3071747954,
-2.311043472,
-2.3149186356,
-2.3188002971,
-2.3226884673,
-2.3265831573,
-2.3304843778,
-2.33439214,
-2.3383064547,
-2.3422273329,
-2.3461547856,
-2.350088824,
-2.3540294589,
-2.3579767015,
-2.3619305628,
-2.365891054,
-2.3698581862,
-2.3738319704,
-2.3778124179,
-2.3817995398,
-2.3857933473,
-2.3897938517,
-2.3938010641,
-2.3978149959,
-2.4018356581,
-2.4058630623,
-2.4098972196,
-2.4139381414,
-2.417985839,
-2.4220403239,
-2.4261016072,
-2.4301697006,
-2.4342446153,
-2.4383263629,
-2.4424149548,
-2.4465104024,
-2.4506127173,
-2.4547219109,
-2.4588379949,
-2.4629609807,
-2.4670908799,
-2.4712277042,
-2.4753714651,
-2.4795221743,
-2.4836798434,
-2.4878444841,
-2.4920161081,
-2.496194727,
-2.5003803527,
-2.5045729968,
-2.5087726712,
-2.5129793876,
-2.5171931579,
-2.5214139938,
-2.5256419072,
-2.52987691,
-2.534119014,
-2.5383682312,
-2.5426245735,
-2.5468880529,
-2.5511586813,
-2.5554364707,
-2.5597214331,
-2.5640135805,
-2.568312925,
-2.5726194786,
-2.5769332535,
-2.5812542618,
-2.5855825155,
-2.5899180268,
-2.594260808,
-2.5986108711,
-2.6029682285,
-2.6073328922,
-2.6117048746,
-2.616084188,
-2.6204708447,
-2.6248648569,
-2.6292662369,
-2.6336749973,
-2.6380911502,
-2.6425147082,
-2.6469456836,
-2.6513840888,
-2.6558299364,
-2.6602832388,
-2.6647440085,
-2.6692122581,
-2.673688,
-2.6781712469,
-2.6826620112,
-2.6871603057,
-2.691666143,
-2.6961795356,
-2.7007004963,
-2.7052290378,
-2.7097651727,
-2.7143089139,
-2.718860274,
-2.7234192658,
-2.7279859022,
-2.7325601959,
-2.7371421598,
-2.7417318068,
-2.7463291496,
-2.7509342013,
-2.7555469748,
-2.760167483,
-2.7647957389,
-2.7694317554,
-2.7740755456,
-2.7787271226,
-2.7833864993,
-2.7880536889,
-2.7927287044,
-2.797411559,
-2.8021022658,
-2.8068008381,
-2.8115072889,
-2.8162216314,
-2.8209438791,
-2.8256740449,
-2.8304121424,
-2.8351581847,
-2.8399121851,
-2.8446741571,
-2.849444114,
-2.8542220691,
-2.859008036,
-2.8638020279,
-2.8686040585,
-2.8734141411,
-2.8782322892,
-2.8830585165,
-2.8878928363,
-2.8927352624,
-2.8975858083,
-2.9024444875,
-2.9073113138,
-2.9121863009,
-2.9170694623,
-2.9219608118,
-2.9268603631,
-2.93176813,
-2.9366841263,
-2.9416083657,
-2.9465408621,
-2.9514816293,
-2.9564306813,
-2.9613880318,
-2.9663536947,
-2.9713276842,
-2.976310014,
-2.9813006982,
-2.9862997508,
-2.9913071859,
-2.9963230174,
-3.0013472594,
-3.0063799262,
-3.0114210317,
-3.0164705902,
-3.0215286157,
-3.0265951226,
-3.031670125,
-3.0367536372,
-3.0418456734,
-3.046946248,
-3.0520553753,
-3.0571730695,
-3.0622993451,
-3.0674342164,
-3.0725776979,
-3.077729804,
-3.0828905492,
-3.088059948,
-3.0932380147,
-3.0984247641,
-3.1036202107,
-3.1088243689,
-3.1140372536,
-3.1192588792,
-3.1244892604,
-3.129728412,
-3.1349763485,
-3.1402330849,
-3.1454986357,
-3.1507730158,
-3.15605624,
-3.1613483232,
-3.1666492801,
-3.1719591257,
-3.1772778748,
-3.1826055425,
-3.1879421436,
-3.1932876931,
-3.198642206,
-3.2040056974,
-3.2093781823,
-3.2147596758,
-3.220150193,
-3.2255497491,
-3.2309583591,
-3.2363760383,
-3.2418028019,
-3.2472386651,
-3.2526836432,
-3.2581377514,
-3.2636010051,
-3.2690734196,
-3.2745550102,
-3.2800457924,
-3.2855457815,
-3.2910549931,
-3.2965734425,
-3.3021011452,
-3.3076381168,
-3.3131843729,
-3.3187399289,
-3.3243048004,
-3.3298790032,
-3.3354625528,
-3.3410554649,
-3.3466577552,
-3.3522694395,
-3.3578905334,
-3.3635210528,
-3.3691610135,
-3.3748104312,
-3.380469322,
-3.3861377015,
-3.3918155859,
-3.3975029909,
-3.4031999326,
-3.4089064269,
-3.4146224899,
-3.4203481375,
-3.426083386,
-3.4318282514,
-3.4375827497,
-3.4433468972,
-3.4491207101,
-3.4549042045,
-3.4606973967,
-3.4665003029,
-3.4723129394,
-3.4781353226,
-3.4839674688,
-3.4898093943,
-3.4956611156,
-3.501522649,
-3.5073940111,
-3.5132752184,
-3.5191662872,
-3.5250672342,
-3.5309780759,
-3.5368988289,
-3.5428295099,
-3.5487701355,
-3.5547207223,
-3.560681287,
-3.5666518465,
-3.5726324174,
-3.5786230165,
-3.5846236607,
-3.5906343668,
-3.5966551517,
-3.6026860322,
-3.6087270253,
-3.614778148,
-3.6208394172,
-3.6269108499,
-3.6329924633,
-3.6390842743,
-3.6451863001,
-3.6512985578,
-3.6574210645,
-3.6635538375,
-3.6696968939,
-3.675850251,
-3.682013926,
-3.6881879364,
-3.6943722993,
-3.7005670322,
-3.7067721524,
-3.7129876774,
-3.7192136246,
-3.7254500115,
-3.7316968555,
-3.7379541743,
-3.7442219854,
-3.7505003064,
-3.7567891549,
-3.7630885485,
-3.769398505,
-3.775719042,
-3.7820501773,
-3.7883919287,
-3.7947443139,
-3.8011073508,
-3.8074810573,
-3.8138654513,
-3.8202605506,
-3.8266663732,
-3.8330829371,
-3.8395102603,
-3.8459483609,
-3.8523972569,
-3.8588569665,
-3.8653275077,
-3.8718088987,
-3.8783011577,
-3.884804303,
-3.8913183527,
-3.8978433253,
-3.9043792389,
-3.9109261119,
-3.9174839628,
-3.9240528099,
-3.9306326716,
-3.9372235665,
-3.943825513,
-3.9504385297,
-3.9570626351,
-3.9636978478,
-3.9703441864,
-3.9770016697,
-3.9836703162,
-3.9903501448,
-3.9970411741,
-4.0037434229,
-4.01045691,
-4.0171816544,
-4.0239176748,
-4.0306649903,
-4.0374236196,
-4.0441935818,
-4.0509748959,
-4.0577675809,
-4.0645716559,
-4.0713871401,
-4.0782140524,
-4.0850524121,
-4.0919022384,
-4.0987635505,
-4.1056363677,
-4.1125207092,
-4.1194165944,
-4.1263240426,
-4.1332430733,
-4.1401737058,
-4.1471159596,
-4.1540698542,
-4.1610354091,
-4.1680126439,
-4.1750015781,
-4.1820022314,
-4.1890146234,
-4.1960387738,
-4.2030747023,
-4.2101224287,
-4.2171819727,
-4.2242533542,
-4.231336593,
-4.238431709,
-4.245538722,
-4.2526576522,
-4.2597885194,
-4.2669313436,
-4.274086145,
-4.2812529435,
-4.2884317593,
-4.2956226126,
-4.3028255236,
-4.3100405124,
-4.3172675993,
-4.3245068046,
-4.3317581486,
-4.3390216517,
-4.3462973343,
-4.3535852167,
-4.3608853195,
-4.3681976631,
-4.3755222681,
-4.382859155,
-4.3902083444,
-4.3975698569,
-4.4049437133,
-4.4123299341,
-4.4197285402,
-4.4271395523,
-4.4345629912,
-4.4419988777,
-4.4494472327,
-4.4569080772,
-4.464381432,
-4.4718673181,
-4.4793657567,
-4.4868767686,
-4.494400375,
-4.501936597,
-4.5094854557,
-4.5170469724,
-4.5246211683,
-4.5322080646,
-4.5398076826,
-4.5474200437,
-4.5550451692,
-4.5626830806,
-4.5703337992,
-4.5779973466,
-4.5856737442,
-4.5933630136,
-4.6010651764,
-4.6087802542,
-4.6165082687,
-4.6242492415,
-4.6320031944,
-4.6397701492,
-4.6475501276,
-4.6553431515,
-4.6631492427,
-4.6709684233,
-4.678800715,
-4.68664614,
-4.6945047202,
-4.7023764776,
-4.7102614345,
-4.7181596129,
-4.7260710349,
-4.7339957229,
-4.741933699,
-4.7498849855,
-4.7578496047,
-4.7658275791,
-4.7738189309,
-4.7818236827,
-4.7898418568,
-4.7978734758,
-4.8059185623,
-4.8139771388,
-4.8220492279,
-4.8301348523,
-4.8382340348,
-4.8463467979,
-4.8544731646,
-4.8626131576,
-4.8707667997,
-4.8789341139,
-4.887115123,
-4.8953098501,
-4.9035183181,
-4.9117405501,
-4.9199765692,
-4.9282263985,
-4.936490061,
-4.9447675802,
-4.953058979,
-4.9613642809,
-4.9696835092,
-4.9780166872,
-4.9863638383,
-4.9947249858,
-5.0031001534,
-5.0114893645,
-5.0198926426,
-5.0283100114,
-5.0367414945,
-5.0451871154,
-5.053646898,
-5.062120866,
-5.0706090432,
-5.0791114534,
-5.0876281204,
-5.0961590682,
-5.1047043207,
-5.1132639019,
-5.1218378358,
-5.1304261466,
-5.1390288582,
-5.1476459949,
-5.1562775808,
-5.1649236402,
-5.1735841973,
-5.1822592765,
-5.190948902,
-5.1996530984,
-5.2083718899,
-5.2171053012,
-5.2258533567,
-5.2346160809,
-5.2433934985,
-5.252185634,
-5.2609925123,
-5.2698141579,
-5.2786505958,
-5.2875018505,
-5.2963679471,
-5.3052489104,
-5.3141447653,
-5.3230555367,
-5.3319812498,
-5.3409219296,
-5.3498776011,
-5.3588482895,
-5.3678340199,
-5.3768348177,
-5.385850708,
-5.3948817162,
-5.4039278676,
-5.4129891876,
-5.4220657017,
-5.4311574353,
-5.4402644139,
-5.4493866631,
-5.4585242086,
-5.4676770759,
-5.4768452907,
-5.4860288789,
-5.4952278661,
-5.5044422781,
-5.513672141,
-5.5229174805,
-5.5321783226,
-5.5414546933,
-5.5507466186,
-5.5600541247,
-5.5693772376,
-5.5787159836,
-5.5880703887,
-5.5974404794,
-5.6068262819,
-5.6162278225,
-5.6256451276,
-5.6350782237,
-5.6445271372,
-5.6539918947,
-5.6634725227,
-5.6729690478,
-5.6824814968,
-5.6920098963,
-5.701554273,
-5.7111146537,
-5.7206910653,
-5.7302835346,
-5.7398920887,
-5.7495167543,
-5.7591575587,
-5.7688145288,
-5.7784876917,
-5.7881770745,
-5.7978827046,
-5.8076046091,
-5.8173428153,
-5.8270973506,
-5.8368682422,
-5.8466555178,
-5.8564592047,
-5.8662793304,
-5.8761159225,
-5.8859690087,
-5.8958386165,
-5.9057247737,
-5.915627508,
-5.9255468473,
-5.9354828194,
-5.9454354521,
-5.9554047734,
-5.9653908113,
-5.9753935938,
-5.985413149,
-5.995449505,
-6.00550269,
-6.0155727322,
-6.0256596599,
-6.0357635014,
-6.045884285,
-6.0560220392,
-6.0661767924,
-6.0763485731,
-6.0865374098,
-6.0967433313,
-6.106966366,
-6.1172065428,
-6.1274638903,
-6.1377384374,
-6.1480302128,
-6.1583392456,
-6.1686655645,
-6.1790091986,
-6.189370177,
-6.1997485287,
-6.2101442828,
-6.2205574686,
-6.2309881152,
-6.2414362519,
-6.2519019081,
-6.2623851132,
-6.2728858965,
-6.2834042876,
-6.2939403159,
-6.304494011,
-6.3150654026,
-6.3256545204,
-6.336261394,
-6.3468860533,
-6.357528528,
-6.368188848,
-6.3788670433,
-6.3895631438,
-6.4002771796,
-6.4110091806,
-6.4217591772,
-6.4325271993,
-6.4433132773,
-6.4541174414,
-6.464939722,
-6.4757801494,
-6.4866387541,
-6.4975155665,
-6.5084106171,
-6.5193239366,
-6.5302555556,
-6.5412055048,
-6.5521738148,
-6.5631605166,
-6.5741656408,
-6.5851892185,
-6.5962312806,
-6.607291858,
-6.6183709818,
-6.6294686832,
-6.6405849931,
-6.651719943,
-6.6628735639,
-6.6740458873,
-6.6852369444,
-6.6964467668,
-6.7076753858,
-6.718922833,
-6.7301891399,
-6.7414743382,
-6.7527784595,
-6.7641015357,
-6.7754435983,
-6.7868046794,
-6.7981848108,
-6.8095840244,
-6.8210023523,
-6.8324398264,
-6.8438964789,
-6.855372342,
-6.8668674478,
-6.8783818286,
-6.8899155168,
-6.9014685447,
-6.9130409447,
-6.9246327494,
-6.9362439912,
-6.9478747028,
-6.9595249168,
-6.9711946659,
-6.9828839829,
-6.9945929006,
-7.0063214518,
-7.0180696694,
-7.0298375865,
-7.0416252361,
-7.0534326512,
-7.0652598651,
-7.0771069108,
-7.0889738217,
-7.1008606311,
-7.1127673723,
-7.1246940787,
-7.1366407839,
-7.1486075214,
-7.1605943247,
-7.1726012275,
-7.1846282635,
-7.1966754665,
-7.2087428702,
-7.2208305086,
-7.2329384156,
-7.2450666252,
-7.2572151714,
-7.2693840883,
-7.28157341,
-7.2937831709,
-7.3060134051,
-7.318264147,
-7.3305354309,
-7.3428272914,
-7.3551397629,
-7.36747288,
-7.3798266773,
-7.3922011895,
-7.4045964513,
-7.4170124975,
-7.4294493629,
-7.4419070826,
-7.4543856913,
-7.4668852242,
-7.4794057164,
-7.491947203,
-7.5045097191,
-7.5170933002,
-7.5296979813,
-7.5423237981,
-7.5549707859,
-7.5676389801,
-7.5803284165,
-7.5930391305,
-7.6057711578,
-7.6185245343,
-7.6312992956,
-7.6440954777,
-7.6569131165,
-7.6697522479,
-7.682612908,
-7.6954951329,
-7.7083989588,
-7.7213244218,
-7.7342715583,
-7.7472404045,
-7.760230997,
-7.7732433721,
-7.7862775664,
-7.7993336164,
-7.8124115589,
-7.8255114305,
-7.838633268,
-7.8517771083,
-7.8649429881,
-7.8781309446,
-7.8913410146,
-7.9045732353,
-7.9178276439,
-7.9311042774,
-7.9444031733,
-7.9577243688,
-7.9710679013,
-7.9844338082,
-7.9978221272,
-8.0112328957,
-8.0246661514,
-8.0381219321,
-8.0516002754,
-8.0651012193,
-8.0786248015,
-8.0921710602,
-8.1057400332,
-8.1193317588,
-8.132946275,
-8.14658362,
-8.1602438322,
-8.1739269498,
-8.1876330114,
-8.2013620553,
-8.21511412,
-8.2288892443,
-8.2426874668,
-8.2565088261,
-8.2703533612,
-8.2842211108,
-8.2981121138,
-8.3120264094,
-8.3259640364,
-8.3399250341,
-8.3539094417,
-8.3679172983,
-8.3819486434,
-8.3960035162,
-8.4100819563,
-8.4241840031,
-8.4383096963,
-8.4524590755,
-8.4666321804,
-8.4808290509,
-8.4950497266,
-8.5092942476,
-8.5235626539,
-8.5378549855,
-8.5521712825,
-8.5665115851,
-8.5808759335,
-8.5952643682,
-8.6096769294,
-8.6241136576,
-8.6385745933,
-8.6530597772,
-8.6675692499,
-8.6821030521,
-8.6966612246,
-8.7112438083,
-8.7258508441,
-8.7404823731,
-8.7551384362,
-8.7698190746,
-8.7845243296,
-8.7992542424,
-8.8140088543,
-8.8287882068,
-8.8435923414,
-8.8584212995,
-8.8732751229,
-8.8881538533,
-8.9030575323,
-8.9179862018,
-8.9329399038,
-8.9479186802,
-8.9629225731,
-8.9779516245,
-8.9930058766,
-9.0080853718,
-9.0231901523,
-9.0383202605,
-9.053475739,
-9.0686566302,
-9.0838629767,
-9.0990948213,
-9.1143522067,
-9.1296351757,
-9.1449437712,
-9.1602780362,
-9.1756380138,
-9.191023747,
-9.206435279,
-9.2218726531,
-9.2373359127,
-9.2528251011,
-9.2683402618,
-9.2838814384,
-9.2994486744,
-9.3150420136,
-9.3306614998,
-9.3463071768,
-9.3619790885,
-9.3776772789,
-9.393401792,
-9.4091526721,
-9.4249299633,
-9.4407337098,
-9.4565639562,
-9.4724207467,
-9.488304126,
-9.5042141385,
-9.520150829,
-9.5361142421,
-9.5521044228,
-9.5681214158,
-9.5841652662,
-9.6002360189,
-9.6163337191,
-9.632458412,
-9.6486101428,
-9.6647889569,
-9.6809948997,
-9.6972280166,
-9.7134883532,
-9.7297759552,
-9.7460908683,
-9.7624331383,
-9.7788028111,
-9.7951999326,
-9.8116245488,
-9.8280767058,
-9.8445564499,
-9.8610638272,
-9.8775988842,
-9.8941616671,
-9.9107522226,
-9.9273705972,
-9.9440168375,
-9.9606909903,
-9.9773931023,
-9.9941232205,
-10.0108813918,
-10.0276676632,
-10.0444820819,
-10.061324695,
-10.0781955499,
-10.0950946939,
-10.1120221744,
-10.128978039,
-10.1459623351,
-10.1629751106,
-10.1800164132,
-10.1970862907,
-10.2141847909,
-10.231311962,
-10.248467852,
-10.265652509,
-10.2828659813,
-10.3001083171,
-10.317379565,
-10.3346797734,
-10.3520089907,
-10.3693672658,
-10.3867546472,
-10.4041711839,
-10.4216169246,
-10.4390919184,
-10.4565962144,
-10.4741298615,
-10.4916929092,
-10.5092854066,
-10.5269074031,
-10.5445589483,
-10.5622400916,
-10.5799508827,
-10.5976913713,
-10.6154616072,
-10.6332616403,
-10.6510915205,
-10.6689512979,
-10.6868410226,
-10.7047607448,
-10.7227105149,
-10.7406903832,
-10.7587004002,
-10.7767406165,
-10.7948110826,
-10.8129118493,
-10.8310429675,
-10.8492044879,
-10.8673964617,
-10.8856189397,
-10.9038719733,
-10.9221556136,
-10.940469912,
-10.9588149198,
-10.9771906886,
-10.9955972699,
-11.0140347154,
-11.0325030769,
-11.0510024061,
-11.0695327551,
-11.0880941759,
-11.1066867204,
-11.125310441,
-11.1439653899,
-11.1626516195,
-11.1813691822,
-11.2001181305,
-11.2188985171,
-11.2377103947,
-11.2565538161,
-11.2754288343,
-11.2943355021,
-11.3132738726,
-11.3322439991,
-11.3512459347,
-11.3702797328,
-11.3893454468,
-11.4084431303,
-11.4275728368,
-11.44673462,
-11.4659285338,
-11.485154632,
-11.5044129685,
-11.5237035975,
-11.5430265731,
-11.5623819494,
-11.5817697809,
-11.601190122,
-11.6206430272,
-11.640128551,
-11.6596467482,
-11.6791976736,
-11.698781382,
-11.7183979284,
-11.7380473679,
-11.7577297557,
-11.7774451469,
-11.7971935969,
-11.8169751612,
-11.8367898953,
-11.8566378547,
-11.8765190953,
-11.8964336728,
-11.9163816431,
-11.9363630622,
-11.9563779861,
-11.9764264712,
-11.9965085736,
-12.0166243498,
-12.0367738561,
-12.0569571492,
-12.0771742856,
-12.0974253223,
-12.1177103159,
-12.1380293234,
-12.1583824019,
-12.1787696085,
-12.1991910004,
-12.2196466349,
-12.2401365696,
-12.2606608617,
-12.2812195691,
-12.3018127494,
-12.3224404603,
-12.3431027599,
-12.3637997061,
-12.3845313569,
-12.4052977706,
-12.4260990055,
-12.44693512,
-12.4678061725,
-12.4887122217,
-12.5096533262,
-12.5306295447,
-12.5516409363,
-12.5726875598,
-12.5937694743,
-12.6148867391,
-12.6360394133,
-12.6572275564,
-12.6784512278,
-12.6997104871,
-12.721005394,
-12.7423360083,
-12.7637023898,
-12.7851045984,
-12.8065426944,
-12.8280167378,
-12.849526789,
-12.8710729082,
-12.8926551561,
-12.9142735931,
-12.93592828,
-12.9576192775,
-12.9793466465,
-13.001110448,
-13.0229107431,
-13.0447475931,
-13.0666210591,
-13.0885312025,
-13.110478085,
-13.1324617681,
-13.1544823134,
-13.1765397829,
-13.1986342384,
-13.2207657419,
-13.2429343556,
-13.2651401416,
-13.2873831624,
-13.3096634804,
-13.331981158,
-13.354336258,
-13.376728843,
-13.399158976,
-13.4216267199,
-13.4441321378,
-13.4666752928,
-13.4892562483,
-13.5118750675,
-13.5345318141,
-13.5572265515,
-13.5799593435,
-13.602730254,
-13.6255393467,
-13.6483866858,
-13.6712723354,
-13.6941963597,
-13.717158823,
-13.7401597899,
-13.7631993248,
-13.7862774925,
-13.8093943577,
-13.8325499854,
-13.8557444404,
-13.878977788,
-13.9022500933,
-13.9255614217,
-13.9489118386,
-13.9723014095,
-13.9957302001,
-14.0191982762,
-14.0427057035,
-14.0662525482,
-14.0898388764,
-14.1134647541,
-14.1371302477,
-14.1608354238,
-14.1845803487,
-14.2083650891,
-14.2321897119,
-14.2560542839,
-14.279958872,
-14.3039035435,
-14.3278883654,
-14.3519134051,
-14.3759787301,
-14.4000844078,
-14.424230506,
-14.4484170925,
-14.4726442351,
-14.4969120018,
-14.5212204608,
-14.5455696803,
-14.5699597286,
-14.5943906742,
-14.6188625856,
-14.6433755317,
-14.6679295811,
-14.6925248028,
-14.7171612658,
-14.7418390393,
-14.7665581926,
-14.791318795,
-14.816120916,
-14.8409646253,
-14.8658499926,
-14.8907770877,
-14.9157459807,
-14.9407567416,
-14.9658094405,
-14.9909041479,
-15.0160409342,
-15.0412198699,
-15.0664410257,
-15.0917044724,
-15.1170102809,
-15.1423585223,
-15.1677492676,
-15.1931825882,
-15.2186585555,
-15.244177241,
-15.2697387162,
-15.295343053,
-15.3209903232,
-15.3466805988,
-15.3724139519,
-15.3981904548,
-15.4240101798,
-15.4498731994,
-15.4757795861,
-15.5017294128,
-15.5277227521,
-15.5537596772,
-15.5798402611,
-15.6059645769,
-15.6321326981,
-15.658344698,
-15.6846006503,
-15.7109006286,
-15.7372447068,
-15.7636329588,
-15.7900654588,
-15.8165422807,
-15.8430634991,
-15.8696291884,
-15.896239423,
-15.9228942778,
-15.9495938275,
-15.9763381471,
-16.0031273116,
-16.0299613962,
-16.0568404763,
-16.0837646274,
-16.1107339249,
-16.1377484446,
-16.1648082623,
-16.191913454,
-16.2190640957,
-16.2462602637,
-16.2735020343,
-16.300789484,
-16.3281226893,
-16.355501727,
-16.382926674,
-16.4103976072,
-16.4379146037,
-16.4654777408,
-16.4930870958,
-16.5207427463,
-16.5484447698,
-16.5761932442,
-16.6039882472,
-16.631829857,
-16.6597181517,
-16.6876532096,
-16.715635109,
-16.7436639285,
-16.7717397469,
-16.7998626428,
-16.8280326953,
-16.8562499834,
-16.8845145863,
-16.9128265834,
-16.9411860541,
-16.969593078,
-16.9980477349,
-17.0265501047,
-17.0551002673,
-17.0836983029,
-17.1123442917,
-17.1410383142,
-17.1697804509,
-17.1985707825,
-17.2274093899,
-17.2562963538,
-17.2852317555,
-17.3142156762,
-17.3432481971,
-17.3723293999,
-17.4014593661,
-17.4306381775,
-17.459865916,
-17.4891426636,
-17.5184685026,
-17.5478435152,
-17.577267784,
-17.6067413914,
-17.6362644202,
-17.6658369533,
-17.6954590737,
-17.7251308646,
-17.7548524092,
-17.7846237909,
-17.8144450934,
-17.8443164003,
-17.8742377955,
-17.904209363,
-17.9342311869,
-17.9643033514,
-17.9944259411,
-18.0245990403,
-18.0548227339,
-18.0850971067,
-18.1154222436,
-18.1457982298,
-18.1762251505,
-18.2067030911,
-18.2372321373,
-18.2678123746,
-18.2984438889,
-18.3291267662,
-18.3598610927,
-18.3906469546,
-18.4214844382,
-18.4523736303,
-18.4833146174,
-18.5143074864,
-18.5453523244,
-18.5764492184,
-18.6075982558,
-18.638799524,
-18.6700531105,
-18.7013591031,
-18.7327175897,
-18.7641286583,
-18.7955923971,
-18.8271088943,
-18.8586782384,
-18.8903005182,
-18.9219758222,
-18.9537042395,
-18.985485859,
-19.0173207701,
-19.049209062,
-19.0811508243,
-19.1131461466,
-19.1451951188,
-19.1772978307,
-19.2094543726,
-19.2416648346,
-19.2739293073,
-19.306247881,
-19.3386206467,
-19.371047695,
-19.4035291172,
-19.4360650042,
-19.4686554475,
-19.5013005386,
-19.534000369,
-19.5667550306,
-19.5995646153,
-19.6324292152,
-19.6653489225,
-19.6983238297,
-19.7313540293,
-19.764439614,
-19.7975806767,
-19.8307773104,
-19.8640296083,
-19.8973376638,
-19.9307015703,
-19.9641214215,
-19.9975973111,
-20.0311293333,
-20.064717582,
-20.0983621515,
-20.1320631364,
-20.1658206312,
-20.1996347306,
-20.2335055295,
-20.2674331232,
-20.3014176067,
-20.3354590754,
-20.369557625,
-20.4037133512,
-20.4379263497,
-20.4721967167,
-20.5065245483,
-20.5409099409,
-20.575352991,
-20.6098537953,
-20.6444124507,
-20.6790290541,
-20.7137037027,
-20.7484364938,
-20.783227525,
-20.8180768939,
-20.8529846983,
-20.8879510361,
-20.9229760057,
-20.9580597051,
-20.993202233,
-21.028403688,
-21.0636641689,
-21.0989837747,
-21.1343626044,
-21.1698007575,
-21.2052983333,
-21.2408554316,
-21.2764721521,
-21.3121485948,
-21.3478848599,
-21.3836810476,
-21.4195372585,
-21.4554535931,
-21.4914301524,
-21.5274670372,
-21.5635643488,
-21.5997221884,
-21.6359406576,
-21.6722198581,
-21.7085598915,
-21.7449608601,
-21.7814228658,
-21.8179460112,
-21.8545303987,
-21.8911761309,
-21.9278833108,
-21.9646520414,
-22.0014824259,
-22.0383745677,
-22.0753285704,
-22.1123445375,
-22.1494225732,
-22.1865627814,
-22.2237652664,
-22.2610301326,
-22.2983574847,
-22.3357474273,
-22.3732000655,
-22.4107155044,
-22.4482938492,
-22.4859352056,
-22.523639679,
-22.5614073754,
-22.5992384008,
-22.6371328613,
-22.6750908634,
-22.7131125135,
-22.7511979184,
-22.7893471851,
-22.8275604205,
-22.865837732,
-22.9041792269,
-22.942585013,
-22.981055198,
-23.0195898899,
-23.0581891969,
-23.0968532273,
-23.1355820897,
-23.1743758927,
-23.2132347452,
-23.2521587564,
-23.2911480354,
-23.3302026918,
-23.3693228351,
-23.4085085752,
-23.447760022,
-23.4870772857,
-23.5264604768,
-23.5659097056,
-23.6054250831,
-23.64500672,
-23.6846547275,
-23.7243692169,
-23.7641502997,
-23.8039980874,
-23.8439126921,
-23.8838942256,
-23.9239428003,
-23.9640585286,
-24.004241523,
-24.0444918963,
-24.0848097616,
-24.125195232,
-24.1656484208,
-24.2061694416,
-24.2467584082,
-24.2874154345,
-24.3281406346,
-24.3689341228,
-24.4097960136,
-24.4507264218,
-24.4917254621,
-24.5327932498,
-24.5739299,
-24.6151355283,
-24.6564102502,
-24.6977541818,
-24.7391674389,
-24.7806501379,
-24.8222023952,
-24.8638243274,
-24.9055160514,
-24.9472776842,
-24.989109343,
-25.0310111452,
-25.0729832084,
-25.1150256506,
-25.1571385896,
-25.1993221436,
-25.2415764312,
-25.2839015709,
-25.3262976815,
-25.3687648819,
-25.4113032915,
-25.4539130296,
-25.4965942159,
-25.53934697,
-25.5821714121,
-25.6250676623,
-25.668035841,
-25.7110760689,
-25.7541884668,
-25.7973731556,
-25.8406302567,
-25.8839598913,
-25.9273621812,
-25.9708372482,
-26.0143852142,
-26.0580062017,
-26.1017003328,
-26.1454677305,
-26.1893085174,
-26.2332228166,
-26.2772107515,
-26.3212724454,
-26.3654080221,
-26.4096176055,
-26.4539013196,
-26.4982592887,
-26.5426916374,
-26.5871984904,
-26.6317799725,
-26.676436209,
-26.7211673252,
-26.7659734467,
-26.8108546992,
-26.8558112086,
-26.9008431013,
-26.9459505035,
-26.991133542,
-27.0363923435,
-27.0817270351,
-27.127137744,
-27.1726245976,
-27.2181877238,
-27.2638272503,
-27.3095433053,
-27.3553360171,
-27.4012055143,
-27.4471519255,
-27.4931753798,
-27.5392760063,
-27.5854539345,
-27.6317092939,
-27.6780422144,
-27.7244528262,
-27.7709412593,
-27.8175076443,
-27.864152112,
-27.9108747933,
-27.9576758193,
-28.0045553213,
-28.051513431,
-28.0985502802,
-28.1456660009,
-28.1928607254,
-28.2401345861,
-28.2874877157,
-28.3349202472,
-28.3824323136,
-28.4300240485,
-28.4776955852,
-28.5254470577,
-28.5732786,
-28.6211903464,
-28.6691824313,
-28.7172549895,
-28.7654081558,
-28.8136420655,
-28.8619568539,
-28.9103526567,
-28.9588296097,
-29.007387849,
-29.0560275108,
-29.1047487318,
-29.1535516486,
-29.2024363983,
-29.251403118,
-29.3004519453,
-29.3495830178,
-29.3987964734,
-29.4480924502,
-29.4974710867,
-29.5469325213,
-29.5964768931,
-29.6461043409,
-29.6958150042,
-29.7456090225,
-29.7954865355,
-29.8454476832,
-29.8954926059,
-29.9456214441,
-29.9958343385,
-30.0461314299,
-30.0965128596,
-30.1469787691,
-30.1975292999,
-30.248164594,
-30.2988847934,
-30.3496900406,
-30.4005804782,
-30.451556249,
-30.5026174961,
-30.5537643629,
-30.6049969928,
-30.6563155297,
-30.7077201177,
-30.7592109011,
-30.8107880243,
-30.8624516321,
-30.9142018697,
-30.9660388821,
-31.017962815,
-31.0699738141,
-31.1220720253,
-31.174257595,
-31.2265306696,
-31.2788913958,
-31.3313399206,
-31.3838763912,
-31.4365009551,
-31.48921376,
-31.5420149538,
-31.5949046849,
-31.6478831015,
-31.7009503526,
-31.7541065869,
-31.8073519537,
-31.8606866025,
-31.914110683,
-31.9676243451,
-32.021227739,
-32.0749210153,
-32.1287043246,
-32.1825778178,
-32.2365416463,
-32.2905959615,
-32.3447409151,
-32.3989766591,
-32.4533033457,
-32.5077211274,
-32.562230157,
-32.6168305875,
-32.6715225721,
-32.7263062644,
-32.7811818182,
-32.8361493874,
-32.8912091263,
-32.9463611896,
-33.001605732,
-33.0569429085,
-33.1123728746,
-33.1678957858,
-33.223511798,
-33.2792210672,
-33.3350237499,
-33.3909200027,
-33.4469099824,
-33.5029938463,
-33.5591717517,
-33.6154438564,
-33.6718103183,
-33.7282712957,
-33.7848269469,
-33.8414774308,
-33.8982229064,
-33.9550635329,
-34.01199947,
-34.0690308773,
-34.1261579151,
-34.1833807437,
-34.2406995236,
-34.2981144158,
-34.3556255814,
-34.4132331819,
-34.470937379,
-34.5287383347,
-34.5866362111,
-34.6446311708,
-34.7027233766,
-34.7609129916,
-34.8192001791,
-34.8775851026,
-34.9360679262,
-34.9946488139,
-35.0533279302,
-35.1121054398,
-35.1709815076,
-35.2299562991,
-35.2890299795,
-35.3482027149,
-35.4074746713,
-35.466846015,
-35.5263169128,
-35.5858875315,
-35.6455580384,
-35.7053286009,
-35.7651993869,
-35.8251705644,
-35.8852423016,
-35.9454147674,
-36.0056881304,
-36.06606256,
-36.1265382256,
-36.187115297,
-36.2477939441,
-36.3085743373,
-36.3694566473,
-36.4304410449,
-36.4915277012,
-36.5527167879,
-36.6140084765,
-36.6754029392,
-36.7369003483,
-36.7985008764,
-36.8602046964,
-36.9220119816,
-36.9839229053,
-37.0459376415,
-37.1080563641,
-37.1702792476,
-37.2326064665,
-37.2950381959,
-37.357574611,
-37.4202158873,
-37.4829622006,
-37.5458137271,
-37.6087706433,
-37.6718331257,
-37.7350013515,
-37.7982754979,
-37.8616557425,
-37.9251422634,
-37.9887352385,
-38.0524348466,
-38.1162412663,
-38.1801546768,
-38.2441752574,
-38.3083031879,
-38.3725386483,
-38.4368818189,
-38.5013328802,
-38.5658920133,
-38.6305593993,
-38.6953352197,
-38.7602196564,
-38.8252128915,
-38.8903151074,
-38.9555264868,
-39.0208472129,
-39.0862774689,
-39.1518174386,
-39.2174673058,
-39.2832272549,
-39.3490974705,
-39.4150781374,
-39.4811694408,
-39.5473715663,
-39.6136846997,
-39.6801090272,
-39.7466447351,
-39.8132920102,
-39.8800510397,
-39.9469220109,
-40.0139051115,
-40.0810005296,
-40.1482084534,
-40.2155290716,
-40.2829625732,
-40.3505091475,
-40.418168984,
-40.4859422728,
-40.5538292039,
-40.6218299681,
-40.6899447561,
-40.7581737591,
-40.8265171687,
-40.8949751767,
-40.9635479753,
-41.0322357569,
-41.1010387144,
-41.1699570408,
-41.2389909297,
-41.3081405747,
-41.3774061701,
-41.4467879102,
-41.5162859898,
-41.5859006039,
-41.655631948,
-41.7254802178,
-41.7954456093,
-41.865528319,
-41.9357285435,
-42.00604648,
-42.0764823258,
-42.1470362785,
-42.2177085364,
-42.2884992976,
-42.359408761,
-42.4304371255,
-42.5015845906,
-42.5728513559,
-42.6442376215,
-42.7157435878,
-42.7873694555,
-42.8591154256,
-42.9309816996,
-43.0029684791,
-43.0750759662,
-43.1473043633,
-43.2196538732,
-43.292124699,
-43.364717044,
-43.437431112,
-43.5102671071,
-43.5832252339,
-43.656305697,
-43.7295087016,
-43.8028344532,
-43.8762831577,
-43.949855021,
-44.0235502499,
-44.0973690511,
-44.1713116319,
-44.2453781998,
-44.3195689627,
-44.3938841289,
-44.4683239069,
-44.5428885057,
-44.6175781347,
-44.6923930033,
-44.7673333218,
-44.8423993004,
-44.9175911498,
-44.9929090811,
-45.0683533057,
-45.1439240353,
-45.2196214821,
-45.2954458587,
-45.3713973777,
-45.4474762524,
-45.5236826964,
-45.6000169235,
-45.6764791481,
-45.7530695847,
-45.8297884484,
-45.9066359544,
-45.9836123185,
-46.0607177568,
-46.1379524857,
-46.215316722,
-46.2928106828,
-46.3704345857,
-46.4481886486,
-46.5260730897,
-46.6040881276,
-46.6822339813,
-46.7605108702,
-46.8389190139,
-46.9174586327,
-46.9961299468,
-47.0749331773,
-47.1538685452,
-47.2329362721,
-47.31213658,
-47.3914696911,
-47.4709358283,
-47.5505352144,
-47.630268073,
-47.7101346279,
-47.7901351032,
-47.8702697235,
-47.9505387137,
-48.0309422992,
-48.1114807056,
-48.1921541591,
-48.2729628859,
-48.3539071131,
-48.4349870678,
-48.5162029775,
-48.5975550702,
-48.6790435744,
-48.7606687187,
-48.8424307322,
-48.9243298445,
-49.0063662855,
-49.0885402853,
-49.1708520747,
-49.2533018848,
-49.3358899469,
-49.4186164928,
-49.5014817549,
-49.5844859656,
-49.667629358,
-49.7509121655,
-49.8343346218,
-49.917896961,
-50.0015994178,
-50.0854422271,
-50.1694256243,
-50.253549845,
-50.3378151254,
-50.4222217021,
-50.5067698119,
-50.5914596922,
-50.6762915807,
-50.7612657155,
-50.8463823352,
-50.9316416787,
-51.0170439852,
-51.1025894946,
-51.1882784468,
-51.2741110825,
-51.3600876427,
-51.4462083685,
-51.5324735017,
-51.6188832846,
-51.7054379596,
-51.7921377697,
-51.8789829583,
-51.9659737691,
-52.0531104463,
-52.1403932346,
-52.2278223788,
-52.3153981244,
-52.4031207173,
-52.4909904036,
-52.5790074301,
-52.6671720437,
-52.755484492,
-52.8439450228,
-52.9325538844,
-53.0213113256,
-53.1102175956,
-53.1992729438,
-53.2884776202,
-53.3778318752,
-53.4673359597,
-53.5569901249,
-53.6467946224,
-53.7367497043,
-53.8268556231,
-53.9171126318,
-54.0075209836,
-54.0980809324,
-54.1887927323,
-54.279656638,
-54.3706729046,
-54.4618417874,
-54.5531635425,
-54.6446384261,
-54.7362666951,
-54.8280486065,
-54.9199844181,
-55.0120743879,
-55.1043187744,
-55.1967178366,
-55.2892718337,
-55.3819810255,
-55.4748456724,
-55.567866035,
-55.6610423744,
-55.754374952,
-55.84786403,
-55.9415098707,
-56.035312737,
-56.1292728921,
-56.2233905999,
-56.3176661246,
-56.4120997306,
-56.5066916832,
-56.6014422477,
-56.6963516903,
-56.7914202773,
-56.8866482755,
-56.9820359523,
-57.0775835754,
-57.1732914129,
-57.2691597336,
-57.3651888066,
-57.4613789013,
-57.5577302879,
-57.6542432367,
-57.7509180186,
-57.8477549051,
-57.9447541679,
-58.0419160794,
-58.1392409121,
-58.2367289394,
-58.3343804349,
-58.4321956726,
-58.5301749272,
-58.6283184737,
-58.7266265874,
-58.8250995445,
-58.9237376213,
-59.0225410947,
-59.121510242,
-59.220645341,
-59.31994667,
-59.4194145077,
-59.5190491334,
-59.6188508266,
-59.7188198676,
-59.8189565369,
-59.9192611156,
-60.0197338853,
-60.120375128,
-60.2211851262,
-60.3221641629,
-60.4233125214,
-60.5246304858,
-60.6261183404,
-60.7277763701,
-60.8296048603,
-60.9316040967,
-61.0337743657,
-61.136115954,
-61.238629149,
-61.3413142384,
-61.4441715104,
-61.5472012538,
-61.6504037577,
-61.7537793118,
-61.8573282062,
-61.9610507318,
-62.0649471795,
-62.1690178411,
-62.2732630086,
-62.3776829747,
-62.4822780324,
-62.5870484754,
-62.6919945978,
-62.7971166941,
-62.9024150593,
-63.0078899892,
-63.1135417796,
-63.2193707273,
-63.3253771292,
-63.4315612829,
-63.5379234865,
-63.6444640385,
-63.7511832379,
-63.8580813844,
-63.965158778,
-64.0724157192,
-64.1798525091,
-64.2874694494,
-64.3952668419,
-64.5032449894,
-64.611404195,
-64.7197447622,
-64.8282669951,
-64.9369711983,
-65.0458576771,
-65.154926737,
-65.2641786841,
-65.3736138252,
-65.4832324675,
-65.5930349185,
-65.7030214866,
-65.8131924804,
-65.9235482093,
-66.0340889829,
-66.1448151115,
-66.255726906,
-66.3668246777,
-66.4781087384,
-66.5895794005,
-66.7012369769,
-66.8130817811,
-66.9251141268,
-67.0373343287,
-67.1497427017,
-67.2623395614,
-67.3751252237,
-67.4881000054,
-67.6012642234,
-67.7146181955,
-67.8281622398,
-67.9418966751,
-68.0558218205,
-68.1699379959,
-68.2842455217,
-68.3987447185,
-68.513435908,
-68.6283194118,
-68.7433955527,
-68.8586646535,
-68.9741270378,
-69.0897830298,
-69.205632954,
-69.3216771357,
-69.4379159005,
-69.5543495748,
-69.6709784854,
-69.7878029597,
-69.9048233255,
-70.0220399113,
-70.1394530463,
-70.2570630598,
-70.3748702822,
-70.492875044,
-70.6110776765,
-70.7294785114,
-70.8480778812,
-70.9668761187,
-71.0858735574,
-71.2050705313,
-71.324467375,
-71.4440644236,
-71.5638620129,
-71.683860479,
-71.8040601589,
-71.9244613899,
-72.04506451,
-72.1658698578,
-72.2868777722,
-72.4080885931,
-72.5295026605,
-72.6511203154,
-72.772941899,
-72.8949677534,
-73.0171982211,
-73.1396336451,
-73.2622743691,
-73.3851207374,
-73.5081730949,
-73.6314317868,
-73.7548971592,
-73.8785695587,
-74.0024493324,
-74.126536828,
-74.2508323938,
-74.3753363787,
-74.5000491323,
-74.6249710045,
-74.750102346,
-74.8754435081,
-75.0009948425,
-75.1267567018,
-75.2527294388,
-75.3789134073,
-75.5053089613,
-75.6319164558,
-75.758736246,
-75.8857686879,
-76.0130141382,
-76.140472954,
-76.2681454931,
-76.3960321137,
-76.524133175,
-76.6524490365,
-76.7809800584,
-76.9097266014,
-77.0386890269,
-77.1678676969,
-77.2972629741,
-77.4268752216,
-77.5567048032,
-77.6867520835,
-77.8170174273,
-77.9475012004,
-78.078203769,
-78.2091255,
-78.3402667609,
-78.4716279198,
-78.6032093455,
-78.7350114072,
-78.8670344749,
-78.9992789192,
-79.1317451114,
-79.2644334232,
-79.3973442272,
-79.5304778963,
-79.6638348042,
-79.7974153254,
-79.9312198347,
-80.0652487078,
-80.1995023208,
-80.3339810507,
-80.4686852748,
-80.6036153713,
-80.7387717189,
-80.874154697,
-81.0097646857,
-81.1456020655,
-81.2816672178,
-81.4179605245,
-81.5544823681,
-81.691233132,
-81.8282131998,
-81.9654229562,
-82.1028627863,
-82.2405330758,
-82.3784342112,
-82.5165665795,
-82.6549305686,
-82.7935265668,
-82.9323549631,
-83.0714161472,
-83.2107105094,
-83.3502384408,
-83.490000333,
-83.6299965783,
-83.7702275697,
-83.9106937007,
-84.0513953657,
-84.1923329596,
-84.333506878,
-84.4749175172,
-84.6165652741,
-84.7584505464,
-84.9005737322,
-85.0429352305,
-85.185535441,
-85.3283747639,
-85.4714536001,
-85.6147723513,
-85.7583314197,
-85.9021312083,
-86.0461721208,
-86.1904545614,
-86.3349789353,
-86.4797456479,
-86.6247551057,
-86.7700077158,
-86.9155038858,
-87.0612440242,
-87.20722854,
-87.353457843,
-87.4999323437,
-87.6466524532,
-87.7936185833,
-87.9408311467,
-88.0882905564,
-88.2359972264,
-88.3839515714,
-88.5321540066,
-88.680604948,
-88.8293048123,
-88.978254017,
-89.12745298,
-89.2769021202,
-89.4266018572,
-89.576552611,
-89.7267548027,
-89.8772088537,
-90.0279151865,
-90.1788742241,
-90.3300863902,
-90.4815521092,
-90.6332718063,
-90.7852459074,
-90.937474839,
-91.0899590285,
-91.2426989039,
-91.3956948939,
-91.548947428,
-91.7024569363,
-91.8562238497,
-92.0102485999,
-92.1645316192,
-92.3190733407,
-92.4738741981,
-92.6289346259,
-92.7842550595,
-92.9398359348,
-93.0956776885,
-93.251780758,
-93.4081455816,
-93.5647725981,
-93.7216622472,
-93.8788149692,
-94.0362312054,
-94.1939113975,
-94.3518559881,
-94.5100654206,
-94.6685401391,
-94.8272805884,
-94.9862872141,
-95.1455604625,
-95.3051007807,
-95.4649086165,
-95.6249844185,
-95.7853286361,
-95.9459417192,
-96.1068241187,
-96.2679762863,
-96.4293986742,
-96.5910917356,
-96.7530559243,
-96.915291695,
-97.077799503,
-97.2405798046,
-97.4036330565,
-97.5669597166,
-97.7305602433,
-97.8944350957,
-98.0585847339,
-98.2230096186,
-98.3877102114,
-98.5526869746,
-98.7179403712,
-98.8834708651,
-99.049278921,
-99.2153650043,
-99.3817295811,
-99.5483731185,
-99.7152960841,
-99.8824989467,
-100.0499821754,
-100.2177462404,
-100.3857916127,
-100.5541187638,
-100.7227281664,
-100.8916202936,
-101.0607956196,
-101.2302546191,
-101.399997768,
-101.5700255426,
-101.7403384202,
-101.9109368789,
-102.0818213975,
-102.2529924558,
-102.424450534,
-102.5961961137,
-102.7682296767,
-102.9405517061,
-103.1131626855,
-103.2860630994,
-103.4592534331,
-103.6327341729,
-103.8065058056,
-103.980568819,
-104.1549237017,
-104.3295709432,
-104.5045110336,
-104.6797444639,
-104.8552717262,
-105.0310933129,
-105.2072097178,
-105.3836214351,
-105.5603289601,
-105.7373327886,
-105.9146334176,
-106.0922313448,
-106.2701270686,
-106.4483210885,
-106.6268139045,
-106.8056060177,
-106.98469793,
-107.1640901441,
-107.3437831635,
-107.5237774926,
-107.7040736367,
-107.8846721017,
-108.0655733948,
-108.2467780236,
-108.4282864968,
-108.6100993239,
-108.7922170151,
-108.9746400818,
-109.157369036,
-109.3404043905,
-109.5237466592,
-109.7073963566,
-109.8913539983,
-110.0756201007,
-110.260195181,
-110.4450797572,
-110.6302743483,
-110.8157794742,
-111.0015956556,
-111.187723414,
-111.3741632719,
-111.5609157526,
-111.7479813804,
-111.9353606803,
-112.1230541783,
-112.3110624012,
-112.4993858768,
-112.6880251337,
-112.8769807014,
-113.0662531102,
-113.2558428915,
-113.4457505774,
-113.635976701,
-113.8265217963,
-114.0173863981,
-114.2085710421,
-114.400076265,
-114.5919026043,
-114.7840505986,
-114.9765207871,
-115.1693137101,
-115.3624299088,
-115.5558699252,
-115.7496343023,
-115.943723584,
-116.1381383151,
-116.3328790414,
-116.5279463093,
-116.7233406666,
-116.9190626616,
-117.1151128438,
-117.3114917634,
-117.5081999717,
-117.7052380208,
-117.9026064638,
-118.1003058547,
-118.2983367485,
-118.496699701,
-118.695395269,
-118.8944240102,
-119.0937864833,
-119.2934832479,
-119.4935148645,
-119.6938818947,
-119.8945849008,
-120.0956244463,
-120.2970010953,
-120.4987154133,
-120.7007679663,
-120.9031593216,
-121.1058900472,
-121.3089607122,
-121.5123718866,
-121.7161241413,
-121.9202180484,
-122.1246541807,
-122.329433112,
-122.5345554171,
-122.7400216718,
-122.9458324529,
-123.151988338,
-123.3584899058,
-123.565337736,
-123.7725324091,
-123.9800745069,
-124.1879646117,
-124.3962033071,
-124.6047911778,
-124.8137288091,
-125.0230167876,
-125.2326557007,
-125.4426461369,
-125.6529886855,
-125.8636839371,
-126.074732483,
-126.2861349157,
-126.4978918284,
-126.7100038158,
-126.922471473,
-127.1352953966,
-127.3484761838,
-127.5620144331,
-127.775910744,
-127.9901657166,
-128.2047799526,
-128.4197540543,
-128.6350886251,
-128.8507842695,
-129.0668415928,
-129.2832612016,
-129.5000437034,
-129.7171897067,
-129.9346998209,
-130.1525746566,
-130.3708148254,
-130.5894209398,
-130.8083936136,
-131.0277334613,
-131.2474410986,
-131.4675171423,
-131.68796221,
-131.9087769205,
-132.1299618937,
-132.3515177505,
-132.5734451127,
-132.7957446032,
-133.0184168461,
-133.2414624664,
-133.4648820902,
-133.6886763445,
-133.9128458576,
-134.1373912588,
-134.3623131782,
-134.5876122473,
-134.8132890984,
-135.039344365,
-135.2657786817,
-135.4925926841,
-135.7197870087,
-135.9473622934,
-136.1753191768,
-136.403658299,
-136.6323803008,
-136.8614858242,
-137.0909755123,
-137.3208500093,
-137.5511099605,
-137.7817560122,
-138.0127888117,
-138.2442090076,
-138.4760172495,
-138.7082141881,
-138.940800475,
-139.1737767633,
-139.4071437067,
-139.6409019605,
-139.8750521807,
-140.1095950246,
-140.3445311505,
-140.5798612179,
-140.8155858874,
-141.0517058206,
-141.2882216803,
-141.5251341304,
-141.7624438359,
-142.0001514629,
-142.2382576787,
-142.4767631516,
-142.715668551,
-142.9549745477,
-143.1946818132,
-143.4347910205,
-143.6753028436,
-143.9162179575,
-144.1575370384,
-144.3992607638,
-144.6413898122,
-144.8839248631,
-145.1268665975,
-145.3702156972,
-145.6139728452,
-145.8581387259,
-146.1027140246,
-146.3476994277,
-146.593095623,
-146.8389032992,
-147.0851231464,
-147.3317558556,
-147.5788021192,
-147.8262626307,
-148.0741380845,
-148.3224291765,
-148.5711366036,
-148.820261064,
-149.069803257,
-149.3197638829,
-149.5701436434,
-149.8209432414,
-150.0721633807,
-150.3238047666,
-150.5758681055,
-150.8283541048,
-151.0812634732,
-151.3345969208,
-151.5883551585,
-151.8425388986,
-152.0971488547,
-152.3521857414,
-152.6076502747,
-152.8635431715,
-153.1198651501,
-153.3766169302,
-153.6337992322,
-153.8914127782,
-154.1494582913,
-154.4079364957,
-154.666848117,
-154.926193882,
-155.1859745186,
-155.4461907561,
-155.7068433248,
-155.9679329564,
-156.2294603838,
-156.491426341,
-156.7538315634,
-157.0166767876,
-157.2799627513,
-157.5436901936,
-157.8078598547,
-158.0724724762,
-158.3375288008,
-158.6030295725,
-158.8689755366,
-159.1353674395,
-159.4022060291,
-159.6694920543,
-159.9372262654,
-160.2054094139,
-160.4740422526,
-160.7431255355,
-161.012660018,
-161.2826464566,
-161.5530856091,
-161.8239782346,
-162.0953250936,
-162.3671269478,
-162.6393845599,
-162.9120986943,
-163.1852701165,
-163.4588995932,
-163.7329878925,
-164.0075357838,
-164.2825440377,
-164.5580134261,
-164.8339447223,
-165.1103387008,
-165.3871961374,
-165.6645178093,
-165.9423044948,
-166.2205569738,
-166.4992760272,
-166.7784624375,
-167.0581169882,
-167.3382404645,
-167.6188336524,
-167.8998973398,
-168.1814323154,
-168.4634393696,
-168.745919294,
-169.0288728814,
-169.3123009261,
-169.5962042237,
-169.8805835711,
-170.1654397664,
-170.4507736094,
-170.7365859009,
-171.0228774431,
-171.3096490398,
-171.5969014958,
-171.8846356174,
-172.1728522123,
-172.4615520896,
-172.7507360596,
-173.0404049339,
-173.3305595258,
-173.6212006497,
-173.9123291213,
-174.2039457578,
-174.4960513779,
-174.7886468015,
-175.0817328498,
-175.3753103455,
-175.6693801127,
-175.9639429769,
-176.2589997648,
-176.5545513047,
-176.8505984262,
-177.1471419602,
-177.4441827392,
-177.7417215969,
-178.0397593686,
-178.3382968907,
-178.6373350013,
-178.9368745398,
-179.2369163469,
-179.5374612649,
-179.8385101374,
-180.1400638094,
-180.4421231274,
-180.7446889392,
-181.0477620942,
-181.3513434429,
-181.6554338377,
-181.960034132,
-182.2651451808,
-182.5707678406,
-182.8769029693,
-183.1835514262,
-183.4907140719,
-183.7983917688,
-184.1065853804,
-184.4152957719,
-184.7245238097,
-185.0342703619,
-185.3445362979,
-185.6553224886,
-185.9666298063,
-186.278459125,
-186.5908113199,
-186.9036872677,
-187.2170878468,
-187.5310139367,
-187.8454664186,
-188.1604461753,
-188.4759540909,
-188.7919910509,
-189.1085579425,
-189.4256556543,
-189.7432850764,
-190.0614471002,
-190.380142619,
-190.6993725272,
-191.0191377209,
-191.3394390977,
-191.6602775567,
-191.9816539985,
-192.303569325,
-192.6260244401,
-192.9490202486,
-193.2725576574,
-193.5966375745,
-193.9212609097,
-194.246428574,
-194.5721414804,
-194.898400543,
-195.2252066776,
-195.5525608016,
-195.8804638337,
-196.2089166946,
-196.537920306,
-196.8674755915,
-197.1975834762,
-197.5282448866,
-197.8594607509,
-198.1912319988,
-198.5235595616,
-198.8564443721,
-199.1898873647,
-199.5238894753,
-199.8584516416,
-200.1935748025,
-200.5292598988,
-200.8655078727,
-201.2023196681,
-201.5396962304,
-201.8776385065,
-202.2161474451,
-202.5552239964,
-202.8948691121,
-203.2350837455,
-203.5758688518,
-203.9172253874,
-204.2591543105,
-204.6016565808,
-204.9447331599,
-205.2883850106,
-205.6326130977,
-205.9774183872,
-206.3228018472,
-206.668764447,
-207.0153071578,
-207.3624309523,
-207.7101368049,
-208.0584256915,
-208.4072985898,
-208.7567564791,
-209.1068003402,
-209.4574311558,
-209.80864991,
-210.1604575888,
-210.5128551795,
-210.8658436715,
-211.2194240554,
-211.5735973238,
-211.9283644709,
-212.2837264924,
-212.6396843858,
-212.9962391504,
-213.3533917869,
-213.7111432978,
-214.0694946874,
-214.4284469616,
-214.7880011278,
-215.1481581953,
-215.5089191751,
-215.8702850799,
-216.2322569239,
-216.5948357233,
-216.9580224957,
-217.3218182606,
-217.6862240392,
-218.0512408543,
-218.4168697305,
-218.7831116942,
-219.1499677733,
-219.5174389976,
-219.8855263986,
-220.2542310096,
-220.6235538653,
-220.9934960025,
-221.3640584597,
-221.7352422769,
-222.1070484961,
-222.479478161,
-222.8525323168,
-223.2262120108,
-223.6005182918,
-223.9754522106,
-224.3510148196,
-224.7272071728,
-225.1040303264,
-225.481485338,
-225.8595732671,
-226.238295175,
-226.6176521248,
-226.9976451813,
-227.3782754111,
-227.7595438826,
-228.1414516661,
-228.5239998335,
-228.9071894587,
-229.2910216172,
-229.6754973865,
-230.0606178457,
-230.4463840759,
-230.8327971598,
-231.2198581822,
-231.6075682296,
-231.9959283901,
-232.3849397539,
-232.774603413,
-233.1649204611,
-233.5558919938,
-233.9475191085,
-234.3398029047,
-234.7327444832,
-235.1263449473,
-235.5206054015,
-235.9155269528,
-236.3111107094,
-236.707357782,
-237.1042692826,
-237.5018463254,
-237.9000900265,
-238.2990015036,
-238.6985818765,
-239.0988322667,
-239.4997537979,
-239.9013475953,
-240.3036147862,
-240.7065564997,
-241.1101738669,
-241.5144680208,
-241.9194400961,
-242.3250912297,
-242.73142256,
-243.1384352278,
-243.5461303755,
-243.9545091475,
-244.36357269,
-244.7733221513,
-245.1837586815,
-245.5948834328,
-246.0066975591,
-246.4192022163,
-246.8323985624,
-247.2462877573,
-247.6608709625,
-248.076149342,
-248.4921240612,
-248.908796288,
-249.3261671918,
-249.7442379442,
-250.1630097187,
-250.5824836908,
-251.0026610379,
-251.4235429395,
-251.8451305769,
-252.2674251335,
-252.6904277947,
-253.1141397479,
-253.5385621823,
-253.9636962893,
-254.3895432624,
-254.8161042966,
-255.2433805896,
-255.6713733405,
-256.1000837507,
-256.5295130237,
-256.9596623647,
-257.3905329813,
-257.8221260828,
-258.2544428807,
-258.6874845885,
-259.1212524218,
-259.5557475981,
-259.9909713369,
-260.4269248601,
-260.8636093913,
-261.3010261561,
-261.7391763826,
-262.1780613004,
-262.6176821416,
-263.0580401401,
-263.4991365321,
-263.9409725556,
-264.3835494508,
-264.8268684602,
-265.270930828,
-265.7157378007,
-266.1612906268,
-266.6075905571,
-267.0546388442,
-267.5024367431,
-267.9509855106,
-268.4002864058,
-268.8503406899,
-269.3011496261,
-269.75271448,
-270.2050365189,
-270.6581170126,
-271.1119572328,
-271.5665584535,
-272.0219219506,
-272.4780490024,
-272.9349408892,
-273.3925988935,
-273.8510242999,
-274.3102183952,
-274.7701824683,
-275.2309178104,
-275.6924257146,
-276.1547074765,
-276.6177643936,
-277.0815977657,
-277.5462088948,
-278.011599085,
-278.4777696427,
-278.9447218764,
-279.4124570968,
-279.8809766167,
-280.3502817514,
-280.8203738182,
-281.2912541365,
-281.7629240281,
-282.235384817,
-282.7086378294,
-283.1826843936,
-283.6575258403,
-284.1331635024,
-284.6095987149,
-285.0868328152,
-285.5648671428,
-286.0437030396,
-286.5233418497,
-287.0037849193,
-287.4850335971,
-287.9670892339,
-288.4499531829,
-288.9336267993,
-289.4181114409,
-289.9034084676,
-290.3895192415,
-290.8764451273,
-291.3641874916,
-291.8527477035,
-292.3421271345,
-292.8323271581,
-293.3233491504,
-293.8151944896,
-294.3078645563,
-294.8013607335,
-295.2956844063,
-295.7908369623,
-296.2868197913,
-296.7836342857,
-297.2812818398,
-297.7797638506,
-298.2790817174,
-298.7792368416,
-299.2802306272,
-299.7820644804,
-300.2847398099,
-300.7882580267,
-301.2926205442,
-301.797828778,
-302.3038841462,
-302.8107880694,
-303.3185419703,
-303.8271472743,
-304.336605409,
-304.8469178044,
-305.3580858929,
-305.8701111093,
-306.3829948909,
-306.8967386774,
-307.4113439107,
-307.9268120355,
-308.4431444984,
-308.960342749,
-309.4784082389,
-309.9973424224,
-310.517146756,
-311.0378226988,
-311.5593717124,
-312.0817952607,
-312.6050948102,
-313.1292718296,
-313.6543277905,
-314.1802641665,
-314.7070824339,
-315.2347840716,
-315.7633705607,
-316.292843385,
-316.8232040306,
-317.3544539864,
-317.8865947434,
-318.4196277954,
-318.9535546386,
-319.4883767717,
-320.0240956959,
-320.5607129149,
-321.0982299351,
-321.6366482652,
-322.1759694165,
-322.7161949028,
-323.2573262407,
-323.799364949,
-324.3423125491,
-324.8861705652,
-325.4309405238,
-325.976623954,
-326.5232223876,
-327.0707373588,
-327.6191704046,
-328.1685230643,
-328.7187968799,
-329.269993396,
-329.8221141599,
-330.3751607212,
-330.9291346325,
-331.4840374486,
-332.0398707272,
-332.5966360284,
-333.1543349152,
-333.7129689528,
-334.2725397094,
-334.8330487557,
-335.3944976649,
-335.9568880132,
-336.520221379,
-337.0844993436,
-337.6497234909,
-338.2158954076,
-338.7830166827,
-339.3510889083,
-339.9201136788,
-340.4900925915,
-341.0610272463,
-341.6329192457,
-342.2057701952,
-342.7795817025,
-343.3543553785,
-343.9300928364,
-344.5067956924,
-345.0844655652,
-345.6631040763,
-346.2427128499,
-346.823293513,
-347.4048476952,
-347.987377029,
-348.5708831494,
-349.1553676944,
-349.7408323046,
-350.3272786233,
-350.9147082967,
-351.5031229736,
-352.0925243058,
-352.6829139477,
-353.2742935564,
-353.8666647919,
-354.460029317,
-355.0543887973,
-355.6497449011,
-356.2460992995,
-356.8434536665,
-357.4418096788,
-358.041169016,
-358.6415333604,
-359.2429043973,
-359.8452838147,
-360.4486733035,
-361.0530745573,
-361.6584892726,
-362.2649191489,
-362.8723658883,
-363.480831196,
-364.0903167799,
-364.7008243507,
-365.3123556222,
-365.9249123109,
-366.5384961362,
-367.1531088204,
-367.7687520887,
-368.3854276693,
-369.003137293,
-369.6218826938,
-370.2416656084,
-370.8624877766,
-371.4843509411,
-372.1072568472,
-372.7312072436,
-373.3562038816,
-373.9822485155,
-374.6093429027,
-375.2374888033,
-375.8666879806,
-376.4969422007,
-377.1282532326,
-377.7606228485,
-378.3940528234,
-379.0285449353,
-379.6641009652,
-380.300722697,
-380.9384119178,
-381.5771704175,
-382.2169999891,
-382.8579024285,
-383.4998795348,
-384.1429331099,
-384.7870649589,
-385.4322768898,
-386.0785707137,
-386.7259482448,
-387.3744113001,
-388.0239617,
-388.6746012676,
-389.3263318293,
-389.9791552145,
-390.6330732556,
-391.2880877881,
-391.9442006506,
-392.6014136849,
-393.2597287357,
-393.9191476508,
-394.5796722813,
-395.2413044811,
-395.9040461075,
-396.5678990207,
-397.2328650842,
-397.8989461645,
-398.5661441312,
-399.2344608572,
-399.9038982183,
-400.5744580938,
-401.2461423657,
-401.9189529196,
-402.5928916439,
-403.2679604304,
-403.9441611739,
-404.6214957725,
-405.2999661276,
-405.9795741434,
-406.6603217278,
-407.3422107914,
-408.0252432483,
-408.7094210158,
-409.3947460143,
-410.0812201675,
-410.7688454023,
-411.4576236488,
-412.1475568405,
-412.8386469139,
-413.530895809,
-414.2243054687,
-414.9188778395,
-415.614614871,
-416.3115185162,
-417.0095907311,
-417.7088334754,
-418.4092487116,
-419.1108384059,
-419.8136045276,
-420.5175490493,
-421.222673947,
-421.9289811999,
-422.6364727906,
-423.345150705,
-424.0550169323,
-424.7660734652,
-425.4783222994,
-426.1917654343,
-426.9064048725,
-427.6222426199,
-428.3392806858,
-429.057521083,
-429.7769658276,
-430.4976169389,
-431.2194764398,
-431.9425463566,
-432.6668287189,
-433.3923255597,
-434.1190389154,
-434.846970826,
-435.5761233346,
-436.306498488,
-437.0380983363,
-437.7709249331,
-438.5049803354,
-439.2402666037,
-439.9767858019,
-440.7145399974,
-441.4535312609,
-442.1937616669,
-442.9352332931,
-443.6779482209,
-444.4219085349,
-445.1671163234,
-445.9135736783,
-446.6612826948,
-447.4102454717,
-448.1604641112,
-448.9119407193,
-449.6646774053,
-450.4186762821,
-451.1739394661,
-451.9304690773,
-452.6882672393,
-453.4473360792,
-454.2076777277,
-454.969294319,
-455.7321879909,
-456.4963608849,
-457.2618151459,
-458.0285529226,
-458.7965763671,
-459.5658876354,
-460.3364888867,
-461.1083822841,
-461.8815699944,
-462.6560541878,
-463.4318370382,
-464.2089207233,
-464.9873074244,
-465.7669993262,
-466.5479986174,
-467.3303074902,
-468.1139281405,
-468.8988627679,
-469.6851135757,
-470.4726827708,
-471.261572564,
-472.0517851696,
-472.8433228057,
-473.6361876941,
-474.4303820604,
-475.2259081339,
-476.0227681475,
-476.8209643379,
-477.6204989458,
-478.4213742154,
-479.2235923946,
-480.0271557354,
-480.8320664932,
-481.6383269274,
-482.4459393011,
-483.2549058813,
-484.0652289388,
-484.876910748,
-485.6899535874,
-486.504359739,
-487.320131489,
-488.1372711271,
-488.9557809471,
-489.7756632464,
-490.5969203264,
-491.4195544924,
-492.2435680534,
-493.0689633225,
-493.8957426165,
-494.7239082561,
-495.553462566,
-496.3844078746,
-497.2167465145,
-498.0504808219,
-498.8856131371,
-499.7221458043,
-500.5600811716,
-501.3994215911,
-502.2401694188,
-503.0823270145,
-503.9258967422,
-504.7708809698,
-505.6172820691,
-506.465102416,
-507.3143443901,
-508.1650103754,
-509.0171027595,
-509.8706239343,
-510.7255762956,
-511.5819622432,
-512.439784181,
-513.2990445167,
-514.1597456624,
-515.021890034,
-515.8854800514,
-516.7505181387,
-517.6170067242,
-518.4849482399,
-519.3543451221,
-520.2251998113,
-521.0975147518,
-521.9712923922,
-522.8465351853,
-523.7232455876,
-524.6014260602,
-525.481079068,
-526.3622070803,
-527.2448125702,
-528.1288980153,
-529.0144658971,
-529.9015187014,
-530.7900589181,
-531.6800890413,
-532.5716115692,
-533.4646290044,
-534.3591438536,
-535.2551586275,
-536.1526758412,
-537.0516980141,
-537.9522276697,
-538.8542673357,
-539.7578195441,
-540.6628868312,
-541.5694717374,
-542.4775768074,
-543.3872045904,
-544.2983576395,
-545.2110385124,
-546.1252497709,
-547.0409939812,
-547.9582737137,
-548.8770915432,
-549.7974500488,
-550.7193518139,
-551.6427994262,
-552.5677954778,
-553.4943425651,
-554.4224432889,
-555.3521002545,
-556.2833160711,
-557.2160933529,
-558.1504347179,
-559.086342789,
-560.0238201931,
-560.9628695616,
-561.9034935306,
-562.8456947402,
-563.7894758352,
-564.7348394648,
-565.6817882825,
-566.6303249463,
-567.5804521189,
-568.5321724672,
-569.4854886625,
-570.4404033809,
-571.3969193027,
-572.3550391128,
-573.3147655007,
-574.2761011602,
-575.2390487899,
-576.2036110925,
-577.1697907757,
-578.1375905514,
-579.1070131363,
-580.0780612514,
-581.0507376225,
-582.0250449798,
-583.0009860582,
-583.978563597,
-584.9577803403,
-585.9386390368,
-586.9211424397,
-587.9052933067,
-588.8910944005,
-589.878548488,
-590.867658341,
-591.858426736,
-592.8508564539,
-593.8449502805,
-594.8407110062,
-595.838141426,
-596.8372443397,
-597.8380225517,
-598.8404788711,
-599.8446161119,
-600.8504370925,
-601.8579446363,
-602.8671415713,
-603.8780307304,
-604.8906149509,
-605.9048970753,
-606.9208799504,
-607.9385664283,
-608.9579593655,
-609.9790616233,
-611.001876068,
-612.0264055705,
-613.0526530068,
-614.0806212573,
-615.1103132076,
-616.1417317481,
-617.1748797737,
-618.2097601846,
-619.2463758856,
-620.2847297865,
-621.3248248018,
-622.3666638511,
-623.4102498587,
-624.4555857541,
-625.5026744713,
-626.5515189496,
-627.6021221329,
-628.6544869704,
-629.7086164159,
-630.7645134283,
-631.8221809715,
-632.8816220144,
-633.9428395307,
-635.0058364993,
-636.0706159038,
-637.1371807332,
-638.2055339812,
-639.2756786467,
-640.3476177334,
-641.4213542504,
-642.4968912114,
-643.5742316356,
-644.653378547,
-645.7343349747,
-646.8171039528,
-647.9016885207,
-648.9880917228,
-650.0763166086,
-651.1663662326,
-652.2582436546,
-653.3519519394,
-654.4474941571,
-655.5448733827,
-656.6440926967,
-657.7451551844,
-658.8480639364,
-659.9528220487,
-661.0594326222,
-662.1678987631,
-663.2782235829,
-664.3904101982,
-665.5044617308,
-666.6203813079,
-667.7381720617,
-668.8578371299,
-669.9793796554,
-671.1028027863,
-672.2281096759,
-673.3553034829,
-674.4843873714,
-675.6153645107,
-676.7482380753,
-677.8830112452,
-679.0196872056,
-680.1582691472,
-681.2987602658,
-682.4411637629,
-683.5854828451,
-684.7317207244,
-685.8798806184,
-687.0299657497,
-688.1819793468,
-689.3359246432,
-690.4918048779,
-691.6496232957,
-692.8093831462,
-693.9710876851,
-695.1347401731,
-696.3003438765,
-697.4679020673,
-698.6374180225,
-699.8088950251,
-700.9823363633,
-702.1577453309,
-703.3351252273,
-704.5144793573,
-705.6958110313,
-706.8791235653,
-708.0644202808,
-709.2517045047,
-710.44097957,
-711.6322488146,
-712.8255155826,
-714.0207832233,
-715.2180550919,
-716.4173345489,
-717.6186249609,
-718.8219296996,
-720.0272521428,
-721.2345956737,
-722.4439636814,
-723.6553595604,
-724.8687867111,
-726.0842485395,
-727.3017484575,
-728.5212898824,
-729.7428762374,
-730.9665109516,
-732.1921974596,
-733.4199392018,
-734.6497396246,
-735.8816021798,
-737.1155303253,
-738.3515275246,
-739.5895972472,
-740.8297429682,
-742.0719681688,
-743.3162763357,
-744.5626709618,
-745.8111555455,
-747.0617335914,
-748.3144086097,
-749.5691841167,
-750.8260636344,
-752.0850506909,
-753.3461488201,
-754.6093615619,
-755.8746924621,
-757.1421450723,
-758.4117229502,
-759.6834296596,
-760.9572687701,
-762.2332438572,
-763.5113585025,
-764.7916162938,
-766.0740208246,
-767.3585756946,
-768.6452845095,
-769.934150881,
-771.2251784269,
-772.5183707711,
-773.8137315435,
-775.1112643801,
-776.4109729231,
-777.7128608207,
-779.0169317273,
-780.3231893032,
-781.6316372152,
-782.942279136,
-784.2551187445,
-785.5701597258,
-786.8874057712,
-788.2068605781,
-789.5285278502,
-790.8524112973,
-792.1785146356,
-793.5068415873,
-794.837395881,
-796.1701812516,
-797.5052014401,
-798.8424601938,
-800.1819612664,
-801.5237084178,
-802.8677054143,
-804.2139560283,
-805.5624640389,
-806.913233231,
-808.2662673964,
-809.621570333,
-810.9791458449,
-812.338997743,
-813.7011298441,
-815.0655459719,
-816.4322499561,
-817.801245633,
-819.1725368453,
-820.5461274423,
-821.9220212794,
-823.3002222189,
-824.6807341291,
-826.0635608853,
-827.4487063689,
-828.836174468,
-830.2259690771,
-831.6180940974,
-833.0125534365,
-834.4093510085,
-835.8084907342,
-837.209976541,
-838.6138123628,
-840.0200021401,
-841.42854982,
-842.8394593562,
-844.2527347091,
-845.6683798457,
-847.0863987397,
-848.5067953714,
-849.9295737277,
-851.3547378025,
-852.782291596,
-854.2122391153,
-855.6445843743,
-857.0793313935,
-858.5164842001,
-859.9560468282,
-861.3980233186,
-862.8424177189,
-864.2892340833,
-865.7384764731,
-867.1901489563,
-868.6442556076,
-870.1008005086,
-871.5597877478,
-873.0212214205,
-874.4851056289,
-875.9514444822,
-877.4202420961,
-878.8915025936,
-880.3652301045,
-881.8414287654,
-883.32010272,
-884.8012561188,
-886.2848931194,
-887.7710178864,
-889.2596345911,
-890.7507474121,
-892.2443605349,
-893.740478152,
-895.2391044629,
-896.7402436742,
-898.2438999996,
-899.7500776598,
-901.2587808824,
-902.7700139025,
-904.283780962,
-905.8000863099,
-907.3189342025,
-908.8403289031,
-910.3642746823,
-911.8907758176,
-913.4198365938,
-914.9514613031,
-916.4856542446,
-918.0224197248,
-919.5617620572,
-921.1036855627,
-922.6481945696,
-924.195293413,
-925.7449864358,
-927.2972779877,
-928.8521724261,
-930.4096741154,
-931.9697874276,
-933.5325167417,
-935.0978664443,
-936.6658409293,
-938.2364445978,
-939.8096818587,
-941.3855571277,
-942.9640748285,
-944.5452393917,
-946.1290552557,
-947.7155268662,
-949.3046586763,
-950.8964551467,
-952.4909207455,
-954.0880599482
-};
-
-uint32_t twopass_calibration[3380] = {
+extern const uint32_t REFERENCE_TWOPASS_CALIBRATION[3380] = {
 25277790,
 35852536,
 35852636,
@@ -0,0 +1,70 @@
+#include <math.h>
+#include <stdio.h>
+
+#include "Tables.hpp"
+
+// Compares the computed lookup curves with the firmware tables they replaced, over every index the tables had.
+// Run with `make test-tables`
+
+extern const float REFERENCE_EXP_4096[4096];
+extern const float REFERENCE_LOG_4096[4096];
+extern const uint32_t REFERENCE_TWOPASS_CALIBRATION[3380];
+
+// Worst relative deviation allowed, as documented in Tables.hpp
+static const double EXP_TOLERANCE		= 1e-6;
+static const double LOG_TOLERANCE		= 2e-7;
+static const double TWOPASS_TOLERANCE	= 2e-6;
+
+static bool check(const char *name, double worst, uint32_t at, double tolerance) {
+	bool ok = worst <= tolerance;
+	printf("%-20s worst deviation %.3g at %u, tolerance %.3g: %s\n", name, worst, at, tolerance, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+static double deviation(double value, double reference) {
+	return fabs(value - reference) / fabs(reference);
+}
+
+int main(void) {
+
+	double worst;
+	uint32_t at;
+	bool ok = true;
+
+	worst = 0.0;
+	at = 0;
+	for (uint32_t i = 0; i < 4096; i++) {
+		double d = deviation(exp_4096(i), REFERENCE_EXP_4096[i]);
+		if (d > worst) {
+			worst = d;
+			at = i;
+		}
+	}
+	ok &= check("exp_4096", worst, at, EXP_TOLERANCE);
+
+	worst = 0.0;
+	at = 0;
+	for (uint32_t i = 0; i < 4096; i++) {
+		double d = deviation(log_4096(i), REFERENCE_LOG_4096[i]);
+		if (d > worst) {
+			worst = d;
+			at = i;
+		}
+	}
+	ok &= check("log_4096", worst, at, LOG_TOLERANCE);
+
+	worst = 0.0;
+	at = 0;
+	// Only the first 3354 entries were ever filled in, the rest are zero; Filter reads 100 to 3025
+	for (uint32_t i = 0; i < 3354; i++) {
+		double d = deviation(twopass_calibration(i), REFERENCE_TWOPASS_CALIBRATION[i]);
+		if (d > worst) {
+			worst = d;
+			at = i;
+		}
+	}
+	ok &= check("twopass_calibration", worst, at, TWOPASS_TOLERANCE);
+
+	return ok ? 0 : 1;
+
+}